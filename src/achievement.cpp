@@ -842,6 +842,13 @@ void achievements_tracker::clear()
     achievements_status_.clear();
 }
 
+bool achievements_tracker::is_interested_in( event_type type ) const
+{
+    // Achievement progress arrives via stats_tracker watchers; the bus
+    // subscription only exists to catch the start of the game.
+    return type == event_type::game_start;
+}
+
 void achievements_tracker::notify( const cata::event &e )
 {
     if( e.type() == event_type::game_start ) {
@@ -0,0 +1,133 @@
+#include "action_replay.h"
+
+#include <ctime>
+#include <vector>
+
+#include "cata_utility.h"
+#include "game.h"
+#include "json.h"
+#include "messages.h"
+#include "path_info.h"
+#include "rng.h"
+#include "string_formatter.h"
+
+namespace action_replay
+{
+
+namespace
+{
+
+bool record_active = false;
+bool replay_active = false;
+unsigned int recorded_seed = 0;
+std::vector<action_id> actions;
+size_t replay_cursor = 0;
+
+void write_recording()
+{
+    const std::string path = string_format( "%sreplay-%lld.json", PATH_INFO::config_dir(),
+                                            static_cast<long long>( std::time( nullptr ) ) );
+    const bool written = write_to_file( path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "seed", recorded_seed );
+        jsout.member( "actions" );
+        jsout.start_array();
+        for( const action_id act : actions ) {
+            jsout.write( action_ident( act ) );
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }, "action replay" );
+    if( written ) {
+        add_msg( "recorded %d actions to %s", static_cast<int>( actions.size() ), path );
+    }
+    actions.clear();
+}
+
+} // namespace
+
+bool recording()
+{
+    return record_active;
+}
+
+bool replaying()
+{
+    return replay_active;
+}
+
+void toggle_recording()
+{
+    if( replay_active ) {
+        add_msg( "cannot record while replaying" );
+        return;
+    }
+    if( record_active ) {
+        record_active = false;
+        write_recording();
+        return;
+    }
+    record_active = true;
+    recorded_seed = g->get_seed();
+    actions.clear();
+    add_msg( "recording actions" );
+}
+
+void start_replay( const std::string &path )
+{
+    if( record_active || replay_active ) {
+        return;
+    }
+    actions.clear();
+    unsigned int seed = 0;
+    const bool read = read_from_file_json( path, [&]( JsonIn & jsin ) {
+        JsonObject jo = jsin.get_object();
+        seed = jo.get_int( "seed" );
+        for( const std::string line : jo.get_array( "actions" ) ) {
+            actions.push_back( look_up_action( line ) );
+        }
+    } );
+    if( !read || actions.empty() ) {
+        add_msg( "no actions loaded from %s", path );
+        actions.clear();
+        return;
+    }
+    // Matches the original session only when replaying from the save the
+    // recording started at; reseeding at least lines the rolls back up.
+    rng_set_engine_seed( seed );
+    replay_active = true;
+    replay_cursor = 0;
+    add_msg( "replaying %d actions from %s", static_cast<int>( actions.size() ), path );
+}
+
+void stop_replay()
+{
+    if( replay_active ) {
+        replay_active = false;
+        actions.clear();
+        add_msg( "replay stopped" );
+    }
+}
+
+void record( const action_id act )
+{
+    // Timeouts are idle-input artifacts, not part of the session.
+    if( record_active && act != ACTION_TIMEOUT ) {
+        actions.push_back( act );
+    }
+}
+
+action_id next_action()
+{
+    if( !replay_active ) {
+        return ACTION_NULL;
+    }
+    if( replay_cursor >= actions.size() ) {
+        stop_replay();
+        return ACTION_NULL;
+    }
+    return actions[replay_cursor++];
+}
+
+} // namespace action_replay
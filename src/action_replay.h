@@ -0,0 +1,44 @@
+#pragma once
+#ifndef CATA_SRC_ACTION_REPLAY_H
+#define CATA_SRC_ACTION_REPLAY_H
+
+#include <string>
+
+#include "action.h"
+
+/**
+ * Capture and replay of avatar actions, for reproducing gameplay-shaped
+ * workloads. Recording logs every action the avatar performs together
+ * with the world seed; replaying feeds the log back through
+ * game::handle_action instead of polling input, so a captured session
+ * can be re-run against another build and timed (e.g. with the turn
+ * profiler or a trace capture).
+ *
+ * Determinism is best-effort: a replay only follows the original
+ * world-state exactly when started from the same save the recording
+ * started from. Actions that open interactive menus still prompt.
+ */
+namespace action_replay
+{
+
+bool recording();
+bool replaying();
+
+/** Starts recording; calling again stops and writes the log to the
+ *  config directory. */
+void toggle_recording();
+
+/** Loads @p path and starts feeding its actions to handle_action. */
+void start_replay( const std::string &path );
+void stop_replay();
+
+/** Appends an action to the running recording, if any. */
+void record( action_id act );
+
+/** Next replayed action, or ACTION_NULL once the log is exhausted
+ *  (which stops the replay). */
+action_id next_action();
+
+} // namespace action_replay
+
+#endif // CATA_SRC_ACTION_REPLAY_H
@@ -3,15 +3,23 @@
 #include <algorithm>
 #include <utility>
 
+#include "calendar.h"
 #include "item.h"
 #include "safe_reference.h"
 
 void active_item_cache::remove( const item *it )
 {
-    active_items[it->processing_speed()].remove_if( [it]( const item_reference & active_item ) {
-        item *const target = active_item.item_ref.get();
-        return !target || target == it;
-    } );
+    for( auto iter = active_items.begin(); iter != active_items.end(); ) {
+        iter->second.remove_if( [it]( const item_reference & active_item ) {
+            item *const target = active_item.item_ref.get();
+            return !target || target == it;
+        } );
+        if( iter->second.empty() ) {
+            iter = active_items.erase( iter );
+        } else {
+            ++iter;
+        }
+    }
     if( it->can_revive() ) {
         special_items[ special_item_type::corpse ].remove_if( [it]( const item_reference & active_item ) {
             item *const target = active_item.item_ref.get();
@@ -30,12 +38,13 @@ void active_item_cache::remove( const item *it )
 void active_item_cache::add( item &it, point location )
 {
     // If the item is already in the cache for some reason, don't add a second reference
-    std::list<item_reference> &target_list = active_items[it.processing_speed()];
-    if( std::find_if( target_list.begin(),
-    target_list.end(), [&it]( const item_reference & active_item_ref ) {
-    return &it == active_item_ref.item_ref.get();
-    } ) != target_list.end() ) {
-        return;
+    for( const std::pair<const int, std::list<item_reference>> &kv : active_items ) {
+        if( std::find_if( kv.second.begin(),
+        kv.second.end(), [&it]( const item_reference & active_item_ref ) {
+        return &it == active_item_ref.item_ref.get();
+        } ) != kv.second.end() ) {
+            return;
+        }
     }
     if( it.can_revive() ) {
         special_items[ special_item_type::corpse ].push_back( item_reference{ location, it.get_safe_reference() } );
@@ -43,7 +52,8 @@ void active_item_cache::add( item &it, point location )
     if( it.get_use( "explosion" ) ) {
         special_items[ special_item_type::explosive ].push_back( item_reference{ location, it.get_safe_reference() } );
     }
-    target_list.push_back( item_reference{ location, it.get_safe_reference() } );
+    const int due = to_turn<int>( calendar::turn ) + it.processing_speed();
+    active_items[due].push_back( item_reference{ location, it.get_safe_reference() } );
 }
 
 bool active_item_cache::empty() const
@@ -53,6 +63,15 @@ bool active_item_cache::empty() const
     } );
 }
 
+size_t active_item_cache::size() const
+{
+    size_t ret = 0;
+    for( const auto &active_queue : active_items ) {
+        ret += active_queue.second.size();
+    }
+    return ret;
+}
+
 std::vector<item_reference> active_item_cache::get()
 {
     std::vector<item_reference> all_cached_items;
@@ -71,28 +90,22 @@ std::vector<item_reference> active_item_cache::get()
 
 std::vector<item_reference> active_item_cache::get_for_processing()
 {
+    const int now = to_turn<int>( calendar::turn );
     std::vector<item_reference> items_to_process;
-    items_to_process.reserve( std::accumulate( active_items.begin(), active_items.end(), 0,
-    []( size_t prev, const auto & kv ) {
-        return prev + kv.second.size() / kv.first;
-    } ) );
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = kv.second.size() / kv.first;
-        std::list<item_reference>::iterator it = kv.second.begin();
-        for( ; it != kv.second.end() && num_to_process >= 0; ) {
-            if( it->item_ref ) {
-                items_to_process.push_back( *it );
-                --num_to_process;
-                ++it;
-            } else {
-                // The item has been destroyed, so remove the reference from the cache
-                it = kv.second.erase( it );
+    auto it = active_items.begin();
+    while( it != active_items.end() && it->first <= now ) {
+        for( item_reference &active_item : it->second ) {
+            item *const target = active_item.item_ref.get();
+            if( !target ) {
+                // The item has been destroyed, so drop the reference with its bucket
+                continue;
             }
+            // Reschedule before handing out the reference. Inserting a later
+            // bucket does not invalidate the iterator of the one being drained.
+            active_items[now + target->processing_speed()].push_back( active_item );
+            items_to_process.push_back( std::move( active_item ) );
         }
-        // Rotate the returned items to the end of their list so that the items that weren't
-        // returned this time will be first in line on the next call
-        kv.second.splice( kv.second.end(), kv.second, kv.second.begin(), it );
+        it = active_items.erase( it );
     }
     return items_to_process;
 }
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <list>
+#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -37,7 +38,13 @@ struct hash<special_item_type> {
 class active_item_cache
 {
     private:
-        std::unordered_map<int, std::list<item_reference>> active_items;
+        /**
+         * Active item references bucketed by the turn they are next due to be
+         * processed. get_for_processing consumes the due buckets in order, so
+         * only items actually due are touched each turn; references that died
+         * while waiting are dropped along with their bucket.
+         */
+        std::map<int, std::list<item_reference>> active_items;
         std::unordered_map<special_item_type, std::list<item_reference>> special_items;
 
     public:
@@ -59,6 +66,12 @@ class active_item_cache
          */
         bool empty() const;
 
+        /**
+         * Returns the number of cached references, including ones that are
+         * not yet due for processing.
+         */
+        size_t size() const;
+
         /**
          * Returns a vector of all cached active item references.
          * Broken references are removed from the cache.
@@ -66,9 +79,9 @@ class active_item_cache
         std::vector<item_reference> get();
 
         /**
-         * Returns the first size() / processing_speed() elements of each list, rounded up.
-         * Items returned are rotated to the back of their respective lists, otherwise only the
-         * first n items will ever be processed.
+         * Returns the items whose next process turn has come, and reschedules
+         * them processing_speed() turns ahead. Items that are not yet due are
+         * not touched at all.
          * Broken references encountered when collecting the items to be processed are removed from
          * the cache.
          * Relies on the fact that item::processing_speed() is a constant.
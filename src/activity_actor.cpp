@@ -2934,7 +2934,18 @@ bool craft_activity_actor::check_if_craft_okay( item_location &craft_item, Chara
     if( !cached_continuation_requirements ) {
         cached_continuation_requirements = craft->get_continue_reqs();
     }
-    return crafter.can_continue_craft( *craft, *cached_continuation_requirements );
+    // Re-verifying tools and materials is pointless while the crafting
+    // inventory has not changed since the last check that passed.
+    const int inv_generation = crafter.crafting_inventory_generation();
+    if( inv_generation == last_verified_inv_generation ) {
+        return true;
+    }
+    if( !crafter.can_continue_craft( *craft, *cached_continuation_requirements ) ) {
+        return false;
+    }
+    // can_continue_craft may have consumed components, so re-read the serial.
+    last_verified_inv_generation = crafter.crafting_inventory_generation();
+    return true;
 }
 
 void craft_activity_actor::start( player_activity &act, Character &crafter )
@@ -944,6 +944,9 @@ class craft_activity_actor : public activity_actor
 
         float activity_override = NO_EXERCISE;
         cata::optional<requirement_data> cached_continuation_requirements; // NOLINT(cata-serialize)
+        // Crafting inventory generation at the last successful requirement
+        // check; while it is unchanged the re-scan is skipped entirely.
+        int last_verified_inv_generation = -1; // NOLINT(cata-serialize)
         float cached_crafting_speed; // NOLINT(cata-serialize)
         int cached_assistants; // NOLINT(cata-serialize)
         double cached_base_total_moves; // NOLINT(cata-serialize)
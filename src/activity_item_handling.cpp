@@ -382,8 +382,8 @@ void drop_on_map( Character &you, item_drop_reason reason, const std::list<item>
                 break;
         }
     }
+    here.add_items_or_charges( where, std::vector<item>( items.begin(), items.end() ) );
     for( const item &it : items ) {
-        here.add_item_or_charges( where, it );
         item( it ).handle_pickup_ownership( you );
     }
 }
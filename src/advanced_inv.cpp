@@ -1625,7 +1625,17 @@ void advanced_inventory::display()
                 item->set_favorite( !item->is_favorite );
             }
             // In case we've merged faved and unfaved items
-            recalc = true;
+            spane.recalc = true;
+            // The other pane only needs recollecting if it can actually
+            // display the favorited items.  Distinct plain squares without
+            // vehicle views are disjoint.
+            const aim_location sarea = spane.get_area();
+            const aim_location darea = dpane.get_area();
+            if( sarea == darea || sarea == AIM_ALL || darea == AIM_ALL ||
+                sarea == AIM_CONTAINER || darea == AIM_CONTAINER ||
+                spane.in_vehicle() || dpane.in_vehicle() ) {
+                dpane.recalc = true;
+            }
         } else if( action == "MOVE_SINGLE_ITEM" ||
                    action == "MOVE_VARIABLE_ITEM" ||
                    action == "MOVE_ITEM_STACK" ) {
@@ -1635,7 +1645,10 @@ void advanced_inventory::display()
             recalc = true;
         } else if( action == "SORT" ) {
             if( show_sort_menu( spane ) ) {
-                recalc = true;
+                // The contents are unchanged, so reordering the collected
+                // entries in place beats recollecting both panes.
+                std::stable_sort( spane.items.begin(), spane.items.end(),
+                                  advanced_inv_sorter( spane.sortby ) );
             }
         } else if( action == "FILTER" ) {
             std::string filter = spane.filter;
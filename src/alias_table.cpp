@@ -0,0 +1,55 @@
+#include "alias_table.h"
+
+#include <cstdint>
+
+#include "rng.h"
+
+void alias_table::build( const std::vector<int> &weights )
+{
+    slots.clear();
+    total = 0;
+    for( const int w : weights ) {
+        if( w > 0 ) {
+            total += w;
+        }
+    }
+    const size_t n = weights.size();
+    if( total <= 0 || n == 0 ) {
+        return;
+    }
+    // Scaled weights sum to exactly n * total, so the n slots of `total`
+    // units each can be filled without rounding slack. 64 bit intermediates
+    // because weight * n may not fit an int.
+    std::vector<int64_t> remaining( n );
+    for( size_t i = 0; i < n; i++ ) {
+        remaining[i] = weights[i] > 0 ? static_cast<int64_t>( weights[i] ) * n : 0;
+    }
+    slots.resize( n );
+    std::vector<size_t> light;
+    std::vector<size_t> heavy;
+    for( size_t i = 0; i < n; i++ ) {
+        slots[i] = { total, i, i };
+        ( remaining[i] < total ? light : heavy ).push_back( i );
+    }
+    // Pair each underfull slot with an overfull entry covering the rest.
+    while( !light.empty() && !heavy.empty() ) {
+        const size_t l = light.back();
+        light.pop_back();
+        const size_t h = heavy.back();
+        slots[l].cutoff = static_cast<int>( remaining[l] );
+        slots[l].alias = h;
+        remaining[h] -= total - remaining[l];
+        if( remaining[h] < total ) {
+            heavy.pop_back();
+            light.push_back( h );
+        }
+    }
+    // With integer weights every slot left over is exactly full, which is
+    // what the initial cutoff of `total` already encodes.
+}
+
+size_t alias_table::pick() const
+{
+    const slot &s = slots[rng( 0, static_cast<int>( slots.size() ) - 1 )];
+    return rng( 0, total - 1 ) < s.cutoff ? s.self : s.alias;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef CATA_SRC_ALIAS_TABLE_H
+#define CATA_SRC_ALIAS_TABLE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Walker/Vose alias table over integer weights. After an O(n) build each
+ * draw costs two rng calls and one comparison regardless of the number of
+ * entries, unlike the usual linear cumulative-weight walk. Intended for
+ * hot weighted draws such as item group and monster group rolls, which
+ * mapgen performs hundreds of times per overmap tile.
+ *
+ * The table is exact for integer weights: entry i is drawn with
+ * probability weights[i] / total.
+ */
+class alias_table
+{
+    public:
+        /** Rebuilds the table from scratch; weights <= 0 are never drawn. */
+        void build( const std::vector<int> &weights );
+        /** Index of a weighted random entry. The table must not be empty. */
+        size_t pick() const;
+        /** True when unbuilt, cleared, or built from all-zero weights. */
+        bool empty() const {
+            return slots.empty();
+        }
+        void clear() {
+            slots.clear();
+        }
+    private:
+        // Each slot covers `total` probability units split between at most
+        // two entries: `self` below the cutoff, `alias` at or above it.
+        struct slot {
+            int cutoff;
+            size_t self;
+            size_t alias;
+        };
+        std::vector<slot> slots;
+        int total = 0;
+};
+
+#endif // CATA_SRC_ALIAS_TABLE_H
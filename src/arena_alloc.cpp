@@ -0,0 +1,12 @@
+#include "arena_alloc.h"
+
+namespace cata
+{
+
+turn_arena &get_turn_arena()
+{
+    static turn_arena arena;
+    return arena;
+}
+
+} // namespace cata
@@ -0,0 +1,133 @@
+#pragma once
+#ifndef CATA_SRC_ARENA_ALLOC_H
+#define CATA_SRC_ARENA_ALLOC_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace cata
+{
+
+/**
+ * Bump allocator backing allocations that do not outlive the turn that
+ * made them. Memory is carved out of fixed blocks by advancing a cursor;
+ * freeing individual allocations is a no-op (except for a trailing one,
+ * so a growing vector can reuse the block tail), and everything is
+ * reclaimed at once by @ref reset, which do_turn calls before each new
+ * turn. Containers on @ref arena_allocator must therefore stay local to
+ * turn processing and never be stored across turns.
+ */
+class turn_arena
+{
+    public:
+        static constexpr size_t block_size = 256 * 1024;
+
+        turn_arena() = default;
+        turn_arena( const turn_arena & ) = delete;
+        turn_arena &operator=( const turn_arena & ) = delete;
+        ~turn_arena() {
+            for( const block &b : blocks ) {
+                ::operator delete( b.mem );
+            }
+        }
+
+        void *allocate( size_t bytes, size_t align ) {
+            char *aligned = cursor == nullptr ? nullptr : align_up( cursor, align );
+            if( aligned == nullptr || aligned + bytes > block_end ) {
+                start_block( bytes + align );
+                aligned = align_up( cursor, align );
+            }
+            cursor = aligned + bytes;
+            return aligned;
+        }
+
+        void deallocate( void *p, size_t bytes ) {
+            // Only a trailing allocation can be handed back.
+            if( static_cast<char *>( p ) + bytes == cursor ) {
+                cursor = static_cast<char *>( p );
+            }
+        }
+
+        /** Invalidates every live arena allocation; blocks are kept for reuse. */
+        void reset() {
+            current = 0;
+            if( !blocks.empty() ) {
+                cursor = blocks[0].mem;
+                block_end = cursor + blocks[0].size;
+            }
+        }
+
+    private:
+        struct block {
+            char *mem;
+            size_t size;
+        };
+
+        static char *align_up( char *p, size_t align ) {
+            const uintptr_t v = reinterpret_cast<uintptr_t>( p );
+            return reinterpret_cast<char *>( ( v + align - 1 ) & ~( align - 1 ) );
+        }
+
+        void start_block( size_t needed ) {
+            size_t next = blocks.empty() || cursor == nullptr ? 0 : current + 1;
+            while( next < blocks.size() && blocks[next].size < needed ) {
+                ++next;
+            }
+            if( next == blocks.size() ) {
+                const size_t size = std::max( block_size, needed );
+                blocks.push_back( { static_cast<char *>( ::operator new( size ) ), size } );
+            }
+            current = next;
+            cursor = blocks[current].mem;
+            block_end = cursor + blocks[current].size;
+        }
+
+        std::vector<block> blocks;
+        size_t current = 0;
+        char *cursor = nullptr;
+        char *block_end = nullptr;
+};
+
+turn_arena &get_turn_arena();
+
+/** Standard allocator face of @ref turn_arena; see the lifetime caveat there. */
+template<typename T>
+class arena_allocator
+{
+    public:
+        using value_type = T;
+
+        arena_allocator() = default;
+        template<typename U>
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        arena_allocator( const arena_allocator<U> & ) { }
+
+        T *allocate( size_t n ) {
+            return static_cast<T *>( get_turn_arena().allocate( n * sizeof( T ), alignof( T ) ) );
+        }
+        void deallocate( T *p, size_t n ) {
+            get_turn_arena().deallocate( p, n * sizeof( T ) );
+        }
+};
+
+template<typename T, typename U>
+inline bool operator==( const arena_allocator<T> &, const arena_allocator<U> & )
+{
+    return true;
+}
+template<typename T, typename U>
+inline bool operator!=( const arena_allocator<T> &, const arena_allocator<U> & )
+{
+    return false;
+}
+
+/** A std::vector whose storage lives in the per-turn arena. */
+template<typename T>
+using arena_vector = std::vector<T, arena_allocator<T>>;
+
+} // namespace cata
+
+#endif // CATA_SRC_ARENA_ALLOC_H
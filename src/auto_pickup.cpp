@@ -644,6 +644,13 @@ bool check_special_rule( const std::vector<material_id> &materials, const std::s
 //Special case. Required for NPC harvest autopickup. Ignores material rules.
 void npc_settings::create_rule( const std::string &to_match )
 {
+    if( map_items.count( to_match ) ) {
+        // Already evaluated; a cached NONE means no rule matches this name.
+        return;
+    }
+    // Cache the miss so unmatched names don't rescan the rule list on
+    // every query; a matching rule below overwrites this.
+    map_items[ to_match ] = rule_state::NONE;
     rules.create_rule( map_items, to_match );
 }
 
@@ -661,6 +668,14 @@ void rule_list::create_rule( cache &map_items, const std::string &to_match )
 void player_settings::create_rule( const item *it )
 {
     // TODO: change it to be a reference
+    const std::string to_match = it->tname( 1, false );
+    if( map_items.count( to_match ) ) {
+        // Already evaluated; a cached NONE means no rule matches this name.
+        return;
+    }
+    // Cache the miss so unmatched items don't rescan both rule lists on
+    // every step over them; a matching rule below overwrites this.
+    map_items[ to_match ] = rule_state::NONE;
     global_rules.create_rule( map_items, *it );
     character_rules.create_rule( map_items, *it );
 }
@@ -0,0 +1,77 @@
+#include "background_writer.h"
+
+#include <ostream>
+#include <utility>
+
+#include "cata_utility.h"
+#include "debug.h"
+#include "filesystem.h"
+
+background_writer::~background_writer()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        stopping = true;
+    }
+    jobs_changed.notify_all();
+    if( worker.joinable() ) {
+        worker.join();
+    }
+}
+
+void background_writer::queue( const std::string &dirname, const std::string &filename,
+                               std::string &&contents )
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        jobs.push_back( write_job{ dirname, filename, std::move( contents ) } );
+        if( !worker.joinable() ) {
+            worker = std::thread( &background_writer::run, this );
+        }
+    }
+    jobs_changed.notify_all();
+}
+
+void background_writer::flush()
+{
+    std::vector<std::string> failed_now;
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        jobs_changed.wait( lock, [this]() {
+            return jobs.empty() && !writing;
+        } );
+        failed_now.swap( failed );
+    }
+    // Reported here rather than on the worker because debugmsg
+    // drives the UI, which is not thread safe.
+    for( const std::string &path : failed_now ) {
+        debugmsg( "Failed to write \"%s\"", path );
+    }
+}
+
+void background_writer::run()
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    while( !stopping || !jobs.empty() ) {
+        if( jobs.empty() ) {
+            jobs_changed.wait( lock, [this]() {
+                return stopping || !jobs.empty();
+            } );
+            continue;
+        }
+        write_job job = std::move( jobs.front() );
+        jobs.pop_front();
+        writing = true;
+        lock.unlock();
+        assure_dir_exist( job.dirname );
+        const bool success = write_to_file( job.filename, [&job]( std::ostream & fout ) {
+            fout << job.contents;
+        }, nullptr );
+        lock.lock();
+        if( !success ) {
+            failed.push_back( job.filename );
+        }
+        writing = false;
+        jobs_changed.notify_all();
+    }
+}
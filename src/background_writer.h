@@ -0,0 +1,53 @@
+#pragma once
+#ifndef CATA_SRC_BACKGROUND_WRITER_H
+#define CATA_SRC_BACKGROUND_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Writes snapshotted save data to disk on a dedicated worker thread.
+ * Contents are serialized into strings on the main thread, so the worker
+ * never touches live game state and play can continue while the (slow)
+ * file IO completes. @ref flush is the completion barrier; it must run
+ * before any queued file is read back or the world is exited.
+ */
+class background_writer
+{
+    public:
+        ~background_writer();
+
+        /**
+         * Queue one file write. The directory is created if needed and the
+         * contents must be a finished snapshot; the caller must not rely on
+         * the file existing until the next @ref flush.
+         */
+        void queue( const std::string &dirname, const std::string &filename,
+                    std::string &&contents );
+
+        /** Wait for all queued writes, then report any failed paths. */
+        void flush();
+
+    private:
+        struct write_job {
+            std::string dirname;
+            std::string filename;
+            std::string contents;
+        };
+
+        void run();
+
+        std::deque<write_job> jobs;
+        std::vector<std::string> failed;
+        std::mutex mutex;
+        std::condition_variable jobs_changed;
+        std::thread worker;
+        bool writing = false;
+        bool stopping = false;
+};
+
+#endif // CATA_SRC_BACKGROUND_WRITER_H
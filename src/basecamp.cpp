@@ -360,6 +360,10 @@ std::vector<basecamp_upgrade> basecamp::available_upgrades( const point &dir )
 // recipes and craft support functions
 std::map<recipe_id, translation> basecamp::recipe_deck( const point &dir ) const
 {
+    const auto cached = recipe_deck_cache.find( dir );
+    if( cached != recipe_deck_cache.end() ) {
+        return cached->second;
+    }
     std::map<recipe_id, translation> recipes;
     const auto &e = expansions.find( dir );
     if( e == expansions.end() ) {
@@ -369,6 +373,7 @@ std::map<recipe_id, translation> basecamp::recipe_deck( const point &dir ) const
         const auto &test_s = recipe_group::get_recipes_by_id( provides.first );
         recipes.insert( test_s.cbegin(), test_s.cend() );
     }
+    recipe_deck_cache.emplace( dir, recipes );
     return recipes;
 }
 
@@ -426,6 +431,7 @@ void basecamp::update_provides( const std::string &bldg, expansion_data &e_data
         }
         e_data.provides[bp_provides.first] += bp_provides.second;
     }
+    recipe_deck_cache.clear();
 }
 
 void basecamp::update_in_progress( const std::string &bldg, const point &dir )
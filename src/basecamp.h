@@ -348,6 +348,9 @@ class basecamp
         void reset_camp_resources();
         void add_resource( const itype_id &camp_resource );
         bool resources_updated = false; // NOLINT(cata-serialize)
+        // cached recipe_deck results per expansion; the underlying recipe
+        // group scan only changes when a building is completed
+        mutable std::map<point, std::map<recipe_id, translation>> recipe_deck_cache; // NOLINT(cata-serialize)
         // omt pos
         tripoint_abs_omt omt_pos;
         std::vector<npc_ptr> assigned_npcs; // NOLINT(cata-serialize)
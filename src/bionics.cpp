@@ -1717,6 +1717,19 @@ static bool attempt_recharge( Character &p, bionic &bio, units::energy &amount )
     return recharged;
 }
 
+const std::vector<bool> &Character::bionic_fuel_processing_mask() const
+{
+    if( !bionic_fuel_mask_built || bionic_fuel_mask.size() != my_bionics->size() ) {
+        bionic_fuel_mask.assign( my_bionics->size(), false );
+        for( size_t i = 0; i < my_bionics->size(); i++ ) {
+            const bionic_data &info = ( *my_bionics )[i].info();
+            bionic_fuel_mask[i] = !info.fuel_opts.empty() || info.is_remote_fueled;
+        }
+        bionic_fuel_mask_built = true;
+    }
+    return bionic_fuel_mask;
+}
+
 void Character::process_bionic( const int b )
 {
     bionic &bio = ( *my_bionics )[b];
@@ -2839,6 +2852,7 @@ void Character::add_bionic( const bionic_id &b )
     }
 
     my_bionics->push_back( bionic( b, get_free_invlet( *this ) ) );
+    bionic_fuel_mask_built = false;
     if( b == bio_tools || b == bio_ears ) {
         activate_bionic( my_bionics->size() - 1 );
     }
@@ -2920,6 +2934,7 @@ void Character::remove_bionic( const bionic_id &b )
     }
 
     *my_bionics = new_my_bionics;
+    bionic_fuel_mask_built = false;
     calc_encumbrance();
     recalc_sight_limits();
     if( !b->enchantments.empty() ) {
@@ -2941,6 +2956,7 @@ bionic &Character::bionic_at_index( int i )
 void Character::clear_bionics()
 {
     my_bionics->clear();
+    bionic_fuel_mask_built = false;
 }
 
 void reset_bionics()
@@ -6,6 +6,10 @@ bool keycode_mode;
 bool log_from_top;
 int message_ttl;
 int message_cooldown;
+// Non-zero before the options are first loaded, so early messages are not
+// trimmed away; matches the option default.
+int message_limit = 255;
+int slow_turn_warning_ms;
 bool test_mode;
 bool tile_iso;
 bool use_tiles;
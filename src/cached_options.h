@@ -12,6 +12,10 @@ extern bool keycode_mode;
 extern bool log_from_top;
 extern int message_ttl;
 extern int message_cooldown;
+extern int message_limit;
+// Turn processing time, in milliseconds, above which the slow turn watchdog
+// dumps diagnostics to the debug log. Zero disables the watchdog.
+extern int slow_turn_warning_ms;
 extern bool tile_iso;
 extern bool use_tiles;
 extern bool use_tiles_overmap;
@@ -171,7 +171,7 @@ static units::angle sidereal_time_at( solar_effective_time t, units::angle longi
     return L0 + L1 * days_since_epoch + longitude;
 }
 
-std::pair<units::angle, units::angle> sun_azimuth_altitude(
+static std::pair<units::angle, units::angle> sun_azimuth_altitude_uncached(
     time_point ti )
 {
     const solar_effective_time t = solar_effective_time( ti );
@@ -216,6 +216,19 @@ std::pair<units::angle, units::angle> sun_azimuth_altitude(
     return std::make_pair( azimuth, altitude );
 }
 
+std::pair<units::angle, units::angle> sun_azimuth_altitude( time_point ti )
+{
+    // Lighting calls this for the same turn once per tile batch; the trig
+    // above is far too heavy for that, so memoize the last answer.
+    static time_point cached_time = calendar::before_time_starts;
+    static std::pair<units::angle, units::angle> cached_result;
+    if( cached_time != ti ) {
+        cached_result = sun_azimuth_altitude_uncached( ti );
+        cached_time = ti;
+    }
+    return cached_result;
+}
+
 static units::angle sun_altitude( time_point t )
 {
     return sun_azimuth_altitude( t ).second;
@@ -295,24 +308,48 @@ static time_point sun_at_altitude( const units::angle altitude, const units::ang
     return initial_approximation + correction_offset_time;
 }
 
+namespace
+{
+// sun_at_altitude depends on its time argument only through the nearby solar
+// noon, so one cached answer per day is exact. Each day-cycle query below
+// keeps its own cache because the target altitude differs.
+struct day_event_cache {
+    time_point noon = calendar::before_time_starts;
+    time_point result;
+
+    time_point get( const units::angle altitude, const bool evening, const time_point &p ) {
+        const time_point solar_noon = solar_noon_near( p );
+        if( noon != solar_noon ) {
+            result = sun_at_altitude( altitude, location_boston.longitude, p, evening );
+            noon = solar_noon;
+        }
+        return result;
+    }
+};
+} // namespace
+
 time_point sunrise( const time_point &p )
 {
-    return sun_at_altitude( sunrise_angle, location_boston.longitude, p, false );
+    static day_event_cache cache;
+    return cache.get( sunrise_angle, false, p );
 }
 
 time_point sunset( const time_point &p )
 {
-    return sun_at_altitude( sunrise_angle, location_boston.longitude, p, true );
+    static day_event_cache cache;
+    return cache.get( sunrise_angle, true, p );
 }
 
 time_point night_time( const time_point &p )
 {
-    return sun_at_altitude( civil_dawn, location_boston.longitude, p, true );
+    static day_event_cache cache;
+    return cache.get( civil_dawn, true, p );
 }
 
 time_point daylight_time( const time_point &p )
 {
-    return sun_at_altitude( civil_dawn, location_boston.longitude, p, false );
+    static day_event_cache cache;
+    return cache.get( civil_dawn, false, p );
 }
 
 bool is_night( const time_point &p )
@@ -298,11 +298,47 @@ tile_type &tileset::create_tile_type( const std::string &id, tile_type &&new_til
     return inserted_tile;
 }
 
+// Describes the inputs a composed tileset is built from: the tileset id and
+// every compatible mod tileset. Only when this changes do the atlases have to
+// be recomposed.
+static std::string tileset_composition_signature( const std::string &tileset_id )
+{
+    std::string signature = tileset_id;
+    for( const mod_tileset &mts : all_mod_tilesets ) {
+        if( mts.is_compatible( tileset_id ) ) {
+            signature += '\n' + mts.get_full_path() + '#' + std::to_string( mts.num_in_file() );
+        }
+    }
+    return signature;
+}
+
 void cata_tiles::load_tileset( const std::string &tileset_id, const bool precheck,
                                const bool force, const bool pump_events )
 {
-    if( tileset_ptr && tileset_ptr->get_tileset_id() == tileset_id && !force ) {
-        return;
+    const std::string signature = tileset_composition_signature( tileset_id );
+    if( !force ) {
+        // Prechecked tilesets carry an empty signature, so they never match
+        // and the first real load still composes the atlases.
+        if( tileset_ptr && tileset_ptr->get_composition_signature() == signature ) {
+            return;
+        }
+        if( retained_tileset_ptr && retained_tileset_ptr->get_composition_signature() == signature ) {
+            // Switching back to the previously composed tileset, its textures
+            // are still uploaded and can be used as they are.
+            std::swap( tileset_ptr, retained_tileset_ptr );
+            frame_cache_valid = false;
+            tile_iso = tileset_ptr->get_composed_iso();
+            tileset_mutation_overlay_ordering = tileset_ptr->get_mutation_overlay_ordering();
+
+            set_draw_scale( 16 );
+
+            minimap->set_type( tile_iso ? pixel_minimap_type::iso : pixel_minimap_type::ortho );
+            return;
+        }
+    } else {
+        // A forced load is a request to reread the files, a retained copy
+        // composed from them would be stale.
+        retained_tileset_ptr.reset();
     }
     // TODO: move into clear or somewhere else.
     // reset the overlay ordering from the previous loaded tileset
@@ -313,7 +349,13 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     std::unique_ptr<tileset> new_tileset_ptr = std::make_unique<tileset>();
     tileset_loader loader( *new_tileset_ptr, renderer );
     loader.load( tileset_id, precheck, /*pump_events=*/pump_events );
+    if( !force && tileset_ptr && !tileset_ptr->get_composition_signature().empty() ) {
+        // Keep the displaced composed tileset around, switching back to it is
+        // common when trying out tilesets and skips the whole composition.
+        retained_tileset_ptr = std::move( tileset_ptr );
+    }
     tileset_ptr = std::move( new_tileset_ptr );
+    frame_cache_valid = false;
 
     set_draw_scale( 16 );
 
@@ -324,6 +366,9 @@ void cata_tiles::reinit()
 {
     set_draw_scale( 16 );
     RenderClear( renderer );
+    // the renderer may have been recreated, drop the cached frame texture
+    frame_cache_tex.reset();
+    frame_cache_valid = false;
 }
 
 static void get_tile_information( const std::string &config_path, std::string &json_path,
@@ -391,6 +436,43 @@ static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
     return surf;
 }
 
+// Box-filter the atlas down to half size, the classic mipmap reduction.
+// Channels are weighted by alpha so transparent texels do not darken edges.
+static SDL_Surface_Ptr downscale_atlas_half( const SDL_Surface_Ptr &original )
+{
+    cata_assert( original );
+    cata_assert( original->w % 2 == 0 && original->h % 2 == 0 );
+    SDL_Surface_Ptr src = create_surface_32( original->w, original->h );
+    cata_assert( src );
+    throwErrorIf( SDL_BlitSurface( original.get(), nullptr, src.get(), nullptr ) != 0,
+                  "SDL_BlitSurface failed" );
+    SDL_Surface_Ptr dst = create_surface_32( original->w / 2, original->h / 2 );
+    cata_assert( dst );
+
+    const SDL_Color *in = static_cast<const SDL_Color *>( src->pixels );
+    SDL_Color *out = static_cast<SDL_Color *>( dst->pixels );
+    for( int y = 0, ey = dst->h; y < ey; ++y ) {
+        const SDL_Color *row0 = in + 2 * y * src->w;
+        const SDL_Color *row1 = row0 + src->w;
+        for( int x = 0, ex = dst->w; x < ex; ++x, ++out ) {
+            const SDL_Color &p0 = row0[2 * x];
+            const SDL_Color &p1 = row0[2 * x + 1];
+            const SDL_Color &p2 = row1[2 * x];
+            const SDL_Color &p3 = row1[2 * x + 1];
+            const int a = p0.a + p1.a + p2.a + p3.a;
+            if( a == 0 ) {
+                *out = SDL_Color{ 0, 0, 0, 0 };
+                continue;
+            }
+            out->r = static_cast<Uint8>( ( p0.r * p0.a + p1.r * p1.a + p2.r * p2.a + p3.r * p3.a ) / a );
+            out->g = static_cast<Uint8>( ( p0.g * p0.a + p1.g * p1.a + p2.g * p2.a + p3.g * p3.a ) / a );
+            out->b = static_cast<Uint8>( ( p0.b * p0.a + p1.b * p1.a + p2.b * p2.a + p3.b * p3.a ) / a );
+            out->a = static_cast<Uint8>( a / 4 );
+        }
+    }
+    return dst;
+}
+
 static bool is_contained( const SDL_Rect &smaller, const SDL_Rect &larger )
 {
     return smaller.x >= larger.x &&
@@ -424,6 +506,31 @@ void tileset_loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf, const
     }
 }
 
+// As copy_surface_to_texture, but for a half-resolution atlas; the indices
+// must line up with the corresponding full-resolution sprites.
+void tileset_loader::copy_surface_to_half_texture( const SDL_Surface_Ptr &surf,
+        const point &offset, std::vector<texture> &target )
+{
+    cata_assert( surf );
+    const int half_width = sprite_width / 2;
+    const int half_height = sprite_height / 2;
+    const rect_range<SDL_Rect> input_range( half_width, half_height,
+                                            point( surf->w / half_width,
+                                                    surf->h / half_height ) );
+
+    const std::shared_ptr<SDL_Texture> texture_ptr = CreateTextureFromSurface( renderer, surf );
+    cata_assert( texture_ptr );
+
+    for( const SDL_Rect rect : input_range ) {
+        const point pos( offset / 2 + point( rect.x, rect.y ) );
+        const size_t index = this->offset + ( pos.x / half_width ) + ( pos.y / half_height ) *
+                             ( tile_atlas_width / sprite_width );
+        cata_assert( index < target.size() );
+        cata_assert( target[index].dimension() == std::make_pair( 0, 0 ) );
+        target[index] = texture( texture_ptr, rect );
+    }
+}
+
 void tileset_loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas,
         const point &offset )
 {
@@ -451,6 +558,33 @@ void tileset_loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &til
                                      *tile_values );
         }
     }
+
+    // Also build the half-resolution mip level served at far zoom. Sprites
+    // with odd dimensions cannot be halved cleanly; those keep minifying the
+    // full-resolution atlas instead.
+    if( sprite_width % 2 == 0 && sprite_height % 2 == 0 &&
+        tile_atlas->w % 2 == 0 && tile_atlas->h % 2 == 0 ) {
+        const SDL_Surface_Ptr half_atlas = downscale_atlas_half( tile_atlas );
+        std::array<tiles_pixel_color_entry, 5> half_values_data = {{
+                { std::make_tuple( &ts.half_tile_values, "color_pixel_none" ) },
+                { std::make_tuple( &ts.half_shadow_tile_values, "color_pixel_grayscale" ) },
+                { std::make_tuple( &ts.half_night_tile_values, "color_pixel_nightvision" ) },
+                { std::make_tuple( &ts.half_overexposed_tile_values, "color_pixel_overexposed" ) },
+                { std::make_tuple( &ts.half_memory_tile_values, tilecontext->memory_map_mode ) }
+            }
+        };
+        for( tiles_pixel_color_entry &entry : half_values_data ) {
+            std::vector<texture> *tile_values = std::get<0>( entry );
+            color_pixel_function_pointer color_pixel_function = get_color_pixel_function( std::get<1>
+                    ( entry ) );
+            if( !color_pixel_function ) {
+                copy_surface_to_half_texture( half_atlas, offset, *tile_values );
+            } else {
+                copy_surface_to_half_texture( apply_color_filter( half_atlas, color_pixel_function ),
+                                              offset, *tile_values );
+            }
+        }
+    }
 }
 
 template<typename T>
@@ -531,6 +665,11 @@ void tileset_loader::load_tileset( const std::string &img_path, const bool pump_
     extend_vector_by( ts.night_tile_values, expected_tilecount );
     extend_vector_by( ts.overexposed_tile_values, expected_tilecount );
     extend_vector_by( ts.memory_tile_values, expected_tilecount );
+    extend_vector_by( ts.half_tile_values, expected_tilecount );
+    extend_vector_by( ts.half_shadow_tile_values, expected_tilecount );
+    extend_vector_by( ts.half_night_tile_values, expected_tilecount );
+    extend_vector_by( ts.half_overexposed_tile_values, expected_tilecount );
+    extend_vector_by( ts.half_memory_tile_values, expected_tilecount );
 
     for( const SDL_Rect sub_rect : output_range ) {
         cata_assert( sub_rect.x % sprite_width == 0 );
@@ -570,6 +709,9 @@ void cata_tiles::set_draw_scale( int scale )
     cata_assert( tileset_ptr );
     tile_width = tileset_ptr->get_tile_width() * tileset_ptr->get_tile_pixelscale() * scale / 16;
     tile_height = tileset_ptr->get_tile_height() * tileset_ptr->get_tile_pixelscale() * scale / 16;
+    // At half scale and below, draw from the pre-filtered half-resolution
+    // atlases instead of minifying the full-resolution ones.
+    tileset_ptr->set_half_res_active( scale <= 8 );
 
     tile_ratiox = ( static_cast<float>( tile_width ) / static_cast<float>( fontwidth ) );
     tile_ratioy = ( static_cast<float>( tile_height ) / static_cast<float>( fontheight ) );
@@ -704,6 +846,9 @@ void tileset_loader::load( const std::string &tileset_id, const bool precheck,
     ensure_default_item_highlight();
 
     ts.tileset_id = tileset_id;
+    ts.composition_signature = tileset_composition_signature( tileset_id );
+    ts.composed_iso = tile_iso;
+    ts.mutation_overlay_ordering = tileset_mutation_overlay_ordering;
 }
 
 void tileset_loader::load_internal( const JsonObject &config, const std::string &tileset_root,
@@ -1097,6 +1242,21 @@ static std::map<tripoint, int> display_npc_attack_potential()
     return effectiveness_map;
 }
 
+bool cata_tiles::frame_cache_usable() const
+{
+    // Animations, tile overrides (mapgen preview) and the debug display
+    // overlays all change the scene without any of the signature inputs
+    // changing, so such frames are never cached or served from the cache.
+    return !( do_draw_explosion || do_draw_custom_explosion || do_draw_bullet || do_draw_hit ||
+              do_draw_line || do_draw_cursor || do_draw_highlight || do_draw_weather ||
+              do_draw_sct || do_draw_zones ) &&
+           !g->any_display_overlay_active() &&
+           radiation_override.empty() && terrain_override.empty() && furniture_override.empty() &&
+           graffiti_override.empty() && trap_override.empty() && field_override.empty() &&
+           item_override.empty() && vpart_override.empty() && draw_below_override.empty() &&
+           monster_override.empty();
+}
+
 void cata_tiles::draw( const point &dest, const tripoint &center, int width, int height,
                        std::multimap<point, formatted_text> &overlay_strings,
                        color_block_overlay_container &color_blocks )
@@ -1113,6 +1273,47 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
     }
 #endif
 
+    const frame_signature sig = { dest, center, width, height, tile_width, tile_height,
+                                  calendar::turn, get_avatar().pos(), get_avatar().view_offset,
+                                  get_avatar().moves
+                                };
+    const bool frame_cacheable = frame_cache_usable();
+    if( frame_cacheable && frame_cache_valid && frame_cache_tex && frame_cache_sig == sig ) {
+        // Scene is unchanged since the last full redraw, present it again.
+        const SDL_Rect frame_rect = { dest.x, dest.y, width, height };
+        RenderCopy( renderer, frame_cache_tex, &frame_rect, &frame_rect );
+        overlay_strings.insert( frame_cache_overlay_strings.begin(),
+                                frame_cache_overlay_strings.end() );
+        if( !frame_cache_color_blocks.second.empty() ) {
+            color_blocks.first = frame_cache_color_blocks.first;
+            color_blocks.second.insert( frame_cache_color_blocks.second.begin(),
+                                        frame_cache_color_blocks.second.end() );
+        }
+        in_animation = false;
+        return;
+    }
+    frame_cache_valid = false;
+    bool rendering_to_cache = false;
+    if( frame_cacheable ) {
+        // Redraw into the cache texture, it is copied to the output below.
+        // It covers the whole output so that all drawing coordinates and the
+        // clipping set up below apply unchanged.
+        int out_w = 0;
+        int out_h = 0;
+        if( SDL_GetRendererOutputSize( renderer.get(), &out_w, &out_h ) == 0 &&
+            out_w > 0 && out_h > 0 ) {
+            if( !frame_cache_tex || frame_cache_tex_size != point( out_w, out_h ) ) {
+                frame_cache_tex = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                                 SDL_TEXTUREACCESS_TARGET, out_w, out_h );
+                frame_cache_tex_size = point( out_w, out_h );
+            }
+            if( frame_cache_tex ) {
+                SetRenderTarget( renderer, frame_cache_tex );
+                rendering_to_cache = true;
+            }
+        }
+    }
+
     {
         //set clipping to prevent drawing over stuff we shouldn't
         SDL_Rect clipRect = {dest.x, dest.y, width, height};
@@ -1123,6 +1324,9 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         geometry->rect( renderer, clipRect, SDL_Color() );
     }
 
+    // batch unrotated sprite draws until the end of the redraw
+    batching_sprites = true;
+
     point s;
     get_window_tile_counts( width, height, s.x, s.y );
 
@@ -1211,6 +1415,32 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                would_apply_vision_effects( here.get_visibility( ch.visibility_cache[np.x][np.y],
                                            cache ) );
     };
+    // apply_visible() is queried for all four neighbours of every cell, both
+    // in the drawing loop and in the memorization loop below, so each cell is
+    // evaluated several times per frame. Memoize it over the union of the
+    // ranges the two loops touch; the visibility cache is constant for the
+    // duration of the frame.
+    const point memo_min( std::min( min_visible.x, o.x - s.x - s.y ) - 1,
+                          std::min( min_visible.y, o.y - s.x - s.y ) - 1 );
+    const point memo_max( std::max( max_visible.x, o.x + s.x + s.y ) + 1,
+                          std::max( max_visible.y, o.y + s.x + s.y ) + 1 );
+    const int memo_w = memo_max.x - memo_min.x + 1;
+    std::vector<char> visible_memo( static_cast<size_t>( memo_w ) *
+                                    ( memo_max.y - memo_min.y + 1 ), 0 );
+    const auto apply_visible_cached = [&]( const tripoint & np ) {
+        if( np.x < memo_min.x || np.x > memo_max.x || np.y < memo_min.y || np.y > memo_max.y ) {
+            return apply_visible( np, ch, here );
+        }
+        char &memo = visible_memo[static_cast<size_t>( np.y - memo_min.y ) * memo_w +
+                                                     ( np.x - memo_min.x )];
+        if( memo == 0 ) {
+            memo = apply_visible( np, ch, here ) ? 1 : 2;
+        }
+        return memo == 1;
+    };
+    // the temperature unit is the same for every tile of the frame
+    const std::string temperature_units = g->display_overlay_state( ACTION_DISPLAY_TEMPERATURE ) ?
+                                          get_option<std::string>( "USE_CELSIUS" ) : std::string();
     std::map<tripoint, int> npc_attack_rating_map;
     int max_npc_effectiveness = 0;
     if( g->display_overlay_state( ACTION_DISPLAY_NPC_ATTACK_POTENTIAL ) ) {
@@ -1340,9 +1570,9 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                 } else {
                     color = catacurses::blue + bold;
                 }
-                if( get_option<std::string>( "USE_CELSIUS" ) == "celsius" ) {
+                if( temperature_units == "celsius" ) {
                     temp_value = temp_to_celsius( temp_value );
-                } else if( get_option<std::string>( "USE_CELSIUS" ) == "kelvin" ) {
+                } else if( temperature_units == "kelvin" ) {
                     temp_value = temp_to_kelvin( temp_value );
 
                 }
@@ -1431,7 +1661,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
             }
             for( int i = 0; i < 4; i++ ) {
                 const tripoint np = pos + neighborhood[i];
-                invisible[1 + i] = apply_visible( np, ch, here );
+                invisible[1 + i] = apply_visible_cached( np );
             }
 
             int height_3d = 0;
@@ -1531,7 +1761,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
             invisible[0] = false;
             for( int i = 0; i < 4; i++ ) {
                 const tripoint np = p + neighborhood[i];
-                invisible[1 + i] = apply_visible( np, ch, here );
+                invisible[1 + i] = apply_visible_cached( np );
             }
             //calling draw to memorize everything.
             //bypass cache check in case we learn something new about the terrain's connections
@@ -1605,8 +1835,21 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
+    sprite_batch.flush( renderer );
+    batching_sprites = false;
+
     printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
                   "SDL_RenderSetClipRect failed" );
+
+    if( rendering_to_cache ) {
+        set_displaybuffer_rendertarget();
+        const SDL_Rect frame_rect = { dest.x, dest.y, width, height };
+        RenderCopy( renderer, frame_cache_tex, &frame_rect, &frame_rect );
+        frame_cache_sig = sig;
+        frame_cache_valid = true;
+        frame_cache_overlay_strings = overlay_strings;
+        frame_cache_color_blocks = color_blocks;
+    }
 }
 
 void cata_tiles::draw_minimap( const point &dest, const tripoint &center, int width, int height )
@@ -2302,7 +2545,9 @@ bool cata_tiles::draw_sprite_at(
 
     int width = 0;
     int height = 0;
-    std::tie( width, height ) = sprite_tex->dimension();
+    // Always size the destination from the full-resolution sprite; at far
+    // zoom sprite_tex may be the half-resolution mip level.
+    std::tie( width, height ) = tileset_ptr->sprite_dimension( sprite_index );
 
     SDL_Rect destination;
     destination.x = p.x + tile.offset.x * tile_width / tileset_ptr->get_tile_width();
@@ -2311,13 +2556,13 @@ bool cata_tiles::draw_sprite_at(
     destination.w = width * tile_width / tileset_ptr->get_tile_width();
     destination.h = height * tile_height / tileset_ptr->get_tile_height();
 
+    double angle = 0;
+    SDL_RendererFlip flip = SDL_FLIP_NONE;
     if( rotate_sprite ) {
         switch( rota ) {
             default:
             case 0:
                 // unrotated (and 180, with just two sprites)
-                ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                  SDL_FLIP_NONE );
                 break;
             case 1:
                 // 90 degrees (and 270, with just two sprites)
@@ -2330,23 +2575,14 @@ bool cata_tiles::draw_sprite_at(
 #endif
                 if( !tile_iso ) {
                     // never rotate isometric tiles
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr,
-                                                      SDL_FLIP_NONE );
-                } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      SDL_FLIP_NONE );
+                    angle = -90;
                 }
                 break;
             case 2:
                 // 180 degrees, implemented with flips instead of rotation
                 if( !tile_iso ) {
                     // never flip isometric tiles vertically
-                    ret = sprite_tex->render_copy_ex(
-                              renderer, &destination, 0, nullptr,
-                              static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
-                } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      SDL_FLIP_NONE );
+                    flip = static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL );
                 }
                 break;
             case 3:
@@ -2360,22 +2596,23 @@ bool cata_tiles::draw_sprite_at(
 #endif
                 if( !tile_iso ) {
                     // never rotate isometric tiles
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr,
-                                                      SDL_FLIP_NONE );
-                } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
-                                                      SDL_FLIP_NONE );
+                    angle = 90;
                 }
                 break;
             case 4:
                 // flip horizontally
-                ret = sprite_tex->render_copy_ex(
-                          renderer, &destination, 0, nullptr,
-                          static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
+                flip = static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL );
         }
+    }
+
+    if( batching_sprites && angle == 0 ) {
+        sprite_tex->queue_batched( sprite_batch, renderer, &destination, flip );
     } else {
-        // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+        if( batching_sprites ) {
+            // Rotated sprites are rare, draw them in order via the slow path.
+            sprite_batch.flush( renderer );
+        }
+        ret = sprite_tex->render_copy_ex( renderer, &destination, angle, nullptr, flip );
     }
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
@@ -2499,6 +2736,8 @@ bool cata_tiles::draw_terrain_below( const tripoint &p, const lit_level, int &,
     if( tile_iso ) {
         belowRect.y += tile_height / 8;
     }
+    // keep the rectangle ordered with the sprites drawn so far
+    sprite_batch.flush( renderer );
     geometry->rect( renderer, belowRect, tercol );
 
     return true;
@@ -2579,7 +2818,7 @@ bool cata_tiles::has_memory_at( const tripoint &p ) const
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         return !t.tile.empty();
     }
     return false;
@@ -2589,7 +2828,7 @@ bool cata_tiles::has_terrain_memory_at( const tripoint &p ) const
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "t_" ) ) {
             return true;
         }
@@ -2601,7 +2840,7 @@ bool cata_tiles::has_furniture_memory_at( const tripoint &p ) const
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "f_" ) ) {
             return true;
         }
@@ -2613,7 +2852,7 @@ bool cata_tiles::has_trap_memory_at( const tripoint &p ) const
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "tr_" ) ) {
             return true;
         }
@@ -2625,7 +2864,7 @@ bool cata_tiles::has_vpart_memory_at( const tripoint &p ) const
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "vp_" ) ) {
             return true;
         }
@@ -2637,7 +2876,7 @@ memorized_terrain_tile cata_tiles::get_terrain_memory_at( const tripoint &p ) co
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "t_" ) ) {
             return t;
         }
@@ -2649,7 +2888,7 @@ memorized_terrain_tile cata_tiles::get_furniture_memory_at( const tripoint &p )
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "f_" ) ) {
             return t;
         }
@@ -2661,7 +2900,7 @@ memorized_terrain_tile cata_tiles::get_trap_memory_at( const tripoint &p ) const
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "tr_" ) ) {
             return t;
         }
@@ -2673,7 +2912,7 @@ memorized_terrain_tile cata_tiles::get_vpart_memory_at( const tripoint &p ) cons
 {
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
-        const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = you.get_memorized_tile( get_map().getabs( p ) );
         if( string_starts_with( t.tile, "vp_" ) ) {
             return t;
         }
@@ -3074,6 +3313,8 @@ bool cata_tiles::draw_critter_at_below( const tripoint &p, const lit_level, int
         belowRect.y += tile_height / 8;
     }
 
+    // keep the rectangle ordered with the sprites drawn so far
+    sprite_batch.flush( renderer );
     geometry->rect( renderer, belowRect, tercol );
 
     return true;
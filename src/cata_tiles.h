@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "animation.h"
+#include "calendar.h"
 #include "cata_void.h"
 #include "creature.h"
 #include "enums.h"
@@ -105,6 +106,12 @@ class texture
             return SDL_RenderCopyEx( renderer.get(), sdl_texture_ptr.get(), &srcrect, dstrect, angle, center,
                                      flip );
         }
+        /// Queues this sprite into the given batch; equivalent to
+        /// render_copy_ex with an angle of zero.
+        void queue_batched( SpriteBatchRenderer &batch, const SDL_Renderer_Ptr &renderer,
+                            const SDL_Rect *const dstrect, const SDL_RendererFlip flip ) const {
+            batch.queue( renderer, sdl_texture_ptr, srcrect, *dstrect, flip );
+        }
 };
 
 class tileset
@@ -116,6 +123,16 @@ class tileset
         };
 
         std::string tileset_id;
+        // Identifies the exact set of inputs this tileset was composed from:
+        // the tileset id plus every compatible mod tileset. Composing a large
+        // tileset means decoding all its images and building the texture
+        // atlases, which can take many seconds, so loads with an identical
+        // signature reuse the already uploaded textures instead.
+        std::string composition_signature;
+        // Globals set while composing this tileset, kept here so that reusing
+        // a retained tileset can restore them without reparsing the JSON.
+        bool composed_iso = false;
+        std::map<std::string, int> mutation_overlay_ordering;
 
         int tile_width = 0;
         int tile_height = 0;
@@ -129,6 +146,17 @@ class tileset
         std::vector<texture> overexposed_tile_values;
         std::vector<texture> memory_tile_values;
 
+        // Half-resolution copies of the above, built while composing the
+        // atlases for sprites with even dimensions. Selected at far zoom so
+        // the GPU samples a pre-filtered mip level instead of minifying the
+        // full-resolution atlas on every frame.
+        std::vector<texture> half_tile_values;
+        std::vector<texture> half_shadow_tile_values;
+        std::vector<texture> half_night_tile_values;
+        std::vector<texture> half_overexposed_tile_values;
+        std::vector<texture> half_memory_tile_values;
+        bool half_res_active = false;
+
         std::unordered_set<std::string> duplicate_ids;
 
         std::unordered_map<std::string, tile_type> tile_ids;
@@ -141,6 +169,18 @@ class tileset
             return index < tiles.size() ? & tiles[index] : nullptr;
         }
 
+        // As get_if_available, but preferring the half-resolution variant
+        // when it is active and this sprite has one (sprites from atlases
+        // with odd dimensions fall back to the full-resolution texture).
+        const texture *get_mip_if_available( const size_t index,
+                                             const decltype( shadow_tile_values ) &half,
+                                             const decltype( shadow_tile_values ) &full ) const {
+            if( half_res_active && index < half.size() && half[index].dimension().first > 0 ) {
+                return &half[index];
+            }
+            return get_if_available( index, full );
+        }
+
         friend class tileset_loader;
 
     public:
@@ -156,21 +196,46 @@ class tileset
         const std::string &get_tileset_id() const {
             return tileset_id;
         }
+        const std::string &get_composition_signature() const {
+            return composition_signature;
+        }
+        bool get_composed_iso() const {
+            return composed_iso;
+        }
+        const std::map<std::string, int> &get_mutation_overlay_ordering() const {
+            return mutation_overlay_ordering;
+        }
 
         const texture *get_tile( const size_t index ) const {
-            return get_if_available( index, tile_values );
+            return get_mip_if_available( index, half_tile_values, tile_values );
         }
         const texture *get_night_tile( const size_t index ) const {
-            return get_if_available( index, night_tile_values );
+            return get_mip_if_available( index, half_night_tile_values, night_tile_values );
         }
         const texture *get_shadow_tile( const size_t index ) const {
-            return get_if_available( index, shadow_tile_values );
+            return get_mip_if_available( index, half_shadow_tile_values, shadow_tile_values );
         }
         const texture *get_overexposed_tile( const size_t index ) const {
-            return get_if_available( index, overexposed_tile_values );
+            return get_mip_if_available( index, half_overexposed_tile_values, overexposed_tile_values );
         }
         const texture *get_memory_tile( const size_t index ) const {
-            return get_if_available( index, memory_tile_values );
+            return get_mip_if_available( index, half_memory_tile_values, memory_tile_values );
+        }
+
+        /**
+         * Logical (full-resolution) pixel size of a sprite, independent of
+         * which mip level the getters currently return. Destination
+         * rectangles must be computed from this so switching mip levels does
+         * not change on-screen sprite sizes.
+         */
+        std::pair<int, int> sprite_dimension( const size_t index ) const {
+            const texture *full = get_if_available( index, tile_values );
+            return full ? full->dimension() : std::make_pair( 0, 0 );
+        }
+
+        /** Select the mip level the sprite getters serve; see @ref half_tile_values. */
+        void set_half_res_active( bool active ) {
+            half_res_active = active;
         }
 
         const std::unordered_set<std::string> &get_duplicate_ids() const {
@@ -223,6 +288,8 @@ class tileset_loader
 
         void copy_surface_to_texture( const SDL_Surface_Ptr &surf, const point &offset,
                                       std::vector<texture> &target );
+        void copy_surface_to_half_texture( const SDL_Surface_Ptr &surf, const point &offset,
+                                           std::vector<texture> &target );
         void create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas, const point &offset );
 
         void process_variations_after_loading( weighted_int_list<std::vector<int>> &v );
@@ -586,6 +653,60 @@ class cata_tiles
         const SDL_Renderer_Ptr &renderer;
         const GeometryRenderer_Ptr &geometry;
         std::unique_ptr<tileset> tileset_ptr;
+        // The most recently displaced composed tileset. Switching back to it
+        // (e.g. trying out another tileset in the options and reverting)
+        // reuses its textures instead of recomposing the atlases.
+        std::unique_ptr<tileset> retained_tileset_ptr;
+
+        // Collects unrotated sprite draws during draw() into per-texture
+        // geometry batches. Only enabled for the map redraw, where nearly
+        // every sprite comes from the same handful of atlas textures.
+        SpriteBatchRenderer sprite_batch;
+        bool batching_sprites = false;
+
+        // Identifies the inputs the cached frame was rendered from. All of
+        // the remaining scene state (lighting, creatures, fields, weather)
+        // only changes when one of these does, so an exact match means the
+        // previous frame can be presented again.
+        struct frame_signature {
+            // no default member initializers, this must stay an aggregate
+            point dest;
+            tripoint center;
+            int width;
+            int height;
+            int tile_width;
+            int tile_height;
+            time_point turn;
+            tripoint player_pos;
+            tripoint view_offset;
+            // Remaining player moves. Scene changes within a turn come from
+            // player actions (opening a door, smashing, dropping an item),
+            // and those all spend moves, so this distinguishes redraws
+            // between actions taken on the same turn from the same spot.
+            int player_moves;
+
+            bool operator==( const frame_signature &rhs ) const {
+                return dest == rhs.dest && center == rhs.center && width == rhs.width &&
+                       height == rhs.height && tile_width == rhs.tile_width &&
+                       tile_height == rhs.tile_height && turn == rhs.turn &&
+                       player_pos == rhs.player_pos && view_offset == rhs.view_offset &&
+                       player_moves == rhs.player_moves;
+            }
+        };
+        // The last fully rendered frame, kept in a render target texture and
+        // re-presented while the scene is unchanged. This spares idle
+        // screens (waiting for input with no animation running) the full
+        // grid redraw. Overlay strings and color blocks produced along with
+        // the frame are replayed on a hit.
+        SDL_Texture_Ptr frame_cache_tex;
+        point frame_cache_tex_size;
+        frame_signature frame_cache_sig = {};
+        bool frame_cache_valid = false;
+        std::multimap<point, formatted_text> frame_cache_overlay_strings;
+        color_block_overlay_container frame_cache_color_blocks;
+
+        /** Whether the current frame may be cached or served from the cache. */
+        bool frame_cache_usable() const;
 
         int tile_height = 0;
         int tile_width = 0;
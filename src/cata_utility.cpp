@@ -10,6 +10,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "catacharset.h"
 #include "debug.h"
@@ -347,10 +348,22 @@ std::istream &safe_getline( std::istream &ins, std::string &str )
 bool read_from_file( const std::string &path, const std::function<void( std::istream & )> &reader )
 {
     try {
-        cata::ifstream fin( fs::u8path( path ), std::ios::binary );
-        if( !fin ) {
+        cata::ifstream infile( fs::u8path( path ), std::ios::binary );
+        if( !infile ) {
             throw std::runtime_error( "opening file failed" );
         }
+        // Slurp the whole file and hand the reader an in-memory stream,
+        // the way the data loader already does ("stuff it into ram"):
+        // streambuf operations on an istringstream are plain pointer
+        // arithmetic, so JsonIn's character-level fast paths never touch
+        // the filesystem layer, and the file itself is read in one large
+        // sequential pass.
+        std::string content( ( std::istreambuf_iterator<char>( infile ) ),
+                             std::istreambuf_iterator<char>() );
+        std::istringstream fin( std::move( content ) );
+        if( infile.bad() ) {
+            throw std::runtime_error( "reading file failed" );
+        }
         reader( fin );
         if( fin.bad() ) {
             throw std::runtime_error( "reading file failed" );
@@ -3,6 +3,7 @@
 #include <array>
 #include <cstdlib>
 #include <cstring>
+#include <unordered_map>
 
 #include "options.h"
 #include "output.h"
@@ -121,7 +122,34 @@ int utf8_width( const char *s, const bool ignore_tags )
 
 int utf8_width( const std::string &str, const bool ignore_tags )
 {
-    return utf8_width( str.c_str(), ignore_tags );
+    // Printable pure-ASCII strings dominate and have width == length.
+    bool plain_ascii = true;
+    for( const char c : str ) {
+        const unsigned char uc = static_cast<unsigned char>( c );
+        if( uc < 0x20 || uc >= 0x7F || ( ignore_tags && c == '<' ) ) {
+            plain_ascii = false;
+            break;
+        }
+    }
+    if( plain_ascii ) {
+        return str.size();
+    }
+    // Everything else pays a decode plus a width-table binary search per
+    // code point, and menus remeasure the same strings every frame, so
+    // memoize per string and tag mode.
+    static std::unordered_map<std::string, int> memo[2];
+    std::unordered_map<std::string, int> &cache = memo[ignore_tags ? 1 : 0];
+    const auto found = cache.find( str );
+    if( found != cache.end() ) {
+        return found->second;
+    }
+    if( cache.size() >= 16384 ) {
+        // Bound memory use; mostly stale menu text by this point.
+        cache.clear();
+    }
+    const int w = utf8_width( str.c_str(), ignore_tags );
+    cache.emplace( str, w );
+    return w;
 }
 
 int utf8_width( const utf8_wrapper &str, const bool ignore_tags )
@@ -54,6 +54,7 @@
 #include "game_constants.h"
 #include "gun_mode.h"
 #include "handle_liquid.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "inventory.h"
 #include "item_location.h"
@@ -321,6 +322,8 @@ static const trait_id trait_ROOTS3( "ROOTS3" );
 static const trait_id trait_SEESLEEP( "SEESLEEP" );
 static const trait_id trait_SELFAWARE( "SELFAWARE" );
 static const trait_id trait_SHELL2( "SHELL2" );
+
+static const material_id material_wool( "wool" );
 static const trait_id trait_SHOUT2( "SHOUT2" );
 static const trait_id trait_SHOUT3( "SHOUT3" );
 static const trait_id trait_SLIMESPAWNER( "SLIMESPAWNER" );
@@ -2029,7 +2032,11 @@ void Character::check_item_encumbrance_flag()
     }
 
     if( update_required ) {
+        // Contents changed; force the rebuild past the fingerprint check
+        // and let get_encumber refresh its relative-encumbrance caches.
+        set_check_encumbrance( true );
         calc_encumbrance();
+        set_check_encumbrance( false );
     }
 }
 
@@ -2177,24 +2184,27 @@ bool Character::practice( const skill_id &id, int amount, int cap, bool suppress
 // 11.0 is zero light or blindness
 float Character::fine_detail_vision_mod( const tripoint &p ) const
 {
-    // PER_SLIME_OK implies you can get enough eyes around the bile
-    // that you can generally see.  There still will be the haze, but
-    // it's annoying rather than limiting.
-    if( is_blind() ||
-        ( ( has_effect( effect_boomered ) || has_effect( effect_darkness ) ) &&
-          !has_trait( trait_PER_SLIME_OK ) ) ) {
+    if( fine_detail_vision_cache.turn != calendar::turn ) {
+        // PER_SLIME_OK implies you can get enough eyes around the bile
+        // that you can generally see.  There still will be the haze, but
+        // it's annoying rather than limiting.
+        fine_detail_vision_cache.blind = is_blind() ||
+                                         ( ( has_effect( effect_boomered ) || has_effect( effect_darkness ) ) &&
+                                           !has_trait( trait_PER_SLIME_OK ) );
+        // Scale linearly as light level approaches LIGHT_AMBIENT_LIT.
+        // If we're actually a source of light, assume we can direct it where we need it.
+        // Therefore give a hefty bonus relative to ambient light.
+        fine_detail_vision_cache.own_light = std::max( 1.0f, LIGHT_AMBIENT_LIT - active_light() - 2.0f );
+        fine_detail_vision_cache.turn = calendar::turn;
+    }
+    if( fine_detail_vision_cache.blind ) {
         return 11.0;
     }
-    // Scale linearly as light level approaches LIGHT_AMBIENT_LIT.
-    // If we're actually a source of light, assume we can direct it where we need it.
-    // Therefore give a hefty bonus relative to ambient light.
-    float own_light = std::max( 1.0f, LIGHT_AMBIENT_LIT - active_light() - 2.0f );
-
-    // Same calculation as above, but with a result 3 lower.
+    // Same calculation as own_light above, but with a result 3 lower.
     float ambient_light = std::max( 1.0f,
                                     LIGHT_AMBIENT_LIT - get_map().ambient_light_at( p == tripoint_zero ? pos() : p ) + 1.0f );
 
-    return std::min( own_light, ambient_light );
+    return std::min( fine_detail_vision_cache.own_light, ambient_light );
 }
 
 units::energy Character::get_power_level() const
@@ -3056,8 +3066,38 @@ void Character::calc_encumbrance()
     calc_encumbrance( item() );
 }
 
+size_t Character::encumbrance_fingerprint() const
+{
+    size_t fingerprint = worn_fingerprint();
+    for( const trait_id &mut : get_mutations() ) {
+        cata::hash_combine( fingerprint, static_cast<const void *>( &mut.obj() ) );
+    }
+    for( const bionic_id &bid : get_bionics() ) {
+        cata::hash_combine( fingerprint, static_cast<const void *>( &bid.obj() ) );
+    }
+    cata::hash_combine( fingerprint, has_active_bionic( bio_shock_absorber ) );
+    return fingerprint;
+}
+
 void Character::calc_encumbrance( const item &new_item )
 {
+    // Several code paths recalculate eagerly after any equipment-related
+    // change, often with nothing relevant changed in between. Skip the
+    // rebuild when every input is identical to the last one. The
+    // check_encumbrance flag bypasses this: it signals container contents
+    // changes, which the fingerprint does not cover.
+    if( new_item.is_null() && !get_check_encumbrance() ) {
+        const size_t fingerprint = encumbrance_fingerprint();
+        if( encumbrance_memo_valid && fingerprint == last_encumbrance_fingerprint ) {
+            return;
+        }
+        last_encumbrance_fingerprint = fingerprint;
+        encumbrance_memo_valid = true;
+    } else {
+        // Either a hypothetical item is layered in or a forced rebuild
+        // was requested; the stored result won't match a plain recompute.
+        encumbrance_memo_valid = false;
+    }
 
     std::map<bodypart_id, encumbrance_data> enc;
     item_encumb( enc, new_item );
@@ -3136,42 +3176,18 @@ bool Character::in_climate_control()
     return regulated_area;
 }
 
-std::map<bodypart_id, int> Character::get_wind_resistance( const std::map <bodypart_id,
-        std::vector<const item *>> &clothing_map ) const
+std::map<bodypart_id, int> Character::get_wind_resistance() const
 {
-
-    std::map<bodypart_id, int> ret;
-    for( const bodypart_id &bp : get_all_body_parts() ) {
-        ret.emplace( bp, 0 );
-    }
-
     // Your shell provides complete wind protection if you're inside it
     if( has_active_mutation( trait_SHELL2 ) ) {
-        for( std::pair<const bodypart_id, int> &this_bp : ret ) {
-            this_bp.second = 100;
+        std::map<bodypart_id, int> ret;
+        for( const bodypart_id &bp : get_all_body_parts() ) {
+            ret.emplace( bp, 100 );
         }
         return ret;
     }
 
-    for( const std::pair<const bodypart_id, std::vector<const item *>> &on_bp : clothing_map ) {
-        const bodypart_id &bp = on_bp.first;
-
-        int coverage = 0;
-        float totalExposed = 1.0f;
-        int totalCoverage = 0;
-        int penalty = 100;
-
-        for( const item *it : on_bp.second ) {
-            const item &i = *it;
-            penalty = 100 - i.wind_resist();
-            coverage = std::max( 0, i.get_coverage( bp ) - penalty );
-            totalExposed *= ( 1.0 - coverage / 100.0 ); // Coverage is between 0 and 1?
-        }
-
-        ret[bp] = totalCoverage = 100 - totalExposed * 100;
-    }
-
-    return ret;
+    return get_worn_warmth_cache().wind_resistance;
 }
 
 void layer_details::reset()
@@ -5293,15 +5309,20 @@ mutation_value_map = {
 
 float Character::mutation_value( const std::string &val ) const
 {
+    const auto cached = mutation_value_cache.find( val );
+    if( cached != mutation_value_cache.end() ) {
+        return cached->second;
+    }
     // Syntax similar to tuple get<n>()
     const auto found = mutation_value_map.find( val );
 
     if( found == mutation_value_map.end() ) {
         debugmsg( "Invalid mutation value name %s", val );
         return 0.0f;
-    } else {
-        return found->second( cached_mutations );
     }
+    const float ret = found->second( cached_mutations );
+    mutation_value_cache.emplace( val, ret );
+    return ret;
 }
 
 float Character::healing_rate( float at_rest_quality ) const
@@ -6431,13 +6452,17 @@ void Character::recalculate_bodyparts()
 
 void Character::recalculate_enchantment_cache()
 {
-    // start by resetting the cache to all inventory items
-    *enchantment_cache = inv->get_active_enchantment_cache( *this );
+    // Gather the active enchantment sources first. The aggregate is a pure
+    // function of this list, so when it matches the one from the previous
+    // rebuild the cached aggregate is still valid and the merge (plus a
+    // possible bodypart recalculation) can be skipped. Several code paths
+    // call this defensively every turn; most turns nothing has changed.
+    std::vector<const enchantment *> sources;
 
     visit_items( [&]( const item * it, item * ) {
         for( const enchantment &ench : it->get_enchantments() ) {
             if( ench.is_active( *this, *it ) ) {
-                enchantment_cache->force_add( ench );
+                sources.push_back( &ench );
             }
         }
         return VisitResponse::NEXT;
@@ -6450,7 +6475,7 @@ void Character::recalculate_enchantment_cache()
         for( const enchantment_id &ench_id : mut.enchantments ) {
             const enchantment &ench = ench_id.obj();
             if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
-                enchantment_cache->force_add( ench );
+                sources.push_back( &ench );
             }
         }
     }
@@ -6462,11 +6487,29 @@ void Character::recalculate_enchantment_cache()
             const enchantment &ench = ench_id.obj();
             if( ench.is_active( *this, bio.powered &&
                                 bid->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) ) ) {
-                enchantment_cache->force_add( ench );
+                sources.push_back( &ench );
             }
         }
     }
 
+    // Pointer identity is enough to detect changes: item enchantments live in
+    // the item's relic data and the rest in static JSON definitions, and a
+    // source becoming (in)active changes the gathered list itself.
+    if( enchantment_cache_built && sources == active_enchantment_sources ) {
+        return;
+    }
+    active_enchantment_sources = std::move( sources );
+    enchantment_cache_built = true;
+    // the rebuilt cache may grant a different set of mutations
+    trait_bitset_built = false;
+
+    // start by resetting the cache to all inventory items, then merge in the
+    // gathered sources
+    *enchantment_cache = inv->get_active_enchantment_cache( *this );
+    for( const enchantment *ench : active_enchantment_sources ) {
+        enchantment_cache->force_add( *ench );
+    }
+
     if( enchantment_cache->modifies_bodyparts() ) {
         recalculate_bodyparts();
     }
@@ -7507,50 +7550,114 @@ std::string Character::is_snuggling() const
     return "nothing";
 }
 
-std::map<bodypart_id, int> Character::warmth( const std::map<bodypart_id, std::vector<const item *>>
-        &clothing_map ) const
+size_t Character::worn_fingerprint() const
 {
-    std::map<bodypart_id, int> ret;
-    for( const bodypart_id &bp : get_all_body_parts() ) {
-        ret.emplace( bp, 0 );
+    size_t fingerprint = 0;
+    cata::hash_combine( fingerprint, worn.size() );
+    cata::hash_combine( fingerprint, get_all_body_parts().size() );
+    for( const item &it : worn ) {
+        cata::hash_combine( fingerprint, &it );
+        cata::hash_combine( fingerprint, static_cast<const void *>( it.type ) );
+        cata::hash_combine( fingerprint, it.damage() );
+        cata::hash_combine( fingerprint, static_cast<int>( it.get_side() ) );
+        // Per-item tags cover in-place changes from fitting and clothing
+        // mods (wooled, furred, ...), which alter warmth, encumbrance and
+        // flag coverage without touching type, damage or side.
+        for( const flag_id &f : it.get_flags() ) {
+            cata::hash_combine( fingerprint, f.str() );
+        }
+        // Installed mods contribute inheritable flags to item::has_flag,
+        // which the flag coverage cache aggregates, so they are part of
+        // the fingerprint too.
+        for( const item *mod : it.is_gun() ? it.gunmods() : it.toolmods() ) {
+            cata::hash_combine( fingerprint, static_cast<const void *>( mod->type ) );
+        }
     }
+    return fingerprint;
+}
 
-    for( const std::pair<const bodypart_id, std::vector<const item *>> &on_bp : clothing_map ) {
-        const bodypart_id &bp = on_bp.first;
+const Character::worn_warmth_cache_type &Character::get_worn_warmth_cache() const
+{
+    const size_t fingerprint = worn_fingerprint();
+    if( worn_warmth_cache.valid && worn_warmth_cache.worn_fingerprint == fingerprint ) {
+        return worn_warmth_cache;
+    }
 
-        double warmth = 0.0;
-        const int wetness_pct = get_part_wetness_percentage( bp );
+    worn_warmth_cache = worn_warmth_cache_type();
+    worn_warmth_cache.valid = true;
+    worn_warmth_cache.worn_fingerprint = fingerprint;
 
-        for( const item *it : on_bp.second ) {
-            warmth = it->get_warmth();
-            // Wool items do not lose their warmth due to being wet.
-            // Warmth is reduced by 0 - 66% based on wetness.
-            if( !it->made_of( material_id( "wool" ) ) ) {
-                warmth *= 1.0 - 0.66 * wetness_pct;
+    for( const bodypart_id &bp : get_all_body_parts() ) {
+        worn_warmth_cache.wool_warmth.emplace( bp, 0 );
+        worn_warmth_cache.nonwool_warmth.emplace( bp, std::vector<int>() );
+        worn_warmth_cache.wind_resistance.emplace( bp, 0 );
+    }
+
+    for( const item &it : worn ) {
+        const int warmth = it.get_warmth();
+        const bool wool = it.made_of( material_wool );
+        if( it.has_flag( flag_POCKETS ) && warmth > worn_warmth_cache.pocket_warmth ) {
+            worn_warmth_cache.pocket_warmth = warmth;
+        }
+        if( it.has_flag( flag_HOOD ) && warmth > worn_warmth_cache.hood_warmth ) {
+            worn_warmth_cache.hood_warmth = warmth;
+        }
+        if( it.has_flag( flag_COLLAR ) && warmth > worn_warmth_cache.collar_warmth ) {
+            worn_warmth_cache.collar_warmth = warmth;
+        }
+        for( const bodypart_id &bp : get_all_body_parts() ) {
+            if( !it.covers( bp ) ) {
+                continue;
+            }
+            if( wool ) {
+                worn_warmth_cache.wool_warmth[bp] += warmth;
+            } else {
+                worn_warmth_cache.nonwool_warmth[bp].push_back( warmth );
             }
-            ret[bp] += std::round( warmth );
         }
-        ret[bp] += get_effect_int( effect_heating_bionic, bp );
     }
-    return ret;
+
+    for( const bodypart_id &bp : get_all_body_parts() ) {
+        float totalExposed = 1.0f;
+        for( const item &it : worn ) {
+            if( !it.covers( bp ) ) {
+                continue;
+            }
+            const int penalty = 100 - it.wind_resist();
+            const int coverage = std::max( 0, it.get_coverage( bp ) - penalty );
+            totalExposed *= ( 1.0 - coverage / 100.0 ); // Coverage is between 0 and 1?
+        }
+        worn_warmth_cache.wind_resistance[bp] = 100 - totalExposed * 100;
+    }
+
+    return worn_warmth_cache;
 }
 
-std::map<bodypart_id, int> Character::bonus_item_warmth() const
+std::map<bodypart_id, int> Character::warmth() const
 {
-    int pocket_warmth = 0;
-    int hood_warmth = 0;
-    int collar_warmth = 0;
-    for( const item &w : worn ) {
-        if( w.has_flag( flag_POCKETS ) && w.get_warmth() > pocket_warmth ) {
-            pocket_warmth = w.get_warmth();
-        }
-        if( w.has_flag( flag_HOOD ) && w.get_warmth() > hood_warmth ) {
-            hood_warmth = w.get_warmth();
-        }
-        if( w.has_flag( flag_COLLAR ) && w.get_warmth() > collar_warmth ) {
-            collar_warmth = w.get_warmth();
+    const worn_warmth_cache_type &cache = get_worn_warmth_cache();
+
+    std::map<bodypart_id, int> ret;
+    for( const bodypart_id &bp : get_all_body_parts() ) {
+        // Wool items do not lose their warmth due to being wet.
+        // Warmth is reduced by 0 - 66% based on wetness.
+        const int wetness_pct = get_part_wetness_percentage( bp );
+        int warmth = cache.wool_warmth.at( bp );
+        for( const int item_warmth : cache.nonwool_warmth.at( bp ) ) {
+            warmth += std::round( item_warmth * ( 1.0 - 0.66 * wetness_pct ) );
         }
+        warmth += get_effect_int( effect_heating_bionic, bp );
+        ret.emplace( bp, warmth );
     }
+    return ret;
+}
+
+std::map<bodypart_id, int> Character::bonus_item_warmth() const
+{
+    const worn_warmth_cache_type &cache = get_worn_warmth_cache();
+    const int pocket_warmth = cache.pocket_warmth;
+    const int hood_warmth = cache.hood_warmth;
+    const int collar_warmth = cache.collar_warmth;
 
     std::map<bodypart_id, int> ret;
     for( const bodypart_id &bp : get_all_body_parts() ) {
@@ -7752,6 +7859,7 @@ std::list<item> Character::use_amount( const itype_id &it, int quantity,
                                        const std::function<bool( const item & )> &filter )
 {
     std::list<item> ret;
+    invalidate_crafting_inventory();
     if( weapon.use_amount( it, quantity, ret ) ) {
         remove_weapon();
     }
@@ -7849,6 +7957,10 @@ std::list<item> Character::use_charges( const itype_id &what, int qty, const int
         return res;
     }
 
+    // carried charges below are drained in place, outside the hooked
+    // add/remove paths
+    invalidate_crafting_inventory();
+
     if( what == itype_fire ) {
         use_fire( qty );
         return res;
@@ -8115,6 +8227,7 @@ void Character::on_worn_item_washed( const item &it )
 void Character::on_item_wear( const item &it )
 {
     invalidate_inventory_validity_cache();
+    fine_detail_vision_cache.turn = calendar::before_time_starts;
     for( const trait_id &mut : it.mutations_from_wearing( *this ) ) {
         mutation_effect( mut, true );
         recalc_sight_limits();
@@ -8131,6 +8244,7 @@ void Character::on_item_wear( const item &it )
 void Character::on_item_takeoff( const item &it )
 {
     invalidate_inventory_validity_cache();
+    fine_detail_vision_cache.turn = calendar::before_time_starts;
     for( const trait_id &mut : it.mutations_from_wearing( *this ) ) {
         mutation_loss_effect( mut );
         recalc_sight_limits();
@@ -8144,6 +8258,8 @@ void Character::on_item_takeoff( const item &it )
 
 void Character::on_effect_int_change( const efftype_id &eid, int intensity, const bodypart_id &bp )
 {
+    // Effects (blindness, boomered, glowing, ...) feed fine_detail_vision_mod.
+    fine_detail_vision_cache.turn = calendar::before_time_starts;
     // Adrenaline can reduce perceived pain (or increase it when you enter comedown).
     // See @ref get_perceived_pain()
     if( eid == effect_adrenaline ) {
@@ -9167,6 +9283,37 @@ std::vector<tripoint> &Character::get_auto_move_route()
     return auto_move_route;
 }
 
+bool Character::repair_auto_move_route()
+{
+    map &here = get_map();
+    // The tile we failed to reach is suspect: route around it so a refused
+    // step (danger prompt, closed obstacle) cannot be proposed again forever.
+    std::set<tripoint> avoid = get_path_avoid();
+    if( next_expected_position ) {
+        avoid.insert( *next_expected_position );
+    }
+    const int window = std::min<int>( auto_move_route.size(), 8 );
+    // Stumbling may have dropped us onto a later point of the route already.
+    for( int i = 0; i < window; i++ ) {
+        if( auto_move_route[i] == pos() ) {
+            auto_move_route.erase( auto_move_route.begin(), auto_move_route.begin() + i + 1 );
+            return !auto_move_route.empty();
+        }
+    }
+    for( int i = 0; i < window; i++ ) {
+        std::vector<tripoint> repair = here.route( pos(), auto_move_route[i],
+                                       get_pathfinding_settings(), avoid );
+        if( repair.empty() ) {
+            continue;
+        }
+        // route() ends on the waypoint itself, so splice the tail after it.
+        repair.insert( repair.end(), auto_move_route.begin() + i + 1, auto_move_route.end() );
+        auto_move_route = std::move( repair );
+        return true;
+    }
+    return false;
+}
+
 action_id Character::get_next_auto_move_direction()
 {
     if( !has_destination() ) {
@@ -9175,8 +9322,11 @@ action_id Character::get_next_auto_move_direction()
 
     if( next_expected_position ) {
         if( pos() != *next_expected_position ) {
-            // We're off course, possibly stumbling or stuck, cancel auto move
-            return ACTION_NULL;
+            // We're off course, possibly stumbling, stuck or blocked. Repair
+            // the route locally before giving up on the whole destination.
+            if( !repair_auto_move_route() ) {
+                return ACTION_NULL;
+            }
         }
     }
 
@@ -10324,6 +10474,9 @@ void Character::process_items()
         w.encumbrance_update_ = false;
     }
     if( update_required ) {
+        // As above in check_item_encumbrance_flag: contents changes are
+        // not covered by the fingerprint, so force the rebuild.
+        set_check_encumbrance( true );
         calc_encumbrance();
         set_check_encumbrance( false );
     }
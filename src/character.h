@@ -773,8 +773,7 @@ class Character : public Creature, public visitable
         bool in_climate_control();
 
         /** Returns wind resistance provided by armor, etc **/
-        std::map<bodypart_id, int> get_wind_resistance( const
-                std::map<bodypart_id, std::vector<const item *>> &clothing_map ) const;
+        std::map<bodypart_id, int> get_wind_resistance() const;
 
         /** Returns true if the player isn't able to see */
         bool is_blind() const;
@@ -1360,6 +1359,12 @@ class Character : public Creature, public visitable
 
         /** Handles bionic effects over time of the entered bionic */
         void process_bionic( int b );
+        /**
+         * Per-index flags for bionics that handle fuel and therefore need
+         * processing even while switched off. Rebuilt when the installed set
+         * changes; powered bionics are always processed.
+         */
+        const std::vector<bool> &bionic_fuel_processing_mask() const;
         /** finds the index of the bionic that corresponds to the currently wielded fake item
          *  i.e. bionic is `BIONIC_WEAPON` and weapon.typeId() == bio.info().fake_item */
         cata::optional<int> active_bionic_weapon_index() const;
@@ -2619,9 +2624,9 @@ class Character : public Creature, public visitable
         player_activity get_destination_activity() const;
         void set_destination_activity( const player_activity &new_destination_activity );
         void clear_destination_activity();
-        /** Returns warmth provided by armor, etc. */
-        std::map<bodypart_id, int> warmth( const std::map<bodypart_id, std::vector<const item *>>
-                                           &clothing_map ) const;
+        /** Returns warmth provided by armor, etc.  Wetness scaling is applied
+         *  to the cached per-item values, so results track current wetness. */
+        std::map<bodypart_id, int> warmth() const;
         /** Returns warmth provided by an armor's bonus, like hoods, pockets, etc. */
         std::map<bodypart_id, int> bonus_item_warmth() const;
         /** Can the player lie down and cover self with blankets etc. **/
@@ -2810,6 +2815,12 @@ class Character : public Creature, public visitable
         const inventory &crafting_inventory( const tripoint &src_pos = tripoint_zero,
                                              int radius = PICKUP_RANGE, bool clear_path = true ) const;
         void invalidate_crafting_inventory();
+        /**
+         * Monotonic counter bumped every time the crafting inventory is
+         * rebuilt. Long activities can remember the value from their last
+         * requirement check and skip re-scanning while it is unchanged.
+         */
+        int crafting_inventory_generation() const;
 
         /** Returns a value from 1.0 to 11.0 that acts as a multiplier
          * for the time taken to perform tasks that require detail vision,
@@ -3046,6 +3057,13 @@ class Character : public Creature, public visitable
         void start_destination_activity();
         std::vector<tripoint> &get_auto_move_route();
         action_id get_next_auto_move_direction();
+        /**
+         * Re-plan a short window of @ref auto_move_route around an
+         * obstruction and splice the result into the committed route,
+         * avoiding a full re-path to the destination. Returns false when
+         * no nearby waypoint of the stored route can be reached.
+         */
+        bool repair_auto_move_route();
         bool defer_move( const tripoint &next );
         time_duration get_consume_time( const item &it );
 
@@ -3186,11 +3204,51 @@ class Character : public Creature, public visitable
          * Pointers to mutation branches in @ref my_mutations.
          */
         std::vector<const mutation_branch *> cached_mutations;
+        /**
+         * Presence bit per dense trait id, covering both @ref my_mutations and the
+         * mutations granted by @ref enchantment_cache. Makes @ref has_trait a bit test.
+         * Rebuilt lazily whenever either source changes; valid only within a session.
+         */
+        mutable std::vector<bool> trait_bitset; // NOLINT(cata-serialize)
+        /** Whether @ref trait_bitset reflects the current mutation state. */
+        mutable bool trait_bitset_built = false; // NOLINT(cata-serialize)
+        /**
+         * Memoized @ref mutation_value results. The underlying fold over
+         * @ref cached_mutations only changes when a mutation is gained or
+         * lost, but spell and move-cost code queries it constantly.
+         */
+        mutable std::map<std::string, float> mutation_value_cache; // NOLINT(cata-serialize)
+        /**
+         * When the next vitamin decay/generation tick is due. Vitamin rates
+         * come from mutations, so mutation changes reset this to recompute
+         * the schedule.
+         */
+        mutable time_point next_vitamin_tick = calendar::before_time_starts; // NOLINT(cata-serialize)
+        /** Backing store for @ref bionic_fuel_processing_mask. */
+        mutable std::vector<bool> bionic_fuel_mask; // NOLINT(cata-serialize)
+        /** Whether @ref bionic_fuel_mask reflects the installed bionics. */
+        mutable bool bionic_fuel_mask_built = false; // NOLINT(cata-serialize)
+        /** Rebuilds @ref trait_bitset from my_mutations and the enchantment cache. */
+        void rebuild_trait_bitset() const;
         /**
          * The amount of weight the Character is carrying.
          * If it is nullopt, needs to be recalculated
          */
         mutable cata::optional<units::mass> cached_weight_carried = cata::nullopt;
+        /**
+         * Character-intrinsic inputs of @ref fine_detail_vision_mod: effect-based
+         * blindness and the light the character itself emits. Cached because
+         * @ref active_light walks the entire inventory. Dropped on effect and
+         * worn-item changes and refreshed at most once per turn, so a light source
+         * toggled in place is picked up no later than the next turn. The ambient
+         * light term is always evaluated live.
+         */
+        struct fine_detail_vision_cache_t {
+            bool blind = false;
+            float own_light = 0.0f;
+            time_point turn = calendar::before_time_starts;
+        };
+        mutable fine_detail_vision_cache_t fine_detail_vision_cache; // NOLINT(cata-serialize)
 
         void store( JsonOut &json ) const;
         void load( const JsonObject &data );
@@ -3293,14 +3351,62 @@ class Character : public Creature, public visitable
         struct weighted_int_list<std::string> melee_miss_reasons;
 
         struct crafting_cache_type {
-            time_point time;
-            int moves;
+            time_point time = calendar::before_time_starts;
+            int map_items_generation = -1;
             tripoint position;
-            int radius;
+            int radius = -1;
+            // See crafting_inventory_generation.
+            int build_serial = 0;
             pimpl<inventory> crafting_inventory;
         };
         mutable crafting_cache_type crafting_cache;
 
+        // Per-bodypart clothing aggregates for bodytemp, rebuilt whenever the
+        // fingerprint of the worn list changes so in-place worn mutations are
+        // picked up without an explicit invalidation call at every site.
+        struct worn_warmth_cache_type {
+            bool valid = false;
+            size_t worn_fingerprint = 0;
+            // Warmth from wool items, which ignore wetness.
+            std::map<bodypart_id, int> wool_warmth;
+            // Individual warmth values of non-wool items, kept per item so the
+            // wetness scaling and rounding match the uncached math exactly.
+            std::map<bodypart_id, std::vector<int>> nonwool_warmth;
+            // Wind resistance without the active-shell mutation, which is
+            // applied at query time.
+            std::map<bodypart_id, int> wind_resistance;
+            int pocket_warmth = 0;
+            int hood_warmth = 0;
+            int collar_warmth = 0;
+        };
+        mutable worn_warmth_cache_type worn_warmth_cache;
+        const worn_warmth_cache_type &get_worn_warmth_cache() const;
+
+        // Hash of the worn list identity (item addresses, types, damage,
+        // sidedness) used to validate the lazy worn aggregates above and
+        // below without an explicit invalidation call at every site that
+        // mutates worn items.
+        size_t worn_fingerprint() const;
+
+        // Per-flag aggregate over the worn list for worn_with_flag:
+        // whether any worn item has the flag, and the union of body parts
+        // those items cover. Bodytemp and wetness handling ask the same
+        // few flags about every body part every turn.
+        struct worn_flag_cache_entry {
+            bool any = false;
+            body_part_set covered;
+        };
+        mutable size_t worn_flag_fingerprint = 0;
+        mutable std::map<flag_id, worn_flag_cache_entry> worn_flag_cache;
+        const worn_flag_cache_entry &get_worn_flag_cache( const flag_id &f ) const;
+
+        // Hash of everything calc_encumbrance reads: the worn list with
+        // per-item fit/tag state, mutations and bionics. Lets redundant
+        // back-to-back recalculations within a turn be skipped.
+        size_t encumbrance_fingerprint() const;
+        mutable size_t last_encumbrance_fingerprint = 0; // NOLINT(cata-serialize)
+        mutable bool encumbrance_memo_valid = false; // NOLINT(cata-serialize)
+
         time_point melee_warning_turn = calendar::turn_zero;
 
         mutable bool pseudo_items_valid = false;
@@ -3322,6 +3428,13 @@ class Character : public Creature, public visitable
         // a cache of all active enchantment values.
         // is recalculated every turn in Character::recalculate_enchantment_cache
         pimpl<enchantment> enchantment_cache;
+        // The enchantment sources that were active when enchantment_cache was
+        // last rebuilt; when the freshly gathered set matches it, the rebuild
+        // is skipped. See recalculate_enchantment_cache.
+        std::vector<const enchantment *> active_enchantment_sources; // NOLINT(cata-serialize)
+        // False until the first rebuild after construction or loading, so a
+        // character without any enchantments still gets one clean rebuild.
+        bool enchantment_cache_built = false; // NOLINT(cata-serialize)
 };
 
 Character &get_player_character();
@@ -481,23 +481,47 @@ bool Character::is_wearing_on_bp( const itype_id &it, const bodypart_id &bp ) co
     return false;
 }
 
+const Character::worn_flag_cache_entry &Character::get_worn_flag_cache( const flag_id &f ) const
+{
+    const size_t fingerprint = worn_fingerprint();
+    if( worn_flag_fingerprint != fingerprint ) {
+        worn_flag_cache.clear();
+        worn_flag_fingerprint = fingerprint;
+    }
+    auto iter = worn_flag_cache.find( f );
+    if( iter == worn_flag_cache.end() ) {
+        worn_flag_cache_entry entry;
+        for( const item &it : worn ) {
+            if( it.has_flag( f ) ) {
+                entry.any = true;
+                entry.covered.unify_set( it.get_covered_body_parts() );
+            }
+        }
+        iter = worn_flag_cache.emplace( f, entry ).first;
+    }
+    return iter->second;
+}
+
 bool Character::worn_with_flag( const flag_id &f, const bodypart_id &bp ) const
 {
-    return std::any_of( worn.begin(), worn.end(), [&f, bp]( const item & it ) {
-        return it.has_flag( f ) && ( bp == bodypart_str_id::NULL_ID() || it.covers( bp ) );
-    } );
+    const worn_flag_cache_entry &entry = get_worn_flag_cache( f );
+    if( bp == bodypart_str_id::NULL_ID() ) {
+        return entry.any;
+    }
+    return entry.covered.test( bp.id() );
 }
 
 bool Character::worn_with_flag( const flag_id &f ) const
 {
-    return std::any_of( worn.begin(), worn.end(), [&f]( const item & it ) {
-        return it.has_flag( f ) ;
-    } );
+    return get_worn_flag_cache( f ).any;
 }
 
 item Character::item_worn_with_flag( const flag_id &f, const bodypart_id &bp ) const
 {
     item it_with_flag;
+    if( !worn_with_flag( f, bp ) ) {
+        return it_with_flag;
+    }
     for( const item &it : worn ) {
         if( it.has_flag( f ) && ( bp == bodypart_str_id::NULL_ID() || it.covers( bp ) ) ) {
             it_with_flag = it;
@@ -193,27 +193,43 @@ void Character::update_body( const time_point &from, const time_point &to )
         get_sick();
     }
 
-    for( const auto &v : vitamin::all() ) {
-        const time_duration rate = vitamin_rate( v.first );
-
-        // No blood volume regeneration if body lacks fluids
-        if( v.first == vitamin_blood && has_effect( effect_hypovolemia ) && get_thirst() > 240 ) {
-            continue;
-        }
-
-        if( rate > 0_turns ) {
-            int qty = ticks_between( from, to, rate );
-            if( qty > 0 ) {
-                vitamin_mod( v.first, 0 - qty );
+    // Vitamins tick at multiples of each vitamin's rate, so on the turns in
+    // between the loop over all vitamins does nothing. Track when the next
+    // tick is due and skip the whole loop until then. Mutation changes reset
+    // the schedule, since they alter the rates.
+    if( to >= next_vitamin_tick ) {
+        // Cap the look-ahead so a stale schedule cannot defer decay for long.
+        time_point soonest_tick = to + 24_hours;
+        for( const auto &v : vitamin::all() ) {
+            const time_duration rate = vitamin_rate( v.first );
+            if( rate == 0_turns ) {
+                continue;
+            }
+            const int rate_turns = to_turns<int>( rate > 0_turns ? rate : -rate );
+            const time_point vit_next = calendar::turn_zero +
+                                        time_duration::from_turns( ( to_turn<int>( to ) / rate_turns + 1 ) * rate_turns );
+            soonest_tick = std::min( soonest_tick, vit_next );
+
+            // No blood volume regeneration if body lacks fluids
+            if( v.first == vitamin_blood && has_effect( effect_hypovolemia ) && get_thirst() > 240 ) {
+                continue;
             }
 
-        } else if( rate < 0_turns ) {
-            // mutations can result in vitamins being generated (but never accumulated)
-            int qty = ticks_between( from, to, -rate );
-            if( qty > 0 ) {
-                vitamin_mod( v.first, qty );
+            if( rate > 0_turns ) {
+                int qty = ticks_between( from, to, rate );
+                if( qty > 0 ) {
+                    vitamin_mod( v.first, 0 - qty );
+                }
+
+            } else {
+                // mutations can result in vitamins being generated (but never accumulated)
+                int qty = ticks_between( from, to, -rate );
+                if( qty > 0 ) {
+                    vitamin_mod( v.first, qty );
+                }
             }
         }
+        next_vitamin_tick = soonest_tick;
     }
 
     if( is_avatar() && ticks_between( from, to, 24_hours ) > 0 ) {
@@ -279,10 +295,17 @@ void Character::update_bodytemp()
     if( vp ) {
         vehwindspeed = std::abs( vp->vehicle().velocity / 100 ); // vehicle velocity in mph
     }
-    const oter_id &cur_om_ter = overmap_buffer.ter( global_omt_location() );
     bool sheltered = g->is_sheltered( pos() );
-    double total_windpower = get_local_windpower( weather_man.windspeed + vehwindspeed, cur_om_ter,
-                             pos(), weather_man.winddirection, sheltered );
+    double total_windpower;
+    if( vehwindspeed == 0 ) {
+        // Common case, shared through the per-turn cache so the overmap
+        // terrain lookup isn't repeated for every query of this tile.
+        total_windpower = weather_man.get_windpower( pos() );
+    } else {
+        const oter_id &cur_om_ter = overmap_buffer.ter( global_omt_location() );
+        total_windpower = get_local_windpower( weather_man.windspeed + vehwindspeed, cur_om_ter,
+                                               pos(), weather_man.winddirection, sheltered );
+    }
     // Let's cache this not to check it for every bodyparts
     const bool has_bark = has_trait( trait_BARK );
     const bool has_sleep = has_effect( effect_sleep );
@@ -336,19 +359,9 @@ void Character::update_bodytemp()
 
     const int h_radiation = get_heat_radiation( pos(), false );
 
-    std::map<bodypart_id, std::vector<const item *>> clothing_map;
-    for( const bodypart_id &bp : get_all_body_parts() ) {
-        clothing_map.emplace( bp, std::vector<const item *>() );
-    }
-    for( const item &it : worn ) {
-        for( const bodypart_str_id &covered : it.get_covered_body_parts() ) {
-            clothing_map[covered.id()].emplace_back( &it );
-        }
-    }
-
-    std::map<bodypart_id, int> warmth_per_bp = warmth( clothing_map );
+    std::map<bodypart_id, int> warmth_per_bp = warmth();
     std::map<bodypart_id, int> bonus_warmth_per_bp = bonus_item_warmth();
-    std::map<bodypart_id, int> wind_res_per_bp = get_wind_resistance( clothing_map );
+    std::map<bodypart_id, int> wind_res_per_bp = get_wind_resistance();
     // We might not use this at all, so leave it empty
     // If we do need to use it, we'll initialize it (once) there
     std::map<bodypart_id, int> fire_armor_per_bp;
@@ -425,6 +438,15 @@ void Character::update_bodytemp()
             blister_count -= 20;
         }
         if( fire_armor_per_bp.empty() && blister_count > 0 ) {
+            std::map<bodypart_id, std::vector<const item *>> clothing_map;
+            for( const bodypart_id &covered_bp : get_all_body_parts() ) {
+                clothing_map.emplace( covered_bp, std::vector<const item *>() );
+            }
+            for( const item &it : worn ) {
+                for( const bodypart_str_id &covered : it.get_covered_body_parts() ) {
+                    clothing_map[covered.id()].emplace_back( &it );
+                }
+            }
             fire_armor_per_bp = get_armor_fire( clothing_map );
         }
         if( blister_count - fire_armor_per_bp[bp] > 0 ) {
@@ -747,7 +769,6 @@ void Character::update_frostbite( const bodypart_id &bp, const int FBwindPower,
 
 void Character::update_stomach( const time_point &from, const time_point &to )
 {
-    const needs_rates rates = calc_needs_rates();
     // No food/thirst/fatigue clock at all
     const bool debug_ls = has_trait( trait_DEBUG_LS );
     // No food/thirst, capped fatigue clock (only up to tired)
@@ -755,12 +776,15 @@ void Character::update_stomach( const time_point &from, const time_point &to )
     const bool foodless = debug_ls || npc_no_food;
     const bool no_thirst = has_flag( json_flag_NO_THIRST );
     const bool mycus = has_trait( trait_M_DEPENDENT );
-    const float kcal_per_time = get_bmr() / ( 12.0f * 24.0f );
     const int five_mins = ticks_between( from, to, 5_minutes );
     const int half_hours = ticks_between( from, to, 30_minutes );
     const units::volume stomach_capacity = stomach.capacity( *this );
 
     if( five_mins > 0 ) {
+        // Needs rates and the metabolic rate are only consumed by the
+        // digestion step, so don't recompute them on the turns in between.
+        const needs_rates rates = calc_needs_rates();
+        const float kcal_per_time = get_bmr() / ( 12.0f * 24.0f );
         // Digest nutrients in stomach, they are destined for the guts (except water)
         food_summary digested_to_guts = stomach.digest( *this, rates, five_mins, half_hours );
         // Digest nutrients in guts, they will be distributed to needs levels
@@ -779,6 +803,9 @@ void Character::update_stomach( const time_point &from, const time_point &to )
             // Explicitly floor it here, the int cast will do so anyways
             mod_stored_calories( -std::floor( five_mins * kcal_per_time * 1000 ) );
         }
+        if( !foodless && rates.thirst > 0.0f ) {
+            mod_thirst( roll_remainder( rates.thirst * five_mins ) );
+        }
     }
     // if npc_no_food no need to calc hunger, and set hunger_effect
     if( npc_no_food ) {
@@ -825,9 +852,6 @@ void Character::update_stomach( const time_point &from, const time_point &to )
         }
     }
 
-    if( !foodless && rates.thirst > 0.0f ) {
-        mod_thirst( roll_remainder( rates.thirst * five_mins ) );
-    }
     // Mycus and Metabolic Rehydration makes thirst unnecessary
     // since water is not limited by intake but by absorption, we can just set thirst to zero
     if( mycus || no_thirst ) {
@@ -230,6 +230,7 @@ item &Character::i_add( item it, bool /* should_stack */, const item *avoid,
                         const bool allow_wield )
 {
     invalidate_inventory_validity_cache();
+    invalidate_crafting_inventory();
     item *added = try_add( it, avoid, original_inventory_item, allow_wield );
     if( added == nullptr ) {
         if( !allow_wield || !wield( it ) ) {
@@ -2,7 +2,9 @@
 #ifndef CATA_SRC_CHARACTER_MARTIAL_ARTS_H
 #define CATA_SRC_CHARACTER_MARTIAL_ARTS_H
 
+#include <array>
 #include <iosfwd>
+#include <set>
 #include <vector>
 
 #include "martialarts.h"
@@ -20,6 +22,18 @@ class character_martial_arts
         std::vector<matype_id> ma_styles;
         matype_id style_selected = matype_id( "style_none" );
         bool keep_hands_free = false;
+
+        /**
+         * Lazy cache for get_offense_techniques: technique candidates that
+         * can ever be picked as an attack, bucketed by (dodge counter,
+         * block counter) class. Rebuilt when the selected style or the
+         * wielded weapon's technique set changes.
+         */
+        mutable std::array<std::vector<matec_id>, 4> offense_techniques; // NOLINT(cata-serialize)
+        // Inputs offense_techniques was built from.
+        mutable matype_id offense_cache_style; // NOLINT(cata-serialize)
+        mutable std::set<matec_id> offense_cache_weapon_techs; // NOLINT(cata-serialize)
+        mutable bool offense_cache_valid = false; // NOLINT(cata-serialize)
     public:
         character_martial_arts();
         character_martial_arts( const std::vector<matype_id> &styles,
@@ -86,6 +100,14 @@ class character_martial_arts
         bool is_force_unarmed() const;
 
         std::vector<matec_id> get_all_techniques( const item &weap ) const;
+        /**
+         * Technique candidates for Character::pick_technique: dummy and
+         * defensive techniques are filtered out once per style/weapon
+         * change instead of per attack, and only the bucket matching the
+         * requested counter class is returned.
+         */
+        const std::vector<matec_id> &get_offense_techniques( const item &weap,
+                bool dodge_counter, bool block_counter ) const;
         std::vector<matype_id> get_unknown_styles( const character_martial_arts &from ) const;
         /** Returns true if the player has a weapon or martial arts skill available with the entered technique */
         bool has_technique( const Character &guy, const matec_id &id, const item &weap ) const;
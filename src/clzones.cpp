@@ -102,6 +102,8 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_bounds.clear();
+    vzone_bounds.clear();
 }
 
 std::string zone_type::name() const
@@ -571,9 +573,43 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
     return type_iter != area_cache.end();
 }
 
+static void expand_bounds( std::unordered_map<std::string, std::pair<tripoint, tripoint>> &bounds,
+                           const std::string &type_hash, const tripoint &start, const tripoint &end )
+{
+    const auto iter = bounds.find( type_hash );
+    if( iter == bounds.end() ) {
+        bounds.emplace( type_hash, std::make_pair( start, end ) );
+    } else {
+        tripoint &min = iter->second.first;
+        tripoint &max = iter->second.second;
+        min.x = std::min( min.x, start.x );
+        min.y = std::min( min.y, start.y );
+        min.z = std::min( min.z, start.z );
+        max.x = std::max( max.x, end.x );
+        max.y = std::max( max.y, end.y );
+        max.z = std::max( max.z, end.z );
+    }
+}
+
+// Fast rejection for the distance-scanning queries: false when no point of
+// the type's bounding box can be within the given square distance of where.
+static bool bounds_in_range( const std::unordered_map<std::string, std::pair<tripoint, tripoint>>
+                             &bounds, const std::string &type_hash, const tripoint &where, int range )
+{
+    const auto iter = bounds.find( type_hash );
+    if( iter == bounds.end() ) {
+        return false;
+    }
+    const tripoint &min = iter->second.first;
+    const tripoint &max = iter->second.second;
+    return where.x >= min.x - range && where.x <= max.x + range &&
+           where.y >= min.y - range && where.y <= max.y + range;
+}
+
 void zone_manager::cache_data()
 {
     area_cache.clear();
+    area_bounds.clear();
 
     for( const zone_data &elem : zones ) {
         if( !elem.get_enabled() ) {
@@ -582,6 +618,7 @@ void zone_manager::cache_data()
 
         const std::string &type_hash = elem.get_type_hash();
         auto &cache = area_cache[type_hash];
+        expand_bounds( area_bounds, type_hash, elem.get_start_point(), elem.get_end_point() );
 
         // Draw marked area
         for( const tripoint &p : tripoint_range<tripoint>( elem.get_start_point(),
@@ -594,6 +631,7 @@ void zone_manager::cache_data()
 void zone_manager::cache_vzones()
 {
     vzone_cache.clear();
+    vzone_bounds.clear();
     map &here = get_map();
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z );
     for( zone_data *elem : vzones ) {
@@ -603,6 +641,7 @@ void zone_manager::cache_vzones()
 
         const std::string &type_hash = elem->get_type_hash();
         auto &cache = vzone_cache[type_hash];
+        expand_bounds( vzone_bounds, type_hash, elem->get_start_point(), elem->get_end_point() );
 
         // TODO: looks very similar to the above cache_data - maybe merge it?
 
@@ -614,12 +653,13 @@ void zone_manager::cache_vzones()
     }
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint> empty_point_set;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return empty_point_set;
     }
 
     return type_iter->second;
@@ -650,13 +690,14 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint> empty_point_set;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return empty_point_set;
     }
 
     return type_iter->second;
@@ -673,20 +714,25 @@ bool zone_manager::has( const zone_type_id &type, const tripoint &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    if( bounds_in_range( area_bounds, type_hash, where, range ) ) {
+        const auto &point_set = get_point_set( type, fac );
+        for( const tripoint &point : point_set ) {
+            if( point.z == where.z ) {
+                if( square_dist( point, where ) <= range ) {
+                    return true;
+                }
             }
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
+    if( bounds_in_range( vzone_bounds, type_hash, where, range ) ) {
+        const auto &vzone_set = get_vzone_set( type, fac );
+        for( const tripoint &point : vzone_set ) {
+            if( point.z == where.z ) {
+                if( square_dist( point, where ) <= range ) {
+                    return true;
+                }
             }
         }
     }
@@ -744,33 +790,38 @@ bool zone_manager::custom_loot_has( const tripoint &where, const item *it ) cons
 std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
         const tripoint &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
     auto near_point_set = std::unordered_set<tripoint>();
 
-    for( const tripoint &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
-                    if( custom_loot_has( point, it ) ) {
+    if( bounds_in_range( area_bounds, type_hash, where, range ) ) {
+        const auto &point_set = get_point_set( type, fac );
+        for( const tripoint &point : point_set ) {
+            if( point.z == where.z ) {
+                if( square_dist( point, where ) <= range ) {
+                    if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
+                        if( custom_loot_has( point, it ) ) {
+                            near_point_set.insert( point );
+                        }
+                    } else {
                         near_point_set.insert( point );
                     }
-                } else {
-                    near_point_set.insert( point );
                 }
             }
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
-                    if( custom_loot_has( point, it ) ) {
+    if( bounds_in_range( vzone_bounds, type_hash, where, range ) ) {
+        const auto &vzone_set = get_vzone_set( type, fac );
+        for( const tripoint &point : vzone_set ) {
+            if( point.z == where.z ) {
+                if( square_dist( point, where ) <= range ) {
+                    if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
+                        if( custom_loot_has( point, it ) ) {
+                            near_point_set.insert( point );
+                        }
+                    } else {
                         near_point_set.insert( point );
                     }
-                } else {
-                    near_point_set.insert( point );
                 }
             }
         }
@@ -788,26 +839,31 @@ cata::optional<tripoint> zone_manager::get_nearest( const zone_type_id &type, co
 
     tripoint nearest_pos = tripoint( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint> &point_set = get_point_set( type, fac );
-    for( const tripoint &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    if( bounds_in_range( area_bounds, type_hash, where, range ) ) {
+        const std::unordered_set<tripoint> &point_set = get_point_set( type, fac );
+        for( const tripoint &p : point_set ) {
+            int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
 
-    const std::unordered_set<tripoint> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    if( bounds_in_range( vzone_bounds, type_hash, where, range ) ) {
+        const std::unordered_set<tripoint> &vzone_set = get_vzone_set( type, fac );
+        for( const tripoint &p : vzone_set ) {
+            int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
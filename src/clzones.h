@@ -361,9 +361,16 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint>> vzone_cache;
-        std::unordered_set<tripoint> get_point_set( const zone_type_id &type,
+        // Bounding boxes of the cached point sets, so the distance-scanning
+        // queries can reject types whose zones are all out of range without
+        // touching the sets themselves.
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::pair<tripoint, tripoint>> area_bounds;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, std::pair<tripoint, tripoint>> vzone_bounds;
+        const std::unordered_set<tripoint> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
 
     public:
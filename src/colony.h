@@ -2409,6 +2409,19 @@ class colony : private element_allocator_type
             blank();
         }
 
+        /**
+         * Releases any memory blocks still held by an empty colony. Erasing
+         * the final element deliberately keeps the group around for reuse;
+         * call this when the colony is expected to stay empty so it owns no
+         * allocation at all. Does nothing if elements are present.
+         */
+        inline void trim() noexcept {
+            if( total_number_of_elements == 0 && begin_iterator.group_pointer != nullptr ) {
+                destroy_all_data();
+                blank();
+            }
+        }
+
         /**
          * Copy assignment:
          * Copy the elements from another colony to this colony, clearing this colony of existing
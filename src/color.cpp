@@ -39,8 +39,14 @@ color_manager &get_all_colors()
 
 static std::unordered_map<std::string, note_color> color_by_string_map;
 
+// Memoized tag-name lookups for get_color_from_tag; every sidebar and menu
+// redraw re-parses the same few dozen tags. Cleared by finalize() so color
+// customization takes effect.
+static std::unordered_map<std::string, nc_color> color_tag_memo;
+
 void color_manager::finalize()
 {
+    color_tag_memo.clear();
     static const std::array<std::string, NUM_HL> hilights = {{
             "",
             "red",
@@ -642,8 +648,15 @@ color_tag_parse_result get_color_from_tag( const std::string &s,
         return { color_tag_parse_result::non_color_tag, {} };
     }
     std::string color_name = s.substr( 7, tag_close - 7 );
+    const auto found = color_tag_memo.find( color_name );
+    if( found != color_tag_memo.end() ) {
+        return { color_tag_parse_result::open_color_tag, found->second };
+    }
     const nc_color color = color_from_string( color_name, color_error );
     if( color != c_unset ) {
+        // Only successful parses are memoized, so invalid tags keep
+        // reporting through color_from_string.
+        color_tag_memo.emplace( std::move( color_name ), color );
         return { color_tag_parse_result::open_color_tag, color };
     } else {
         return { color_tag_parse_result::non_color_tag, color };
@@ -113,16 +113,12 @@ void read_condition( const JsonObject &jo, const std::string &member_name,
         condition = null_function;
     } else if( jo.has_string( member_name ) ) {
         const std::string type = jo.get_string( member_name );
-        conditional_t<T> sub_condition( type );
-        condition = [sub_condition]( const T & d ) {
-            return sub_condition( d );
-        };
+        const conditional_t<T> sub_condition( type );
+        condition = sub_condition.get_condition();
     } else if( jo.has_object( member_name ) ) {
         JsonObject con_obj = jo.get_object( member_name );
-        conditional_t<T> sub_condition( con_obj );
-        condition = [sub_condition]( const T & d ) {
-            return sub_condition( d );
-        };
+        const conditional_t<T> sub_condition( con_obj );
+        condition = sub_condition.get_condition();
     } else {
         jo.throw_error( "invalid condition syntax", member_name );
     }
@@ -1310,7 +1306,7 @@ void conditional_t<T>::set_is_in_field( const JsonObject &jo, const std::string
     condition = [field_type, is_npc]( const T & d ) {
         map &here = get_map();
         field_type_id ft = field_type_id( field_type );
-        for( const std::pair<const field_type_id, field_entry> &f : here.field_at( d.actor(
+        for( const std::pair<field_type_id, field_entry> &f : here.field_at( d.actor(
                     is_npc )->pos() ) ) {
             if( f.second.get_field_type() == ft ) {
                 return true;
@@ -1326,22 +1322,24 @@ conditional_t<T>::conditional_t( const JsonObject &jo )
     // improve the clarity of NPC setter functions
     const bool is_npc = true;
     bool found_sub_member = false;
+    // Store the extracted closures rather than whole conditional_t objects so
+    // evaluating a combinator doesn't pay an extra wrapper call per operand.
     const auto parse_array = []( const JsonObject & jo, const std::string & type ) {
-        std::vector<conditional_t> conditionals;
+        std::vector<std::function<bool( const T & )>> conditionals;
         for( const JsonValue entry : jo.get_array( type ) ) {
             if( entry.test_string() ) {
-                conditional_t<T> type_condition( entry.get_string() );
-                conditionals.emplace_back( type_condition );
+                const conditional_t<T> type_condition( entry.get_string() );
+                conditionals.emplace_back( type_condition.get_condition() );
             } else {
                 JsonObject cond = entry.get_object();
-                conditional_t<T> type_condition( cond );
-                conditionals.emplace_back( type_condition );
+                const conditional_t<T> type_condition( cond );
+                conditionals.emplace_back( type_condition.get_condition() );
             }
         }
         return conditionals;
     };
     if( jo.has_array( "and" ) ) {
-        std::vector<conditional_t> and_conditionals = parse_array( jo, "and" );
+        std::vector<std::function<bool( const T & )>> and_conditionals = parse_array( jo, "and" );
         found_sub_member = true;
         condition = [and_conditionals]( const T & d ) {
             for( const auto &cond : and_conditionals ) {
@@ -1352,7 +1350,7 @@ conditional_t<T>::conditional_t( const JsonObject &jo )
             return true;
         };
     } else if( jo.has_array( "or" ) ) {
-        std::vector<conditional_t> or_conditionals = parse_array( jo, "or" );
+        std::vector<std::function<bool( const T & )>> or_conditionals = parse_array( jo, "or" );
         found_sub_member = true;
         condition = [or_conditionals]( const T & d ) {
             for( const auto &cond : or_conditionals ) {
@@ -1366,14 +1364,14 @@ conditional_t<T>::conditional_t( const JsonObject &jo )
         JsonObject cond = jo.get_object( "not" );
         const conditional_t<T> sub_condition = conditional_t<T>( cond );
         found_sub_member = true;
-        condition = [sub_condition]( const T & d ) {
-            return !sub_condition( d );
+        condition = [sub = sub_condition.get_condition()]( const T & d ) {
+            return !sub( d );
         };
     } else if( jo.has_string( "not" ) ) {
         const conditional_t<T> sub_condition = conditional_t<T>( jo.get_string( "not" ) );
         found_sub_member = true;
-        condition = [sub_condition]( const T & d ) {
-            return !sub_condition( d );
+        condition = [sub = sub_condition.get_condition()]( const T & d ) {
+            return !sub( d );
         };
     }
     if( !found_sub_member ) {
@@ -1526,9 +1524,7 @@ conditional_t<T>::conditional_t( const JsonObject &jo )
         for( const std::string &sub_member : dialogue_data::simple_string_conds ) {
             if( jo.has_string( sub_member ) ) {
                 const conditional_t<T> sub_condition( jo.get_string( sub_member ) );
-                condition = [sub_condition]( const T & d ) {
-                    return sub_condition( d );
-                };
+                condition = sub_condition.get_condition();
                 found_sub_member = true;
                 break;
             }
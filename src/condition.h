@@ -219,6 +219,21 @@ struct conditional_t {
             }
             return condition( d );
         }
+
+        /**
+         * Extract the compiled closure so callers can invoke it directly
+         * instead of keeping this wrapper object alive as one more layer of
+         * indirection.  Conditions that failed to parse become a constant
+         * false, matching operator().
+         */
+        std::function<bool( const T & )> get_condition() const {
+            if( !condition ) {
+                return []( const T & ) {
+                    return false;
+                };
+            }
+            return condition;
+        }
 };
 
 #if !defined(MACOSX)
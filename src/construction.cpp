@@ -138,6 +138,10 @@ void failure_deconstruct( const tripoint & );
 
 static std::vector<construction> constructions;
 static std::map<construction_str_id, construction_id> construction_id_map;
+// group -> member constructions, built at finalization so the menu does not
+// rescan the whole list for every group query
+static std::map<construction_group_str_id, std::vector<construction *>>
+        constructions_by_group_map;
 
 // Helper functions, nobody but us needs to call these.
 static bool can_construct( const construction_group_str_id &group );
@@ -195,13 +199,11 @@ static std::vector<construction *> constructions_by_group( const construction_gr
         debugmsg( "constructions_by_group called before finalization" );
         return {};
     }
-    std::vector<construction *> result;
-    for( auto &constructions_a : constructions ) {
-        if( constructions_a.group == group ) {
-            result.push_back( &constructions_a );
-        }
+    const auto it = constructions_by_group_map.find( group );
+    if( it == constructions_by_group_map.end() ) {
+        return {};
     }
-    return result;
+    return it->second;
 }
 
 static void load_available_constructions( std::vector<construction_group_str_id> &available,
@@ -333,6 +335,10 @@ construction_id construction_menu( const bool blueprint )
     bool exit = false;
     construction_category_id category_id;
     std::vector<construction_group_str_id> constructs;
+    // Nothing the availability colors depend on (map, inventory, skills) can
+    // change while the menu is open, so compute each group's color once per
+    // session instead of once per list row per redraw.
+    std::map<construction_group_str_id, nc_color> color_cache;
     //storage for the color text so it can be scrolled
     std::vector< std::vector < std::string > > construct_buffers;
     std::vector<std::string> full_construct_buffer;
@@ -578,8 +584,13 @@ construction_id construction_menu( const bool blueprint )
             if( highlight ) {
                 cursor_pos = print_from;
             }
+            auto col_iter = color_cache.find( group );
+            if( col_iter == color_cache.end() ) {
+                col_iter = color_cache.emplace( group, construction_color( group, false ) ).first;
+            }
+            const nc_color col = col_iter->second;
             trim_and_print( w_list, print_from, w_list_width,
-                            construction_color( group, highlight ), group->name() );
+                            highlight ? hilite( col ) : col, group->name() );
         }
 
         // Clear out lines for tools & materials
@@ -1701,6 +1712,7 @@ void reset_constructions()
 {
     constructions.clear();
     construction_id_map.clear();
+    constructions_by_group_map.clear();
     finalized = false;
 }
 
@@ -1857,6 +1869,11 @@ void finalize_constructions()
         construction_id_map.emplace( constructions[i].str_id, constructions[i].id );
     }
 
+    constructions_by_group_map.clear();
+    for( construction &con : constructions ) {
+        constructions_by_group_map[con.group].push_back( &con );
+    }
+
     finalized = true;
 }
 
@@ -1762,6 +1762,8 @@ static bool consume_med( item &target, Character &you )
 
 trinary Character::consume( item &target, bool force, bool refuel )
 {
+    // consuming drains charges of a carried item in place
+    invalidate_crafting_inventory();
     if( target.is_null() ) {
         add_msg_if_player( m_info, _( "You do not have that item." ) );
         return trinary::NONE;
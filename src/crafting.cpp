@@ -545,10 +545,14 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     if( src_pos == tripoint_zero ) {
         inv_pos = pos();
     }
-    if( moves == crafting_cache.moves
+    // The cache survives until something changes the nearby item stacks
+    // (tracked by the map items generation counter) or mutates the character
+    // side of the inventory (those paths call invalidate_crafting_inventory,
+    // which resets the build time sentinel).
+    if( crafting_cache.time != calendar::before_time_starts
         && radius == crafting_cache.radius
-        && calendar::turn == crafting_cache.time
-        && inv_pos == crafting_cache.position ) {
+        && inv_pos == crafting_cache.position
+        && get_map().get_items_generation() == crafting_cache.map_items_generation ) {
         return *crafting_cache.crafting_inventory;
     }
     crafting_cache.crafting_inventory->clear();
@@ -575,10 +579,11 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
         *crafting_cache.crafting_inventory += item( "shovel", calendar::turn );
     }
 
-    crafting_cache.moves = moves;
+    crafting_cache.map_items_generation = get_map().get_items_generation();
     crafting_cache.time = calendar::turn;
     crafting_cache.position = inv_pos;
     crafting_cache.radius = radius;
+    crafting_cache.build_serial++;
     return *crafting_cache.crafting_inventory;
 }
 
@@ -587,6 +592,14 @@ void Character::invalidate_crafting_inventory()
     crafting_cache.time = calendar::before_time_starts;
 }
 
+int Character::crafting_inventory_generation() const
+{
+    // Refresh first so a stale cache is rebuilt (and the serial bumped)
+    // before callers compare against their remembered value.
+    crafting_inventory();
+    return crafting_cache.build_serial;
+}
+
 void Character::make_craft( const recipe_id &id_to_make, int batch_size,
                             const cata::optional<tripoint> &loc )
 {
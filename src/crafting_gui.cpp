@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <iterator>
@@ -165,12 +166,18 @@ struct availability {
         has_proficiencies = r->character_has_required_proficiencies( player );
         can_craft = ( !r->is_practice() || has_all_skills ) && has_proficiencies &&
                     req.can_make_with_inventory( inv, all_items_filter, batch_size, craft_flags::start_only );
-        would_use_rotten = !req.can_make_with_inventory( inv, no_rotten_filter, batch_size,
+        // Only shown for craftable recipes, so don't pay for a second full
+        // requirement evaluation when the recipe can't be crafted anyway.
+        would_use_rotten = can_craft && !req.can_make_with_inventory( inv, no_rotten_filter, batch_size,
                            craft_flags::start_only );
         would_not_benefit = r->is_practice() && cannot_gain_skill_or_prof( player, *r );
-        const requirement_data &simple_req = r->simple_requirements();
-        apparently_craftable = ( !r->is_practice() || has_all_skills ) && has_proficiencies &&
-                               simple_req.can_make_with_inventory( inv, all_items_filter, batch_size, craft_flags::start_only );
+        if( can_craft ) {
+            apparently_craftable = true;
+        } else {
+            const requirement_data &simple_req = r->simple_requirements();
+            apparently_craftable = ( !r->is_practice() || has_all_skills ) && has_proficiencies &&
+                                   simple_req.can_make_with_inventory( inv, all_items_filter, batch_size, craft_flags::start_only );
+        }
         proficiency_time_maluses = r->proficiency_time_maluses( player );
         proficiency_failure_maluses = r->proficiency_failure_maluses( player );
         for( const std::pair<const skill_id, int> &e : r->required_skills ) {
@@ -209,8 +216,119 @@ struct availability {
         }
     }
 };
+
+// Availability entries kept across invocations of the crafting menu, together
+// with snapshots of the inputs they were computed against.
+struct availability_cache_type {
+    std::map<const recipe *, availability> entries;
+    // per itype: number of binned items and their total charges
+    std::map<itype_id, std::pair<int, int>> item_summary;
+    std::map<quality_id, std::map<int, int>> quality_summary;
+    tripoint position;
+    time_point turn = calendar::before_time_starts;
+    uint64_t character_key = 0;
+};
+
+availability_cache_type avail_cache;
+
+// Hash of the character state that feeds into recipe availability besides the
+// crafting inventory itself.
+uint64_t character_crafting_key( const Character &guy )
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const auto mix_string = [&hash]( const std::string & s ) {
+        for( const char c : s ) {
+            hash ^= static_cast<unsigned char>( c );
+            hash *= 1099511628211ULL;
+        }
+        hash ^= 0xFF;
+        hash *= 1099511628211ULL;
+    };
+    for( const auto &sk : guy.get_all_skills() ) {
+        mix_string( sk.first.str() );
+        hash ^= static_cast<uint64_t>( sk.second.level() );
+        hash *= 1099511628211ULL;
+    }
+    for( const proficiency_id &prof : guy.known_proficiencies() ) {
+        mix_string( prof.str() );
+    }
+    for( const trait_id &mut : guy.get_mutations() ) {
+        mix_string( mut.str() );
+    }
+    return hash;
+}
+
+// Drops the cached availability entries whose inputs changed since they were
+// computed, using the reverse indices built at recipe finalization, then
+// stores the current inputs as the new snapshots.
+void prune_availability_cache( const Character &guy, const inventory &inv )
+{
+    const uint64_t character_key = character_crafting_key( guy );
+    if( character_key != avail_cache.character_key || guy.pos() != avail_cache.position ) {
+        avail_cache.entries.clear();
+    }
+    std::map<itype_id, std::pair<int, int>> item_summary;
+    for( const auto &bin : inv.get_binned_items() ) {
+        std::pair<int, int> &summary = item_summary[bin.first];
+        summary.first += static_cast<int>( bin.second.size() );
+        for( const item *it : bin.second ) {
+            summary.second += it->charges;
+        }
+    }
+    const std::map<quality_id, std::map<int, int>> &quality_summary = inv.get_quality_summary();
+    if( !avail_cache.entries.empty() ) {
+        const auto drop_itype = [&]( const itype_id & id ) {
+            for( const recipe *rec : recipe_dict.recipes_using_itype( id ) ) {
+                avail_cache.entries.erase( rec );
+            }
+        };
+        const auto drop_quality = [&]( const quality_id & id ) {
+            for( const recipe *rec : recipe_dict.recipes_using_quality( id ) ) {
+                avail_cache.entries.erase( rec );
+            }
+        };
+        for( const auto &entry : item_summary ) {
+            const auto old = avail_cache.item_summary.find( entry.first );
+            if( old == avail_cache.item_summary.end() || old->second != entry.second ) {
+                drop_itype( entry.first );
+            }
+        }
+        for( const auto &entry : avail_cache.item_summary ) {
+            if( !item_summary.count( entry.first ) ) {
+                drop_itype( entry.first );
+            }
+        }
+        for( const auto &entry : quality_summary ) {
+            const auto old = avail_cache.quality_summary.find( entry.first );
+            if( old == avail_cache.quality_summary.end() || old->second != entry.second ) {
+                drop_quality( entry.first );
+            }
+        }
+        for( const auto &entry : avail_cache.quality_summary ) {
+            if( !quality_summary.count( entry.first ) ) {
+                drop_quality( entry.first );
+            }
+        }
+        if( calendar::turn != avail_cache.turn ) {
+            // perishable components may have rotted with no count change
+            for( const recipe *rec : recipe_dict.recipes_with_perishable_components() ) {
+                avail_cache.entries.erase( rec );
+            }
+        }
+    }
+    avail_cache.item_summary = std::move( item_summary );
+    avail_cache.quality_summary = quality_summary;
+    avail_cache.position = guy.pos();
+    avail_cache.turn = calendar::turn;
+    avail_cache.character_key = character_key;
+}
 } // namespace
 
+void reset_recipe_availability_cache()
+{
+    avail_cache = availability_cache_type();
+}
+
 static std::vector<std::string> recipe_info(
     const recipe &recp,
     const availability &avail,
@@ -599,7 +717,8 @@ const recipe *select_crafting_recipe( int &batch_size_out )
     std::string filterstring;
 
     const auto &available_recipes = player_character.get_available_recipes( crafting_inv, &helpers );
-    std::map<const recipe *, availability> availability_cache;
+    prune_availability_cache( player_character, crafting_inv );
+    std::map<const recipe *, availability> &availability_cache = avail_cache.entries;
 
     const std::string new_recipe_str = pgettext( "crafting gui", "NEW!" );
     const nc_color new_recipe_str_col = c_light_green;
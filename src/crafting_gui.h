@@ -13,6 +13,10 @@ const recipe *select_crafting_recipe( int &batch_size_out );
 void load_recipe_category( const JsonObject &jsobj );
 void reset_recipe_categories();
 
+// Drops all cached recipe availability; required when the recipes
+// themselves are unloaded or reloaded.
+void reset_recipe_availability_cache();
+
 // Returns nullptr if the category does not exist, or a pointer to its vector
 // of subcategories it the category does exist
 const std::vector<std::string> *subcategories_for_category( const std::string &category );
@@ -55,6 +55,10 @@ extern "C" {
         // reasons, including the memory allocations and the SDL message box.
         // But it should usually work in practice, unless for example the
         // program segfaults inside malloc.
+
+        // Drain buffered debug log lines first; the log tail is often the
+        // best clue to what went wrong.
+        flushDebugLog();
 #if defined(_WIN32)
         dump_to( ".core" );
 #endif
@@ -241,12 +241,8 @@ bool Creature::is_ranged_attacker() const
 
     const monster *mon = as_monster();
     if( mon ) {
-        for( const std::pair<const std::string, mtype_special_attack> &attack :
-             mon->type->special_attacks ) {
-            if( attack.second->id == "gun" ) {
-                return true;
-            }
-        }
+        // Derived from the special attacks at finalize.
+        return mon->type->ranged_attacker;
     }
     //TODO Potentially add check for this as npc wielding ranged weapon
 
@@ -1512,18 +1508,22 @@ void Creature::process_effects()
                 on_effect_int_change( e.get_id(), e.get_intensity(), e.get_bp() );
             }
 
-            const bool reduced = resists_effect( e );
-            if( e.kill_roll( reduced ) ) {
-                add_msg_if_player( m_bad, e.get_death_message() );
-                if( is_avatar() ) {
-                    std::map<std::string, cata_variant> event_data;
-                    std::pair<std::string, cata_variant> data_obj( "character",
-                            cata_variant::make<cata_variant_type::character_id>( as_character()->getID() ) );
-                    event_data.insert( data_obj );
-                    cata::event sent( e.death_event(), calendar::turn, std::move( event_data ) );
-                    get_event_bus().send( sent );
+            // Checking effect resistance just to feed kill_roll is wasted
+            // work for the vast majority of effects, which cannot kill.
+            if( e.has_kill_chance() ) {
+                const bool reduced = resists_effect( e );
+                if( e.kill_roll( reduced ) ) {
+                    add_msg_if_player( m_bad, e.get_death_message() );
+                    if( is_avatar() ) {
+                        std::map<std::string, cata_variant> event_data;
+                        std::pair<std::string, cata_variant> data_obj( "character",
+                                cata_variant::make<cata_variant_type::character_id>( as_character()->getID() ) );
+                        event_data.insert( data_obj );
+                        cata::event sent( e.death_event(), calendar::turn, std::move( event_data ) );
+                        get_event_bus().send( sent );
+                    }
+                    die( e.get_source().resolve_creature() );
                 }
-                die( e.get_source().resolve_creature() );
             }
         }
     }
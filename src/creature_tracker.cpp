@@ -88,11 +88,114 @@ bool creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
+    weak_monsters_list.reset();
+    generation_++;
     monsters_by_location[critter.get_location()] = critter_ptr;
+    add_to_spatial_map( critter.get_location(), critter_ptr );
     add_to_faction_map( critter_ptr );
     return true;
 }
 
+void creature_tracker::add_to_spatial_map( const tripoint_abs_ms &pos,
+        const shared_ptr_fast<monster> &critter_ptr )
+{
+    monsters_by_submap_[project_to<coords::sm>( pos )].push_back( critter_ptr );
+}
+
+void creature_tracker::remove_from_spatial_map( const tripoint_abs_ms &pos,
+        const monster &critter )
+{
+    const auto find_in_bucket = [&critter]( std::vector<shared_ptr_fast<monster>> &bucket ) {
+        return std::find_if( bucket.begin(), bucket.end(),
+        [&critter]( const shared_ptr_fast<monster> &ptr ) {
+            return ptr.get() == &critter;
+        } );
+    };
+    const auto bucket_iter = monsters_by_submap_.find( project_to<coords::sm>( pos ) );
+    if( bucket_iter != monsters_by_submap_.end() ) {
+        const auto iter = find_in_bucket( bucket_iter->second );
+        if( iter != bucket_iter->second.end() ) {
+            bucket_iter->second.erase( iter );
+            if( bucket_iter->second.empty() ) {
+                monsters_by_submap_.erase( bucket_iter );
+            }
+            return;
+        }
+    }
+
+    // As in remove_from_location_map, the monster may be filed under a
+    // stale position, so fall back to scanning every bucket.
+    for( auto it = monsters_by_submap_.begin(); it != monsters_by_submap_.end(); ++it ) {
+        const auto iter = find_in_bucket( it->second );
+        if( iter != it->second.end() ) {
+            it->second.erase( iter );
+            if( it->second.empty() ) {
+                monsters_by_submap_.erase( it );
+            }
+            return;
+        }
+    }
+}
+
+std::vector<shared_ptr_fast<monster>> creature_tracker::find_in_radius(
+                                       const tripoint_abs_ms &center, const int radius ) const
+{
+    std::vector<shared_ptr_fast<monster>> result;
+    const tripoint_abs_sm center_sm = project_to<coords::sm>( center );
+    // Covers the worst-case offset of the center within its submap.
+    const int bucket_radius = radius / SEEX + 1;
+    const int min_z = std::max( center.z() - radius, -OVERMAP_DEPTH );
+    const int max_z = std::min( center.z() + radius, OVERMAP_HEIGHT );
+    for( int z = min_z; z <= max_z; z++ ) {
+        for( int x = center_sm.x() - bucket_radius; x <= center_sm.x() + bucket_radius; x++ ) {
+            for( int y = center_sm.y() - bucket_radius; y <= center_sm.y() + bucket_radius; y++ ) {
+                const auto bucket_iter = monsters_by_submap_.find( tripoint_abs_sm( x, y, z ) );
+                if( bucket_iter == monsters_by_submap_.end() ) {
+                    continue;
+                }
+                for( const shared_ptr_fast<monster> &mon_ptr : bucket_iter->second ) {
+                    if( !mon_ptr->is_dead() && rl_dist( mon_ptr->get_location(), center ) <= radius ) {
+                        result.push_back( mon_ptr );
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+bool creature_tracker::any_in_aabb( const tripoint_abs_ms &min, const tripoint_abs_ms &max ) const
+{
+    const auto in_box = [&min, &max]( const tripoint_abs_ms & pos ) {
+        return pos.x() >= min.x() && pos.x() <= max.x() &&
+               pos.y() >= min.y() && pos.y() <= max.y() &&
+               pos.z() >= min.z() && pos.z() <= max.z();
+    };
+    for( const shared_ptr_fast<npc> &guy : active_npc ) {
+        if( !guy->is_dead() && in_box( guy->get_location() ) ) {
+            return true;
+        }
+    }
+    const tripoint_abs_sm min_sm = project_to<coords::sm>( min );
+    const tripoint_abs_sm max_sm = project_to<coords::sm>( max );
+    for( int z = min_sm.z(); z <= max_sm.z(); z++ ) {
+        for( int x = min_sm.x(); x <= max_sm.x(); x++ ) {
+            for( int y = min_sm.y(); y <= max_sm.y(); y++ ) {
+                const auto bucket_iter = monsters_by_submap_.find( tripoint_abs_sm( x, y, z ) );
+                if( bucket_iter == monsters_by_submap_.end() ) {
+                    continue;
+                }
+                for( const shared_ptr_fast<monster> &mon_ptr : bucket_iter->second ) {
+                    if( !mon_ptr->is_dead() && in_box( mon_ptr->get_location() ) ) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
 void creature_tracker::add_to_faction_map( const shared_ptr_fast<monster> &critter_ptr )
 {
     cata_assert( critter_ptr );
@@ -112,6 +215,16 @@ size_t creature_tracker::size() const
     return monsters_list.size();
 }
 
+const shared_ptr_fast<std::vector<weak_ptr_fast<monster>>>
+&creature_tracker::get_weak_monsters_list()
+{
+    if( !weak_monsters_list ) {
+        weak_monsters_list = make_shared_fast<std::vector<weak_ptr_fast<monster>>>(
+                                 monsters_list.begin(), monsters_list.end() );
+    }
+    return weak_monsters_list;
+}
+
 bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms &old_pos,
                                    const tripoint_abs_ms &new_pos )
 {
@@ -140,6 +253,9 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
     if( iter != monsters_list.end() ) {
         monsters_by_location.erase( old_pos );
         monsters_by_location[new_pos] = *iter;
+        remove_from_spatial_map( old_pos, critter );
+        add_to_spatial_map( new_pos, *iter );
+        generation_++;
         return true;
     } else {
         // We're changing the x/y/z coordinates of a zombie that hasn't been added
@@ -154,6 +270,8 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
 
 void creature_tracker::remove_from_location_map( const monster &critter )
 {
+    remove_from_spatial_map( critter.get_location(), critter );
+
     const auto pos_iter = monsters_by_location.find( critter.get_location() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
         monsters_by_location.erase( pos_iter );
@@ -195,22 +313,63 @@ void creature_tracker::remove( const monster &critter )
     remove_from_location_map( critter );
     removed_.push_back( *iter );
     monsters_list.erase( iter );
+    weak_monsters_list.reset();
+    generation_++;
+}
+
+std::vector<shared_ptr_fast<monster>> creature_tracker::remove_if(
+                                       const std::function<bool( const monster & )> &predicate )
+{
+    std::vector<shared_ptr_fast<monster>> removed;
+    const auto first_removed = std::stable_partition( monsters_list.begin(), monsters_list.end(),
+    [&]( const shared_ptr_fast<monster> &ptr ) {
+        return !predicate( *ptr );
+    } );
+    if( first_removed == monsters_list.end() ) {
+        return removed;
+    }
+    removed.assign( first_removed, monsters_list.end() );
+    monsters_list.erase( first_removed, monsters_list.end() );
+    for( const shared_ptr_fast<monster> &ptr : removed ) {
+        const monster &critter = *ptr;
+        for( auto &pair : monster_faction_map_ ) {
+            const int zpos = critter.pos().z;
+            const auto fac_iter = pair.second[zpos].find( ptr );
+            if( fac_iter != pair.second[zpos].end() ) {
+                // Need to do this manually because the shared pointer containing critter is kept
+                // valid within removed_ and so the weak pointer in monster_faction_map_ is also
+                // valid.
+                pair.second[zpos].erase( fac_iter );
+                break;
+            }
+        }
+        remove_from_location_map( critter );
+        removed_.push_back( ptr );
+    }
+    weak_monsters_list.reset();
+    generation_++;
+    return removed;
 }
 
 void creature_tracker::clear()
 {
     monsters_list.clear();
+    weak_monsters_list.reset();
     monsters_by_location.clear();
+    monsters_by_submap_.clear();
     monster_faction_map_.clear();
     removed_.clear();
+    generation_++;
 }
 
 void creature_tracker::rebuild_cache()
 {
     monsters_by_location.clear();
+    monsters_by_submap_.clear();
     monster_faction_map_.clear();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
         monsters_by_location[mon_ptr->get_location()] = mon_ptr;
+        add_to_spatial_map( mon_ptr->get_location(), mon_ptr );
         add_to_faction_map( mon_ptr );
     }
 }
@@ -230,25 +389,30 @@ void creature_tracker::swap_positions( monster &first, monster &second )
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
         monsters_by_location.erase( first_iter );
+        remove_from_spatial_map( first.get_location(), first );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
         monsters_by_location.erase( second_iter );
+        remove_from_spatial_map( second.get_location(), second );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
     const tripoint_abs_ms temp = second.get_location();
     second.spawn( first.get_location() );
     first.spawn( temp );
+    generation_++;
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
         monsters_by_location[first.get_location()] = first_ptr;
+        add_to_spatial_map( first.get_location(), first_ptr );
     }
     if( second_ptr ) {
         monsters_by_location[second.get_location()] = second_ptr;
+        add_to_spatial_map( second.get_location(), second_ptr );
     }
 }
 
@@ -284,10 +448,12 @@ void creature_tracker::remove_dead()
         if( critter.is_dead() ) {
             remove_from_location_map( critter );
             iter = monsters_list.erase( iter );
+            generation_++;
         } else {
             ++iter;
         }
     }
+    weak_monsters_list.reset();
 
     removed_.clear();
 }
@@ -3,6 +3,7 @@
 #define CATA_SRC_CREATURE_TRACKER_H
 
 #include <cstddef>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -73,12 +74,30 @@ class creature_tracker
          */
         bool add( const shared_ptr_fast<monster> &critter );
         size_t size() const;
+        /**
+         * Monotonic counter bumped whenever a monster is added, removed or
+         * moved. Callers can compare it against a stored value to detect
+         * that the set of tracked monsters and their positions have not
+         * changed since they last looked, without scanning the list.
+         */
+        int generation() const {
+            return generation_;
+        }
         /** Updates the position of the given monster to the given point. Returns whether the operation
          *  was successful. */
         bool update_pos( const monster &critter, const tripoint_abs_ms &old_pos,
                          const tripoint_abs_ms &new_pos );
         /** Removes the given monster from the Creature tracker, adjusting other entries as needed. */
         void remove( const monster &critter );
+        /**
+         * Removes every monster for which @p predicate returns true in a
+         * single pass over the tracker, and returns the removed monsters.
+         * Equivalent to calling remove() once per monster but without the
+         * per-monster linear scan of the monster list; used when the
+         * reality bubble shifts and whole hordes leave at once.
+         */
+        std::vector<shared_ptr_fast<monster>> remove_if(
+            const std::function<bool( const monster & )> &predicate );
         void clear();
         void clear_npcs() {
             active_npc.clear();
@@ -105,10 +124,37 @@ class creature_tracker
         template<typename T = Creature>
         const T * creature_at( const tripoint_abs_ms &p, bool allow_hallucination = false ) const;
 
+        /**
+         * Returns all live monsters within @p radius tiles of @p center.
+         * Only submap-sized buckets overlapping that cube are examined,
+         * so the cost scales with local monster density rather than the
+         * global monster count.
+         */
+        std::vector<shared_ptr_fast<monster>> find_in_radius( const tripoint_abs_ms &center,
+                                           int radius ) const;
+
+        /**
+         * Whether any live monster or active NPC stands inside the
+         * axis-aligned box spanned by @p min and @p max (inclusive).
+         * A cheap broadphase for callers that would otherwise probe
+         * creature_at tile by tile; does not consider the avatar.
+         */
+        bool any_in_aabb( const tripoint_abs_ms &min, const tripoint_abs_ms &max ) const;
+
         const std::vector<shared_ptr_fast<monster>> &get_monsters_list() const {
             return monsters_list;
         }
 
+        /**
+         * A snapshot of @ref monsters_list as weak pointers, shared with
+         * @ref game::monster_range so repeated iteration does not copy the
+         * list (touching every control block) on each call. It is rebuilt
+         * lazily after the list changes; ranges created earlier keep their
+         * snapshot alive, which preserves the rule that creatures added
+         * during iteration are not iterated over.
+         */
+        const shared_ptr_fast<std::vector<weak_ptr_fast<monster>>> &get_weak_monsters_list();
+
         void serialize( JsonOut &jsout ) const;
         void deserialize( JsonIn &jsin );
 
@@ -119,9 +165,23 @@ class creature_tracker
     private:
         std::list<shared_ptr_fast<npc>> active_npc; // NOLINT(cata-serialize)
         std::vector<shared_ptr_fast<monster>> monsters_list;
+        /** Built by @ref get_weak_monsters_list, reset whenever @ref monsters_list changes. */
+        // NOLINTNEXTLINE(cata-serialize)
+        shared_ptr_fast<std::vector<weak_ptr_fast<monster>>> weak_monsters_list;
+        /** See @ref generation. */
+        int generation_ = 0; // NOLINT(cata-serialize)
         void rebuild_cache();
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * Spatial hash of the monsters in @ref monsters_by_location,
+         * bucketed by the submap they stand in; backs @ref find_in_radius.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<tripoint_abs_sm, std::vector<shared_ptr_fast<monster>>> monsters_by_submap_;
+        void add_to_spatial_map( const tripoint_abs_ms &pos,
+                                 const shared_ptr_fast<monster> &critter_ptr );
+        void remove_from_spatial_map( const tripoint_abs_ms &pos, const monster &critter );
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
 };
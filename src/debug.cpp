@@ -600,6 +600,13 @@ void deinitDebug()
     debugFile().deinit();
 }
 
+void flushDebugLog()
+{
+    if( debugFile().file ) {
+        debugFile().file->flush();
+    }
+}
+
 // OStream Operators                                                {{{2
 // ---------------------------------------------------------------------
 
@@ -1224,7 +1231,17 @@ std::ostream &DebugLog( DebugLevel lev, DebugClass cl )
     // Messages from D_MAIN come from debugmsg and are equally important.
     if( ( lev & debugLevel && cl & debugClass ) || lev & D_ERROR || cl & D_MAIN ) {
         std::ostream &out = debugFile().get_file();
-        out << std::endl;
+        out << '\n';
+        // Flushing every message stalls the turn loop on setups that log
+        // heavily, so batch routine messages and push them out at most once
+        // per second. Errors and debugmsg output flush promptly, and the
+        // crash handlers drain the stream via flushDebugLog.
+        static time_t next_flush = 0;
+        const time_t flush_now = time( nullptr );
+        if( lev & D_ERROR || cl & D_MAIN || flush_now >= next_flush ) {
+            out.flush();
+            next_flush = flush_now + 1;
+        }
         out << get_time() << " ";
         out << lev;
         if( cl != debugClass ) {
@@ -184,6 +184,11 @@ enum class DebugOutput : int {
 void setupDebug( DebugOutput );
 /** Opposite of setupDebug, shuts the debugging system down. */
 void deinitDebug();
+/**
+ * Pushes any buffered log lines to disk. Routine messages are flushed in
+ * batches; the crash handlers call this so the log tail survives a crash.
+ */
+void flushDebugLog();
 
 // Function Declarations                                            {{{1
 // ---------------------------------------------------------------------
@@ -27,6 +27,7 @@
 
 #include "achievement.h"
 #include "action.h"
+#include "action_replay.h"
 #include "avatar.h"
 #include "bodypart.h"
 #include "calendar.h"
@@ -67,6 +68,7 @@
 #include "mapgendata.h"
 #include "martialarts.h"
 #include "memory_fast.h"
+#include "memory_stats.h"
 #include "messages.h"
 #include "mission.h"
 #include "monster.h"
@@ -97,6 +99,7 @@
 #include "trait_group.h"
 #include "translations.h"
 #include "try_parse_integer.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 #include "ui.h"
 #include "ui_manager.h"
@@ -195,6 +198,11 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::DISPLAY_REACHABILITY_ZONES: return "DISPLAY_REACHABILITY_ZONES";
         case debug_menu::debug_menu_index::DISPLAY_RADIATION: return "DISPLAY_RADIATION";
         case debug_menu::debug_menu_index::HOUR_TIMER: return "HOUR_TIMER";
+        case debug_menu::debug_menu_index::TURN_PROFILER: return "TURN_PROFILER";
+        case debug_menu::debug_menu_index::TRACE_CAPTURE: return "TRACE_CAPTURE";
+        case debug_menu::debug_menu_index::MEMORY_REPORT: return "MEMORY_REPORT";
+        case debug_menu::debug_menu_index::ACTION_RECORDING: return "ACTION_RECORDING";
+        case debug_menu::debug_menu_index::ACTION_REPLAY: return "ACTION_REPLAY";
         case debug_menu::debug_menu_index::CHANGE_SPELLS: return "CHANGE_SPELLS";
         case debug_menu::debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION: return "TEST_MAP_EXTRA_DISTRIBUTION";
         case debug_menu::debug_menu_index::NESTED_MAPGEN: return "NESTED_MAPGEN";
@@ -295,6 +303,11 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::SHOW_MUT_CAT, true, 'm', _( "Show mutation category levels" ) ) },
             { uilist_entry( debug_menu_index::BENCHMARK, true, 'b', _( "Draw benchmark (X seconds)" ) ) },
             { uilist_entry( debug_menu_index::HOUR_TIMER, true, 'E', _( "Toggle hour timer" ) ) },
+            { uilist_entry( debug_menu_index::TURN_PROFILER, true, 'P', _( "Toggle turn profiler" ) ) },
+            { uilist_entry( debug_menu_index::TRACE_CAPTURE, true, 'j', _( "Capture performance trace (X turns)" ) ) },
+            { uilist_entry( debug_menu_index::MEMORY_REPORT, true, 'u', _( "Show memory usage report" ) ) },
+            { uilist_entry( debug_menu_index::ACTION_RECORDING, true, 'k', _( "Toggle action recording" ) ) },
+            { uilist_entry( debug_menu_index::ACTION_REPLAY, true, 'r', _( "Replay recorded actions" ) ) },
             { uilist_entry( debug_menu_index::TRAIT_GROUP, true, 't', _( "Test trait group" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_PATH, true, 'n', _( "Toggle NPC pathfinding on map" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_ATTACK, true, 'A', _( "Toggle NPC attack potential values on map" ) ) },
@@ -2710,6 +2723,36 @@ void debug()
         case debug_menu_index::HOUR_TIMER:
             g->toggle_debug_hour_timer();
             break;
+        case debug_menu_index::TURN_PROFILER:
+            turn_profiler::toggle();
+            break;
+        case debug_menu_index::TRACE_CAPTURE: {
+            int turns = 0;
+            if( query_int( turns, _( "Trace how many turns?" ) ) && turns > 0 ) {
+                turn_profiler::start_capture( turns );
+            }
+            break;
+        }
+        case debug_menu_index::MEMORY_REPORT:
+            memory_stats::show_report();
+            break;
+        case debug_menu_index::ACTION_RECORDING:
+            action_replay::toggle_recording();
+            break;
+        case debug_menu_index::ACTION_REPLAY: {
+            if( action_replay::replaying() ) {
+                action_replay::stop_replay();
+                break;
+            }
+            const std::string file = string_input_popup()
+                                     .title( _( "Replay which file (in the config directory)?" ) )
+                                     .width( 40 )
+                                     .query_string();
+            if( !file.empty() ) {
+                action_replay::start_replay( PATH_INFO::config_dir() + file );
+            }
+            break;
+        }
         case debug_menu_index::CHANGE_TIME:
             debug_menu_change_time();
             break;
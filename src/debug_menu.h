@@ -84,6 +84,11 @@ enum class debug_menu_index : int {
     DISPLAY_REACHABILITY_ZONES,
     DISPLAY_RADIATION,
     HOUR_TIMER,
+    TURN_PROFILER,
+    TRACE_CAPTURE,
+    MEMORY_REPORT,
+    ACTION_RECORDING,
+    ACTION_REPLAY,
     CHANGE_SPELLS,
     TEST_MAP_EXTRA_DISTRIBUTION,
     NESTED_MAPGEN,
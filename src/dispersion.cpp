@@ -1,15 +1,26 @@
 #include "dispersion.h"
 
+#include "cata_utility.h"
 #include "rng.h"
 
 double dispersion_sources::roll() const
 {
+    // Ranged attacks roll this several times per shot, so draw from the
+    // dedicated combat stream: cheaper than the shared engine and it
+    // keeps combat sequences reproducible under a fixed seed.
+    pcg32_engine &eng = rng_get_stream( rng_stream::combat );
     double this_roll = 0.0;
     for( const double &source : linear_sources ) {
-        this_roll += rng_float( 0.0, source );
+        this_roll += eng.uniform( 0.0, source );
     }
     for( const double &source : normal_sources ) {
-        this_roll += rng_normal( source );
+        // Matches rng_normal: a 4-sigma window clamped to its bounds.
+        const double range = source / 4;
+        if( range == 0.0 ) {
+            this_roll += source;
+        } else {
+            this_roll += clamp( normal_roll_on( eng, source / 2, range ), 0.0, source );
+        }
     }
     for( const double &source : multipliers ) {
         this_roll *= source;
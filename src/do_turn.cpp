@@ -1,6 +1,9 @@
 #include "do_turn.h"
 
+#include <algorithm>
+
 #include "action.h"
+#include "arena_alloc.h"
 #include "avatar.h"
 #include "bionics.h"
 #include "cached_options.h"
@@ -20,6 +23,7 @@
 #include "mission.h"
 #include "monattack.h"
 #include "mtype.h"
+#include "optional.h"
 #include "options.h"
 #include "output.h"
 #include "overmapbuffer.h"
@@ -27,6 +31,7 @@
 #include "scent_map.h"
 #include "string_input_popup.h"
 #include "timed_event.h"
+#include "turn_profiler.h"
 #include "ui_manager.h"
 #include "vehicle.h"
 #include "vpart_position.h"
@@ -55,6 +60,11 @@ extern bool add_best_key_for_action_to_quick_shortcuts( action_id action,
 
 #define dbg(x) DebugLog((x),D_GAME) << __FILE__ << ":" << __LINE__ << ": "
 
+// Polled every turn, so cached instead of looked up by name.
+static cached_option<bool> autosave_enabled( "AUTOSAVE", true );
+static cached_option<int> autosave_turns( "AUTOSAVE_TURNS", 50 );
+static cached_option<bool> force_redraw( "FORCE_REDRAW", true );
+
 namespace turn_handler
 {
 bool cleanup_at_end()
@@ -393,6 +403,10 @@ namespace
 {
 void monmove()
 {
+    // Re-targeted at the monster/NPC boundary below; emplacing banks the
+    // time measured so far into the previous phase.
+    cata::optional<turn_profiler::scoped_timer> ai_timer;
+    ai_timer.emplace( turn_profiler::phase::monster_ai );
     g->cleanup_dead();
     map &m = get_map();
     avatar &u = get_avatar();
@@ -433,16 +447,42 @@ void monmove()
             critter.try_biosignature();
             critter.try_reproduce();
         }
+    }
+
+    // Plan phase: every monster formulates its intent against the
+    // world state as of the start of the monster phase, before anyone
+    // has moved. Kept separate from the commit phase below so planning
+    // works from one consistent snapshot.
+    std::vector<const monster *> planned;
+    for( monster &critter : g->all_monsters() ) {
+        if( critter.moves > 0 && !critter.is_dead() && !critter.has_effect( effect_ridden ) &&
+            !critter.has_effect( effect_controlled ) ) {
+            critter.plan();
+            planned.push_back( &critter );
+        }
+    }
+    // Sorted so the commit phase below can binary-search instead of
+    // scanning the whole list once per monster.
+    std::sort( planned.begin(), planned.end() );
+
+    // Commit phase: execute moves and attacks in tracker order, which
+    // keeps the outcome deterministic. Monsters re-plan between steps,
+    // since the world has changed under them by then; monsters spawned
+    // during this phase (e.g. blob splits) plan before their first step.
+    for( monster &critter : g->all_monsters() ) {
+        bool has_plan = std::binary_search( planned.begin(), planned.end(), &critter );
         while( critter.moves > 0 && !critter.is_dead() && !critter.has_effect( effect_ridden ) ) {
             critter.made_footstep = false;
             // Controlled critters don't make their own plans
-            if( !critter.has_effect( effect_controlled ) ) {
-                // Formulate a path to follow
-                critter.plan();
-            } else {
+            if( critter.has_effect( effect_controlled ) ) {
                 critter.moves = 0;
                 break;
             }
+            if( !has_plan ) {
+                // Formulate a path to follow
+                critter.plan();
+            }
+            has_plan = false;
             critter.move(); // Move one square, possibly hit u
             critter.process_triggers();
             m.creature_in_field( critter );
@@ -479,6 +519,7 @@ void monmove()
     }
 
     // Now, do active NPCs.
+    ai_timer.emplace( turn_profiler::phase::npc_ai );
     for( npc &guy : g->all_npcs() ) {
         int turns = 0;
         if( guy.is_mounted() ) {
@@ -574,12 +615,58 @@ void overmap_npc_move()
     }
 }
 
+// Generate the map ahead of a fast-moving vehicle before it gets there.
+// Mapgen for an OMT otherwise only runs when map::shift reaches it, and
+// at driving speeds that means a stutter every few seconds as whole new
+// columns generate at once. Pulling at most one upcoming OMT through a
+// tinymap per turn spreads that cost out ahead of the crossing.
+void prefetch_driving_mapgen()
+{
+    avatar &u = get_avatar();
+    map &m = get_map();
+    const optional_vpart_position vp = m.veh_at( u.pos() );
+    if( !u.in_vehicle || !vp ) {
+        return;
+    }
+    const vehicle &veh = vp->vehicle();
+    // Below ~30 mph the usual shift-time generation keeps up fine.
+    if( std::abs( veh.velocity ) < 3000 ) {
+        return;
+    }
+    static constexpr std::array<point, 8> dir_offsets = {{
+            point_east, point_south_east, point_south, point_south_west,
+            point_west, point_north_west, point_north, point_north_east
+        }
+    };
+    point heading = dir_offsets[veh.face.dir8()];
+    if( veh.velocity < 0 ) {
+        heading = point( -heading.x, -heading.y );
+    }
+    const tripoint_abs_omt omt_pos = u.global_omt_location();
+    // Closer OMTs are already inside the reality bubble; look just past
+    // its edge along the heading.
+    for( int k = 3; k <= 5; k++ ) {
+        const tripoint_abs_omt next = omt_pos + point_rel_omt( heading * k );
+        const tripoint_abs_sm corner = project_to<coords::sm>( next );
+        if( MAPBUFFER.lookup_submap( corner.raw() ) != nullptr ) {
+            continue;
+        }
+        tinymap tm;
+        // Loading generates the missing submaps straight into MAPBUFFER.
+        tm.load( corner, false );
+        break;
+    }
+}
+
 } // namespace
 
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool do_turn()
 {
+    // Anything parked in the per-turn arena died with the previous turn.
+    cata::get_turn_arena().reset();
+    turn_profiler::finish_turn();
     if( g->is_game_over() ) {
         return turn_handler::cleanup_at_end();
     }
@@ -592,8 +679,9 @@ bool do_turn()
     }
 
     weather_manager &weather = get_weather();
-    // starting a new turn, clear out temperature cache
+    // starting a new turn, clear out temperature and windpower caches
     weather.temperature_cache.clear();
+    weather.windpower_cache.clear();
 
     if( g->npcs_dirty ) {
         g->load_npcs();
@@ -635,8 +723,8 @@ bool do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( autosave_enabled &&
+        calendar::once_every( 1_turns * static_cast<int>( autosave_turns ) ) &&
         !u.is_dead_state() ) {
         g->autosave();
     }
@@ -751,8 +839,15 @@ bool do_turn()
     m.build_floor_caches();
 
     m.process_falling();
-    m.vehmove();
-    m.process_fields();
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::phase::vehicles );
+        m.vehmove();
+    }
+    prefetch_driving_mapgen();
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::phase::fields );
+        m.process_fields();
+    }
     m.process_items();
     explosion_handler::process_explosions();
     m.creature_in_field( u );
@@ -762,7 +857,10 @@ bool do_turn()
     const int levz = m.get_abs_sub().z;
     // Update vision caches for monsters. If this turns out to be expensive,
     // consider a stripped down cache just for monsters.
-    m.build_map_cache( levz, true );
+    {
+        turn_profiler::scoped_timer timer( turn_profiler::phase::map_cache );
+        m.build_map_cache( levz, true );
+    }
     monmove();
     if( calendar::once_every( 5_minutes ) ) {
         overmap_npc_move();
@@ -783,7 +881,8 @@ bool do_turn()
     }
     g->mon_info_update();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.moves < 0 && force_redraw ) {
+        turn_profiler::scoped_timer timer( turn_profiler::phase::drawing );
         ui_manager::redraw();
         refresh_display();
     }
@@ -413,6 +413,13 @@ bool effect_type::load_mod_data( const JsonObject &jo, const std::string &member
         extract_effect( j, mod_data, "cut_mod",    member, "CUT",  "min" );
         extract_effect( j, mod_data, "size_mod",    member, "SIZE",  "min" );
 
+        // Rebuild the index of mod types that actually have data, so the
+        // per-turn getters can skip absent ones without any tuple lookups.
+        mod_args.clear();
+        for( const auto &pr : mod_data ) {
+            mod_args.insert( std::get<2>( pr.first ) );
+        }
+
         return true;
     } else {
         return false;
@@ -1040,6 +1047,9 @@ std::vector<efftype_id> effect::get_blocks_effects() const
 
 int effect::get_mod( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_args.count( arg ) == 0 ) {
+        return 0;
+    }
     const auto &mod_data = eff_type->mod_data;
     double min = 0;
     double max = 0;
@@ -1072,6 +1082,9 @@ int effect::get_mod( const std::string &arg, bool reduced ) const
 
 int effect::get_avg_mod( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_args.count( arg ) == 0 ) {
+        return 0;
+    }
     const auto &mod_data = eff_type->mod_data;
     double min = 0;
     double max = 0;
@@ -1104,6 +1117,9 @@ int effect::get_avg_mod( const std::string &arg, bool reduced ) const
 
 int effect::get_amount( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_args.count( arg ) == 0 ) {
+        return 0;
+    }
     const auto &mod_data = eff_type->mod_data;
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "amount" ) );
@@ -1119,6 +1135,9 @@ int effect::get_amount( const std::string &arg, bool reduced ) const
 
 int effect::get_min_val( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_args.count( arg ) == 0 ) {
+        return 0;
+    }
     const auto &mod_data = eff_type->mod_data;
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "min_val" ) );
@@ -1134,6 +1153,9 @@ int effect::get_min_val( const std::string &arg, bool reduced ) const
 
 int effect::get_max_val( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_args.count( arg ) == 0 ) {
+        return 0;
+    }
     const auto &mod_data = eff_type->mod_data;
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "max_val" ) );
@@ -1525,6 +1547,11 @@ bool effect::has_flag( const flag_id &flag ) const
     return eff_type->has_flag( flag );
 }
 
+bool effect::has_kill_chance() const
+{
+    return !eff_type->kill_chance.empty() || !eff_type->red_kill_chance.empty();
+}
+
 bool effect::kill_roll( bool reduced ) const
 {
     const std::vector<std::pair<int, int>> &chances = reduced ? eff_type->red_kill_chance :
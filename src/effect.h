@@ -8,6 +8,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -191,6 +192,9 @@ class effect_type
         /** Key tuple order is:("base_mods"/"scaling_mods", reduced: bool, type of mod: "STR", desired argument: "tick") */
         std::unordered_map <
         std::tuple<std::string, bool, std::string, std::string>, double, cata::tuple_hash > mod_data;
+        /** Mod type keys ("STR", "PAIN", ...) present in mod_data, so the per-turn
+         *  getters can bail out without building tuple keys for absent mods. */
+        std::unordered_set<std::string> mod_args;
         std::vector<vitamin_rate_effect> vitamin_data;
         std::vector<std::pair<int, int>> kill_chance;
         std::vector<std::pair<int, int>> red_kill_chance;
@@ -325,6 +329,8 @@ class effect
         /** Check if the effect has the specified flag */
         bool has_flag( const flag_id &flag ) const;
 
+        /** Returns true if the effect type defines any kill chance at all. */
+        bool has_kill_chance() const;
         bool kill_roll( bool reduced ) const;
         std::string get_death_message() const;
         event_type death_event() const;
@@ -143,6 +143,12 @@ void effect_on_conditions::queue_effect_on_condition( time_duration duration,
 
 void effect_on_conditions::process_effect_on_conditions( Character &you )
 {
+    // This runs every turn for every character; don't build a talker until
+    // something is actually due.
+    if( you.queued_effect_on_conditions.empty() ||
+        you.queued_effect_on_conditions.top().time > calendar::turn ) {
+        return;
+    }
     dialogue d( get_talker_for( you ), nullptr );
     std::vector<queued_eoc> eocs_to_queue;
     while( !you.queued_effect_on_conditions.empty() &&
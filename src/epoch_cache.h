@@ -0,0 +1,66 @@
+#pragma once
+#ifndef CATA_SRC_EPOCH_CACHE_H
+#define CATA_SRC_EPOCH_CACHE_H
+
+#include <array>
+#include <cstdint>
+
+#include "point.h"
+
+/**
+ * A dense fixed-size grid cache with O(1) clearing.
+ *
+ * Every cell carries the epoch it was last written in and @ref clear just
+ * advances the current epoch, so cells written before it read as unset
+ * without re-zeroing the whole array. Useful for scratch grids that are
+ * wiped once per turn or per submap - a light source buffer or a scent
+ * assignment block - where the wipe costs more than stamping accesses.
+ */
+template<typename T, std::size_t SizeX, std::size_t SizeY>
+class epoch_cache
+{
+    public:
+        epoch_cache() = default;
+        explicit epoch_cache( const T &unset ) : unset_value( unset ) {}
+
+        /** Marks every cell unset. O(1), except once every 2^32 clears. */
+        void clear() {
+            if( ++epoch == 0 ) {
+                stamps = {};
+                epoch = 1;
+            }
+        }
+
+        bool is_set( const point &p ) const {
+            return stamps[p.x][p.y] == epoch;
+        }
+
+        /** Value at @p p, or the unset value if nothing was stored since the last clear. */
+        const T &get( const point &p ) const {
+            return is_set( p ) ? values[p.x][p.y] : unset_value;
+        }
+
+        void set( const point &p, const T &value ) {
+            stamps[p.x][p.y] = epoch;
+            values[p.x][p.y] = value;
+        }
+
+        /** Reference for in-place updates; stale cells are reset to the unset value first. */
+        T &get_or_init( const point &p ) {
+            if( !is_set( p ) ) {
+                stamps[p.x][p.y] = epoch;
+                values[p.x][p.y] = unset_value;
+            }
+            return values[p.x][p.y];
+        }
+
+    private:
+        std::array<std::array<T, SizeY>, SizeX> values = {};
+        // Zero-initialized, so with the epoch starting at 1 a fresh cache
+        // reads as all unset without touching the value array.
+        std::array<std::array<std::uint32_t, SizeY>, SizeX> stamps = {};
+        std::uint32_t epoch = 1;
+        T unset_value = T();
+};
+
+#endif // CATA_SRC_EPOCH_CACHE_H
@@ -39,6 +39,11 @@ event_bus::~event_bus()
 void event_bus::subscribe( event_subscriber *s )
 {
     subscribers.push_back( s );
+    for( size_t i = 0; i < typed_subscribers.size(); ++i ) {
+        if( s->is_interested_in( static_cast<event_type>( i ) ) ) {
+            typed_subscribers[i].push_back( s );
+        }
+    }
     s->on_subscribe( this );
 }
 
@@ -50,12 +55,15 @@ void event_bus::unsubscribe( event_subscriber *s )
     } else {
         ( *it )->on_unsubscribe( this );
         subscribers.erase( it );
+        for( std::vector<event_subscriber *> &typed : typed_subscribers ) {
+            typed.erase( std::remove( typed.begin(), typed.end(), s ), typed.end() );
+        }
     }
 }
 
 void event_bus::send( const cata::event &e ) const
 {
-    for( event_subscriber *s : subscribers ) {
+    for( event_subscriber *s : typed_subscribers[static_cast<size_t>( e.type() )] ) {
         s->notify( e );
     }
 }
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_EVENT_BUS_H
 #define CATA_SRC_EVENT_BUS_H
 
+#include <array>
 #include <type_traits>
 #include <vector>
 
@@ -26,6 +27,11 @@ class event_bus
         }
     private:
         std::vector<event_subscriber *> subscribers;
+        // Per-type dispatch lists, built at subscription time from
+        // event_subscriber::is_interested_in, so high-frequency events only
+        // touch the subscribers that handle them.
+        std::array<std::vector<event_subscriber *>, static_cast<size_t>( event_type::num_event_types )>
+        typed_subscribers;
 };
 
 event_bus &get_event_bus();
@@ -6,6 +6,7 @@ namespace cata
 class event;
 }  // namespace cata
 class event_bus;
+enum class event_type : int;
 
 class event_subscriber
 {
@@ -15,6 +16,12 @@ class event_subscriber
         event_subscriber &operator=( const event_subscriber & ) = delete;
         virtual ~event_subscriber();
         virtual void notify( const cata::event & ) = 0;
+        // Queried once at subscription time so the bus can dispatch each event
+        // only to subscribers that handle its type.  Subscribers whose notify
+        // ignores most event types should override this.
+        virtual bool is_interested_in( event_type ) const {
+            return true;
+        }
     private:
         friend class event_bus;
         void on_subscribe( event_bus * );
@@ -381,10 +381,23 @@ static std::vector<tripoint> shrapnel( const tripoint &src, int power,
     fragment_cloud visited_cache[MAPSIZE_X][MAPSIZE_Y];
 
     map &here = get_map();
-    // TODO: Calculate range based on max effective range for projectiles.
-    // Basically bisect between 0 and map diameter using shrapnel_calc().
-    // Need to update shadowcasting to support limiting range without adjusting initial distance.
-    const tripoint_range<tripoint> area = here.points_on_zlevel( src.z );
+    // Open air is the least attenuating thing a fragment can traverse, so
+    // walking shrapnel_calc down an unobstructed ray bounds how far any
+    // fragment can reach. The caches and the application scan below then
+    // only cover that box instead of the whole z-level; outside it the
+    // zero-density default of the obstacle cache stops the cast.
+    const fragment_cloud air_cloud( 1.2f, 1.0f );
+    const fragment_cloud start_cloud( fragment_velocity, static_cast<float>( fragment_count ) );
+    int effective_range = 1;
+    while( effective_range < MAPSIZE_X &&
+           shrapnel_check( air_cloud, shrapnel_calc( start_cloud, air_cloud, effective_range ) ) ) {
+        ++effective_range;
+    }
+    const tripoint blast_min( std::max( 0, src.x - effective_range ),
+                              std::max( 0, src.y - effective_range ), src.z );
+    const tripoint blast_max( std::min( MAPSIZE_X - 1, src.x + effective_range ),
+                              std::min( MAPSIZE_Y - 1, src.y + effective_range ), src.z );
+    const tripoint_range<tripoint> area = here.points_in_rectangle( blast_min, blast_max );
 
     here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, obstacle_cache );
 
@@ -73,25 +73,33 @@ time_duration field_entry::set_field_age( const time_duration &new_age )
     return age = new_age;
 }
 
-void field_entry::do_decay()
+void field_entry::do_decay( const time_duration &elapsed )
 {
-    // Bypass set_field_age() so we don't reset decay_time;
-    age += 1_turns;
-    if( type.obj().half_life > 0_turns && get_field_age() > 0_turns ) {
-        // Legacy handling for fire because it's weird and complicated.
-        if( type == STATIC( field_type_str_id( "fd_fire" ) ) ) {
-            if( to_turns<int>( type->half_life ) < dice( 2, to_turns<int>( age ) ) ) {
+    // Legacy handling for fire because it's weird and complicated.
+    // It rolls every turn, so a multi-turn span replays the skipped
+    // rolls one by one to decay at the per-turn rate.
+    if( type.obj().half_life > 0_turns && type == STATIC( field_type_str_id( "fd_fire" ) ) ) {
+        for( time_duration left = elapsed; left > 0_turns; left -= 1_turns ) {
+            // Bypass set_field_age() so we don't reset decay_time;
+            age += 1_turns;
+            if( age > 0_turns && to_turns<int>( type->half_life ) < dice( 2, to_turns<int>( age ) ) ) {
                 set_field_age( 0_turns );
                 set_field_intensity( get_field_intensity() - 1 );
+                return;
             }
-            return;
         }
+        return;
+    }
+    age += elapsed;
+    if( type.obj().half_life > 0_turns && get_field_age() > 0_turns ) {
         if( decay_time == calendar::turn_zero ) {
             std::exponential_distribution<> d( 1.0f / ( M_LOG2E * to_turns<float>
                                                ( type.obj().half_life ) ) );
             const time_duration decay_delay = time_duration::from_turns( d( rng_get_engine() ) );
             decay_time = calendar::turn - age + decay_delay;
         }
+        // The deadline is an absolute time, so no matter how many turns
+        // the span above covered the drop still lands on schedule.
         if( decay_time <= calendar::turn ) {
             set_field_age( 0_turns );
             set_field_intensity( get_field_intensity() - 1 );
@@ -134,6 +142,11 @@ const field_entry *field::find_field( const field_type_id &field_type_to_find,
     return nullptr;
 }
 
+field::entries::iterator field::find( const field_type_id &field_type_to_find )
+{
+    return _field_type_list.find( field_type_to_find );
+}
+
 /*
 Function: add_field
 Inserts the given field_type_id into the field list for a given tile if it does not already exist.
@@ -178,9 +191,9 @@ bool field::remove_field( const field_type_id &field_to_remove )
     return true;
 }
 
-void field::remove_field( std::map<field_type_id, field_entry>::iterator const it )
+field::entries::iterator field::remove_field( const entries::iterator it )
 {
-    _field_type_list.erase( it );
+    const entries::iterator next = _field_type_list.erase( it );
     _displayed_field_type = fd_null;
     if( !_field_type_list.empty() ) {
         for( auto &fld : _field_type_list ) {
@@ -189,6 +202,7 @@ void field::remove_field( std::map<field_type_id, field_entry>::iterator const i
             }
         }
     }
+    return next;
 }
 
 void field::clear()
@@ -206,22 +220,22 @@ unsigned int field::field_count() const
     return _field_type_list.size();
 }
 
-std::map<field_type_id, field_entry>::iterator field::begin()
+field::entries::iterator field::begin()
 {
     return _field_type_list.begin();
 }
 
-std::map<field_type_id, field_entry>::const_iterator field::begin() const
+field::entries::const_iterator field::begin() const
 {
     return _field_type_list.begin();
 }
 
-std::map<field_type_id, field_entry>::iterator field::end()
+field::entries::iterator field::end()
 {
     return _field_type_list.end();
 }
 
-std::map<field_type_id, field_entry>::const_iterator field::end() const
+field::entries::const_iterator field::end() const
 {
     return _field_type_list.end();
 }
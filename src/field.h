@@ -3,13 +3,13 @@
 #define CATA_SRC_FIELD_H
 
 #include <iosfwd>
-#include <map>
 #include <vector>
 
 #include "calendar.h"
 #include "color.h"
 #include "enums.h"
 #include "field_type.h"
+#include "flat_map.h"
 #include "type_id.h"
 
 /**
@@ -58,6 +58,12 @@ class field_entry
             return set_field_age( get_field_age() + mod_age );
         }
 
+        /// @returns @ref decay_time - when this entry will next lose
+        /// intensity, or time 0 if that has not been determined yet.
+        time_point get_decay_time() const {
+            return decay_time;
+        }
+
         bool is_dangerous() const;
 
         //Returns the display name of the current field given its current intensity.
@@ -75,7 +81,10 @@ class field_entry
             return is_field_alive() && type.obj().phase == phase_id::GAS && type.obj().percent_spread > 0;
         }
 
-        void do_decay();
+        /// Ages the entry by the given span and applies any decay that
+        /// came due in it. Spans longer than a turn are how deferred
+        /// submaps catch up; see map::process_fields.
+        void do_decay( const time_duration &elapsed = 1_turns );
 
         std::vector<field_effect> field_effects() const;
 
@@ -103,6 +112,11 @@ class field_entry
 class field
 {
     public:
+        // Sorted-vector map: these lists hold a handful of entries and
+        // field processing iterates them per tile, so contiguous storage
+        // beats tree nodes. See flat_map.h for the iterator caveats.
+        using entries = cata::flat_map<field_type_id, field_entry>;
+
         field();
 
         /**
@@ -118,6 +132,13 @@ class field
          */
         const field_entry *find_field( const field_type_id &field_type_to_find,
                                        bool alive_only = true ) const;
+        /**
+         * Returns an iterator to the entry of the given type, or @ref end.
+         * Field processing uses this to re-resolve its iterator after code
+         * that may have inserted into this list: inserts invalidate
+         * flat_map iterators and references.
+         */
+        entries::iterator find( const field_type_id &field_type_to_find );
 
         /**
          * Inserts the given field_type_id into the field list for a given tile if it does not already exist.
@@ -139,8 +160,9 @@ class field
         /**
          * Make sure to decrement the field counter in the submap.
          * Removes the field entry, the iterator must point into @ref _field_type_list and must be valid.
+         * @return Iterator to the entry following the removed one.
          */
-        void remove_field( std::map<field_type_id, field_entry>::iterator );
+        entries::iterator remove_field( entries::iterator );
 
         /**
          * Removes all fields.
@@ -159,12 +181,12 @@ class field
         description_affix displayed_description_affix() const;
 
         //Returns the vector iterator to begin searching through the list.
-        std::map<field_type_id, field_entry>::iterator begin();
-        std::map<field_type_id, field_entry>::const_iterator begin() const;
+        entries::iterator begin();
+        entries::const_iterator begin() const;
 
         //Returns the vector iterator to end searching through the list.
-        std::map<field_type_id, field_entry>::iterator end();
-        std::map<field_type_id, field_entry>::const_iterator end() const;
+        entries::iterator end();
+        entries::const_iterator end() const;
 
         /**
          * Returns the total move cost from all fields.
@@ -173,7 +195,7 @@ class field
 
     private:
         // A pointer lookup table of all field effects on the current tile.
-        std::map<field_type_id, field_entry> _field_type_list;
+        entries _field_type_list;
         //_displayed_field_type currently is equal to the last field added to the square. You can modify this behavior in the class functions if you wish.
         field_type_id _displayed_field_type;
 };
@@ -340,6 +340,37 @@ const json_flag &flag_id::obj() const
     return json_flags_all.obj( *this );
 }
 
+/** @relates int_id */
+template<>
+bool int_id<json_flag>::is_valid() const
+{
+    return json_flags_all.is_valid( *this );
+}
+
+/** @relates int_id */
+template<>
+const json_flag &int_id<json_flag>::obj() const
+{
+    return json_flags_all.obj( *this );
+}
+
+/** @relates int_id */
+template<>
+const flag_id &int_id<json_flag>::id() const
+{
+    return json_flags_all.convert( *this );
+}
+
+/** @relates string_id */
+template<>
+int_id<json_flag> flag_id::id_or( const int_id<json_flag> &fallback ) const
+{
+    if( json_flags_all.initialized ) {
+        return json_flags_all.convert( *this, fallback, false );
+    }
+    return fallback;
+}
+
 json_flag::operator bool() const
 {
     return id.is_valid();
@@ -395,6 +426,11 @@ void json_flag::finalize_all()
     json_flags_all.finalize();
 }
 
+size_t json_flag::count()
+{
+    return json_flags_all.size();
+}
+
 bool json_flag::is_ready()
 {
     return !json_flags_all.empty();
@@ -398,6 +398,9 @@ class json_flag
         /** true, if flags were loaded */
         static bool is_ready();
 
+        /** Number of loaded flag definitions; dense int ids are 0..count()-1 */
+        static size_t count();
+
         static const std::vector<json_flag> &get_all();
 
     private:
@@ -0,0 +1,157 @@
+#pragma once
+#ifndef CATA_SRC_FLAT_MAP_H
+#define CATA_SRC_FLAT_MAP_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "flat_set.h"
+
+namespace cata
+{
+
+/**
+ * @brief A PairAssociativeContainer implemented as a sorted vector.
+ *
+ * The flat_set counterpart for maps: O(n) insertion, O(log(n)) lookup, a
+ * single allocation, and contiguous storage, so iteration walks one cache
+ * line instead of chasing tree nodes. Intended for small, iteration-heavy
+ * tables like the per-tile field list.
+ *
+ * Unlike std::map, erase and insert invalidate iterators at or after the
+ * touched position, and keys must not be modified through the (mutable)
+ * iterators.
+ */
+template<typename Key, typename Mapped, typename Compare = transparent_less_than>
+class flat_map : private Compare
+{
+    public:
+        using key_type = Key;
+        using mapped_type = Mapped;
+        using value_type = std::pair<Key, Mapped>;
+        using key_compare = Compare;
+
+    private:
+        using Data = std::vector<value_type>;
+        Data data;
+
+    public:
+        using size_type = typename Data::size_type;
+        using iterator = typename Data::iterator;
+        using const_iterator = typename Data::const_iterator;
+
+        flat_map() = default;
+
+        const key_compare &key_comp() const {
+            return *this;
+        }
+
+        size_type size() const {
+            return data.size();
+        }
+        bool empty() const {
+            return data.empty();
+        }
+        void clear() {
+            data.clear();
+        }
+        void reserve( size_type n ) {
+            data.reserve( n );
+        }
+
+        iterator begin() {
+            return data.begin();
+        }
+        iterator end() {
+            return data.end();
+        }
+        const_iterator begin() const {
+            return data.begin();
+        }
+        const_iterator end() const {
+            return data.end();
+        }
+        const_iterator cbegin() const {
+            return data.cbegin();
+        }
+        const_iterator cend() const {
+            return data.cend();
+        }
+
+        iterator lower_bound( const key_type &k ) {
+            return std::lower_bound( data.begin(), data.end(), k,
+            [this]( const value_type & v, const key_type & key ) {
+                return key_comp()( v.first, key );
+            } );
+        }
+        const_iterator lower_bound( const key_type &k ) const {
+            return std::lower_bound( data.begin(), data.end(), k,
+            [this]( const value_type & v, const key_type & key ) {
+                return key_comp()( v.first, key );
+            } );
+        }
+
+        iterator find( const key_type &k ) {
+            auto at = lower_bound( k );
+            if( at != end() && !key_comp()( k, at->first ) ) {
+                return at;
+            }
+            return end();
+        }
+        const_iterator find( const key_type &k ) const {
+            auto at = lower_bound( k );
+            if( at != end() && !key_comp()( k, at->first ) ) {
+                return at;
+            }
+            return end();
+        }
+        size_type count( const key_type &k ) const {
+            return find( k ) != end();
+        }
+
+        mapped_type &operator[]( const key_type &k ) {
+            auto at = lower_bound( k );
+            if( at == end() || key_comp()( k, at->first ) ) {
+                at = data.insert( at, value_type( k, mapped_type() ) );
+            }
+            return at->second;
+        }
+
+        std::pair<iterator, bool> insert( const value_type &value ) {
+            auto at = lower_bound( value.first );
+            if( at != end() && !key_comp()( value.first, at->first ) ) {
+                return { at, false };
+            }
+            return { data.insert( at, value ), true };
+        }
+        std::pair<iterator, bool> insert( value_type &&value ) {
+            auto at = lower_bound( value.first );
+            if( at != end() && !key_comp()( value.first, at->first ) ) {
+                return { at, false };
+            }
+            return { data.insert( at, std::move( value ) ), true };
+        }
+
+        iterator erase( const_iterator at ) {
+            return data.erase( at );
+        }
+        size_type erase( const key_type &k ) {
+            auto at = find( k );
+            if( at != end() ) {
+                data.erase( at );
+                return 1;
+            }
+            return 0;
+        }
+
+        friend void swap( flat_map &l, flat_map &r ) {
+            using std::swap;
+            swap( static_cast<Compare &>( l ), static_cast<Compare &>( r ) );
+            swap( l.data, r.data );
+        }
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_FLAT_MAP_H
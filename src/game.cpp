@@ -25,6 +25,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -41,6 +42,7 @@
 #include "auto_pickup.h"
 #include "avatar.h"
 #include "avatar_action.h"
+#include "background_writer.h"
 #include "basecamp.h"
 #include "bionics.h"
 #include "bodypart.h"
@@ -194,6 +196,9 @@ class computer;
 
 static constexpr int DANGEROUS_PROXIMITY = 5;
 
+// Read by the per-turn monster info scan, so cached instead of looked up by name.
+static cached_option<int> safemode_proximity( "SAFEMODEPROXIMITY", 0 );
+
 static const mtype_id mon_manhack( "mon_manhack" );
 
 static const skill_id skill_dodge( "dodge" );
@@ -603,10 +608,10 @@ void game::setup()
         popup.message( "%s", _( "Please wait while the world data loads…\nLoading core data" ) );
         ui_manager::redraw();
         refresh_display();
-
-        load_core_data( ui );
     }
 
+    // Core data is (re)loaded from load_world_modfiles, which can skip the
+    // entire parse when the previous world used the same content packs.
     load_world_modfiles( ui );
 
     m = map();
@@ -649,6 +654,8 @@ void game::setup()
     effect_on_conditions::clear( u );
     remoteveh_cache_time = calendar::before_time_starts;
     remoteveh_cache = nullptr;
+    overmap_seen_cache_pos = tripoint_abs_omt( tripoint_min );
+    overmap_seen_cache_dist = -1;
     // back to menu for save loading, new game etc
 }
 
@@ -2435,15 +2442,44 @@ bool game::load( const save_t &name )
     u = avatar();
     u.set_save_id( name.decoded_name() );
     const std::string save_filename = playerpath + SAVE_EXTENSION;
+    // An autosave may still be writing this file in the background.
+    log_writer->flush();
     if( !read_from_file( save_filename, std::bind( &game::unserialize, this, _1, save_filename ) ) ) {
         return false;
     }
 
+    // The memorial log and the player's map memory live in separate files
+    // and deserialize into disjoint objects, so parse them concurrently and
+    // join before anything downstream reads either. The other save
+    // artifacts (overmaps, NPCs, missions) all register into shared
+    // buffers as they parse and have to stay on this thread. Errors are
+    // carried back and reported after the join - no UI from the worker.
+    const std::string log_filename = worldpath + name.base_path() + SAVE_EXTENSION_LOG;
+    std::string log_error;
+    std::thread log_loader( [this, log_filename, &log_error]() {
+        if( !file_exist( log_filename ) ) {
+            return;
+        }
+        try {
+            cata::ifstream fin( fs::u8path( log_filename ), std::ios::binary );
+            if( !fin ) {
+                throw std::runtime_error( "opening file failed" );
+            }
+            memorial().load( fin, log_filename );
+            if( fin.bad() ) {
+                throw std::runtime_error( "reading file failed" );
+            }
+        } catch( const std::exception &err ) {
+            log_error = err.what();
+        }
+    } );
+
     u.load_map_memory();
 
-    const std::string log_filename = worldpath + name.base_path() + SAVE_EXTENSION_LOG;
-    read_from_file_optional( log_filename,
-                             std::bind( &memorial_logger::load, &memorial(), _1, log_filename ) );
+    log_loader.join();
+    if( !log_error.empty() ) {
+        debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), log_filename.c_str(), log_error.c_str() );
+    }
 
 #if defined(__ANDROID__)
     const std::string shortcuts_filename = worldpath + name.base_path() + SAVE_EXTENSION_SHORTCUTS;
@@ -2544,6 +2580,29 @@ void game::load_world_modfiles( loading_ui &ui )
         mods.insert( mods.begin(), mod_id( "dda" ) );
     }
 
+    // The loaded factories depend only on the sequence of pack paths
+    // parsed. If the previously loaded world used exactly the same
+    // sequence, the finalized data is still valid and the whole re-parse
+    // (tens of seconds on a modded game) can be skipped. The per-world
+    // mods folder is part of the signature, so switching worlds with
+    // world-local mods still reloads.
+    std::string signature = PATH_INFO::jsondir();
+    for( const mod_id &e : mods ) {
+        if( e.is_valid() ) {
+            signature += '\n';
+            signature += e->path;
+        }
+    }
+    signature += '\n';
+    signature += PATH_INFO::world_base_save_path() + "/mods";
+    DynamicDataLoader &loader = DynamicDataLoader::get_instance();
+    if( loader.is_data_finalized() && loader.get_loaded_signature() == signature ) {
+        return;
+    }
+
+    // core data can be loaded only once and must be first anyway
+    load_core_data( ui );
+
     // this code does not care about mod dependencies,
     // it assumes that those dependencies are static and
     // are resolved during the creation of the world.
@@ -2555,6 +2614,7 @@ void game::load_world_modfiles( loading_ui &ui )
     load_data_from_dir( PATH_INFO::world_base_save_path() + "/mods", "custom", ui );
 
     DynamicDataLoader::get_instance().finalize_loaded_data( ui );
+    loader.set_loaded_signature( signature );
 }
 
 bool game::load_packs( const std::string &msg, const std::vector<mod_id> &packs, loading_ui &ui )
@@ -2626,6 +2686,9 @@ bool game::save_maps()
     try {
         m.save();
         overmap_buffer.save(); // can throw
+        // Everything is on disk now, so distant overmaps can be dropped
+        // and reloaded on demand.
+        overmap_buffer.evict_distant();
         MAPBUFFER.save(); // can throw
         return true;
     } catch( const std::exception &err ) {
@@ -2638,14 +2701,38 @@ bool game::save_player_data()
 {
     const std::string playerfile = PATH_INFO::player_base_save_path();
 
-    const bool saved_data = write_to_file( playerfile + SAVE_EXTENSION, [&]( std::ostream & fout ) {
-        serialize( fout );
-    }, _( "player data" ) );
+    bool saved_data = true;
+    if( get_option<bool>( "BACKGROUND_SAVE" ) ) {
+        // Serialize on the main thread - the avatar is live game state - and
+        // leave only the file IO to the worker. On big characters the write
+        // is the second-largest chunk of autosave time after the mapbuffer,
+        // which already saves this way.
+        std::ostringstream data;
+        serialize( data );
+        const std::string data_filename = playerfile + SAVE_EXTENSION;
+        log_writer->queue( data_filename.substr( 0, data_filename.rfind( '/' ) ),
+                           data_filename, data.str() );
+    } else {
+        saved_data = write_to_file( playerfile + SAVE_EXTENSION, [&]( std::ostream & fout ) {
+            serialize( fout );
+        }, _( "player data" ) );
+    }
     const bool saved_map_memory = u.save_map_memory();
-    const bool saved_log = write_to_file( playerfile + SAVE_EXTENSION_LOG, [&](
-    std::ostream & fout ) {
-        memorial().save( fout );
-    }, _( "player memorial" ) );
+    bool saved_log = true;
+    if( get_option<bool>( "BACKGROUND_SAVE" ) ) {
+        // Snapshot the log into a string now; the file IO happens on the
+        // worker and failures surface at the next flush.
+        std::ostringstream log;
+        memorial().save( log );
+        const std::string log_filename = playerfile + SAVE_EXTENSION_LOG;
+        log_writer->queue( log_filename.substr( 0, log_filename.rfind( '/' ) ),
+                           log_filename, log.str() );
+    } else {
+        saved_log = write_to_file( playerfile + SAVE_EXTENSION_LOG, [&](
+        std::ostream & fout ) {
+            memorial().save( fout );
+        }, _( "player memorial" ) );
+    }
 #if defined(__ANDROID__)
     const bool saved_shortcuts = write_to_file( playerfile + SAVE_EXTENSION_SHORTCUTS, [&](
     std::ostream & fout ) {
@@ -3124,7 +3211,7 @@ void game::draw()
     }
     wnoutrefresh( w_terrain );
 
-    draw_panels( true );
+    draw_panels();
 
     // This breaks stuff in the SDL port, see
     // https://github.com/CleverRaven/Cataclysm-DDA/issues/45910
@@ -3140,9 +3227,6 @@ void game::draw()
 
 void game::draw_panels( bool force_draw )
 {
-    static int previous_turn = -1;
-    const int current_turn = to_turns<int>( calendar::turn - calendar::turn_zero );
-    const bool draw_this_turn = current_turn > previous_turn || force_draw;
     auto &mgr = panel_manager::get_manager();
     int y = 0;
     const bool sidebar_right = get_option<std::string>( "SIDEBAR_POSITION" ) == "right";
@@ -3154,6 +3238,7 @@ void game::draw_panels( bool force_draw )
         }
     }
     log_height = std::max( TERMY - log_height, 3 );
+    const uint64_t data_version = window_panel::global_data_version( u );
     for( const window_panel &panel : mgr.get_current_layout().panels() ) {
         if( panel.render() ) {
             // height clamped to window height.
@@ -3163,9 +3248,18 @@ void game::draw_panels( bool force_draw )
             }
             h += spacer;
             if( panel.toggle && panel.render() && h > 0 ) {
-                if( panel.always_draw || draw_this_turn ) {
-                    panel.draw( u, catacurses::newwin( h, panel.get_width(),
-                                                       point( sidebar_right ? TERMX - panel.get_width() : 0, y ) ) );
+                const point origin( sidebar_right ? TERMX - panel.get_width() : 0, y );
+                catacurses::window w = force_draw || panel.always_draw
+                                       ? catacurses::window()
+                                       : panel.cached_window( data_version, h, panel.get_width(), origin );
+                if( w ) {
+                    // Unchanged data and geometry, put the previous frame
+                    // back on the virtual screen without re-rendering.
+                    wnoutrefresh( w );
+                } else {
+                    w = catacurses::newwin( h, panel.get_width(), origin );
+                    panel.draw( u, w );
+                    panel.cache_window( data_version, w );
                 }
                 if( show_panel_adm ) {
                     const std::string panel_name = panel.get_name();
@@ -3193,7 +3287,6 @@ void game::draw_panels( bool force_draw )
             }
         }
     }
-    previous_turn = current_turn;
 }
 
 void game::draw_pixel_minimap( const catacurses::window &w )
@@ -3583,8 +3676,7 @@ character_id game::assign_npc_id()
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = ( get_option<int>( "SAFEMODEPROXIMITY" ) <= 0 ) ? MAX_VIEW_DISTANCE :
-                   get_option<int>( "SAFEMODEPROXIMITY" );
+    const int distance = ( safemode_proximity <= 0 ) ? MAX_VIEW_DISTANCE : safemode_proximity;
     return is_hostile_within( distance );
 }
 
@@ -3695,10 +3787,33 @@ std::vector<monster *> game::get_fishable_monsters( std::unordered_set<tripoint>
 void game::mon_info_update( )
 {
     int newseen = 0;
-    const int safe_proxy_dist = get_option<int>( "SAFEMODEPROXIMITY" );
+    const int safe_proxy_dist = safemode_proximity;
     const int iProxyDist = ( safe_proxy_dist <= 0 ) ? MAX_VIEW_DISTANCE :
                            safe_proxy_dist;
 
+    // The scan below depends on the player's viewpoint, the creature roster
+    // and the safe mode configuration. On quiet turns none of these change
+    // between successive calls, so remember the state they had last time and
+    // keep the previous result while it still matches. The memo is written
+    // at the end of the function, after the safe mode state has settled.
+    static time_point memo_turn = calendar::before_time_starts;
+    static tripoint memo_view;
+    static int memo_tracker_gen = -1;
+    static int memo_rules_gen = -1;
+    static int memo_safe_mode = -1;
+    static int memo_proxy_dist = -1;
+    static size_t memo_npc_count = 0;
+    creature_tracker &tracker = get_creature_tracker();
+    const tripoint view = u.pos() + u.view_offset;
+    if( memo_turn == calendar::turn && memo_view == view &&
+        memo_tracker_gen == tracker.generation() &&
+        memo_rules_gen == get_safemode().generation() &&
+        memo_safe_mode == static_cast<int>( safe_mode ) &&
+        memo_proxy_dist == iProxyDist &&
+        memo_npc_count == tracker.active_npc.size() ) {
+        return;
+    }
+
     monster_visible_info &mon_visible = u.get_mon_visible();
     auto &new_seen_mon = mon_visible.new_seen_mon;
     auto &unique_types = mon_visible.unique_types;
@@ -3716,7 +3831,6 @@ void game::mon_info_update( )
     }
     std::fill_n( dangerous, 8, false );
 
-    const tripoint view = u.pos() + u.view_offset;
     new_seen_mon.clear();
 
     static time_point previous_turn = calendar::turn_zero;
@@ -3900,6 +4014,14 @@ void game::mon_info_update( )
 
     previous_turn = calendar::turn;
     mostseen = newseen;
+
+    memo_turn = calendar::turn;
+    memo_view = view;
+    memo_tracker_gen = tracker.generation();
+    memo_rules_gen = get_safemode().generation();
+    memo_safe_mode = static_cast<int>( safe_mode );
+    memo_proxy_dist = iProxyDist;
+    memo_npc_count = tracker.active_npc.size();
 }
 
 void game::cleanup_dead()
@@ -6593,7 +6715,11 @@ std::vector<map_item_stack> game::find_nearby_items( int iRadius )
     }
 
     for( auto &points_p_it : closest_points_first( u.pos(), iRadius ) ) {
+        // Check for items before any visibility work; the vast majority of
+        // tiles in the radius are empty and the item check is a cheap submap
+        // lookup, while the sight checks are not.
         if( points_p_it.y >= u.posy() - iRadius && points_p_it.y <= u.posy() + iRadius &&
+            m.has_items( points_p_it ) &&
             u.sees( points_p_it ) &&
             m.sees_some_items( points_p_it, u ) ) {
 
@@ -6601,11 +6727,12 @@ std::vector<map_item_stack> game::find_nearby_items( int iRadius )
                 const std::string name = elem.tname();
                 const tripoint relative_pos = points_p_it - u.pos();
 
-                if( std::find( item_order.begin(), item_order.end(), name ) == item_order.end() ) {
+                const auto iter = temp_items.find( name );
+                if( iter == temp_items.end() ) {
                     item_order.push_back( name );
                     temp_items[name] = map_item_stack( &elem, relative_pos );
                 } else {
-                    temp_items[name].add_at_pos( &elem, relative_pos );
+                    iter->second.add_at_pos( &elem, relative_pos );
                 }
             }
         }
@@ -8715,7 +8842,7 @@ std::vector<std::string> game::get_dangerous_tile( const tripoint &dest_loc ) co
     const bool veh_here_inside = veh_here && veh_here->is_inside();
     const bool veh_dest_inside = veh_dest && veh_dest->is_inside();
 
-    for( const std::pair<const field_type_id, field_entry> &e : m.field_at( dest_loc ) ) {
+    for( const std::pair<field_type_id, field_entry> &e : m.field_at( dest_loc ) ) {
         if( !u.is_dangerous_field( e.second ) ) {
             continue;
         }
@@ -10733,8 +10860,20 @@ point game::update_map( int &x, int &y )
 void game::update_overmap_seen()
 {
     const tripoint_abs_omt ompos = u.global_omt_location();
+    // Pull the next overmap(s) into existence before the border is
+    // reached, so worldgen doesn't hitch mid-drive on the crossing.
+    overmap_buffer.prefetch_adjacent( ompos );
     const int dist = u.overmap_sight_range( light_level( u.posz() ) );
     const int dist_squared = dist * dist;
+    // Seen state never reverts, so an unchanged center and sight range
+    // cannot reveal anything new and the whole scan can be skipped.
+    // The members are reset in setup() so a freshly loaded game always
+    // runs its first scan.
+    if( ompos == overmap_seen_cache_pos && dist == overmap_seen_cache_dist ) {
+        return;
+    }
+    overmap_seen_cache_pos = ompos;
+    overmap_seen_cache_dist = dist;
     // We can always see where we're standing
     overmap_buffer.set_seen( ompos, true );
     for( const tripoint_abs_omt &p : points_in_radius( ompos, dist ) ) {
@@ -10748,6 +10887,12 @@ void game::update_overmap_seen()
             // 2. Calculating multiplier would cause division by zero
             continue;
         }
+        // For the same reason only tiles still unseen need a sight line:
+        // after one OMT step that is the leading crescent of the disc plus
+        // whatever terrain blocked before, not the whole radius.
+        if( overmap_buffer.seen( p ) ) {
+            continue;
+        }
         // If circular distances are enabled, scale overmap distances by the diagonality of the sight line.
         point abs_delta = delta.raw().abs();
         int max_delta = std::max( abs_delta.x, abs_delta.y );
@@ -10760,11 +10905,9 @@ void game::update_overmap_seen()
             sight_points -= static_cast<int>( ter->get_see_cost() ) * multiplier;
         }
         if( sight_points >= 0 ) {
-            tripoint_abs_omt seen( p );
-            do {
-                overmap_buffer.set_seen( seen, true );
-                --seen.z();
-            } while( seen.z() >= 0 );
+            // Mark the whole column down to ground level in one bulk write.
+            const tripoint_abs_omt ground( p.xy(), 0 );
+            overmap_buffer.set_seen( p.z() > 0 ? ground : p, p, true );
         }
     }
 }
@@ -10788,17 +10931,26 @@ void game::shift_monsters( const tripoint &shift )
     if( shift == tripoint_zero ) {
         return;
     }
-    for( monster &critter : all_monsters() ) {
-        if( shift.xy() != point_zero ) {
+    if( shift.xy() != point_zero ) {
+        for( monster &critter : all_monsters() ) {
             critter.shift( shift.xy() );
         }
-
-        if( m.inbounds( critter.pos() ) ) {
-            // We're inbounds, so don't despawn after all.
-            continue;
+    }
+    // Everything now outside of the reality bubble must be saved and removed.
+    // Doing it as a single tracker pass avoids the per-monster list scans of
+    // despawn_monster, and moving the monsters into overmap storage avoids
+    // deep-copying them; whole hordes cross the bubble edge at once.
+    for( const shared_ptr_fast<monster> &critter :
+         critter_tracker->remove_if( [this]( const monster & mon ) {
+    return !m.inbounds( mon.pos() );
+    } ) ) {
+        critter->on_unload();
+        // hallucinations aren't stored, they come and go as they like
+        if( !critter->is_hallucination() ) {
+            overmap_buffer.despawn_monster( std::move( *critter ) );
         }
-        // The critter is now outside of the reality bubble; it must be saved and removed.
-        despawn_monster( critter );
+        // simulate it being dead so further processing of it (e.g. in monmove) will yield
+        critter->set_hp( 0 );
     }
 }
 
@@ -10880,6 +11032,11 @@ bool game::display_overlay_state( const action_id action )
     return displaying_overlays && *displaying_overlays == action;
 }
 
+bool game::any_display_overlay_active() const
+{
+    return displaying_overlays.has_value();
+}
+
 void game::display_toggle_overlay( const action_id action )
 {
     if( display_overlay_state( action ) ) {
@@ -11239,13 +11396,17 @@ bool game::non_dead_range<Creature>::iterator::valid()
 
 game::monster_range::monster_range( game &game_ref )
 {
-    const auto &monsters = game_ref.critter_tracker->get_monsters_list();
-    items.insert( items.end(), monsters.begin(), monsters.end() );
+    // The tracker caches this snapshot across calls, so the common
+    // several-ranges-per-turn pattern shares one weak pointer vector.
+    snapshot = game_ref.critter_tracker->get_weak_monsters_list();
 }
 
 game::Creature_range::Creature_range( game &game_ref ) : u( &game_ref.u, []( Character * ) { } )
 {
+    // The element type differs from the tracker's lists, so this range
+    // has to build its own vector.
     const auto &monsters = game_ref.critter_tracker->get_monsters_list();
+    items.reserve( monsters.size() + game_ref.critter_tracker->active_npc.size() + 1 );
     items.insert( items.end(), monsters.begin(), monsters.end() );
     items.insert( items.end(), game_ref.critter_tracker->active_npc.begin(),
                   game_ref.critter_tracker->active_npc.end() );
@@ -11254,6 +11415,7 @@ game::Creature_range::Creature_range( game &game_ref ) : u( &game_ref.u, []( Cha
 
 game::npc_range::npc_range( game &game_ref )
 {
+    items.reserve( game_ref.critter_tracker->active_npc.size() );
     items.insert( items.end(), game_ref.critter_tracker->active_npc.begin(),
                   game_ref.critter_tracker->active_npc.end() );
 }
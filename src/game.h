@@ -79,6 +79,7 @@ enum action_id : int;
 
 class achievements_tracker;
 class avatar;
+class background_writer;
 class event_bus;
 class faction_manager;
 class kill_tracker;
@@ -360,6 +361,12 @@ class game
         {
             public:
                 std::vector<weak_ptr_fast<T>> items;
+                /**
+                 * When set, the range iterates this shared snapshot instead of
+                 * @ref items, keeping it alive for the duration; see
+                 * creature_tracker::get_weak_monsters_list.
+                 */
+                shared_ptr_fast<std::vector<weak_ptr_fast<T>>> snapshot;
 
                 class iterator
                 {
@@ -395,11 +402,14 @@ class game
                             return *current;
                         }
                 };
+                std::vector<weak_ptr_fast<T>> &list() {
+                    return snapshot ? *snapshot : items;
+                }
                 iterator begin() {
-                    return iterator( items, items.begin() );
+                    return iterator( list(), list().begin() );
                 }
                 iterator end() {
-                    return iterator( items, items.end() );
+                    return iterator( list(), list().end() );
                 }
                 void push_back( T &new_item ) {
                     items.push_back( new_item );
@@ -966,6 +976,9 @@ class game
         pimpl<achievements_tracker> achievements_tracker_ptr;
         pimpl<kill_tracker> kill_tracker_ptr;
         pimpl<memorial_logger> memorial_logger_ptr; // NOLINT(cata-serialize)
+        // Writes the memorial log snapshot on a worker thread during
+        // saves; see background_writer.h.
+        pimpl<background_writer> log_writer; // NOLINT(cata-serialize)
         pimpl<spell_events> spell_events_ptr; // NOLINT(cata-serialize)
 
         map &m;
@@ -1019,6 +1032,8 @@ class game
         void display_toggle_overlay( action_id );
         // Get the state of an overlay (on/off).
         bool display_overlay_state( action_id );
+        // Whether any debug display overlay is shown.
+        bool any_display_overlay_active() const;
         // toggles the timing of in-game hours
         void toggle_debug_hour_timer();
         /** Creature for which to display the visibility map */
@@ -1069,6 +1084,9 @@ class game
         // remoteveh() cache
         time_point remoteveh_cache_time; // NOLINT(cata-serialize)
         vehicle *remoteveh_cache; // NOLINT(cata-serialize)
+        // update_overmap_seen() skip: last processed center and sight range
+        tripoint_abs_omt overmap_seen_cache_pos = tripoint_abs_omt( tripoint_min ); // NOLINT(cata-serialize)
+        int overmap_seen_cache_dist = -1; // NOLINT(cata-serialize)
         /** Has a NPC been spawned since last load? */
         bool npcs_dirty = false; // NOLINT(cata-serialize)
         /** Has anything died in this turn and needs to be cleaned up? */
@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "action.h"
+#include "action_replay.h"
 #include "activity_actor_definitions.h"
 #include "activity_type.h"
 #include "advanced_inv.h"
@@ -702,7 +703,7 @@ static void smash()
             crit->use_mech_power( -3 );
         }
     }
-    for( std::pair<const field_type_id, field_entry> &fd_to_smsh : here.field_at( smashp ) ) {
+    for( std::pair<field_type_id, field_entry> &fd_to_smsh : here.field_at( smashp ) ) {
         const map_bash_info &bash_info = fd_to_smsh.first->bash_info;
         if( bash_info.str_min == -1 ) {
             continue;
@@ -1822,19 +1823,37 @@ bool game::do_regular_action( action_id &act, avatar &player_character,
             } else {
                 point dest_delta = get_delta_from_movement_action( act, iso_rotate::yes );
                 if( auto_travel_mode && !player_character.is_auto_moving() ) {
-                    for( int i = 0; i < SEEX; i++ ) {
-                        tripoint auto_travel_destination( player_character.posx() + dest_delta.x * ( SEEX - i ),
-                                                          player_character.posy() + dest_delta.y * ( SEEX - i ),
-                                                          player_character.posz() );
-                        destination_preview = m.route( player_character.pos(),
-                                                       auto_travel_destination,
-                                                       player_character.get_pathfinding_settings(),
-                                                       player_character.get_path_avoid() );
-                        if( !destination_preview.empty() ) {
-                            destination_preview.erase( destination_preview.begin() + 1, destination_preview.end() );
-                            player_character.set_destination( destination_preview );
-                            break;
+                    // Only one step of the route is committed per keypress, but
+                    // the route itself is kept between keypresses and reused
+                    // while the player holds the same direction and stays on
+                    // course, instead of running a fresh A* for every step.
+                    static point last_auto_travel_delta;
+                    static tripoint auto_travel_expected_pos;
+                    static std::vector<tripoint> auto_travel_route;
+                    if( dest_delta != last_auto_travel_delta ||
+                        player_character.pos() != auto_travel_expected_pos ||
+                        auto_travel_route.empty() ||
+                        !m.passable( auto_travel_route.front() ) ) {
+                        auto_travel_route.clear();
+                        for( int i = 0; i < SEEX; i++ ) {
+                            tripoint auto_travel_destination( player_character.posx() + dest_delta.x * ( SEEX - i ),
+                                                              player_character.posy() + dest_delta.y * ( SEEX - i ),
+                                                              player_character.posz() );
+                            auto_travel_route = m.route( player_character.pos(),
+                                                         auto_travel_destination,
+                                                         player_character.get_pathfinding_settings(),
+                                                         player_character.get_path_avoid() );
+                            if( !auto_travel_route.empty() ) {
+                                break;
+                            }
                         }
+                        last_auto_travel_delta = dest_delta;
+                    }
+                    if( !auto_travel_route.empty() ) {
+                        destination_preview.assign( 1, auto_travel_route.front() );
+                        auto_travel_route.erase( auto_travel_route.begin() );
+                        auto_travel_expected_pos = destination_preview.front();
+                        player_character.set_destination( destination_preview );
                     }
                     act = player_character.get_next_auto_move_direction();
                     const point dest_next = get_delta_from_movement_action( act, iso_rotate::yes );
@@ -2612,8 +2631,14 @@ bool game::handle_action()
     action_id act = ACTION_NULL;
     user_turn current_turn;
     avatar &player_character = get_avatar();
-    // Check if we have an auto-move destination
-    if( player_character.has_destination() ) {
+    if( action_replay::replaying() ) {
+        act = action_replay::next_action();
+        if( act == ACTION_NULL ) {
+            // Replay log exhausted.
+            return false;
+        }
+        // Check if we have an auto-move destination
+    } else if( player_character.has_destination() ) {
         act = player_character.get_next_auto_move_direction();
         if( act == ACTION_NULL ) {
             add_msg( m_info, _( "Auto-move canceled" ) );
@@ -2756,6 +2781,8 @@ bool game::handle_action()
         return false;
     }
 
+    action_replay::record( act );
+
     // This has no action unless we're in a special game mode.
     gamemode->pre_action( act );
 
@@ -585,8 +585,14 @@ class atm_menu
 
         //! Reset and repopulate the menu; with a fair bit of work this could be more efficient.
         void reset( const bool clear = true ) {
-            const int card_count   = you.amount_of( itype_cash_card );
-            const int charge_count = card_count ? you.charges_of( itype_cash_card ) : 0;
+            // One traversal answers both the card and the charge count.
+            std::vector<item_count_query> queries = {
+                item_count_query( itype_cash_card, item_count_query::count_kind::amount ),
+                item_count_query( itype_cash_card, item_count_query::count_kind::charges ),
+            };
+            you.count_all_of( queries );
+            const int card_count   = queries[0].qty;
+            const int charge_count = queries[1].qty;
 
             if( clear ) {
                 amenu.reset();
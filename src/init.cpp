@@ -1,12 +1,17 @@
 #include "init.h"
 
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include "achievement.h"
 #include "activity_type.h"
 #include "ammo.h"
@@ -478,10 +483,22 @@ void DynamicDataLoader::load_data_from_path( const std::string &path, const std:
             files.push_back( path );
         }
     }
-    // iterate over each file
-    for( const std::string &file : files ) {
+    if( files.empty() ) {
+        return;
+    }
+    // Iterate over each file, reading the next one on a worker thread
+    // while the current one parses. The reader only slurps bytes, so it
+    // is safe off-thread; parsing and factory insertion stay here because
+    // the load functions touch shared registries throughout.
+    std::future<std::string> next_file = std::async( std::launch::async, read_entire_file,
+                                         files[0] );
+    for( size_t i = 0; i < files.size(); i++ ) {
+        const std::string &file = files[i];
         // and stuff it into ram
-        std::istringstream iss( read_entire_file( file ) );
+        std::istringstream iss( next_file.get() );
+        if( i + 1 < files.size() ) {
+            next_file = std::async( std::launch::async, read_entire_file, files[i + 1] );
+        }
         try {
             // parse it
             JsonIn jsin( iss, file );
@@ -523,6 +540,7 @@ void DynamicDataLoader::load_all_from_json( JsonIn &jsin, const std::string &src
 void DynamicDataLoader::unload_data()
 {
     finalized = false;
+    loaded_signature.clear();
 
     achievement::reset();
     activity_type::reset();
@@ -699,6 +717,14 @@ void DynamicDataLoader::finalize_loaded_data( loading_ui &ui )
 
     check_consistency( ui );
     finalized = true;
+
+#if defined(__GLIBC__)
+    // Parsing and finalizing the JSON data churns through a lot of transient
+    // memory that glibc keeps assigned to the process after it has been freed.
+    // Hand it back to the OS here; on hosts running several headless instances
+    // this frees a substantial amount of resident memory per instance.
+    malloc_trim( 0 );
+#endif
 }
 
 void DynamicDataLoader::check_consistency( loading_ui &ui )
@@ -71,6 +71,10 @@ class DynamicDataLoader
     private:
         bool finalized = false;
 
+        // Ordered pack paths of the currently loaded, finalized data; see
+        // get_loaded_signature.
+        std::string loaded_signature;
+
         struct cached_streams;
 
         std::unique_ptr<cached_streams> stream_cache;
@@ -171,6 +175,21 @@ class DynamicDataLoader
             return finalized;
         }
 
+        /**
+         * Signature (the ordered pack paths) of the currently loaded and
+         * finalized data, or the empty string when nothing is loaded. Set
+         * by game::load_world_modfiles after a successful load, cleared by
+         * @ref unload_data. Loading a world whose packs produce the same
+         * signature can keep the factories as they are instead of
+         * re-parsing every JSON file; see game::load_world_modfiles.
+         */
+        const std::string &get_loaded_signature() const {
+            return loaded_signature;
+        }
+        void set_loaded_signature( const std::string &sig ) {
+            loaded_signature = sig;
+        }
+
         /**
          * Get a possibly cached stream for deferred data loading. If the cached
          * stream is still in use by outside code, this returns a new stream to
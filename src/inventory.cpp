@@ -1090,6 +1090,7 @@ const itype_bin &inventory::get_binned_items() const
     }
 
     binned_items.clear();
+    quality_cache.clear();
 
     // HACK: Hack warning
     inventory *this_nonconst = const_cast<inventory *>( this );
@@ -1098,6 +1099,13 @@ const itype_bin &inventory::get_binned_items() const
         for( const item *it : e->softwares() ) {
             binned_items[it->typeId()].push_back( it );
         }
+        for( const std::pair<const quality_id, int> &q : e->quality_of() ) {
+            // get_quality applies the BOIL exception for non-empty containers
+            const int level = e->get_quality( q.first );
+            if( level > INT_MIN ) {
+                quality_cache[q.first][level] += e->count();
+            }
+        }
         return VisitResponse::NEXT;
     } );
 
@@ -222,6 +222,15 @@ class inventory : public visitable
          */
         const itype_bin &get_binned_items() const;
 
+        /**
+         * Returns the tool quality summary built along with the item bin;
+         * see @ref quality_cache.
+         */
+        const std::map<quality_id, std::map<int, int>> &get_quality_summary() const {
+            get_binned_items();
+            return quality_cache;
+        }
+
         void update_cache_with_item( item &newit );
 
         void copy_invlet_of( const inventory &other );
@@ -265,6 +274,13 @@ class inventory : public visitable
          * `mutable` because this is a pure cache that doesn't affect the contained items.
          */
         mutable itype_bin binned_items;
+        /**
+         * Summary of the tool qualities provided by the binned items:
+         * quality_cache[qual][level] is how many items provide the quality at
+         * exactly that level. Built together with @ref binned_items, so it is
+         * valid whenever `binned` is true.
+         */
+        mutable std::map<quality_id, std::map<int, int>> quality_cache;
 };
 
 #endif // CATA_SRC_INVENTORY_H
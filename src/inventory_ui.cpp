@@ -602,14 +602,44 @@ void inventory_column::expand_to_fit( const inventory_entry &entry )
     }
 }
 
+void inventory_column::expand_to_fit( const size_t index )
+{
+    const inventory_entry &entry = entries[index];
+    if( !entry ) {
+        return;
+    }
+
+    // The entry is placed, so the formatted cells can come from the cache and
+    // stay there for the subsequent drawing.
+    const std::string &denial = get_entry_cell_cache( index ).denial;
+
+    for( size_t i = 0, num = denial.empty() ? cells.size() : 1; i < num; ++i ) {
+        auto &cell = cells[i];
+
+        cell.real_width = std::max( cell.real_width, get_entry_cell_width( index, i ) );
+
+        // Don't reveal the cell for headers and stubs
+        if( cell.visible() || ( entry.is_item() && !preset.is_stub_cell( entry, i ) ) ) {
+            const size_t cell_gap = i > 0 ? normal_cell_gap : 0;
+            cell.current_width = std::max( cell.current_width, cell_gap + cell.real_width );
+        }
+    }
+
+    if( !denial.empty() ) {
+        reserved_width = std::max( get_entry_cell_width( index, 0 ) + min_denial_gap + utf8_width( denial,
+                                   true ),
+                                   reserved_width );
+    }
+}
+
 void inventory_column::reset_width( const std::vector<inventory_column *> & )
 {
     for( auto &elem : cells ) {
         elem = cell_t();
     }
     reserved_width = 0;
-    for( auto &elem : entries ) {
-        expand_to_fit( elem );
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        expand_to_fit( i );
     }
 }
 
@@ -841,7 +871,11 @@ void inventory_column::order_by_parent()
 
 void inventory_column::add_entry( const inventory_entry &entry )
 {
-    if( std::find( entries.begin(), entries.end(), entry ) != entries.end() ) {
+    const item *const leading_item = entry.is_item() ? &*entry.locations.front() : nullptr;
+    // The index cannot contain a leading item the column has never seen, so
+    // the linear duplicate scan is only needed on an index hit.
+    if( ( leading_item == nullptr || entries_index.count( leading_item ) > 0 ) &&
+        std::find( entries.begin(), entries.end(), entry ) != entries.end() ) {
         debugmsg( "Tried to add a duplicate entry." );
         return;
     }
@@ -879,6 +913,9 @@ void inventory_column::add_entry( const inventory_entry &entry )
     }
     if( !has_loc ) {
         entries.insert( iter.base(), entry );
+        if( leading_item != nullptr ) {
+            entries_index.insert( leading_item );
+        }
     }
     entries_unfiltered.clear();
     entries_cell_cache.clear();
@@ -993,6 +1030,7 @@ void inventory_column::clear()
     entries.clear();
     entries_unfiltered.clear();
     entries_cell_cache.clear();
+    entries_index.clear();
     paging_is_valid = false;
 }
 
@@ -13,6 +13,7 @@
 #include <memory>
 #include <new>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -353,6 +354,11 @@ class inventory_column
         size_t get_height() const;
         /** Expands the column to fit the new entry. */
         void expand_to_fit( const inventory_entry &entry );
+        /**
+         * Same, but for an entry that is already placed in the column, so the
+         * formatted cells can be taken from (and stored into) the cell cache.
+         */
+        void expand_to_fit( size_t index );
         /** Resets width to original (unchanged). */
         virtual void reset_width( const std::vector<inventory_column *> &all_columns );
         /** Returns next custom inventory letter. */
@@ -462,6 +468,13 @@ class inventory_column
 
         std::vector<cell_t> cells;
         mutable std::vector<entry_cell_cache_t> entries_cell_cache;
+        /**
+         * Leading items of every item entry ever added to the column (a
+         * superset of the current entries, erasures are not tracked).  An item
+         * absent from here cannot form a duplicate entry, which lets
+         * @ref add_entry skip the linear duplicate scan in the common case.
+         */
+        std::unordered_set<const item *> entries_index;
 
         cata::optional<bool> indent_entries_override = cata::nullopt;
         /** @return Number of visible cells */
@@ -1093,7 +1093,7 @@ bool item::stacks_with( const item &rhs, bool check_components, bool combine_liq
     if( faults != rhs.faults ) {
         return false;
     }
-    if( techniques != rhs.techniques ) {
+    if( item_techniques() != rhs.item_techniques() ) {
         return false;
     }
     // Guns with enough fouling to change the indicator symbol don't stack
@@ -1103,7 +1103,7 @@ bool item::stacks_with( const item &rhs, bool check_components, bool combine_liq
     // Guns that differ only by dirt/shot_counter can still stack,
     // but other item_vars such as label/note will prevent stacking
     const std::vector<std::string> ignore_keys = { "dirt", "shot_counter", "spawn_location_omt" };
-    if( map_without_keys( item_vars, ignore_keys ) != map_without_keys( rhs.item_vars, ignore_keys ) ) {
+    if( map_without_keys( cvars(), ignore_keys ) != map_without_keys( rhs.cvars(), ignore_keys ) ) {
         return false;
     }
     const std::string omt_loc_var = "spawn_location_omt";
@@ -1229,12 +1229,32 @@ void item::force_insert_item( const item &it, item_pocket::pocket_type pk_type )
     contents.force_insert_item( it, pk_type );
 }
 
+const std::map<std::string, std::string> &item::cvars() const
+{
+    static const std::map<std::string, std::string> no_vars;
+    return item_vars_ ? *item_vars_ : no_vars;
+}
+
+std::map<std::string, std::string> &item::vars()
+{
+    if( !item_vars_ ) {
+        item_vars_ = cata::make_value<std::map<std::string, std::string>>();
+    }
+    return *item_vars_;
+}
+
+const std::set<matec_id> &item::item_techniques() const
+{
+    static const std::set<matec_id> no_techniques;
+    return techniques_ ? *techniques_ : no_techniques;
+}
+
 void item::set_var( const std::string &name, const int value )
 {
     std::ostringstream tmpstream;
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    vars()[name] = tmpstream.str();
 }
 
 void item::set_var( const std::string &name, const long long value )
@@ -1242,7 +1262,7 @@ void item::set_var( const std::string &name, const long long value )
     std::ostringstream tmpstream;
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    vars()[name] = tmpstream.str();
 }
 
 // NOLINTNEXTLINE(cata-no-long)
@@ -1251,18 +1271,18 @@ void item::set_var( const std::string &name, const long value )
     std::ostringstream tmpstream;
     tmpstream.imbue( std::locale::classic() );
     tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    vars()[name] = tmpstream.str();
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    vars()[name] = string_format( "%f", value );
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    const auto it = cvars().find( name );
+    if( it == cvars().end() ) {
         return default_value;
     }
     const std::string &val = it->second;
@@ -1282,13 +1302,13 @@ double item::get_var( const std::string &name, const double default_value ) cons
 
 void item::set_var( const std::string &name, const tripoint &value )
 {
-    item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    vars()[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    const auto it = cvars().find( name );
+    if( it == cvars().end() ) {
         return default_value;
     }
     std::vector<std::string> values = string_split( it->second, ',' );
@@ -1309,13 +1329,13 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    vars()[name] = value;
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    const auto it = cvars().find( name );
+    if( it == cvars().end() ) {
         return default_value;
     }
     return it->second;
@@ -1328,17 +1348,19 @@ std::string item::get_var( const std::string &name ) const
 
 bool item::has_var( const std::string &name ) const
 {
-    return item_vars.count( name ) > 0;
+    return cvars().count( name ) > 0;
 }
 
 void item::erase_var( const std::string &name )
 {
-    item_vars.erase( name );
+    if( item_vars_ ) {
+        item_vars_->erase( name );
+    }
 }
 
 void item::clear_vars()
 {
-    item_vars.clear();
+    item_vars_.reset();
 }
 
 // TODO: Get rid of, handle multiple types gracefully
@@ -1799,12 +1821,12 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
         const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
+            cvars().find( "description" );
         const cata::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
             info.emplace_back( "DESCRIPTION", snippet.value().translated() );
-        } else if( idescription != item_vars.end() ) {
+        } else if( idescription != cvars().end() ) {
             info.emplace_back( "DESCRIPTION", idescription->second );
         } else if( has_itype_variant() ) {
             info.emplace_back( "DESCRIPTION", itype_variant().alt_description.translated() );
@@ -1900,7 +1922,7 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             }, enumeration_conjunction::none );
 
             info.emplace_back( "BASE", string_format( _( "flags: %s" ), flags_listed ) );
-            for( auto const &imap : item_vars ) {
+            for( auto const &imap : cvars() ) {
                 info.emplace_back( "BASE",
                                    string_format( _( "item var: %s, %s" ), imap.first,
                                                   imap.second ) );
@@ -4175,7 +4197,7 @@ void item::combat_info( std::vector<iteminfo> &info, const iteminfo_query *parts
 
     if( parts->test( iteminfo_parts::DESCRIPTION_TECHNIQUES ) ) {
         std::set<matec_id> all_techniques = type->techniques;
-        all_techniques.insert( techniques.begin(), techniques.end() );
+        all_techniques.insert( item_techniques().begin(), item_techniques().end() );
 
         if( !all_techniques.empty() ) {
             const std::vector<matec_id> all_tec_sorted = sorted_lex( all_techniques );
@@ -4520,15 +4542,15 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         }
     }
 
-    std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
+    std::map<std::string, std::string>::const_iterator item_note = cvars().find( "item_note" );
 
-    if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
+    if( item_note != cvars().end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
         insert_separation_line( info );
         std::string ntext;
         std::map<std::string, std::string>::const_iterator item_note_tool =
-            item_vars.find( "item_note_tool" );
+            cvars().find( "item_note_tool" );
         const use_function *use_func =
-            item_note_tool != item_vars.end() ?
+            item_note_tool != cvars().end() ?
             item_controller->find_template(
                 itype_id( item_note_tool->second ) )->get_use( "inscribe" ) :
             nullptr;
@@ -5101,6 +5123,7 @@ void item::on_pickup( Character &p )
 void item::on_contents_changed()
 {
     contents.update_open_pockets();
+    contents.invalidate_cached_aggregates();
     cached_relative_encumbrance.reset();
     encumbrance_update_ = true;
 }
@@ -5144,8 +5167,82 @@ std::string item::dirt_symbol() const
     return dirt_symbol;
 }
 
+static uint64_t fnv_mix( uint64_t hash, uint64_t value )
+{
+    for( int i = 0; i < 8; i++ ) {
+        hash ^= value & 0xFF;
+        hash *= 1099511628211ULL;
+        value >>= 8;
+    }
+    return hash;
+}
+
+static uint64_t fnv_mix_string( uint64_t hash, const std::string &value )
+{
+    for( const char c : value ) {
+        hash ^= static_cast<unsigned char>( c );
+        hash *= 1099511628211ULL;
+    }
+    // terminator, so that consecutive strings can not run together
+    hash ^= 0xFF;
+    hash *= 1099511628211ULL;
+    return hash;
+}
+
+uint64_t item::tname_fingerprint( unsigned int quantity, bool with_prefix, unsigned int truncate,
+                                  bool with_contents ) const
+{
+    uint64_t hash = 14695981039346656037ULL;
+    hash = fnv_mix( hash, quantity );
+    hash = fnv_mix( hash, truncate );
+    hash = fnv_mix( hash, ( with_prefix ? 1 : 0 ) | ( with_contents ? 2 : 0 ) |
+                    ( active ? 4 : 0 ) | ( is_favorite ? 8 : 0 ) |
+                    ( get_option<bool>( "ITEM_HEALTH_BAR" ) ? 16 : 0 ) );
+    // Several name fragments (rot, freshness, burn state) depend on the passage
+    // of time, so a cached name is never carried across turns.
+    hash = fnv_mix( hash, to_turn<int>( calendar::turn ) );
+    hash = fnv_mix( hash, detail::get_current_language_version() );
+    hash = fnv_mix( hash, charges );
+    hash = fnv_mix( hash, damage_ );
+    hash = fnv_mix( hash, burnt );
+    hash = fnv_mix( hash, item_counter );
+    hash = fnv_mix( hash, wetness );
+    hash = fnv_mix( hash, reinterpret_cast<uintptr_t>( corpse ) );
+    hash = fnv_mix_string( hash, corpse_name );
+    for( const flag_id &tag : item_tags ) {
+        hash = fnv_mix_string( hash, tag.str() );
+    }
+    for( const auto &var : cvars() ) {
+        hash = fnv_mix_string( hash, var.first );
+        hash = fnv_mix_string( hash, var.second );
+    }
+    for( const fault_id &fault : faults ) {
+        hash = fnv_mix_string( hash, fault.str() );
+    }
+    // Shallow fingerprint of the contents, enough for the contents suffixes.
+    for( const item *it : contents.all_items_top() ) {
+        hash = fnv_mix_string( hash, it->typeId().str() );
+        hash = fnv_mix( hash, it->charges );
+        hash = fnv_mix( hash, it->damage_ );
+        hash = fnv_mix( hash, it->item_tags.size() );
+    }
+    // 0 is reserved as the "nothing cached" sentinel.
+    return hash != 0 ? hash : 1;
+}
+
 std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int truncate,
                          bool with_contents ) const
+{
+    const uint64_t key = tname_fingerprint( quantity, with_prefix, truncate, with_contents );
+    if( key != cached_tname_key ) {
+        cached_tname = tname_uncached( quantity, with_prefix, truncate, with_contents );
+        cached_tname_key = key;
+    }
+    return cached_tname;
+}
+
+std::string item::tname_uncached( unsigned int quantity, bool with_prefix, unsigned int truncate,
+                                  bool with_contents ) const
 {
     // item damage and/or fouling level
     std::string damtext;
@@ -5197,7 +5294,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     std::string maintext;
     std::string contents_suffix_text;
 
-    if( is_corpse() || typeId() == itype_blood || item_vars.find( "name" ) != item_vars.end() ) {
+    if( is_corpse() || typeId() == itype_blood || cvars().find( "name" ) != cvars().end() ) {
         maintext = type_name( quantity );
     } else if( ( is_gun() || is_tool() || is_magazine() ) && !is_power_armor() ) {
         int amt = 0;
@@ -5397,7 +5494,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
         ret = utf8_truncate( ret, truncate + truncate_override );
     }
 
-    if( item_vars.find( "item_note" ) != item_vars.end() ) {
+    if( cvars().find( "item_note" ) != cvars().end() ) {
         //~ %s is an item name. This style is used to denote items with notes.
         return string_format( _( "*%s*" ), ret );
     } else {
@@ -6124,12 +6221,15 @@ int item::get_quality( const quality_id &id ) const
 
 bool item::has_technique( const matec_id &tech ) const
 {
-    return type->techniques.count( tech ) > 0 || techniques.count( tech ) > 0;
+    return type->techniques.count( tech ) > 0 || item_techniques().count( tech ) > 0;
 }
 
 void item::add_technique( const matec_id &tech )
 {
-    techniques.insert( tech );
+    if( !techniques_ ) {
+        techniques_ = cata::make_value<std::set<matec_id>>();
+    }
+    techniques_->insert( tech );
 }
 
 std::vector<item *> item::toolmods()
@@ -6161,7 +6261,7 @@ std::vector<const item *> item::toolmods() const
 std::set<matec_id> item::get_techniques() const
 {
     std::set<matec_id> result = type->techniques;
-    result.insert( techniques.begin(), techniques.end() );
+    result.insert( item_techniques().begin(), item_techniques().end() );
     return result;
 }
 
@@ -7861,10 +7961,11 @@ bool item::has_relic_activation() const
     return is_relic() && relic_data->has_activation();
 }
 
-std::vector<enchantment> item::get_enchantments() const
+const std::vector<enchantment> &item::get_enchantments() const
 {
+    static const std::vector<enchantment> no_enchantments;
     if( !is_relic() ) {
-        return std::vector<enchantment> {};
+        return no_enchantments;
     }
     return relic_data->get_enchantments();
 }
@@ -9890,8 +9991,8 @@ bool item_compare_by_charges( const item &left, const item &right )
 static const std::string USED_BY_IDS( "USED_BY_IDS" );
 bool item::already_used_by_player( const Character &p ) const
 {
-    const auto it = item_vars.find( USED_BY_IDS );
-    if( it == item_vars.end() ) {
+    const auto it = cvars().find( USED_BY_IDS );
+    if( it == cvars().end() ) {
         return false;
     }
     // USED_BY_IDS always starts *and* ends with a ';', the search string
@@ -9903,7 +10004,7 @@ bool item::already_used_by_player( const Character &p ) const
 
 void item::mark_as_used_by_player( const Character &p )
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string &used_by_ids = vars()[ USED_BY_IDS ];
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
@@ -11069,7 +11170,7 @@ bool item::is_reloadable() const
 
 std::string item::type_name( unsigned int quantity ) const
 {
-    const auto iter = item_vars.find( "name" );
+    const auto iter = cvars().find( "name" );
     std::string ret_name;
     if( typeId() == itype_blood ) {
         if( corpse == nullptr || corpse->id.is_null() ) {
@@ -11079,7 +11180,7 @@ std::string item::type_name( unsigned int quantity ) const
                                              "%s blood",  quantity ),
                                   corpse->nname() );
         }
-    } else if( iter != item_vars.end() ) {
+    } else if( iter != cvars().end() ) {
         return iter->second;
     } else if( has_itype_variant() ) {
         ret_name = itype_variant().alt_name.translated();
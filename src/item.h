@@ -2292,7 +2292,7 @@ class item : public visitable
         void set_cached_tool_selections( const std::vector<comp_selection<tool_comp>> &selections );
         const std::vector<comp_selection<tool_comp>> &get_cached_tool_selections() const;
 
-        std::vector<enchantment> get_enchantments() const;
+        const std::vector<enchantment> &get_enchantments() const;
         double calculate_by_enchantment( const Character &owner, double modify, enchant_vals::mod value,
                                          bool round_value = false ) const;
         // calculates the enchantment value as if this item were wielded.
@@ -2440,6 +2440,19 @@ class item : public visitable
         bool process_blackpowder_fouling( Character *carrier );
         bool process_tool( Character *carrier, const tripoint &pos );
 
+        /** Actual implementation of @ref tname, bypassing the memoized name. */
+        std::string tname_uncached( unsigned int quantity, bool with_prefix,
+                                    unsigned int truncate, bool with_contents ) const;
+        /**
+         * Hash of every piece of mutable state that feeds into @ref tname, plus its
+         * arguments, the current turn and the current language. Comparing fingerprints
+         * replaces explicit invalidation hooks, which could never be complete while
+         * members like @ref charges are public. Never returns 0, which is reserved
+         * as the "no cached name" sentinel.
+         */
+        uint64_t tname_fingerprint( unsigned int quantity, bool with_prefix,
+                                    unsigned int truncate, bool with_contents ) const;
+
     public:
         static const int INFINITE_CHARGES;
 
@@ -2457,10 +2470,28 @@ class item : public visitable
         FlagsSetType item_tags; // generic item specific flags
         safe_reference_anchor anchor;
         const itype *curammo = nullptr;
-        std::map<std::string, std::string> item_vars;
+        /**
+         * Per-item free-form variables and item specific techniques, allocated
+         * on first use. Most items never customize either, so pristine items
+         * only pay for a null pointer instead of the full container overhead;
+         * copying a customized item deep-copies the storage.
+         */
+        cata::value_ptr<std::map<std::string, std::string>> item_vars_;
+        cata::value_ptr<std::set<matec_id>> techniques_;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
-        std::set<matec_id> techniques; // item specific techniques
+
+        // Memoized result of the last tname() call and the fingerprint it was
+        // computed for; see @ref tname_fingerprint.
+        mutable uint64_t cached_tname_key = 0;
+        mutable std::string cached_tname;
+
+        /** The per-item variables, or a shared empty map when none are set. */
+        const std::map<std::string, std::string> &cvars() const;
+        /** The per-item variables, allocated on first use. */
+        std::map<std::string, std::string> &vars();
+        /** The item specific techniques, or a shared empty set when none are set. */
+        const std::set<matec_id> &item_techniques() const;
 
         // Select a random variant from the possibilities
         // Intended to be called when no explicit variant is set
@@ -909,6 +909,13 @@ void item_contents::update_open_pockets()
     }
 }
 
+void item_contents::invalidate_cached_aggregates()
+{
+    for( item_pocket &pocket : contents ) {
+        pocket.invalidate_cached_aggregates();
+    }
+}
+
 void item_contents::set_item_defaults()
 {
     /* For Items with a magazine or battery in its contents */
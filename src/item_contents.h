@@ -199,6 +199,12 @@ class item_contents
         void clear_magazines();
         void update_open_pockets();
 
+        /**
+         * Drops every pocket's cached contents volume/weight totals; see
+         * item_pocket::invalidate_cached_aggregates.
+         */
+        void invalidate_cached_aggregates();
+
         /**
          * Sets the items contained to their defaults.
          */
@@ -612,6 +612,16 @@ void Item_factory::finalize_post( itype &obj )
             }
         }
     }
+
+    // Dense flag bits for itype::has_flag; all json flags are loaded by
+    // the time types are finalized, so their int ids are stable now.
+    obj.item_tag_bits.assign( json_flag::count(), false );
+    for( const flag_id &f : obj.item_tags ) {
+        const int fid = f.id_or( int_id<json_flag>( -1 ) ).to_i();
+        if( fid >= 0 ) {
+            obj.item_tag_bits[fid] = true;
+        }
+    }
 }
 
 void Item_factory::finalize()
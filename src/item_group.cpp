@@ -640,6 +640,7 @@ void Item_group::add_entry( std::unique_ptr<Item_spawn_data> ptr )
         ptr->probability = std::min( 100, ptr->probability );
     }
     sum_prob += ptr->probability;
+    distribution_alias.clear();
 
     // Make the ammo and magazine probabilities from the outer entity apply to the nested entity:
     // If ptr is an Item_group, it already inherited its parent's ammo/magazine chances in its constructor.
@@ -663,15 +664,9 @@ Item_spawn_data::ItemList Item_group::create(
             result.insert( result.end(), tmp.begin(), tmp.end() );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            p -= ( elem )->probability;
-            if( p >= 0 ) {
-                continue;
-            }
-            ItemList tmp = ( elem )->create( birthday, rec, flags );
+        if( const Item_spawn_data *elem = pick_distribution_entry() ) {
+            ItemList tmp = elem->create( birthday, rec, flags );
             result.insert( result.end(), tmp.begin(), tmp.end() );
-            break;
         }
     }
     put_into_container( result, container_item, birthday, on_overflow, context() );
@@ -689,18 +684,29 @@ item Item_group::create_single( const time_point &birthday, RecursionList &rec )
             return ( elem )->create_single( birthday, rec );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            p -= ( elem )->probability;
-            if( p >= 0 ) {
-                continue;
-            }
-            return ( elem )->create_single( birthday, rec );
+        if( const Item_spawn_data *elem = pick_distribution_entry() ) {
+            return elem->create_single( birthday, rec );
         }
     }
     return item( null_item_id, birthday );
 }
 
+const Item_spawn_data *Item_group::pick_distribution_entry() const
+{
+    if( sum_prob <= 0 || items.empty() ) {
+        return nullptr;
+    }
+    if( distribution_alias.empty() ) {
+        std::vector<int> weights;
+        weights.reserve( items.size() );
+        for( const std::unique_ptr<Item_spawn_data> &elem : items ) {
+            weights.push_back( elem->probability );
+        }
+        distribution_alias.build( weights );
+    }
+    return items[distribution_alias.pick()].get();
+}
+
 void Item_group::check_consistency() const
 {
     for( const auto &elem : items ) {
@@ -719,6 +725,7 @@ bool Item_group::remove_item( const itype_id &itemid )
     for( prop_list::iterator a = items.begin(); a != items.end(); ) {
         if( ( *a )->remove_item( itemid ) ) {
             sum_prob -= ( *a )->probability;
+            distribution_alias.clear();
             a = items.erase( a );
         } else {
             ++a;
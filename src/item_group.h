@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "alias_table.h"
 #include "item.h"
 #include "optional.h"
 #include "relic.h"
@@ -387,6 +388,15 @@ class Item_group : public Item_spawn_data
          * Links to the entries in this group.
          */
         prop_list items;
+
+    private:
+        /**
+         * O(1) weighted draw over @ref items for G_DISTRIBUTION groups.
+         * Built lazily on the first roll; dropped whenever entries change.
+         * Returns null if the group has no entries with positive probability.
+         */
+        const Item_spawn_data *pick_distribution_entry() const;
+        mutable alias_table distribution_alias;
 };
 
 #endif // CATA_SRC_ITEM_GROUP_H
@@ -98,7 +98,17 @@ class item_location::impl
 
         item *target() const {
             ensure_unpacked();
-            return what.get();
+            // Locking the weak reference builds and tears down a shared_ptr
+            // on every call, and activity code resolves the same location
+            // constantly. Keep the resolved pointer and hand it back while
+            // the reference is still live, which is a single expiry check;
+            // expiry (the item moved or was destroyed) drops back to the
+            // lock, which then reports nullptr as before.
+            if( resolved != nullptr && what ) {
+                return resolved;
+            }
+            resolved = what.get();
+            return resolved;
         }
 
         virtual bool valid() const {
@@ -118,6 +128,8 @@ class item_location::impl
             }
         }
         mutable safe_reference<item> what;
+        /** See @ref target. Never dereferenced without checking @ref what. */
+        mutable item *resolved = nullptr;
         mutable int idx = -1;
         mutable bool needs_unpacking = false;
 
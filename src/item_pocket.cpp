@@ -360,6 +360,8 @@ bool item_pocket::is_funnel_container( units::volume &bigger_than ) const
 
 std::list<item *> item_pocket::all_items_top()
 {
+    // Mutable pointers are handed out; assume the caller modifies something.
+    invalidate_cached_aggregates();
     std::list<item *> items;
     for( item &it : contents ) {
         items.push_back( &it );
@@ -411,6 +413,7 @@ bool item_pocket::has_any_with( const std::function<bool( const item &it )> &fil
 
 item &item_pocket::back()
 {
+    invalidate_cached_aggregates();
     return contents.back();
 }
 
@@ -421,6 +424,7 @@ const item &item_pocket::back() const
 
 item &item_pocket::front()
 {
+    invalidate_cached_aggregates();
     return contents.front();
 }
 
@@ -431,6 +435,7 @@ const item &item_pocket::front() const
 
 void item_pocket::pop_back()
 {
+    invalidate_cached_aggregates();
     contents.pop_back();
 }
 
@@ -543,6 +548,7 @@ int item_pocket::moves() const
 
 std::vector<item *> item_pocket::gunmods()
 {
+    invalidate_cached_aggregates();
     std::vector<item *> mods;
     for( item &it : contents ) {
         if( it.is_gunmod() ) {
@@ -570,6 +576,7 @@ cata::flat_set<itype_id> item_pocket::item_type_restrictions() const
 
 item *item_pocket::magazine_current()
 {
+    invalidate_cached_aggregates();
     auto iter = std::find_if( contents.begin(), contents.end(), []( const item & it ) {
         return it.is_magazine();
     } );
@@ -586,6 +593,7 @@ itype_id item_pocket::magazine_default() const
 
 int item_pocket::ammo_consume( int qty )
 {
+    invalidate_cached_aggregates();
     int need = qty;
     int used = 0;
     std::list<item>::iterator it;
@@ -647,6 +655,7 @@ std::set<ammotype> item_pocket::ammo_types() const
 
 void item_pocket::casings_handle( const std::function<bool( item & )> &func )
 {
+    invalidate_cached_aggregates();
     for( auto it = contents.begin(); it != contents.end(); ) {
         if( it->has_flag( flag_CASING ) ) {
             it->unset_flag( flag_CASING );
@@ -663,6 +672,7 @@ void item_pocket::casings_handle( const std::function<bool( item & )> &func )
 
 void item_pocket::handle_liquid_or_spill( Character &guy, const item *avoid )
 {
+    invalidate_cached_aggregates();
     if( guy.is_npc() ) {
         spill_contents( guy.pos() );
         return;
@@ -688,6 +698,7 @@ void item_pocket::handle_liquid_or_spill( Character &guy, const item *avoid )
 
 bool item_pocket::use_amount( const itype_id &it, int &quantity, std::list<item> &used )
 {
+    invalidate_cached_aggregates();
     bool used_item = false;
     for( auto a = contents.begin(); a != contents.end() && quantity > 0; ) {
         if( a->use_amount( it, quantity, used ) ) {
@@ -766,6 +777,7 @@ std::string item_pocket::translated_sealed_prefix() const
 
 bool item_pocket::detonate( const tripoint &pos, std::vector<item> &drops )
 {
+    invalidate_cached_aggregates();
     const auto new_end = std::remove_if( contents.begin(), contents.end(), [&pos, &drops]( item & it ) {
         return it.detonate( pos, drops );
     } );
@@ -780,6 +792,7 @@ bool item_pocket::detonate( const tripoint &pos, std::vector<item> &drops )
 bool item_pocket::process( const itype &type, Character *carrier, const tripoint &pos,
                            float insulation, const temperature_flag flag )
 {
+    invalidate_cached_aggregates();
     bool processed = false;
     float spoil_multiplier = 1.0f;
     for( auto it = contents.begin(); it != contents.end(); ) {
@@ -799,6 +812,7 @@ bool item_pocket::process( const itype &type, Character *carrier, const tripoint
 
 void item_pocket::remove_all_ammo( Character &guy )
 {
+    invalidate_cached_aggregates();
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->is_irremovable() ) {
             iter++;
@@ -811,6 +825,7 @@ void item_pocket::remove_all_ammo( Character &guy )
 
 void item_pocket::remove_all_mods( Character &guy )
 {
+    invalidate_cached_aggregates();
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->is_toolmod() ) {
             guy.i_add_or_drop( *iter );
@@ -823,6 +838,7 @@ void item_pocket::remove_all_mods( Character &guy )
 
 void item_pocket::set_item_defaults()
 {
+    invalidate_cached_aggregates();
     for( item &contained_item : contents ) {
         /* for guns and other items defined to have a magazine but don't use "ammo" */
         if( contained_item.is_magazine() ) {
@@ -1178,6 +1194,7 @@ bool item_pocket::contains_phase( phase_id phase ) const
 
 cata::optional<item> item_pocket::remove_item( const item &it )
 {
+    invalidate_cached_aggregates();
     item ret( it );
     const size_t sz = contents.size();
     contents.remove_if( [&it]( const item & rhs ) {
@@ -1193,6 +1210,7 @@ cata::optional<item> item_pocket::remove_item( const item &it )
 bool item_pocket::remove_internal( const std::function<bool( item & )> &filter,
                                    int &count, std::list<item> &res )
 {
+    invalidate_cached_aggregates();
     for( auto it = contents.begin(); it != contents.end(); ) {
         if( filter( *it ) ) {
             res.splice( res.end(), contents, it++ );
@@ -1217,6 +1235,7 @@ cata::optional<item> item_pocket::remove_item( const item_location &it )
 
 void item_pocket::overflow( const tripoint &pos )
 {
+    invalidate_cached_aggregates();
     if( is_type( item_pocket::pocket_type::MOD ) || is_type( item_pocket::pocket_type::CORPSE ) ||
         is_type( item_pocket::pocket_type::EBOOK ) ) {
         return;
@@ -1314,12 +1333,14 @@ void item_pocket::on_pickup( Character &guy )
 
 void item_pocket::on_contents_changed()
 {
+    invalidate_cached_aggregates();
     unseal();
     restack();
 }
 
 bool item_pocket::spill_contents( const tripoint &pos )
 {
+    invalidate_cached_aggregates();
     if( is_type( pocket_type::EBOOK ) ) {
         return false;
     }
@@ -1335,6 +1356,7 @@ bool item_pocket::spill_contents( const tripoint &pos )
 
 void item_pocket::clear_items()
 {
+    invalidate_cached_aggregates();
     contents.clear();
 }
 
@@ -1348,6 +1370,7 @@ bool item_pocket::has_item( const item &it ) const
 
 item *item_pocket::get_item_with( const std::function<bool( const item & )> &filter )
 {
+    invalidate_cached_aggregates();
     for( item &it : contents ) {
         if( filter( it ) ) {
             return &it;
@@ -1365,6 +1388,7 @@ void item_pocket::remove_items_if( const std::function<bool( item & )> &filter )
 void item_pocket::process( Character *carrier, const tripoint &pos, float insulation,
                            temperature_flag flag, float spoil_multiplier_parent )
 {
+    invalidate_cached_aggregates();
     for( auto iter = contents.begin(); iter != contents.end(); ) {
         if( iter->process( carrier, pos, insulation, flag,
                            // spoil multipliers on pockets are not additive or multiplicative, they choose the best
@@ -1433,6 +1457,7 @@ const pocket_data *item_pocket::get_pocket_data() const
 
 void item_pocket::add( const item &it, item **ret )
 {
+    invalidate_cached_aggregates();
     contents.push_back( it );
     if( ret == nullptr ) {
         restack();
@@ -1455,11 +1480,13 @@ bool item_pocket::can_unload_liquid() const
 
 std::list<item> &item_pocket::edit_contents()
 {
+    invalidate_cached_aggregates();
     return contents;
 }
 
 ret_val<item_pocket::contain_code> item_pocket::insert_item( const item &it )
 {
+    invalidate_cached_aggregates();
     const ret_val<item_pocket::contain_code> ret = !is_standard_type() ?
             ret_val<item_pocket::contain_code>::make_success() : can_contain( it );
     if( ret.success() ) {
@@ -1495,22 +1522,34 @@ units::length item_pocket::max_containable_length() const
     return 0_mm;
 }
 
+void item_pocket::invalidate_cached_aggregates() const
+{
+    cached_contains_volume.reset();
+    cached_contains_weight.reset();
+}
+
 units::volume item_pocket::contains_volume() const
 {
-    units::volume vol = 0_ml;
-    for( const item &it : contents ) {
-        vol += it.volume();
+    if( !cached_contains_volume ) {
+        units::volume vol = 0_ml;
+        for( const item &it : contents ) {
+            vol += it.volume();
+        }
+        cached_contains_volume = vol;
     }
-    return vol;
+    return *cached_contains_volume;
 }
 
 units::mass item_pocket::contains_weight() const
 {
-    units::mass weight = 0_gram;
-    for( const item &it : contents ) {
-        weight += it.weight();
+    if( !cached_contains_weight ) {
+        units::mass weight = 0_gram;
+        for( const item &it : contents ) {
+            weight += it.weight();
+        }
+        cached_contains_weight = weight;
     }
-    return weight;
+    return *cached_contains_weight;
 }
 
 units::mass item_pocket::remaining_weight() const
@@ -1565,6 +1604,7 @@ int item_pocket::best_quality( const quality_id &id ) const
 
 void item_pocket::heat_up()
 {
+    invalidate_cached_aggregates();
     for( item &it : contents ) {
         if( it.has_temperature() ) {
             it.heat_up();
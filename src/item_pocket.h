@@ -321,6 +321,14 @@ class item_pocket
 
         bool operator==( const item_pocket &rhs ) const;
 
+        /**
+         * Drops the cached totals of the contained items' volume and weight.
+         * Every member that mutates the contents or hands out a mutable item
+         * calls this; mutations made later through a stored pointer must
+         * reach it via item::on_contents_changed (item_location does so).
+         */
+        void invalidate_cached_aggregates() const;
+
         favorite_settings settings;
     private:
         // the type of pocket, saved to json
@@ -330,6 +338,11 @@ class item_pocket
         // the items inside the pocket
         std::list<item> contents;
         bool _sealed = false;
+        // Lazily computed totals over contents; recursive traversal of a
+        // nested container adds up fast when character::best_pocket probes
+        // every worn pocket per picked-up item. See invalidate_cached_aggregates().
+        mutable cata::optional<units::volume> cached_contains_volume; // NOLINT(cata-serialize)
+        mutable cata::optional<units::mass> cached_contains_weight; // NOLINT(cata-serialize)
 };
 
 /**
@@ -89,6 +89,11 @@ bool itype::has_use() const
 
 bool itype::has_flag( const flag_id &flag ) const
 {
+    if( !item_tag_bits.empty() ) {
+        const int fid = flag.id_or( int_id<json_flag>( -1 ) ).to_i();
+        return fid >= 0 && static_cast<size_t>( fid ) < item_tag_bits.size() && item_tag_bits[fid];
+    }
+    // Factory not finalized yet; fall back to the set.
     return item_tags.count( flag );
 }
 
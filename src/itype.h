@@ -1076,6 +1076,13 @@ struct itype {
 
         FlagsSetType item_tags;
 
+        /**
+         * One bit per flag int id, mirroring @ref item_tags. Built by
+         * Item_factory::finalize_post once all flags are loaded, turning
+         * has_flag into a vector bit test instead of a set lookup.
+         */
+        std::vector<bool> item_tag_bits;
+
     protected:
         itype_id id = itype_id::NULL_ID(); /** unique string identifier for this type */
 
@@ -89,20 +89,30 @@ JsonObject::JsonObject( JsonIn &j )
     while( !jsin->end_object() ) {
         std::string n = jsin->get_member_name();
         int p = jsin->tell();
-        if( positions.count( n ) > 0 ) {
-            j.error( "duplicate entry in json object" );
+        for( const std::pair<std::string, int> &elem : positions ) {
+            if( elem.first == n ) {
+                j.error( "duplicate entry in json object" );
+            }
         }
-        positions[n] = p;
+        positions.emplace_back( std::move( n ), p );
         jsin->skip_value();
     }
     end_ = jsin->tell();
     final_separator = jsin->get_ate_separator();
+#ifndef CATA_IN_TOOL
+    visited_members.assign( positions.size(), false );
+#endif
 }
 
 void JsonObject::mark_visited( const std::string &name ) const
 {
 #ifndef CATA_IN_TOOL
-    visited_members.emplace( name );
+    for( size_t i = 0; i < positions.size(); ++i ) {
+        if( positions[i].first == name ) {
+            visited_members[i] = true;
+            return;
+        }
+    }
 #else
     static_cast<void>( name );
 #endif
@@ -114,9 +124,9 @@ void JsonObject::report_unvisited() const
     if( report_unvisited_members && !reported_unvisited_members &&
         !std::uncaught_exception() ) {
         reported_unvisited_members = true;
-        for( const std::pair<const std::string, int> &p : positions ) {
-            const std::string &name = p.first;
-            if( !visited_members.count( name ) && !string_starts_with( name, "//" ) ) {
+        for( size_t i = 0; i < positions.size(); ++i ) {
+            const std::string &name = positions[i].first;
+            if( !visited_members[i] && !string_starts_with( name, "//" ) ) {
                 try {
                     throw_error( string_format( "Invalid or misplaced field name \"%s\" in JSON data", name ), name );
                 } catch( const JsonError &e ) {
@@ -173,22 +183,28 @@ int JsonObject::verify_position( const std::string &name,
         // so it will never indicate a valid member position
         return 0;
     }
-    const auto iter = positions.find( name );
-    if( iter == positions.end() ) {
-        if( throw_exception ) {
-            jsin->seek( start );
-            jsin->error( "member not found: " + name );
+    for( const std::pair<std::string, int> &elem : positions ) {
+        if( elem.first == name ) {
+            return elem.second;
         }
-        // 0 is always before the opening brace,
-        // so it will never indicate a valid member position
-        return 0;
     }
-    return iter->second;
+    if( throw_exception ) {
+        jsin->seek( start );
+        jsin->error( "member not found: " + name );
+    }
+    // 0 is always before the opening brace,
+    // so it will never indicate a valid member position
+    return 0;
 }
 
 bool JsonObject::has_member( const std::string &name ) const
 {
-    return positions.count( name ) > 0;
+    for( const std::pair<std::string, int> &elem : positions ) {
+        if( elem.first == name ) {
+            return true;
+        }
+    }
+    return false;
 }
 
 std::string JsonObject::line_number() const
@@ -810,8 +826,16 @@ void JsonIn::seek( int pos )
 
 void JsonIn::eat_whitespace()
 {
-    while( is_whitespace( peek() ) ) {
-        stream->get();
+    // Hot: runs between every pair of tokens. Work on the stream buffer
+    // directly - istream::peek/get construct a sentry per character.
+    std::streambuf *buf = stream->rdbuf();
+    int c = buf->sgetc();
+    while( c != std::char_traits<char>::eof() && is_whitespace( static_cast<char>( c ) ) ) {
+        c = buf->snextc();
+    }
+    if( c == std::char_traits<char>::eof() ) {
+        // Sync eofbit on the stream, as the old peek() loop did.
+        stream->peek();
     }
 }
 
@@ -896,14 +920,19 @@ void JsonIn::skip_string()
         err << "expecting string but found '" << ch << "'";
         error( err.str(), -1 );
     }
-    while( stream->good() ) {
-        stream->get( ch );
-        if( ch == '\\' ) {
+    std::streambuf *buf = stream->rdbuf();
+    while( true ) {
+        const int c = buf->sbumpc();
+        if( c == std::char_traits<char>::eof() ) {
+            // Sync the stream's eof/fail bits, as the old get() loop did.
             stream->get( ch );
-            continue;
-        } else if( ch == '"' ) {
             break;
-        } else if( ch == '\r' || ch == '\n' ) {
+        }
+        if( c == '\\' ) {
+            buf->sbumpc();
+        } else if( c == '"' ) {
+            break;
+        } else if( c == '\r' || c == '\n' ) {
             error( "string not closed before end of line", -1 );
         }
     }
@@ -1169,8 +1198,22 @@ std::string JsonIn::get_string()
             err = "expected string but got '" + std::string( 1, ch ) + "'";
             break;
         }
-        // add chars to the string, one at a time
-        do {
+        // Most strings are short runs of plain ASCII with no escapes.
+        // Consume those straight from the stream buffer - one bounds check
+        // per character instead of a sentry-paying peek/get pair - and drop
+        // to get_escaped_or_unicode only for escapes, multibyte utf8 and
+        // malformed input.
+        std::streambuf *buf = stream->rdbuf();
+        while( true ) {
+            int c = buf->sgetc();
+            while( c != std::char_traits<char>::eof() ) {
+                const unsigned char uc = static_cast<unsigned char>( c );
+                if( uc == '"' || uc == '\\' || uc < 0x20 || uc >= 0x80 ) {
+                    break;
+                }
+                s += static_cast<char>( c );
+                c = buf->snextc();
+            }
             ch = stream->peek();
             if( !stream->good() ) {
                 err = "read operation failed";
@@ -1184,7 +1227,7 @@ std::string JsonIn::get_string()
             if( !get_escaped_or_unicode( *stream, s, err ) ) {
                 break;
             }
-        } while( stream->good() );
+        }
     } while( false );
     if( success ) {
         end_value();
@@ -2284,10 +2327,10 @@ JsonIn &JsonValue::seek() const
 
 JsonValue JsonObject::get_member( const std::string &name ) const
 {
-    const auto iter = positions.find( name );
-    if( !jsin || iter == positions.end() ) {
+    const int pos = jsin ? verify_position( name, false ) : 0;
+    if( !pos ) {
         throw_error( "missing required field \"" + name + "\" in object: " + str() );
     }
     mark_visited( name );
-    return JsonValue( *jsin, iter->second );
+    return JsonValue( *jsin, pos );
 }
@@ -1034,12 +1034,16 @@ class JsonOut
 class JsonObject
 {
     private:
-        std::map<std::string, int> positions;
+        // Members in file order. Objects are small, so linear scans beat a
+        // node-based map here and skip the per-member node allocations -
+        // deserializing a large save constructs one of these per object.
+        std::vector<std::pair<std::string, int>> positions;
         int start;
         int end_;
         bool final_separator;
 #ifndef CATA_IN_TOOL
-        mutable std::set<std::string> visited_members;
+        // Parallel to positions.
+        mutable std::vector<bool> visited_members;
         mutable bool report_unvisited_members = true;
         mutable bool reported_unvisited_members = false;
 #endif
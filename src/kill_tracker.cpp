@@ -161,3 +161,9 @@ void kill_tracker::notify( const cata::event &e )
             break;
     }
 }
+
+bool kill_tracker::is_interested_in( event_type type ) const
+{
+    return type == event_type::character_kills_monster ||
+           type == event_type::character_kills_character;
+}
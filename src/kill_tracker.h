@@ -37,6 +37,7 @@ class kill_tracker : public event_subscriber
         void clear();
 
         void notify( const cata::event & ) override;
+        bool is_interested_in( event_type ) const override;
 
         void serialize( JsonOut & ) const;
         void deserialize( const JsonObject &data );
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "epoch_cache.h"
 #include "game_constants.h"
 #include "lightmap.h"
 #include "point.h"
@@ -25,7 +26,9 @@ struct level_cache {
 
         std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
         bool outside_cache_dirty = false;
-        bool floor_cache_dirty = false;
+        // Per-submap dirty bits, like transparency_cache_dirty: a floor
+        // change only forces a rebuild of the submaps it touched.
+        std::bitset<MAPSIZE *MAPSIZE> floor_cache_dirty;
         bool seen_cache_dirty = false;
         // This is a single value indicating that the entire level is floored.
         bool no_floor_gaps = false;
@@ -33,8 +36,9 @@ struct level_cache {
         four_quadrants lm[MAPSIZE_X][MAPSIZE_Y];
         float sm[MAPSIZE_X][MAPSIZE_Y];
         // To prevent redundant ray casting into neighbors: precalculate bulk light source positions.
-        // This is only valid for the duration of generate_lightmap
-        float light_source_buffer[MAPSIZE_X][MAPSIZE_Y];
+        // This is only valid for the duration of generate_lightmap; the
+        // epoch stamp makes the per-pass wipe O(1) instead of a memset.
+        epoch_cache<float, MAPSIZE_X, MAPSIZE_Y> light_source_buffer;
 
         // if false, means tile is under the roof ("inside"), true means tile is "outside"
         // "inside" tiles are protected from sun, rain, etc. (see ter_furn_flag::TFLAG_INDOORS flag)
@@ -397,7 +397,7 @@ void map::generate_lightmap( const int zlev )
      * Step 4: Profit!
      */
     auto &light_source_buffer = map_cache.light_source_buffer;
-    std::memset( light_source_buffer, 0, sizeof( light_source_buffer ) );
+    light_source_buffer.clear();
 
     constexpr std::array<int, 4> dir_x = { {  0, -1, 1, 0 } };    //    [0]
     constexpr std::array<int, 4> dir_y = { { -1,  0, 0, 1 } };    // [1][X][2]
@@ -583,8 +583,9 @@ void map::generate_lightmap( const int zlev )
     const tripoint cache_start( 0, 0, zlev );
     const tripoint cache_end( LIGHTMAP_CACHE_X, LIGHTMAP_CACHE_Y, zlev );
     for( const tripoint &p : points_in_rectangle( cache_start, cache_end ) ) {
-        if( light_source_buffer[p.x][p.y] > 0.0 ) {
-            apply_light_source( p, light_source_buffer[p.x][p.y] );
+        const float buffered = light_source_buffer.get( p.xy() );
+        if( buffered > 0.0 ) {
+            apply_light_source( p, buffered );
         }
     }
     for( const std::pair<tripoint, float> &elem : lm_override ) {
@@ -594,8 +595,8 @@ void map::generate_lightmap( const int zlev )
 
 void map::add_light_source( const tripoint &p, float luminance )
 {
-    auto &light_source_buffer = get_cache( p.z ).light_source_buffer;
-    light_source_buffer[p.x][p.y] = std::max( luminance, light_source_buffer[p.x][p.y] );
+    float &buffered = get_cache( p.z ).light_source_buffer.get_or_init( p.xy() );
+    buffered = std::max( luminance, buffered );
 }
 
 // Tile light/transparency: 3D
@@ -840,6 +841,11 @@ void castLight( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
         delta.y = -distance;
         bool started_row = false;
         T current_transparency( 0.0 );
+        // calc is relatively expensive (sight_calc is an exp()) and
+        // depends only on the distance while scanning one row; adjacent
+        // tiles usually round to the same distance, so memoize it.
+        int cached_dist = -1;
+        T cached_intensity( 0.0 );
         float away = start - ( -distance + 0.5f ) / ( -distance -
                      0.5f ); //The distance between our first leadingEdge and start
 
@@ -863,7 +869,11 @@ void castLight( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
             }
 
             const int dist = rl_dist( tripoint_zero, delta ) + offsetDistance;
-            last_intensity = calc( numerator, cumulative_transparency, dist );
+            if( dist != cached_dist ) {
+                cached_intensity = calc( numerator, cumulative_transparency, dist );
+                cached_dist = dist;
+            }
+            last_intensity = cached_intensity;
 
             T new_transparency = input_array[ current.x ][ current.y ];
 
@@ -952,6 +962,16 @@ castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
     const fragment_cloud( &input_array )[MAPSIZE_X][MAPSIZE_Y],
     const point &offset, int offsetDistance, fragment_cloud numerator );
 
+void map::cast_shared_seen_grid( shared_seen_grid &target ) const
+{
+    const level_cache &map_cache = get_cache( target.origin.z );
+    std::uninitialized_fill_n( &target.grid[0][0], MAPSIZE_X * MAPSIZE_Y,
+                               LIGHT_TRANSPARENCY_SOLID );
+    target.grid[target.origin.x][target.origin.y] = VISIBILITY_FULL;
+    castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+        target.grid, map_cache.transparency_cache, target.origin.xy(), 0 );
+}
+
 /**
  * Calculates the Field Of View for the provided map from the given x, y
  * coordinates. Returns a lightmap for a result where the values represent a
@@ -1110,7 +1130,7 @@ void map::apply_light_source( const tripoint &p, float luminance )
     four_quadrants( &lm )[MAPSIZE_X][MAPSIZE_Y] = cache.lm;
     float ( &sm )[MAPSIZE_X][MAPSIZE_Y] = cache.sm;
     float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y] = cache.transparency_cache;
-    float ( &light_source_buffer )[MAPSIZE_X][MAPSIZE_Y] = cache.light_source_buffer;
+    auto &light_source_buffer = cache.light_source_buffer;
 
     const point p2( p.xy() );
 
@@ -1142,10 +1162,10 @@ void map::apply_light_source( const tripoint &p, float luminance )
            sy
     */
     const int peer_inbounds = LIGHTMAP_CACHE_X - 1;
-    bool north = ( p2.y != 0 && light_source_buffer[p2.x][p2.y - 1] < luminance );
-    bool south = ( p2.y != peer_inbounds && light_source_buffer[p2.x][p2.y + 1] < luminance );
-    bool east = ( p2.x != peer_inbounds && light_source_buffer[p2.x + 1][p2.y] < luminance );
-    bool west = ( p2.x != 0 && light_source_buffer[p2.x - 1][p2.y] < luminance );
+    bool north = ( p2.y != 0 && light_source_buffer.get( p2 + point_north ) < luminance );
+    bool south = ( p2.y != peer_inbounds && light_source_buffer.get( p2 + point_south ) < luminance );
+    bool east = ( p2.x != peer_inbounds && light_source_buffer.get( p2 + point_east ) < luminance );
+    bool west = ( p2.x != 0 && light_source_buffer.get( p2 + point_west ) < luminance );
 
     if( north ) {
         castLight < 1, 0, 0, -1, float, four_quadrants, light_calc, light_check,
@@ -26,199 +26,17 @@ double iso_tangent( double distance, const units::angle &vertex )
 void bresenham( const point &p1, const point &p2, int t,
                 const std::function<bool( const point & )> &interact )
 {
-    // The slope components.
-    const point d = p2 - p1;
-    // Signs of slope values.
-    const point s( ( d.x == 0 ) ? 0 : sgn( d.x ), ( d.y == 0 ) ? 0 : sgn( d.y ) );
-    // Absolute values of slopes x2 to avoid rounding errors.
-    const point a = d.abs() * 2;
-
-    point cur = p1;
-
-    if( a.x == a.y ) {
-        while( cur.x != p2.x ) {
-            cur.y += s.y;
-            cur.x += s.x;
-            if( !interact( cur ) ) {
-                break;
-            }
-        }
-    } else if( a.x > a.y ) {
-        while( cur.x != p2.x ) {
-            if( t > 0 ) {
-                cur.y += s.y;
-                t -= a.x;
-            }
-            cur.x += s.x;
-            t += a.y;
-            if( !interact( cur ) ) {
-                break;
-            }
-        }
-    } else {
-        while( cur.y != p2.y ) {
-            if( t > 0 ) {
-                cur.x += s.x;
-                t -= a.y;
-            }
-            cur.y += s.y;
-            t += a.x;
-            if( !interact( cur ) ) {
-                break;
-            }
-        }
-    }
+    bresenham( p1, p2, t, [&interact]( const point & p ) {
+        return interact( p );
+    } );
 }
 
 void bresenham( const tripoint &loc1, const tripoint &loc2, int t, int t2,
                 const std::function<bool( const tripoint & )> &interact )
 {
-    // The slope components.
-    const tripoint d( -loc1 + loc2 );
-    // The signs of the slopes.
-    const tripoint s( ( d.x == 0 ? 0 : sgn( d.x ) ), ( d.y == 0 ? 0 : sgn( d.y ) ),
-                      ( d.z == 0 ? 0 : sgn( d.z ) ) );
-    // Absolute values of slope components, x2 to avoid rounding errors.
-    const tripoint a( std::abs( d.x ) * 2, std::abs( d.y ) * 2, std::abs( d.z ) * 2 );
-
-    tripoint cur( loc1 );
-
-    if( a.z == 0 ) {
-        if( a.x == a.y ) {
-            while( cur.x != loc2.x ) {
-                cur.y += s.y;
-                cur.x += s.x;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else if( a.x > a.y ) {
-            while( cur.x != loc2.x ) {
-                if( t > 0 ) {
-                    cur.y += s.y;
-                    t -= a.x;
-                }
-                cur.x += s.x;
-                t += a.y;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else {
-            while( cur.y != loc2.y ) {
-                if( t > 0 ) {
-                    cur.x += s.x;
-                    t -= a.y;
-                }
-                cur.y += s.y;
-                t += a.x;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        }
-    } else {
-        if( a.x == a.y && a.y == a.z ) {
-            while( cur.x != loc2.x ) {
-                cur.z += s.z;
-                cur.y += s.y;
-                cur.x += s.x;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else if( ( a.z > a.x ) && ( a.z > a.y ) ) {
-            while( cur.z != loc2.z ) {
-                if( t > 0 ) {
-                    cur.x += s.x;
-                    t -= a.z;
-                }
-                if( t2 > 0 ) {
-                    cur.y += s.y;
-                    t2 -= a.z;
-                }
-                cur.z += s.z;
-                t += a.x;
-                t2 += a.y;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else if( a.x == a.y ) {
-            while( cur.x != loc2.x ) {
-                if( t > 0 ) {
-                    cur.z += s.z;
-                    t -= a.x;
-                }
-                cur.y += s.y;
-                cur.x += s.x;
-                t += a.z;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else if( a.x == a.z ) {
-            while( cur.x != loc2.x ) {
-                if( t > 0 ) {
-                    cur.y += s.y;
-                    t -= a.x;
-                }
-                cur.z += s.z;
-                cur.x += s.x;
-                t += a.y;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else if( a.y == a.z ) {
-            while( cur.y != loc2.y ) {
-                if( t > 0 ) {
-                    cur.x += s.x;
-                    t -= a.z;
-                }
-                cur.y += s.y;
-                cur.z += s.z;
-                t += a.x;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else if( a.x > a.y ) {
-            while( cur.x != loc2.x ) {
-                if( t > 0 ) {
-                    cur.y += s.y;
-                    t -= a.x;
-                }
-                if( t2 > 0 ) {
-                    cur.z += s.z;
-                    t2 -= a.x;
-                }
-                cur.x += s.x;
-                t += a.y;
-                t2 += a.z;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        } else { //dy > dx >= dz
-            while( cur.y != loc2.y ) {
-                if( t > 0 ) {
-                    cur.x += s.x;
-                    t -= a.y;
-                }
-                if( t2 > 0 ) {
-                    cur.z += s.z;
-                    t2 -= a.y;
-                }
-                cur.y += s.y;
-                t += a.x;
-                t2 += a.z;
-                if( !interact( cur ) ) {
-                    break;
-                }
-            }
-        }
-    }
+    bresenham( loc1, loc2, t, t2, [&interact]( const tripoint & p ) {
+        return interact( p );
+    } );
 }
 
 //Trying to pull points out of a tripoint vector is messy and
@@ -257,12 +75,24 @@ std::vector <tripoint> line_to( const tripoint &loc1, const tripoint &loc2, int
     return line;
 }
 
-float rl_dist_exact( const tripoint &loc1, const tripoint &loc2 )
+template<distance_metric Metric>
+static void rl_dist_batch_impl( const tripoint &origin, const std::vector<tripoint> &targets,
+                                std::vector<int> &out )
+{
+    out.resize( targets.size() );
+    for( size_t i = 0; i < targets.size(); ++i ) {
+        out[i] = rl_dist_t<Metric>( origin, targets[i] );
+    }
+}
+
+void rl_dist_batch( const tripoint &origin, const std::vector<tripoint> &targets,
+                    std::vector<int> &out )
 {
     if( trigdist ) {
-        return trig_dist( loc1, loc2 );
+        rl_dist_batch_impl<distance_metric::TRIG>( origin, targets, out );
+    } else {
+        rl_dist_batch_impl<distance_metric::SQUARE>( origin, targets, out );
     }
-    return square_dist( loc1, loc2 );
 }
 
 int manhattan_dist( const point &loc1, const point &loc2 )
@@ -8,6 +8,7 @@
 #include <iosfwd>
 #include <vector>
 
+#include "enums.h"
 #include "point.h"
 #include "units_fwd.h"
 
@@ -127,6 +128,213 @@ void bresenham( const point &p1, const point &p2, int t,
 void bresenham( const tripoint &loc1, const tripoint &loc2, int t, int t2,
                 const std::function<bool( const tripoint & )> &interact );
 
+/**
+ * Template forms of the Bresenham walkers above. Lambdas bind to these
+ * directly, so the functor is inlined and nothing is allocated - the
+ * std::function overloads exist for callers that already hold one. The
+ * walk stops when the functor returns false; the starting point is not
+ * visited.
+ */
+template<typename Interact>
+inline void bresenham( const point &p1, const point &p2, int t,
+                       Interact &&interact )
+{
+    // The slope components.
+    const point d = p2 - p1;
+    // Signs of slope values.
+    const point s( ( d.x == 0 ) ? 0 : sgn( d.x ), ( d.y == 0 ) ? 0 : sgn( d.y ) );
+    // Absolute values of slopes x2 to avoid rounding errors.
+    const point a = d.abs() * 2;
+
+    point cur = p1;
+
+    if( a.x == a.y ) {
+        while( cur.x != p2.x ) {
+            cur.y += s.y;
+            cur.x += s.x;
+            if( !interact( cur ) ) {
+                break;
+            }
+        }
+    } else if( a.x > a.y ) {
+        while( cur.x != p2.x ) {
+            if( t > 0 ) {
+                cur.y += s.y;
+                t -= a.x;
+            }
+            cur.x += s.x;
+            t += a.y;
+            if( !interact( cur ) ) {
+                break;
+            }
+        }
+    } else {
+        while( cur.y != p2.y ) {
+            if( t > 0 ) {
+                cur.x += s.x;
+                t -= a.y;
+            }
+            cur.y += s.y;
+            t += a.x;
+            if( !interact( cur ) ) {
+                break;
+            }
+        }
+    }
+}
+
+template<typename Interact>
+inline void bresenham( const tripoint &loc1, const tripoint &loc2, int t, int t2,
+                       Interact &&interact )
+{
+    // The slope components.
+    const tripoint d( -loc1 + loc2 );
+    // The signs of the slopes.
+    const tripoint s( ( d.x == 0 ? 0 : sgn( d.x ) ), ( d.y == 0 ? 0 : sgn( d.y ) ),
+                      ( d.z == 0 ? 0 : sgn( d.z ) ) );
+    // Absolute values of slope components, x2 to avoid rounding errors.
+    const tripoint a( std::abs( d.x ) * 2, std::abs( d.y ) * 2, std::abs( d.z ) * 2 );
+
+    tripoint cur( loc1 );
+
+    if( a.z == 0 ) {
+        if( a.x == a.y ) {
+            while( cur.x != loc2.x ) {
+                cur.y += s.y;
+                cur.x += s.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x > a.y ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                cur.x += s.x;
+                t += a.y;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else {
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.y;
+                }
+                cur.y += s.y;
+                t += a.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        }
+    } else {
+        if( a.x == a.y && a.y == a.z ) {
+            while( cur.x != loc2.x ) {
+                cur.z += s.z;
+                cur.y += s.y;
+                cur.x += s.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( ( a.z > a.x ) && ( a.z > a.y ) ) {
+            while( cur.z != loc2.z ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.z;
+                }
+                if( t2 > 0 ) {
+                    cur.y += s.y;
+                    t2 -= a.z;
+                }
+                cur.z += s.z;
+                t += a.x;
+                t2 += a.y;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x == a.y ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.z += s.z;
+                    t -= a.x;
+                }
+                cur.y += s.y;
+                cur.x += s.x;
+                t += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x == a.z ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                cur.z += s.z;
+                cur.x += s.x;
+                t += a.y;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.y == a.z ) {
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.z;
+                }
+                cur.y += s.y;
+                cur.z += s.z;
+                t += a.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x > a.y ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                if( t2 > 0 ) {
+                    cur.z += s.z;
+                    t2 -= a.x;
+                }
+                cur.x += s.x;
+                t += a.y;
+                t2 += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else { //dy > dx >= dz
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.y;
+                }
+                if( t2 > 0 ) {
+                    cur.z += s.z;
+                    t2 -= a.y;
+                }
+                cur.y += s.y;
+                t += a.x;
+                t2 += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        }
+    }
+}
+
 tripoint move_along_line( const tripoint &loc, const std::vector<tripoint> &line,
                           int distance );
 // The "t" value decides WHICH Bresenham line is used.
@@ -158,19 +366,67 @@ inline int square_dist( const point &loc1, const point &loc2 )
     return std::max( d.x, d.y );
 }
 
+/**
+ * Compile-time metric selection. @ref rl_dist re-tests the trigdist
+ * option on every call; loops taking many distances can instead resolve
+ * @ref current_distance_metric once and instantiate their kernel on it,
+ * the way rl_dist_batch does.
+ */
+enum class distance_metric : int {
+    // Chebyshev distance, the roguelike default
+    SQUARE,
+    // Euclidean distance, the "circular distances" option
+    TRIG
+};
+
+inline distance_metric current_distance_metric()
+{
+    return trigdist ? distance_metric::TRIG : distance_metric::SQUARE;
+}
+
+template<distance_metric Metric>
+inline float rl_dist_exact_t( const tripoint &loc1, const tripoint &loc2 )
+{
+    // Metric is a constant expression, so the branch folds away.
+    return Metric == distance_metric::TRIG
+           ? trig_dist( loc1, loc2 )
+           : static_cast<float>( square_dist( loc1, loc2 ) );
+}
+
+template<distance_metric Metric>
+inline int rl_dist_t( const tripoint &loc1, const tripoint &loc2 )
+{
+    return Metric == distance_metric::TRIG
+           ? static_cast<int>( trig_dist( loc1, loc2 ) )
+           : square_dist( loc1, loc2 );
+}
+
+template<distance_metric Metric>
+inline int rl_dist_t( const point &a, const point &b )
+{
+    return rl_dist_t<Metric>( tripoint( a, 0 ), tripoint( b, 0 ) );
+}
+
 // Choose between the above two according to the "circular distances" option
 inline int rl_dist( const tripoint &loc1, const tripoint &loc2 )
 {
-    if( trigdist ) {
-        return trig_dist( loc1, loc2 );
-    }
-    return square_dist( loc1, loc2 );
+    return trigdist ? rl_dist_t<distance_metric::TRIG>( loc1, loc2 )
+           : rl_dist_t<distance_metric::SQUARE>( loc1, loc2 );
 }
 inline int rl_dist( const point &a, const point &b )
 {
     return rl_dist( tripoint( a, 0 ), tripoint( b, 0 ) );
 }
 
+/**
+ * Distances from @p origin to every element of @p targets, written to
+ * @p out (resized to match). The metric is resolved once at entry and
+ * the loop is instantiated on it, so the per-element work is branch
+ * free and the square variant vectorizes.
+ */
+void rl_dist_batch( const tripoint &origin, const std::vector<tripoint> &targets,
+                    std::vector<int> &out );
+
 /**
  * Helper type for the return value of dist_fast().
  *
@@ -227,7 +483,11 @@ inline FastDistanceApproximation rl_dist_fast( const point &a, const point &b )
     return rl_dist_fast( tripoint( a, 0 ), tripoint( b, 0 ) );
 }
 
-float rl_dist_exact( const tripoint &loc1, const tripoint &loc2 );
+inline float rl_dist_exact( const tripoint &loc1, const tripoint &loc2 )
+{
+    return trigdist ? rl_dist_exact_t<distance_metric::TRIG>( loc1, loc2 )
+           : rl_dist_exact_t<distance_metric::SQUARE>( loc1, loc2 );
+}
 // Sum of distance in both axes
 int manhattan_dist( const point &loc1, const point &loc2 );
 
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "memory_fast.h"
+#include "pathfinding.h"
 #include "point.h"
 
 template<typename Key, typename Value>
@@ -73,5 +74,5 @@ const std::list<typename lru_cache<Key, Value>::Pair> &lru_cache<Key, Value>::li
 
 // explicit template initialization for lru_cache of all types
 template class lru_cache<tripoint, int>;
-template class lru_cache<point, char>;
 template class lru_cache<std::string, shared_ptr_fast<std::istringstream>>;
+template class lru_cache<route_cache_key, route_cache_entry>;
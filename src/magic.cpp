@@ -2441,3 +2441,8 @@ void spell_events::notify( const cata::event &e )
 
     }
 }
+
+bool spell_events::is_interested_in( event_type type ) const
+{
+    return type == event_type::player_levels_spell;
+}
@@ -179,6 +179,7 @@ class spell_events : public event_subscriber
 {
     public:
         void notify( const cata::event & ) override;
+        bool is_interested_in( event_type ) const override;
 };
 
 class spell_type
@@ -12,6 +12,7 @@
 #include <queue>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -129,6 +130,46 @@ static void build_line( spell_detail::line_iterable line, const tripoint &source
         line.next();
     }
 }
+// Offsets within @ref rl_dist radius of the origin, cached per radius. The
+// disc shape depends on the trigdist option, so the cache is rebuilt when
+// that changes.
+static const std::vector<point> &blast_mask( int radius )
+{
+    static std::map<int, std::vector<point>> masks;
+    static bool masks_trigdist = trigdist;
+    if( masks_trigdist != trigdist ) {
+        masks.clear();
+        masks_trigdist = trigdist;
+    }
+    auto iter = masks.find( radius );
+    if( iter == masks.end() ) {
+        std::vector<point> mask;
+        for( int x = -radius; x <= radius; x++ ) {
+            for( int y = -radius; y <= radius; y++ ) {
+                const point offset( x, y );
+                if( rl_dist( point_zero, offset ) <= radius ) {
+                    mask.push_back( offset );
+                }
+            }
+        }
+        iter = masks.emplace( radius, std::move( mask ) ).first;
+    }
+    return iter->second;
+}
+// Bresenham path from the origin to delta, cached. The aoe shapes otherwise
+// rebuild the same short lines for every affected tile of every cast.
+static const std::vector<tripoint> &line_mask( const tripoint &delta )
+{
+    static std::unordered_map<tripoint, std::vector<tripoint>> masks;
+    if( masks.size() > 16384 ) {
+        masks.clear();
+    }
+    auto iter = masks.find( delta );
+    if( iter == masks.end() ) {
+        iter = masks.emplace( delta, line_to( tripoint_zero, delta ) ).first;
+    }
+    return iter->second;
+}
 } // namespace spell_detail
 
 void spell_effect::short_range_teleport( const spell &sp, Creature &caster, const tripoint &target )
@@ -196,9 +237,8 @@ static bool in_spell_aoe( const tripoint &start, const tripoint &end, const int
         return true;
     }
     map &here = get_map();
-    const std::vector<tripoint> trajectory = line_to( start, end );
-    for( const tripoint &pt : trajectory ) {
-        if( here.impassable( pt ) ) {
+    for( const tripoint &pt : spell_detail::line_mask( end - start ) ) {
+        if( here.impassable( start + pt ) ) {
             return false;
         }
     }
@@ -210,8 +250,13 @@ std::set<tripoint> spell_effect::spell_effect_blast( const override_parameters &
         const tripoint &target )
 {
     std::set<tripoint> targets;
+    ::map &here = get_map();
     // TODO: Make this breadth-first
-    for( const tripoint &potential_target : get_map().points_in_radius( target, params.aoe_radius ) ) {
+    for( const point &offset : spell_detail::blast_mask( params.aoe_radius ) ) {
+        const tripoint potential_target = target + offset;
+        if( !here.inbounds( potential_target ) ) {
+            continue;
+        }
         if( in_spell_aoe( target, potential_target, params.aoe_radius, params.ignore_walls ) ) {
             targets.emplace( potential_target );
         }
@@ -243,8 +288,8 @@ static std::set<tripoint> spell_effect_cone_range_override( const spell_effect::
     if( !params.ignore_walls ) {
         map &here = get_map();
         for( const tripoint &ep : end_points ) {
-            std::vector<tripoint> trajectory = line_to( source, ep );
-            for( const tripoint &tp : trajectory ) {
+            for( const tripoint &off : spell_detail::line_mask( ep - source ) ) {
+                const tripoint tp = source + off;
                 if( here.passable( tp ) ) {
                     targets.emplace( tp );
                 } else {
@@ -702,7 +747,7 @@ static void move_field( map &here, const tripoint &from, const tripoint &to )
 {
     field &src_field = here.field_at( from );
     std::map<field_type_id, int> moving_fields;
-    for( const std::pair<const field_type_id, field_entry> &fd : src_field ) {
+    for( const std::pair<field_type_id, field_entry> &fd : src_field ) {
         if( fd.first.is_valid() && !fd.first.id().is_null() ) {
             const int intensity = fd.second.get_field_intensity();
             moving_fields.emplace( fd.first, intensity );
@@ -822,13 +867,21 @@ void spell_effect::directed_push( const spell &sp, Creature &caster, const tripo
     // -1 is push and 1 is pull
     const int sign = sp.damage() > 0 ? -1 : 1;
 
-    std::multimap<int, tripoint> targets_ordered_by_range;
-    for( const tripoint &pt : area ) {
-        targets_ordered_by_range.emplace( sign * rl_dist( pt, caster.pos() ), pt );
-    }
+    const std::vector<tripoint> area_pts( area.begin(), area.end() );
+    std::vector<int> area_dists;
+    rl_dist_batch( caster.pos(), area_pts, area_dists );
+    std::vector<std::pair<int, tripoint>> targets_ordered_by_range;
+    targets_ordered_by_range.reserve( area_pts.size() );
+    for( size_t i = 0; i < area_pts.size(); ++i ) {
+        targets_ordered_by_range.emplace_back( sign * area_dists[i], area_pts[i] );
+    }
+    std::stable_sort( targets_ordered_by_range.begin(), targets_ordered_by_range.end(),
+    []( const std::pair<int, tripoint> &l, const std::pair<int, tripoint> &r ) {
+        return l.first < r.first;
+    } );
 
     creature_tracker &creatures = get_creature_tracker();
-    for( const std::pair<const int, tripoint> &pair : targets_ordered_by_range ) {
+    for( const std::pair<int, tripoint> &pair : targets_ordered_by_range ) {
         const tripoint &push_point = pair.second;
         const units::angle angle = coord_to_angle( caster.pos(), target );
         // positive is push, negative is pull
@@ -1282,6 +1282,7 @@ void main_menu::world_tab()
             if( action == "RIGHT" || action == "NEXT_TAB" || action == "CONFIRM" ) {
                 if( sel3 == 2 ) { // Active World Mods
                     WORLDPTR world = world_generator->get_world( all_worldnames[sel2 - 1] );
+                    world->ensure_details_loaded();
                     world_generator->show_active_world_mods( world->active_mod_order );
 
                 } else {
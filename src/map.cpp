@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <climits>
 #include <cmath>
 #include <cstdlib>
@@ -9,6 +10,7 @@
 #include <ostream>
 #include <queue>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 
@@ -100,6 +102,9 @@
 #include "weather.h"
 #include "weighted_list.h"
 
+// Tested on every map cache rebuild, so cached instead of looked up by name.
+static cached_option<bool> parallel_map_cache( "PARALLEL_MAP_CACHE", false );
+
 static const itype_id itype_battery( "battery" );
 static const itype_id itype_nail( "nail" );
 
@@ -330,6 +335,7 @@ std::unique_ptr<vehicle> map::detach_vehicle( vehicle *veh )
             ch.zone_vehicles.erase( veh );
             std::unique_ptr<vehicle> result = std::move( current_submap->vehicles[i] );
             current_submap->vehicles.erase( current_submap->vehicles.begin() + i );
+            current_submap->modified = true;
             if( veh->tracking_on ) {
                 overmap_buffer.remove_vehicle( veh );
             }
@@ -1206,7 +1212,9 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
         auto src_submap_veh_it = src_submap->vehicles.begin() + our_i;
         dst_submap->vehicles.push_back( std::move( *src_submap_veh_it ) );
         src_submap->vehicles.erase( src_submap_veh_it );
+        src_submap->modified = true;
         dst_submap->is_uniform = false;
+        dst_submap->modified = true;
         invalidate_max_populated_zlev( dst.z );
     }
     if( need_update ) {
@@ -1397,13 +1405,13 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture, const bool
 
     if( old_t.has_flag( ter_furn_flag::TFLAG_NO_FLOOR ) != new_t.has_flag(
             ter_furn_flag::TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
+        set_floor_cache_dirty( p );
         set_seen_cache_dirty( p );
     }
 
     if( old_t.has_flag( ter_furn_flag::TFLAG_SUN_ROOF_ABOVE ) != new_t.has_flag(
             ter_furn_flag::TFLAG_SUN_ROOF_ABOVE ) ) {
-        set_floor_cache_dirty( p.z + 1 );
+        set_floor_cache_dirty( p + tripoint_above );
     }
 
     invalidate_max_populated_zlev( p.z );
@@ -1411,7 +1419,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture, const bool
     set_memory_seen_cache_dirty( p );
 
     // TODO: Limit to changes that affect move cost, traps and stairs
-    set_pathfinding_cache_dirty( p.z );
+    set_pathfinding_cache_dirty( p );
 
     // Make sure the furniture falls if it needs to
     support_dirty( p );
@@ -1715,7 +1723,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
 
     if( new_t.has_flag( ter_furn_flag::TFLAG_NO_FLOOR ) != old_t.has_flag(
             ter_furn_flag::TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
+        set_floor_cache_dirty( p );
         // It's a set, not a flag
         support_cache_dirty.insert( p );
         set_seen_cache_dirty( p );
@@ -1725,7 +1733,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     set_memory_seen_cache_dirty( p );
 
     // TODO: Limit to changes that affect move cost, traps and stairs
-    set_pathfinding_cache_dirty( p.z );
+    set_pathfinding_cache_dirty( p );
 
     tripoint above( p.xy(), p.z + 1 );
     // Make sure that if we supported something and no longer do so, it falls down
@@ -3552,7 +3560,7 @@ void map::bash_vehicle( const tripoint &p, bash_params &params )
 void map::bash_field( const tripoint &p, bash_params &params )
 {
     std::vector<field_type_id> to_remove;
-    for( const std::pair<const field_type_id, field_entry> &fd : field_at( p ) ) {
+    for( const std::pair<field_type_id, field_entry> &fd : field_at( p ) ) {
         if( fd.first->bash_info.str_min > -1 ) {
             params.did_bash = true;
             params.bashed_solid = true; // To prevent bashing furniture/vehicles
@@ -3749,7 +3757,7 @@ void map::shoot( const tripoint &p, projectile &proj, const bool hit_items )
     if( fields_there.field_count() > 0 ) {
         // Need to make a copy since 'remove_field' modifies the value
         field fields_copy = fields_there;
-        for( const std::pair<const field_type_id, field_entry> &fd : fields_copy ) {
+        for( const std::pair<field_type_id, field_entry> &fd : fields_copy ) {
             if( fd.first->bash_info.str_min > 0 ) {
                 if( incendiary ) {
                     add_field( p, fd_fire, fd.second.get_field_intensity() - 1 );
@@ -4124,8 +4132,17 @@ map_stack::iterator map::i_rem( const tripoint &p, const map_stack::const_iterat
     }
 
     current_submap->update_lum_rem( l, *it );
+    bump_items_generation();
 
-    return current_submap->get_items( l ).erase( it );
+    cata::colony<item> &stack = current_submap->get_items( l );
+    const map_stack::iterator result = stack.erase( it );
+    if( stack.empty() ) {
+        // Erasing the last element keeps the memory block for reuse;
+        // release it so looted tiles don't pin an item-sized allocation.
+        stack.trim();
+        return stack.end();
+    }
+    return result;
 }
 
 void map::i_rem( const tripoint &p, item *it )
@@ -4156,8 +4173,11 @@ void map::i_clear( const tripoint &p )
 
     current_submap->set_lum( l, 0 );
     current_submap->get_items( l ).clear();
+    bump_items_generation();
 }
 
+static std::vector<item> merge_item_batch( std::vector<item> objs );
+
 std::vector<item *> map::spawn_items( const tripoint &p, const std::vector<item> &new_items )
 {
     std::vector<item *> ret;
@@ -4165,7 +4185,7 @@ std::vector<item *> map::spawn_items( const tripoint &p, const std::vector<item>
         return ret;
     }
     const bool swimmable = has_flag( ter_furn_flag::TFLAG_SWIMMABLE, p );
-    for( const item &new_item : new_items ) {
+    for( const item &new_item : merge_item_batch( new_items ) ) {
 
         if( new_item.made_of( phase_id::LIQUID ) && swimmable ) {
             continue;
@@ -4349,6 +4369,42 @@ item &map::add_item_or_charges( const tripoint &pos, item obj, bool overflow )
     return null_item_reference();
 }
 
+// Merge a batch of incoming items with each other before they reach the
+// map. Surviving charge stacks are indexed by type, so every absorbed
+// item checks only its own merge candidates; without this, dropping a
+// large stack one merge-scan at a time is quadratic in the tile's size.
+static std::vector<item> merge_item_batch( std::vector<item> objs )
+{
+    std::map<itype_id, std::vector<size_t>> merge_candidates;
+    std::vector<item> result;
+    result.reserve( objs.size() );
+    for( item &obj : objs ) {
+        if( obj.count_by_charges() ) {
+            bool absorbed = false;
+            std::vector<size_t> &candidates = merge_candidates[obj.typeId()];
+            for( const size_t candidate : candidates ) {
+                if( result[candidate].merge_charges( obj ) ) {
+                    absorbed = true;
+                    break;
+                }
+            }
+            if( absorbed ) {
+                continue;
+            }
+            candidates.push_back( result.size() );
+        }
+        result.push_back( std::move( obj ) );
+    }
+    return result;
+}
+
+void map::add_items_or_charges( const tripoint &pos, std::vector<item> objs, bool overflow )
+{
+    for( item &obj : merge_item_batch( std::move( objs ) ) ) {
+        add_item_or_charges( pos, std::move( obj ), overflow );
+    }
+}
+
 item &map::add_item( const tripoint &p, item new_item )
 {
     static const flag_id json_flag_PRESERVE_SPAWN_OMT( "PRESERVE_SPAWN_OMT" );
@@ -4410,7 +4466,9 @@ item &map::add_item( const tripoint &p, item new_item )
     }
 
     current_submap->is_uniform = false;
+    current_submap->modified = true;
     invalidate_max_populated_zlev( p.z );
+    bump_items_generation();
 
     current_submap->update_lum_add( l, new_item );
 
@@ -4705,6 +4763,17 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
     // If they are destroyed before processing, they don't get processed.
     std::vector<item_reference> active_items = current_submap.active_items.get_for_processing();
     const point grid_offset( gridp.x * SEEX, gridp.y * SEEY );
+    // Group the references by tile, so the furniture/terrain lookups below are
+    // made once per location instead of once per item; stocked tiles (fridges,
+    // root cellars) hold dozens of active items sharing one environment.
+    std::sort( active_items.begin(), active_items.end(),
+    []( const item_reference & lhs, const item_reference & rhs ) {
+        return lhs.location < rhs.location;
+    } );
+    cata::optional<point> env_location;
+    bool env_skip = false;
+    temperature_flag env_flag = temperature_flag::NORMAL;
+    float env_spoil_multiplier = 1.0f;
     for( item_reference &active_item_ref : active_items ) {
         if( !active_item_ref.item_ref ) {
             // The item was destroyed, so skip it.
@@ -4712,28 +4781,27 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
         }
 
         const tripoint map_location = tripoint( grid_offset + active_item_ref.location, gridp.z );
-        const furn_t &furn = this->furn( map_location ).obj();
+        if( !env_location || *env_location != active_item_ref.location ) {
+            env_location = active_item_ref.location;
+            const furn_t &furn = this->furn( map_location ).obj();
 
-        if( furn.has_flag( ter_furn_flag::TFLAG_DONT_REMOVE_ROTTEN ) ) {
             // plants contain a seed item which must not be removed under any circumstances.
-            // Lets not process it at all.
+            // Lets not process them at all.
+            env_skip = furn.has_flag( ter_furn_flag::TFLAG_DONT_REMOVE_ROTTEN );
+            // root cellars are special
+            env_flag = ter( map_location ) == t_rootcellar
+                       ? temperature_flag::ROOT_CELLAR
+                       : temperature_flag::NORMAL;
+            env_spoil_multiplier = has_flag( ter_furn_flag::TFLAG_NO_SPOIL, map_location ) ? 0.0f : 1.0f;
+        }
+        if( env_skip ) {
             continue;
         }
-        // root cellars are special
-        temperature_flag flag = temperature_flag::NORMAL;
-        if( ter( map_location ) == t_rootcellar ) {
-            flag = temperature_flag::ROOT_CELLAR;
-        }
-
-        float spoil_multiplier = 1.0f;
-
-        if( has_flag( ter_furn_flag::TFLAG_NO_SPOIL, map_location ) ) {
-            spoil_multiplier = 0.0f;
-        }
 
         map_stack items = i_at( map_location );
 
-        process_map_items( items, active_item_ref.item_ref, map_location, 1, flag, spoil_multiplier );
+        process_map_items( items, active_item_ref.item_ref, map_location, 1, env_flag,
+                           env_spoil_multiplier );
     }
 }
 
@@ -4770,17 +4838,29 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         process_vehicle_items( cur_veh, vp.part_index() );
     }
 
-    for( item_reference &active_item_ref : cur_veh.active_items.get_for_processing() ) {
+    std::vector<item_reference> vehicle_active_items = cur_veh.active_items.get_for_processing();
+    // Group the references by mount point so the linear cargo part search
+    // below runs once per part instead of once per item.
+    std::sort( vehicle_active_items.begin(), vehicle_active_items.end(),
+    []( const item_reference & lhs, const item_reference & rhs ) {
+        return lhs.location < rhs.location;
+    } );
+    cata::optional<point> part_mount;
+    auto it = end( cargo_parts );
+    for( item_reference &active_item_ref : vehicle_active_items ) {
         if( empty( cargo_parts ) ) {
             return;
         } else if( !active_item_ref.item_ref ) {
             // The item was destroyed, so skip it.
             continue;
         }
-        const auto it = std::find_if( begin( cargo_parts ),
-        end( cargo_parts ), [&]( const vpart_reference & part ) {
-            return active_item_ref.location == part.mount();
-        } );
+        if( !part_mount || *part_mount != active_item_ref.location ) {
+            part_mount = active_item_ref.location;
+            it = std::find_if( begin( cargo_parts ),
+            end( cargo_parts ), [&]( const vpart_reference & part ) {
+                return active_item_ref.location == part.mount();
+            } );
+        }
 
         if( it == end( cargo_parts ) ) {
             continue; // Can't find a cargo part matching the active item.
@@ -4828,6 +4908,9 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         // a low index has been removed by an explosion, all the other
         // parts would move up to fill the gap).
         cargo_parts = cur_veh.get_any_parts( VPFLAG_CARGO );
+        // the cached part lookup points into the old list
+        part_mount.reset();
+        it = end( cargo_parts );
     }
 }
 
@@ -4927,6 +5010,8 @@ std::list<item> map::use_amount( const tripoint &origin, const int range, const
                                  int &quantity, const std::function<bool( const item & )> &filter )
 {
     std::list<item> ret;
+    // charges may be drained in place without going through i_rem
+    bump_items_generation();
     for( int radius = 0; radius <= range && quantity > 0; radius++ ) {
         for( const tripoint &p : points_in_radius( origin, radius ) ) {
             if( rl_dist( origin, p ) >= radius ) {
@@ -4999,6 +5084,9 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
 {
     std::list<item> ret;
 
+    // charges may be drained in place without going through i_rem
+    bump_items_generation();
+
     // populate a grid of spots that can be reached
     std::vector<tripoint> reachable_pts;
     reachable_flood_steps( reachable_pts, origin, range, 1, 100 );
@@ -5155,6 +5243,7 @@ void map::partial_con_remove( const tripoint &p )
         debugmsg( "Tried to remove construction at (%d,%d) but the submap is not loaded", l.x, l.y );
         return;
     }
+    current_submap->modified = true;
     current_submap->partial_constructions.erase( tripoint( l, p.z ) );
 }
 
@@ -5169,6 +5258,7 @@ void map::partial_con_set( const tripoint &p, const partial_con &con )
         debugmsg( "Tried to set construction at (%d,%d) but the submap is not loaded", l.x, l.y );
         return;
     }
+    current_submap->modified = true;
     if( !current_submap->partial_constructions.emplace( tripoint( l, p.z ), con ).second ) {
         debugmsg( "set partial con on top of terrain which already has a partial con" );
     }
@@ -5288,6 +5378,8 @@ time_duration map::set_field_age( const tripoint &p, const field_type_id &type,
                                   const time_duration &age, const bool isoffset )
 {
     if( field_entry *const field_ptr = get_field( p, type ) ) {
+        // Changing the age changes the decay schedule; wake the submap.
+        unsafe_get_submap_at( p )->fields_dormant_until = calendar::turn_zero;
         return field_ptr->set_field_age( ( isoffset ? field_ptr->get_field_age() : 0_turns ) + age );
     }
     return -1_turns;
@@ -5384,9 +5476,11 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
         return false;
     }
     current_submap->is_uniform = false;
+    current_submap->modified = true;
     invalidate_max_populated_zlev( p.z );
 
     if( current_submap->get_field( l ).add_field( type_id, intensity, age ) ) {
+        current_submap->set_field_presence( l );
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -5419,6 +5513,10 @@ void map::on_field_modified( const tripoint &p, const field_type &fd_type )
     get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
                                           p.y / SEEX ) * MAPSIZE ) ) );
 
+    // The earliest due time of the submap's field scheduler may have
+    // changed; wake it so the next process_fields pass has a look.
+    unsafe_get_submap_at( p )->fields_dormant_until = calendar::turn_zero;
+
     // Dirty the transparency cache now that field processing doesn't always do it
     if( fd_type.dirty_transparency_cache || !fd_type.is_transparent() ) {
         set_transparency_cache_dirty( p, true );
@@ -5426,7 +5524,7 @@ void map::on_field_modified( const tripoint &p, const field_type &fd_type )
     }
 
     if( fd_type.is_dangerous() ) {
-        set_pathfinding_cache_dirty( p.z );
+        set_pathfinding_cache_dirty( p );
     }
 
     // Ensure blood type fields don't hang in the air
@@ -5524,6 +5622,7 @@ void map::remove_submap_camp( const tripoint &p )
         return;
     }
     current_submap->camp.reset();
+    current_submap->modified = true;
 }
 
 basecamp map::hoist_submap_camp( const tripoint &p )
@@ -5558,6 +5657,42 @@ void map::update_submap_active_item_status( const tripoint &p )
     }
 }
 
+int map::debug_field_count() const
+{
+    const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    int count = 0;
+    for( int z = minz; z <= maxz; z++ ) {
+        for( int gx = 0; gx < my_MAPSIZE; gx++ ) {
+            for( int gy = 0; gy < my_MAPSIZE; gy++ ) {
+                const submap *sm = get_submap_at_grid( { gx, gy, z } );
+                if( sm != nullptr ) {
+                    count += sm->field_count;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+int map::debug_active_item_count() const
+{
+    const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    int count = 0;
+    for( int z = minz; z <= maxz; z++ ) {
+        for( int gx = 0; gx < my_MAPSIZE; gx++ ) {
+            for( int gy = 0; gy < my_MAPSIZE; gy++ ) {
+                const submap *sm = get_submap_at_grid( { gx, gy, z } );
+                if( sm != nullptr ) {
+                    count += static_cast<int>( sm->active_items.size() );
+                }
+            }
+        }
+    }
+    return count;
+}
+
 void map::update_visibility_cache( const int zlev )
 {
     Character &player_character = get_player_character();
@@ -6115,6 +6250,13 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         bresenham_slope = 0;
         return false; // Out of range!
     }
+    if( F.z == T.z ) {
+        for( const std::unique_ptr<shared_seen_grid> &grid : shared_seen_grids ) {
+            if( grid->origin == T ) {
+                return grid->grid[F.x][F.y] > LIGHT_TRANSPARENCY_SOLID;
+            }
+        }
+    }
     // Cannonicalize the order of the tripoints so the cache is reflexive.
     const tripoint &min = F < T ? F : T;
     const tripoint &max = !( F < T ) ? F : T;
@@ -6123,9 +6265,26 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         min.x << 16 | min.y << 8 | ( min.z + OVERMAP_DEPTH ),
         max.x << 16 | max.y << 8 | ( max.z + OVERMAP_DEPTH )
     );
-    char cached = skew_vision_cache.get( key, -1 );
-    if( cached >= 0 ) {
-        return cached > 0;
+    const auto cached = skew_vision_cache.find( key );
+    if( cached != skew_vision_cache.end() && cached->second.first == skew_vision_generation ) {
+        return cached->second.second > 0;
+    }
+    if( cached == skew_vision_cache.end() && skew_vision_cache.size() >= 100000 ) {
+        // Bound memory use; by this point most entries are stale generations anyway.
+        skew_vision_cache.clear();
+    }
+    // Promote targets that keep attracting distinct line casts to a full
+    // shadowcast; one cast from the target answers a whole cluster of
+    // observers (a horde watching one npc) as array reads above.
+    constexpr int promote_queries = 16;
+    constexpr size_t max_shared_grids = 4;
+    if( F.z == T.z && shared_seen_grids.size() < max_shared_grids &&
+        ++seen_grid_queries[T] == promote_queries ) {
+        shared_seen_grids.emplace_back( std::make_unique<shared_seen_grid>() );
+        shared_seen_grid &grid = *shared_seen_grids.back();
+        grid.origin = T;
+        cast_shared_seen_grid( grid );
+        return grid.grid[F.x][F.y] > LIGHT_TRANSPARENCY_SOLID;
     }
     bool visible = true;
 
@@ -6143,7 +6302,8 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        skew_vision_cache[key] = std::make_pair( skew_vision_generation,
+                                 static_cast<char>( visible ? 1 : 0 ) );
         return visible;
     }
 
@@ -6176,7 +6336,8 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    skew_vision_cache[key] = std::make_pair( skew_vision_generation,
+                             static_cast<char>( visible ? 1 : 0 ) );
     return visible;
 }
 
@@ -6228,6 +6389,17 @@ int map::coverage( const tripoint &p ) const
 std::vector<tripoint> map::find_clear_path( const tripoint &source,
         const tripoint &destination ) const
 {
+    if( clear_path_generation == skew_vision_generation &&
+        source == clear_path_source && destination == clear_path_target ) {
+        return clear_path_result;
+    }
+    const auto remember = [this, &source, &destination]( std::vector<tripoint> path ) {
+        clear_path_generation = skew_vision_generation;
+        clear_path_source = source;
+        clear_path_target = destination;
+        clear_path_result = std::move( path );
+        return clear_path_result;
+    };
     // TODO: Push this junk down into the Bresenham method, it's already doing it.
     const point d( destination.xy() - source.xy() );
     const point a( std::abs( d.x ) * 2, std::abs( d.y ) * 2 );
@@ -6241,11 +6413,11 @@ std::vector<tripoint> map::find_clear_path( const tripoint &source,
     for( int horizontal_offset = -1; horizontal_offset <= max_start_offset; ++horizontal_offset ) {
         int candidate_offset = horizontal_offset * start_sign;
         if( sees( source, destination, rl_dist( source, destination ), candidate_offset ) ) {
-            return line_to( source, destination, candidate_offset, 0 );
+            return remember( line_to( source, destination, candidate_offset, 0 ) );
         }
     }
     // If we couldn't find a clear LoS, just return the ideal one.
-    return line_to( source, destination, ideal_start_offset, 0 );
+    return remember( line_to( source, destination, ideal_start_offset, 0 ) );
 }
 
 void map::reachable_flood_steps( std::vector<tripoint> &reachable_pts, const tripoint &f,
@@ -6615,6 +6787,13 @@ void map::shift( const point &sp )
 
     shift_traps( tripoint( sp, 0 ) );
 
+    // Flow fields and cached routes are keyed on local coordinates,
+    // which all just moved.
+    flow_fields.clear();
+    if( route_cache ) {
+        route_cache->clear();
+    }
+
     vehicle *remoteveh = g->remoteveh();
 
     const int zmin = zlevels ? -OVERMAP_DEPTH : abs.z;
@@ -6625,6 +6804,21 @@ void map::shift( const point &sp )
         }
     }
 
+    // Snapshot which pathfinding caches were valid. loadn dirties them
+    // wholesale while the new edge loads, but for levels that were clean
+    // the contents can be slid over afterwards with only the new edge
+    // recomputed.
+    std::bitset<OVERMAP_LAYERS> pf_was_dirty;
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        pathfinding_cache &pf_cache = get_pathfinding_cache( gridz );
+        if( !pf_cache.dirty && pf_cache.dirty_submaps.any() ) {
+            // Flush pending per-submap refreshes now; their bits would
+            // point at the wrong submaps once the contents slide.
+            update_pathfinding_cache( gridz );
+        }
+        pf_was_dirty.set( gridz + OVERMAP_DEPTH, pf_cache.dirty );
+    }
+
     // Shift the map sx submaps to the right and sy submaps down.
     // sx and sy should never be bigger than +/-1.
     // absx and absy are our position in the world, for saving/loading purposes.
@@ -6725,6 +6919,10 @@ void map::shift( const point &sp )
     }
     rebuild_vehicle_level_caches();
 
+    // Vehicle caches are correct again, so the pathfinding caches can
+    // be slid into place and their new edges filled in.
+    shift_pathfinding_caches( sp, pf_was_dirty );
+
     g->setremoteveh( remoteveh );
 
     if( !support_cache_dirty.empty() ) {
@@ -7551,6 +7749,7 @@ void map::spawn_monsters_submap( const tripoint &gp, bool ignore_sight )
         }
     }
     current_submap->spawns.clear();
+    current_submap->modified = true;
 }
 
 void map::spawn_monsters( bool ignore_sight )
@@ -7927,20 +8126,27 @@ std::bitset<OVERMAP_LAYERS> map::get_inter_level_visibility( const int origin_zl
 bool map::build_floor_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    if( !ch.floor_cache_dirty ) {
+    if( ch.floor_cache_dirty.none() ) {
         return false;
     }
 
+    // if true, all submaps are invalid (can use batch init)
+    const bool rebuild_all = ch.floor_cache_dirty.all();
+
     auto &floor_cache = ch.floor_cache;
-    std::uninitialized_fill_n(
-        &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
-    bool &no_floor_gaps = ch.no_floor_gaps;
-    no_floor_gaps = true;
+    if( rebuild_all ) {
+        std::uninitialized_fill_n(
+            &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
+    }
 
     bool lowest_z_lev = zlev <= -OVERMAP_DEPTH;
 
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( !rebuild_all && !ch.floor_cache_dirty[smx * MAPSIZE + smy] ) {
+                continue;
+            }
+
             const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
             const submap *below_submap = !lowest_z_lev ? get_submap_at_grid( { smx, smy, zlev - 1 } ) : nullptr;
 
@@ -7954,6 +8160,13 @@ bool map::build_floor_cache( const int zlev )
                 continue;
             }
 
+            if( !rebuild_all ) {
+                // Reset only this submap's stripe of the cache.
+                for( int sx = 0; sx < SEEX; ++sx ) {
+                    std::uninitialized_fill_n( &floor_cache[smx * SEEX + sx][smy * SEEY], SEEY, true );
+                }
+            }
+
             for( int sx = 0; sx < SEEX; ++sx ) {
                 for( int sy = 0; sy < SEEY; ++sy ) {
                     point sp( sx, sy );
@@ -7966,14 +8179,20 @@ bool map::build_floor_cache( const int zlev )
                         }
                         const point p( sx + smx * SEEX, sy + smy * SEEY );
                         floor_cache[p.x][p.y] = false;
-                        no_floor_gaps = false;
                     }
                 }
             }
         }
     }
 
-    ch.floor_cache_dirty = false;
+    // Clean submaps may still contain gaps, so the aggregate is
+    // recomputed from the cache itself. This is a plain memory scan and
+    // is much cheaper than the terrain lookups above.
+    const bool *const floor_begin = &floor_cache[0][0];
+    const bool *const floor_end = floor_begin + ( MAPSIZE_X ) * ( MAPSIZE_Y );
+    ch.no_floor_gaps = std::find( floor_begin, floor_end, false ) == floor_end;
+
+    ch.floor_cache_dirty.reset();
     return zlevels;
 }
 
@@ -8046,12 +8265,48 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
+
+    // The per-z-level caches only read submaps and write their own
+    // level_cache (the floor cache reads the level below's submaps, but
+    // never its caches), so independent z-levels can build in parallel.
+    // The dependent parts - vehicle caching, the seen cache cascade and
+    // the lightmap - stay sequential below.
+    std::array<bool, OVERMAP_LAYERS> floor_dirty = {};
+    const auto build_z_caches = [this, &floor_dirty]( const int z ) {
+        build_outside_cache( z );
+        build_transparency_cache( z );
+        floor_dirty[z + OVERMAP_DEPTH] = build_floor_cache( z );
+    };
+
+    const unsigned int num_threads =
+        std::min<unsigned int>( std::thread::hardware_concurrency(),
+                                static_cast<unsigned int>( maxz - minz + 1 ) );
+    if( zlevels && num_threads > 1 && parallel_map_cache ) {
+        std::atomic<int> next_z( minz );
+        const auto worker = [&]() {
+            for( int z = next_z++; z <= maxz; z = next_z++ ) {
+                build_z_caches( z );
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve( num_threads - 1 );
+        for( unsigned int i = 0; i < num_threads - 1; i++ ) {
+            threads.emplace_back( worker );
+        }
+        worker();
+        for( std::thread &t : threads ) {
+            t.join();
+        }
+    } else {
+        for( int z = minz; z <= maxz; z++ ) {
+            build_z_caches( z );
+        }
+    }
+
     for( int z = minz; z <= maxz; z++ ) {
         // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
         const bool affects_seen_cache =  z == zlev || fov_3d;
-        build_outside_cache( z );
-        build_transparency_cache( z );
-        bool floor_cache_was_dirty = build_floor_cache( z );
+        const bool floor_cache_was_dirty = floor_dirty[z + OVERMAP_DEPTH];
         seen_cache_dirty |= ( floor_cache_was_dirty && affects_seen_cache );
         if( floor_cache_was_dirty && z > -OVERMAP_DEPTH ) {
             get_cache( z - 1 ).r_up_cache->invalidate();
@@ -8067,7 +8322,9 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     seen_cache_dirty |= build_vision_transparency_cache( zlev );
 
     if( seen_cache_dirty ) {
-        skew_vision_cache.clear();
+        ++skew_vision_generation;
+        seen_grid_queries.clear();
+        shared_seen_grids.clear();
     }
     // Initial value is illegal player position.
     const tripoint p = get_player_character().pos();
@@ -8115,13 +8372,10 @@ tripoint map::get_abs_sub() const
     return abs_sub;
 }
 
-submap *map::getsubmap( const size_t grididx ) const
+submap *map::getsubmap_out_of_range( const size_t grididx ) const
 {
-    if( grididx >= grid.size() ) {
-        debugmsg( "Tried to access invalid grid index %d. Grid size: %d", grididx, grid.size() );
-        return nullptr;
-    }
-    return grid[grididx];
+    debugmsg( "Tried to access invalid grid index %d. Grid size: %d", grididx, grid.size() );
+    return nullptr;
 }
 
 void map::setsubmap( const size_t grididx, submap *const smap )
@@ -8145,26 +8399,10 @@ submap *map::get_submap_at( const tripoint &p ) const
     return unsafe_get_submap_at( p );
 }
 
-submap *map::get_submap_at_grid( const tripoint &gridp ) const
+size_t map::get_nonant_out_of_range( const tripoint &gridp ) const
 {
-    return getsubmap( get_nonant( gridp ) );
-}
-
-size_t map::get_nonant( const tripoint &gridp ) const
-{
-    if( gridp.x < 0 || gridp.x >= my_MAPSIZE ||
-        gridp.y < 0 || gridp.y >= my_MAPSIZE ||
-        gridp.z < -OVERMAP_DEPTH || gridp.z > OVERMAP_HEIGHT ) {
-        debugmsg( "Tried to access invalid map position at grid (%d,%d,%d)", gridp.x, gridp.y, gridp.z );
-        return 0;
-    }
-
-    if( zlevels ) {
-        const int indexz = gridp.z + OVERMAP_HEIGHT; // Can't be lower than 0
-        return indexz + ( gridp.x + gridp.y * my_MAPSIZE ) * OVERMAP_LAYERS;
-    } else {
-        return gridp.x + gridp.y * my_MAPSIZE;
-    }
+    debugmsg( "Tried to access invalid map position at grid (%d,%d,%d)", gridp.x, gridp.y, gridp.z );
+    return 0;
 }
 
 void map::draw_line_ter( const ter_id &type, const point &p1, const point &p2 )
@@ -8624,6 +8862,14 @@ void map::set_pathfinding_cache_dirty( const int zlev )
     }
 }
 
+void map::set_pathfinding_cache_dirty( const tripoint &p )
+{
+    if( inbounds( p ) ) {
+        const tripoint smp = ms_to_sm_copy( p );
+        get_pathfinding_cache( smp.z ).dirty_submaps.set( smp.x * MAPSIZE + smp.y );
+    }
+}
+
 const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 {
     if( !inbounds_z( zlev ) ) {
@@ -8631,7 +8877,7 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
         return *pathfinding_caches[ OVERMAP_DEPTH ];
     }
     auto &cache = get_pathfinding_cache( zlev );
-    if( cache.dirty ) {
+    if( cache.dirty || cache.dirty_submaps.any() ) {
         update_pathfinding_cache( zlev );
     }
 
@@ -8641,80 +8887,172 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 void map::update_pathfinding_cache( int zlev ) const
 {
     auto &cache = get_pathfinding_cache( zlev );
+    if( !cache.dirty && cache.dirty_submaps.none() ) {
+        return;
+    }
+
     if( !cache.dirty ) {
+        // Only local mutations since the last rebuild; refresh just the
+        // affected submaps.
+        for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+            for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+                if( cache.dirty_submaps.test( smx * MAPSIZE + smy ) &&
+                    !update_pathfinding_cache_submap( cache, tripoint( smx, smy, zlev ) ) ) {
+                    return;
+                }
+            }
+        }
+        cache.dirty_submaps.reset();
+        cache.generation++;
         return;
     }
 
     std::uninitialized_fill_n( &cache.special[0][0], MAPSIZE_X * MAPSIZE_Y, PF_NORMAL );
+    std::uninitialized_fill_n( &cache.move_cost[0][0], MAPSIZE_X * MAPSIZE_Y,
+                               static_cast<uint8_t>( 2 ) );
 
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
-            submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
-            if( !cur_submap ) {
+            if( !update_pathfinding_cache_submap( cache, tripoint( smx, smy, zlev ) ) ) {
                 return;
             }
+        }
+    }
 
-            tripoint p( 0, 0, zlev );
-
-            for( int sx = 0; sx < SEEX; ++sx ) {
-                p.x = sx + smx * SEEX;
-                for( int sy = 0; sy < SEEY; ++sy ) {
-                    p.y = sy + smy * SEEY;
+    cache.dirty = false;
+    cache.dirty_submaps.reset();
+    cache.generation++;
+}
 
-                    pf_special cur_value = PF_NORMAL;
+bool map::update_pathfinding_cache_submap( pathfinding_cache &cache,
+        const tripoint &sm_grid ) const
+{
+    const int zlev = sm_grid.z;
+    const int smx = sm_grid.x;
+    const int smy = sm_grid.y;
+    submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
+    if( !cur_submap ) {
+        return false;
+    }
 
-                    maptile tile( cur_submap, point( sx, sy ) );
+    tripoint p( 0, 0, zlev );
 
-                    const auto &terrain = tile.get_ter_t();
-                    const auto &furniture = tile.get_furn_t();
-                    const auto &field = tile.get_field();
-                    int part;
-                    const vehicle *veh = veh_at_internal( p, part );
+    const bool submap_has_traps = cur_submap->get_trap_count() > 0;
 
-                    const int cost = move_cost_internal( furniture, terrain, field, veh, part );
+    for( int sx = 0; sx < SEEX; ++sx ) {
+        p.x = sx + smx * SEEX;
+        for( int sy = 0; sy < SEEY; ++sy ) {
+            p.y = sy + smy * SEEY;
 
-                    if( cost > 2 ) {
-                        cur_value |= PF_SLOW;
-                    } else if( cost <= 0 ) {
-                        cur_value |= PF_WALL;
-                        if( terrain.has_flag( ter_furn_flag::TFLAG_CLIMBABLE ) ) {
-                            cur_value |= PF_CLIMBABLE;
-                        }
-                    }
+            pf_special cur_value = PF_NORMAL;
 
-                    if( veh != nullptr ) {
-                        cur_value |= PF_VEHICLE;
-                    }
+            maptile tile( cur_submap, point( sx, sy ) );
 
-                    for( const auto &fld : tile.get_field() ) {
-                        const field_entry &cur = fld.second;
-                        if( cur.is_dangerous() ) {
-                            cur_value |= PF_FIELD;
-                        }
-                    }
+            const auto &terrain = tile.get_ter_t();
+            const auto &furniture = tile.get_furn_t();
+            const auto &field = tile.get_field();
+            int part;
+            const vehicle *veh = veh_at_internal( p, part );
 
-                    if( !tile.get_trap_t().is_benign() || !terrain.trap.obj().is_benign() ) {
-                        cur_value |= PF_TRAP;
-                    }
+            const int cost = move_cost_internal( furniture, terrain, field, veh, part );
 
-                    if( terrain.has_flag( ter_furn_flag::TFLAG_GOES_DOWN ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_GOES_UP ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_RAMP ) || terrain.has_flag( ter_furn_flag::TFLAG_RAMP_UP ) ||
-                        terrain.has_flag( ter_furn_flag::TFLAG_RAMP_DOWN ) ) {
-                        cur_value |= PF_UPDOWN;
-                    }
+            if( cost > 2 ) {
+                cur_value |= PF_SLOW;
+            } else if( cost <= 0 ) {
+                cur_value |= PF_WALL;
+                if( terrain.has_flag( ter_furn_flag::TFLAG_CLIMBABLE ) ) {
+                    cur_value |= PF_CLIMBABLE;
+                }
+            }
 
-                    if( terrain.has_flag( ter_furn_flag::TFLAG_SHARP ) ) {
-                        cur_value |= PF_SHARP;
-                    }
+            if( veh != nullptr ) {
+                cur_value |= PF_VEHICLE;
+            }
 
-                    cache.special[p.x][p.y] = cur_value;
+            for( const auto &fld : tile.get_field() ) {
+                const field_entry &cur = fld.second;
+                if( cur.is_dangerous() ) {
+                    cur_value |= PF_FIELD;
                 }
             }
+
+            if( ( submap_has_traps && !tile.get_trap_t().is_benign() ) ||
+                !terrain.trap.obj().is_benign() ) {
+                cur_value |= PF_TRAP;
+            }
+
+            if( terrain.has_flag( ter_furn_flag::TFLAG_GOES_DOWN ) ||
+                terrain.has_flag( ter_furn_flag::TFLAG_GOES_UP ) ||
+                terrain.has_flag( ter_furn_flag::TFLAG_RAMP ) || terrain.has_flag( ter_furn_flag::TFLAG_RAMP_UP ) ||
+                terrain.has_flag( ter_furn_flag::TFLAG_RAMP_DOWN ) ) {
+                cur_value |= PF_UPDOWN;
+            }
+
+            if( terrain.has_flag( ter_furn_flag::TFLAG_SHARP ) ) {
+                cur_value |= PF_SHARP;
+            }
+
+            cache.special[p.x][p.y] = cur_value;
+            cache.move_cost[p.x][p.y] = static_cast<uint8_t>( std::max( 0, std::min( cost, 255 ) ) );
         }
     }
 
-    cache.dirty = false;
+    return true;
+}
+
+void map::shift_pathfinding_caches( const point &sp,
+                                    const std::bitset<OVERMAP_LAYERS> &was_dirty )
+{
+    const int dx = sp.x * SEEX;
+    const int dy = sp.y * SEEY;
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        if( was_dirty.test( gridz + OVERMAP_DEPTH ) ) {
+            // Was already due a full rebuild before the shift started.
+            continue;
+        }
+        pathfinding_cache &cache = get_pathfinding_cache( gridz );
+        // Slide the retained area. Columns are contiguous in y, and the
+        // x iteration order keeps each source column unread-after-write.
+        const int y_dst = std::max( 0, -dy );
+        const int y_src = std::max( 0, dy );
+        const int y_len = MAPSIZE_Y - std::abs( dy );
+        const auto move_column = [&]( int x ) {
+            std::memmove( &cache.special[x][y_dst], &cache.special[x + dx][y_src],
+                          y_len * sizeof( pf_special ) );
+            std::memmove( &cache.move_cost[x][y_dst], &cache.move_cost[x + dx][y_src],
+                          y_len * sizeof( uint8_t ) );
+        };
+        if( dx >= 0 ) {
+            for( int x = 0; x < MAPSIZE_X - dx; x++ ) {
+                move_column( x );
+            }
+        } else {
+            for( int x = MAPSIZE_X - 1; x >= -dx; x-- ) {
+                move_column( x );
+            }
+        }
+        // Recompute only the newly exposed submap row and/or column.
+        bool ok = true;
+        for( int smx = 0; smx < my_MAPSIZE && ok; smx++ ) {
+            for( int smy = 0; smy < my_MAPSIZE && ok; smy++ ) {
+                const bool new_col = ( sp.x > 0 && smx == my_MAPSIZE - 1 ) ||
+                                     ( sp.x < 0 && smx == 0 );
+                const bool new_row = ( sp.y > 0 && smy == my_MAPSIZE - 1 ) ||
+                                     ( sp.y < 0 && smy == 0 );
+                if( new_col || new_row ) {
+                    ok = update_pathfinding_cache_submap( cache, tripoint( smx, smy, gridz ) );
+                }
+            }
+        }
+        if( ok ) {
+            cache.dirty = false;
+            // The flags are valid but every local coordinate moved, so
+            // structures derived from this cache must still rebuild.
+            cache.generation++;
+        }
+    }
 }
 
 void map::clip_to_bounds( tripoint &p ) const
@@ -15,6 +15,7 @@
 #include <new>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -89,7 +90,11 @@ using VehicleList = std::vector<wrapped_vehicle>;
 class map;
 
 enum class ter_furn_flag : int;
+struct flow_field;
 struct pathfinding_cache;
+struct route_cache_entry;
+struct route_cache_key;
+struct submap_connectivity;
 struct pathfinding_settings;
 template<typename T>
 struct weighted_int_list;
@@ -384,11 +389,23 @@ class map
 
         void set_floor_cache_dirty( const int zlev ) {
             if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).floor_cache_dirty = true;
+                get_cache( zlev ).floor_cache_dirty.set();
+            }
+        }
+
+        // more granular version of the floor cache invalidation
+        // preferred over map::set_floor_cache_dirty( const int zlev )
+        // p is in local coords ("ms")
+        void set_floor_cache_dirty( const tripoint &p ) {
+            if( inbounds( p ) ) {
+                const tripoint smp = ms_to_sm_copy( p );
+                get_cache( smp.z ).floor_cache_dirty.set( smp.x * MAPSIZE + smp.y );
             }
         }
 
         void set_pathfinding_cache_dirty( int zlev );
+        // p is in local coords ("ms"); marks a single submap for refresh
+        void set_pathfinding_cache_dirty( const tripoint &p );
         /*@}*/
 
         void set_memory_seen_cache_dirty( const tripoint &p ) {
@@ -401,7 +418,7 @@ class map
         void invalidate_map_cache( const int zlev ) {
             if( inbounds_z( zlev ) ) {
                 level_cache &ch = get_cache( zlev );
-                ch.floor_cache_dirty = true;
+                ch.floor_cache_dirty.set();
                 ch.seen_cache_dirty = true;
                 ch.outside_cache_dirty = true;
                 set_transparency_cache_dirty( zlev );
@@ -708,6 +725,16 @@ class map
                                      const pathfinding_settings &settings,
         const std::set<tripoint> &pre_closed = {{ }} ) const;
 
+        /**
+         * Path toward a shared goal using a cached goal-centric Dijkstra
+         * field (see flow_field in pathfinding.h). Much cheaper than
+         * route() when many creatures head for the same destination.
+         * Returns an empty path when the goal cannot be served or reached
+         * this way; callers should then fall back to route().
+         */
+        std::vector<tripoint> route_via_flow_field( const tripoint &f, const tripoint &t,
+                const pathfinding_settings &settings ) const;
+
         // Vehicles: Common to 2D and 3D
         VehicleList get_vehicles();
         void add_vehicle_to_cache( vehicle * );
@@ -1240,6 +1267,15 @@ class map
             return add_item_or_charges( tripoint( p, abs_sub.z ), obj, overflow );
         }
 
+        /**
+         * Batch version of add_item_or_charges. The incoming items are
+         * sort-merged with each other before they touch the tile, so bulk
+         * drops do one merge scan per distinct stack instead of one per
+         * item. Prefer this when dropping a whole list at once.
+         */
+        void add_items_or_charges( const tripoint &pos, std::vector<item> objs,
+                                   bool overflow = true );
+
         /**
          * Place an item on the map, despite the parameter name, this is not necessarily a new item.
          * WARNING: does -not- check volume or stack charges. player functions (drop etc) should use
@@ -1372,7 +1408,8 @@ class map
         void create_burnproducts( const tripoint &p, const item &fuel, const units::mass &burned_mass );
         // See fields.cpp
         void process_fields();
-        void process_fields_in_submap( submap *current_submap, const tripoint &submap_pos );
+        void process_fields_in_submap( submap *current_submap, const tripoint &submap_pos,
+                                       scent_block &sblk );
         /**
          * Apply field effects to the creature when it's on a square with fields.
          */
@@ -1824,8 +1861,17 @@ class map
 
         /**
          * Get the submap pointer with given index in @ref grid, the index must be valid!
+         * Inline so the resolution chain from @ref unsafe_get_submap_at collapses
+         * into direct address math; it is on every tile access.
          */
-        submap *getsubmap( size_t grididx ) const;
+        submap *getsubmap( const size_t grididx ) const {
+            if( grididx >= grid.size() ) {
+                return getsubmap_out_of_range( grididx );
+            }
+            return grid[grididx];
+        }
+        // Out-of-line error path of getsubmap; reports and returns null.
+        submap *getsubmap_out_of_range( size_t grididx ) const;
         /**
          * Get the submap pointer containing the specified position within the reality bubble.
          * (p) must be a valid coordinate, check with @ref inbounds.
@@ -1864,17 +1910,34 @@ class map
         submap *get_submap_at_grid( const point &gridp ) const {
             return getsubmap( get_nonant( gridp ) );
         }
-        submap *get_submap_at_grid( const tripoint &gridp ) const;
+        submap *get_submap_at_grid( const tripoint &gridp ) const {
+            return getsubmap( get_nonant( gridp ) );
+        }
     protected:
         /**
          * Get the index of a submap pointer in the grid given by grid coordinates. The grid
          * coordinates must be valid: 0 <= x < my_MAPSIZE, same for y.
          * Version with z-levels checks for z between -OVERMAP_DEPTH and OVERMAP_HEIGHT
          */
-        size_t get_nonant( const tripoint &gridp ) const;
+        size_t get_nonant( const tripoint &gridp ) const {
+            if( gridp.x < 0 || gridp.x >= my_MAPSIZE ||
+                gridp.y < 0 || gridp.y >= my_MAPSIZE ||
+                gridp.z < -OVERMAP_DEPTH || gridp.z > OVERMAP_HEIGHT ) {
+                return get_nonant_out_of_range( gridp );
+            }
+
+            if( zlevels ) {
+                const int indexz = gridp.z + OVERMAP_HEIGHT; // Can't be lower than 0
+                return indexz + ( gridp.x + gridp.y * my_MAPSIZE ) * OVERMAP_LAYERS;
+            } else {
+                return gridp.x + gridp.y * my_MAPSIZE;
+            }
+        }
         size_t get_nonant( const point &gridp ) const {
             return get_nonant( { gridp, abs_sub.z } );
         }
+        // Out-of-line error path of get_nonant; reports and returns 0.
+        size_t get_nonant_out_of_range( const tripoint &gridp ) const;
         /**
          * Set the submap pointer in @ref grid at the give index. This is the inverse of
          * @ref getsubmap, any existing pointer is overwritten. The index must be valid.
@@ -2000,15 +2063,80 @@ class map
         std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
 
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
+        /**
+         * Most recently used shared flow fields, newest first; see
+         * route_via_flow_field. Invalidated wholesale when the map shifts.
+         */
+        mutable std::vector<std::unique_ptr<flow_field>> flow_fields;
+        /**
+         * Recently computed route() results, reused while the
+         * pathfinding cache generation they were built under lasts.
+         * Behind a pointer because route_cache_key is incomplete here.
+         */
+        mutable std::unique_ptr<lru_cache<route_cache_key, route_cache_entry>> route_cache;
+        /**
+         * Per-z-level submap connectivity graphs, rebuilt lazily when
+         * the pathfinding cache generation changes; see route().
+         */
+        mutable std::array<std::unique_ptr<submap_connectivity>, OVERMAP_LAYERS> connectivity_caches;
+        const submap_connectivity &get_submap_connectivity( int zlev ) const;
+        /**
+         * The tile-level A* behind route(). When @p corridor is non-null
+         * the search is restricted to submaps whose bit is set in it.
+         */
+        std::vector<tripoint> route_impl( const tripoint &f, const tripoint &t,
+                                          const pathfinding_settings &settings,
+                                          const std::set<tripoint> &pre_closed,
+                                          const std::bitset<MAPSIZE *MAPSIZE> *corridor ) const;
         /**
          * Set of submaps that contain active items in absolute coordinates.
          */
         std::set<tripoint> submaps_with_active_items;
 
         /**
-         * Cache of coordinate pairs recently checked for visibility.
+         * Monotonic counter bumped whenever map or vehicle item stacks are
+         * mutated. See @ref get_items_generation.
+         */
+        int items_generation_count = 0;
+
+        /**
+         * Cache of coordinate pairs recently checked for visibility,
+         * stamped with the @ref skew_vision_generation they were computed
+         * under. Stale entries count as misses and are overwritten in
+         * place, so a transparency change invalidates the whole cache by
+         * bumping the generation instead of deallocating 100k entries.
          */
-        mutable lru_cache<point, char> skew_vision_cache;
+        mutable std::unordered_map<point, std::pair<uint32_t, char>> skew_vision_cache;
+        mutable uint32_t skew_vision_generation = 0;
+
+        /**
+         * Memo of the last @ref find_clear_path result. Burst fire and
+         * turret volleys recompute the same corridor for every shot in
+         * the volley; the memo answers the repeats until a transparency
+         * change (a shot breaking a window) invalidates it through
+         * @ref skew_vision_generation.
+         */
+        mutable tripoint clear_path_source = tripoint_min;
+        mutable tripoint clear_path_target = tripoint_min;
+        mutable uint32_t clear_path_generation = 0;
+        mutable std::vector<tripoint> clear_path_result;
+
+        /**
+         * Shadowcast visibility grid for a single heavily queried
+         * line-of-sight target. When many creatures cast lines at the same
+         * position in the same transparency generation - a horde watching
+         * one npc - one cast from the target answers all of them as an
+         * array read. See @ref sees for the promotion heuristic.
+         */
+        struct shared_seen_grid {
+            tripoint origin;
+            float grid[MAPSIZE_X][MAPSIZE_Y];
+        };
+        /** Fills @ref shared_seen_grid::grid by shadowcasting from its origin. */
+        void cast_shared_seen_grid( shared_seen_grid &target ) const;
+        /** Line cast misses per target this generation; feeds grid promotion. */
+        mutable std::unordered_map<tripoint, int> seen_grid_queries;
+        mutable std::vector<std::unique_ptr<shared_seen_grid>> shared_seen_grids;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
@@ -2031,6 +2159,19 @@ class map
         const pathfinding_cache &get_pathfinding_cache_ref( int zlev ) const;
 
         void update_pathfinding_cache( int zlev ) const;
+        // Refresh one submap's worth of a pathfinding cache; returns
+        // false if that submap is not loaded.
+        bool update_pathfinding_cache_submap( pathfinding_cache &cache,
+                                              const tripoint &sm_grid ) const;
+        /**
+         * Slide still-valid pathfinding caches along with a bubble
+         * shift and recompute only the newly exposed submap row and
+         * column, instead of letting the whole 132x132 grid rebuild.
+         * @p was_dirty records which caches already needed a full
+         * rebuild before the shift started (indexed by z + OVERMAP_DEPTH).
+         */
+        void shift_pathfinding_caches( const point &sp,
+                                       const std::bitset<OVERMAP_LAYERS> &was_dirty );
 
         void update_visibility_cache( int zlev );
         const visibility_variables &get_visibility_variables_cache() const;
@@ -2041,6 +2182,22 @@ class map
         const std::set<tripoint> &get_submaps_with_active_items() const {
             return submaps_with_active_items;
         }
+        /** Total field entries across all loaded submaps; watchdog diagnostics. */
+        int debug_field_count() const;
+        /** Total cached active item references across all loaded submaps. */
+        int debug_active_item_count() const;
+        /**
+         * Generation counter for map and vehicle item stacks. An unchanged
+         * value means no items were added, removed or consumed through the
+         * map since it was last read, so caches built from nearby item
+         * stacks (e.g. the crafting inventory) are still valid.
+         */
+        int get_items_generation() const {
+            return items_generation_count;
+        }
+        void bump_items_generation() {
+            items_generation_count++;
+        }
         // Clips the area to map bounds
         tripoint_range<tripoint> points_in_rectangle(
             const tripoint &from, const tripoint &to ) const;
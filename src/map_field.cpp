@@ -140,6 +140,30 @@ int map::burn_body_part( Character &you, field_entry &cur, const bodypart_id &bp
 
 void map::process_fields()
 {
+    // Gather the submaps that need work, then process them in two
+    // checkerboard phases, so that no two horizontally adjacent submaps
+    // are handled in the same phase. Cross-submap writes (gas spread,
+    // fire licking over an edge) from one phase therefore only land in
+    // submaps of the other phase, which is the sharding a worker pool
+    // would need. The phases themselves still run serially: the
+    // processors touch plenty of global state (player effects, the
+    // scent accumulator, the message log, the rng), so handing shards
+    // to threads is not safe in this tree yet.
+    // Submaps on the fringe of the bubble can't reach the player this
+    // turn, so their fields are processed in coarse multi-turn steps:
+    // after a pass they sleep for a few turns via fields_dormant_until,
+    // and the next pass ages them by the full slept span (see
+    // process_fields_in_submap). A fire out there is at most a few
+    // turns stale by the time the player has closed the distance.
+    constexpr int lod_radius = 2;
+    const time_duration lod_stride = 4_turns;
+    const point player_sm = ms_to_sm_copy( get_player_character().pos().xy() );
+
+    // One scent assignment block serves every submap; retargeting it is
+    // an epoch bump rather than re-zeroing the grid per submap.
+    scent_block sblk( tripoint_zero, get_scent() );
+
+    std::array<std::vector<tripoint>, 2> phases;
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
@@ -150,14 +174,30 @@ void map::process_fields()
                         debugmsg( "Tried to process field at (%d,%d,%d) but the submap is not loaded", x, y, z );
                         continue;
                     }
-                    process_fields_in_submap( current_submap, tripoint( x, y, z ) );
-                    if( current_submap->field_count == 0 ) {
-                        field_cache[ x + y * MAPSIZE ] = false;
+                    if( calendar::turn < current_submap->fields_dormant_until ) {
+                        // Nothing here is due yet; see process_fields_in_submap.
+                        continue;
                     }
+                    phases[( x + y ) % 2].emplace_back( x, y, z );
                 }
             }
         }
     }
+
+    for( const std::vector<tripoint> &phase : phases ) {
+        for( const tripoint &gp : phase ) {
+            submap *const current_submap = get_submap_at_grid( gp );
+            sblk.reset( gp );
+            process_fields_in_submap( current_submap, gp, sblk );
+            if( current_submap->field_count == 0 ) {
+                get_cache( gp.z ).field_cache[ gp.x + gp.y * MAPSIZE ] = false;
+            } else if( std::max( std::abs( gp.x - player_sm.x ),
+                                 std::abs( gp.y - player_sm.y ) ) > lod_radius ) {
+                current_submap->fields_dormant_until =
+                    std::max( current_submap->fields_dormant_until, calendar::turn + lod_stride );
+            }
+        }
+    }
 }
 
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, const ter_furn_flag flag )
@@ -396,11 +436,10 @@ This is the general update function for field effects. This should only be calle
 If you need to insert a new field behavior per unit time add a case statement in the switch below.
 */
 void map::process_fields_in_submap( submap *const current_submap,
-                                    const tripoint &submap )
+                                    const tripoint &submap, scent_block &sblk )
 {
     const oter_id &om_ter = overmap_buffer.ter( tripoint_abs_omt( sm_to_omt_copy( submap ) ) );
     Character &player_character = get_player_character();
-    scent_block sblk( submap, get_scent() );
 
     // Initialize the map tile wrapper
     maptile map_tile( current_submap, point_zero );
@@ -418,9 +457,45 @@ void map::process_fields_in_submap( submap *const current_submap,
         &( *fd_null )
     };
 
+    // A dormant or distance-deferred submap catches up by the whole
+    // span it sat out, so ages and decay stay wall-clock exact.
+    const time_duration elapsed =
+        current_submap->last_field_process == calendar::turn_zero
+        ? 1_turns
+        : std::max( 1_turns, calendar::turn - current_submap->last_field_process );
+    current_submap->last_field_process = calendar::turn;
+
+    // Track when this submap next needs a visit. A submap holding only
+    // passive fields - no processors and a known decay time - can sleep
+    // until the earliest of those decay times instead of being rescanned
+    // every turn. Smoldering remains of an off-screen fire are the
+    // common case.
+    bool all_passive = true;
+    time_point earliest_due = calendar::turn + 1_days;
+    const auto note_entry_due = [&all_passive, &earliest_due, &pd]( const field_entry &cur ) {
+        if( !pd.cur_fd_type->get_processors().empty() ) {
+            all_passive = false;
+        } else if( !cur.is_field_alive() ) {
+            // Needs another pass to get removed.
+            earliest_due = std::min( earliest_due, calendar::turn + 1_turns );
+        } else if( pd.cur_fd_type->half_life <= 0_turns ) {
+            // Permanent; due again only when something else changes it.
+        } else if( cur.get_decay_time() > calendar::turn ) {
+            earliest_due = std::min( earliest_due, cur.get_decay_time() );
+        } else {
+            earliest_due = std::min( earliest_due, calendar::turn + 1_turns );
+        }
+    };
+
     // Loop through all tiles in this submap indicated by current_submap
     for( locx = 0; locx < SEEX; locx++ ) {
         for( locy = 0; locy < SEEY; locy++ ) {
+            // Cheapest check first: the submap tracks which of its cells
+            // hold fields, so empty tiles are skipped without touching them.
+            if( !current_submap->has_field_at( map_tile.pos() ) ) {
+                continue;
+            }
+
             // Get a reference to the field variable from the submap;
             // contains all the pointers to the real field effects.
             field &curfield = current_submap->get_field( {static_cast<int>( locx ), static_cast<int>( locy )} );
@@ -428,6 +503,7 @@ void map::process_fields_in_submap( submap *const current_submap,
             // when displayed_field_type == fd_null it means that `curfield` has no fields inside
             // avoids instantiating (relatively) expensive map iterator
             if( !curfield.displayed_field_type() ) {
+                current_submap->clear_field_presence( map_tile.pos() );
                 continue;
             }
 
@@ -446,32 +522,50 @@ void map::process_fields_in_submap( submap *const current_submap,
                 if( prev_intensity == 0 ) {
                     on_field_modified( p, *pd.cur_fd_type );
                     --current_submap->field_count;
-                    curfield.remove_field( it++ );
+                    it = curfield.remove_field( it );
+                    if( curfield.field_count() == 0 ) {
+                        current_submap->clear_field_presence( map_tile.pos() );
+                    }
                     continue;
                 }
 
                 // Don't process "newborn" fields. This gives the player time to run if they need to.
                 if( cur.get_field_age() == 0_turns ) {
-                    cur.do_decay();
+                    cur.do_decay( elapsed );
                     if( !cur.is_field_alive() || cur.get_field_intensity() != prev_intensity ) {
                         on_field_modified( p, *pd.cur_fd_type );
                     }
+                    note_entry_due( cur );
                     it++;
                     continue;
                 }
 
                 for( const FieldProcessorPtr &proc : pd.cur_fd_type->get_processors() ) {
-                    proc( p, cur, pd );
+                    proc( p, it->second, pd );
+                    // A processor may add a field to this very tile (fire
+                    // vents smoke, flame bursts and hot air land on p), and
+                    // flat_map inserts invalidate iterators and references -
+                    // re-resolve from the key before the entry is touched
+                    // again. Processors never remove entries (they set the
+                    // intensity to 0 instead, see the notes further down),
+                    // so the key is always found.
+                    it = curfield.find( pd.cur_fd_type_id );
                 }
 
-                cur.do_decay();
-                if( !cur.is_field_alive() || cur.get_field_intensity() != prev_intensity ) {
+                field_entry &processed = it->second;
+                processed.do_decay( elapsed );
+                if( !processed.is_field_alive() ||
+                    processed.get_field_intensity() != prev_intensity ) {
                     on_field_modified( p, *pd.cur_fd_type );
                 }
+                note_entry_due( processed );
                 it++;
             }
         }
     }
+    // on_field_modified resets this to 0, so set it last; a field added
+    // or changed from outside the loop above must wake the submap.
+    current_submap->fields_dormant_until = all_passive ? earliest_due : calendar::turn;
     sblk.commit_modifications();
 }
 
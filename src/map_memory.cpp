@@ -63,6 +63,27 @@ bool mm_region::is_empty() const
     return true;
 }
 
+bool mm_region::is_dirty() const
+{
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x  = 0; x < MM_REG_SIZE; x++ ) {
+            if( submaps[x][y]->is_dirty() ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void mm_region::mark_clean()
+{
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x  = 0; x < MM_REG_SIZE; x++ ) {
+            submaps[x][y]->mark_clean();
+        }
+    }
+}
+
 map_memory::coord_pair::coord_pair( const tripoint &p ) : loc( p.xy() )
 {
     sm = tripoint( ms_to_sm_remain( loc.x, loc.y ), p.z );
@@ -339,7 +360,9 @@ bool map_memory::save( const tripoint &pos )
     for( auto &it : regions ) {
         const tripoint &regp = it.first;
         mm_region &reg = it.second;
-        if( !reg.is_empty() ) {
+        // Unchanged regions are already on disk in their current state, so
+        // only the dirty ones are rewritten.
+        if( !reg.is_empty() && reg.is_dirty() ) {
             const std::string path = find_region_path( dirname, regp );
             const std::string descr = string_format(
                                           _( "memory map region for (%d,%d,%d)" ),
@@ -354,6 +377,9 @@ bool map_memory::save( const tripoint &pos )
             };
 
             const bool res = write_to_file( path, writer, descr.c_str() );
+            if( res ) {
+                reg.mark_clean();
+            }
             result = result & res;
         }
         tripoint regp_sm = mmr_to_sm_copy( regp );
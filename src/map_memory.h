@@ -41,6 +41,16 @@ struct mm_submap {
             return tiles.empty() && symbols.empty();
         }
 
+        /** Whether this mm_submap was modified since it was loaded or last saved.
+         *  Regions with no dirty submaps are not rewritten on save. */
+        bool is_dirty() const {
+            return dirty;
+        }
+
+        void mark_clean() {
+            dirty = false;
+        }
+
         // Whether this mm_submap is invalid, i.e. returned from an uninitialized region.
         bool is_valid() const {
             return valid;
@@ -61,6 +71,7 @@ struct mm_submap {
                 tiles.resize( SEEX * SEEY, default_tile );
             }
             tiles[p.y * SEEX + p.x] = value;
+            dirty = true;
         }
 
         inline int symbol( const point &p ) const {
@@ -78,6 +89,7 @@ struct mm_submap {
                 symbols.resize( SEEX * SEEY, default_symbol );
             }
             symbols[p.y * SEEX + p.x] = value;
+            dirty = true;
         }
 
         void serialize( JsonOut &jsout ) const;
@@ -89,6 +101,8 @@ struct mm_submap {
         // NOLINTNEXTLINE(cata-serialize)
         std::vector<int> symbols; // holds either 0 or SEEX*SEEY elements
         bool valid = true; // NOLINT(cata-serialize)
+        // Cleared on (de)serialization, set by writes; see is_dirty.
+        bool dirty = false; // NOLINT(cata-serialize)
 };
 
 /**
@@ -102,6 +116,9 @@ struct mm_region {
     mm_region();
 
     bool is_empty() const;
+    /** Whether any submap in this region changed since loading or last save. */
+    bool is_dirty() const;
+    void mark_clean();
 
     void serialize( JsonOut &jsout ) const;
     void deserialize( JsonIn &jsin );
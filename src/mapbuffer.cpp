@@ -1,6 +1,8 @@
 #include "mapbuffer.h"
 
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <ratio>
@@ -10,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "background_writer.h"
 #include "cata_utility.h"
 #include "coordinate_conversions.h"
 #include "debug.h"
@@ -17,12 +20,14 @@
 #include "game_constants.h"
 #include "json.h"
 #include "map.h"
+#include "options.h"
 #include "output.h"
 #include "path_info.h"
 #include "popup.h"
 #include "string_formatter.h"
 #include "submap.h"
 #include "translations.h"
+#include "turn_profiler.h"
 #include "ui_manager.h"
 
 #define dbg(x) DebugLog((x),D_MAP) << __FILE__ << ":" << __LINE__ << ": "
@@ -33,6 +38,25 @@ extern std::unique_ptr<game> g;
 // NOLINTNEXTLINE(cata-static-declarations)
 extern const int savegame_version;
 
+// Leading bytes of quad files saved in the binary format. JSON quads
+// start with '[', so the two are cheap to tell apart when reading.
+static const char BINARY_QUAD_MAGIC[8] = { 'C', 'D', 'D', 'A', '-', 'B', 'S', 'M' };
+// Bump when the binary quad layout changes; unknown versions fall back
+// to regenerating the quad rather than misreading it.
+static constexpr uint32_t binary_quad_version = 1;
+
+static void write_quad_u32( std::ostream &fout, uint32_t val )
+{
+    fout.write( reinterpret_cast<const char *>( &val ), sizeof( val ) );
+}
+
+static uint32_t read_quad_u32( std::istream &fin )
+{
+    uint32_t val = 0;
+    fin.read( reinterpret_cast<char *>( &val ), sizeof( val ) );
+    return val;
+}
+
 static std::string find_quad_path( const std::string &dirname, const tripoint &om_addr )
 {
     return string_format( "%s/%d.%d.%d.map", dirname, om_addr.x, om_addr.y, om_addr.z );
@@ -50,8 +74,18 @@ mapbuffer MAPBUFFER;
 mapbuffer::mapbuffer() = default;
 mapbuffer::~mapbuffer() = default;
 
+void mapbuffer::flush_pending_writes()
+{
+    if( writer ) {
+        writer->flush();
+    }
+}
+
 void mapbuffer::clear()
 {
+    // Pending writes hold their own copies of the serialized data, but
+    // they must hit the disk before the world can be left or reloaded.
+    flush_pending_writes();
     submaps.clear();
 }
 
@@ -107,8 +141,13 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
 
 void mapbuffer::save( bool delete_after_save )
 {
+    turn_profiler::scoped_span span( "mapbuffer::save" );
     assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
 
+    // Don't let a previous background save overlap with this one.
+    flush_pending_writes();
+    const bool save_in_background = get_option<bool>( "BACKGROUND_SAVE" );
+
     int num_saved_submaps = 0;
     int num_total_submaps = submaps.size();
 
@@ -158,7 +197,8 @@ void mapbuffer::save( bool delete_after_save )
                    delete_after_save || zlev_del ||
                    om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
                    om_addr.x > map_origin.x + HALF_MAPSIZE ||
-                   om_addr.y > map_origin.y + HALF_MAPSIZE );
+                   om_addr.y > map_origin.y + HALF_MAPSIZE,
+                   save_in_background );
         num_saved_submaps += 4;
     }
     for( auto &elem : submaps_to_delete ) {
@@ -168,7 +208,7 @@ void mapbuffer::save( bool delete_after_save )
 
 void mapbuffer::save_quad( const std::string &dirname, const std::string &filename,
                            const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
-                           bool delete_after_save )
+                           bool delete_after_save, bool save_in_background )
 {
     std::vector<point> offsets;
     std::vector<tripoint> submap_addrs;
@@ -202,50 +242,134 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         return;
     }
 
-    // Don't create the directory if it would be empty
-    assure_dir_exist( dirname );
-    write_to_file( filename, [&]( std::ostream & fout ) {
-        JsonOut jsout( fout );
-        jsout.start_array();
-        for( auto &submap_addr : submap_addrs ) {
-            if( submaps.count( submap_addr ) == 0 ) {
-                continue;
+    // If nothing in this quad changed since its file was last written (or
+    // since it was loaded), the copy on disk is already current and the
+    // rewrite can be skipped - on a long game that is the vast majority of
+    // the buffer. Submaps holding a vehicle, a camp or active items mutate
+    // through pointers the submap can't see, so they always count as
+    // changed.
+    bool unchanged = true;
+    for( auto &submap_addr : submap_addrs ) {
+        const auto iter = submaps.find( submap_addr );
+        if( iter == submaps.end() || iter->second == nullptr ) {
+            continue;
+        }
+        const submap &sm = *iter->second;
+        if( sm.modified || !sm.vehicles.empty() || sm.camp || !sm.active_items.empty() ) {
+            unchanged = false;
+            break;
+        }
+    }
+    if( unchanged && file_exist( filename ) ) {
+        if( delete_after_save ) {
+            for( auto &submap_addr : submap_addrs ) {
+                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
+                    submaps_to_delete.push_back( submap_addr );
+                }
             }
+        }
+        return;
+    }
+
+    std::vector<std::pair<tripoint, submap *>> quad_content;
+    for( auto &submap_addr : submap_addrs ) {
+        if( submaps.count( submap_addr ) == 0 ) {
+            continue;
+        }
 
-            submap *sm = submaps[submap_addr].get();
+        submap *sm = submaps[submap_addr].get();
 
-            if( sm == nullptr ) {
-                continue;
-            }
+        if( sm == nullptr ) {
+            continue;
+        }
+
+        quad_content.emplace_back( submap_addr, sm );
 
+        if( delete_after_save ) {
+            submaps_to_delete.push_back( submap_addr );
+        }
+    }
+
+    const auto serialize_quad_json = [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_array();
+        for( const std::pair<tripoint, submap *> &elem : quad_content ) {
             jsout.start_object();
 
             jsout.member( "version", savegame_version );
             jsout.member( "coordinates" );
 
             jsout.start_array();
-            jsout.write( submap_addr.x );
-            jsout.write( submap_addr.y );
-            jsout.write( submap_addr.z );
+            jsout.write( elem.first.x );
+            jsout.write( elem.first.y );
+            jsout.write( elem.first.z );
             jsout.end_array();
 
-            sm->store( jsout );
+            elem.second->store( jsout );
 
             jsout.end_object();
-
-            if( delete_after_save ) {
-                submaps_to_delete.push_back( submap_addr );
-            }
         }
 
         jsout.end_array();
-    } );
+    };
+
+    const auto serialize_quad_binary = [&]( std::ostream & fout ) {
+        fout.write( BINARY_QUAD_MAGIC, sizeof( BINARY_QUAD_MAGIC ) );
+        write_quad_u32( fout, binary_quad_version );
+        write_quad_u32( fout, quad_content.size() );
+        for( const std::pair<tripoint, submap *> &elem : quad_content ) {
+            write_quad_u32( fout, elem.first.x );
+            write_quad_u32( fout, elem.first.y );
+            write_quad_u32( fout, elem.first.z );
+            elem.second->store_tile_arrays( fout );
+            // The dynamic members (items, fields, vehicles, ...) keep the
+            // JSON representation, embedded as one length-prefixed blob.
+            std::ostringstream blob;
+            JsonOut jsout( blob );
+            jsout.start_object();
+            jsout.member( "version", savegame_version );
+            elem.second->store( jsout, true );
+            jsout.end_object();
+            const std::string text = blob.str();
+            write_quad_u32( fout, text.size() );
+            fout.write( text.data(), text.size() );
+        }
+    };
+
+    const auto serialize_quad = get_option<bool>( "BINARY_MAP_SAVES" )
+                               ? std::function<void( std::ostream & )>( serialize_quad_binary )
+                               : std::function<void( std::ostream & )>( serialize_quad_json );
+
+    if( save_in_background ) {
+        // Snapshot the serialized quad on this thread - the submaps keep
+        // changing as play continues - and hand only the string to the
+        // worker for the actual file IO.
+        std::ostringstream snapshot;
+        serialize_quad( snapshot );
+        if( !writer ) {
+            writer = std::make_unique<background_writer>();
+        }
+        writer->queue( dirname, filename, snapshot.str() );
+    } else {
+        // Don't create the directory if it would be empty
+        assure_dir_exist( dirname );
+        write_to_file( filename, serialize_quad );
+    }
+    // The serialized state is on its way to disk (the background path
+    // snapshots on this thread before queueing), so the submaps are clean
+    // until the next mutation.
+    for( const std::pair<tripoint, submap *> &elem : quad_content ) {
+        elem.second->modified = false;
+    }
 }
 
 // We're reading in way too many entities here to mess around with creating sub-objects and
 // seeking around in them, so we're using the json streaming API.
 submap *mapbuffer::unserialize_submaps( const tripoint &p )
 {
+    // The quad we want may still be sitting in the background write queue.
+    flush_pending_writes();
+
     // Map the tripoint to the submap quad that stores it.
     const tripoint om_addr = sm_to_omt_copy( p );
     const std::string dirname = find_dirname( om_addr );
@@ -263,8 +387,20 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
         }
     }
 
-    using namespace std::placeholders;
-    if( !read_from_file_optional_json( quad_path, std::bind( &mapbuffer::deserialize, this, _1 ) ) ) {
+    const auto read_quad = [this]( std::istream & fin ) {
+        char magic[sizeof( BINARY_QUAD_MAGIC )] = {};
+        fin.read( magic, sizeof( magic ) );
+        if( fin.good() && memcmp( magic, BINARY_QUAD_MAGIC, sizeof( magic ) ) == 0 ) {
+            deserialize_binary( fin );
+        } else {
+            // JSON quad - rewind past the sniffed bytes and parse normally.
+            fin.clear();
+            fin.seekg( 0 );
+            JsonIn jsin( fin );
+            deserialize( jsin );
+        }
+    };
+    if( !read_from_file_optional( quad_path, read_quad ) ) {
         // If it doesn't exist, trigger generating it.
         return nullptr;
     }
@@ -298,6 +434,47 @@ void mapbuffer::deserialize( JsonIn &jsin )
             }
         }
 
+        // Freshly read from disk, so the file is current until mutated.
+        sm->modified = false;
+        if( !add_submap( submap_coordinates, sm ) ) {
+            debugmsg( "submap %d,%d,%d was already loaded", submap_coordinates.x, submap_coordinates.y,
+                      submap_coordinates.z );
+        }
+    }
+}
+
+void mapbuffer::deserialize_binary( std::istream &fin )
+{
+    const uint32_t version = read_quad_u32( fin );
+    if( version != binary_quad_version ) {
+        debugmsg( "unknown binary map quad version %u", version );
+        return;
+    }
+    const uint32_t count = read_quad_u32( fin );
+    for( uint32_t n = 0; n < count && fin.good(); n++ ) {
+        tripoint submap_coordinates;
+        submap_coordinates.x = static_cast<int>( read_quad_u32( fin ) );
+        submap_coordinates.y = static_cast<int>( read_quad_u32( fin ) );
+        submap_coordinates.z = static_cast<int>( read_quad_u32( fin ) );
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->load_tile_arrays( fin );
+
+        std::string blob( read_quad_u32( fin ), '\0' );
+        fin.read( &blob[0], blob.size() );
+        std::istringstream blob_stream( blob );
+        JsonIn jsin( blob_stream );
+        jsin.start_object();
+        int json_version = 0;
+        while( !jsin.end_object() ) {
+            const std::string submap_member_name = jsin.get_member_name();
+            if( submap_member_name == "version" ) {
+                json_version = jsin.get_int();
+            } else {
+                sm->load( jsin, submap_member_name, json_version );
+            }
+        }
+
+        sm->modified = false;
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %d,%d,%d was already loaded", submap_coordinates.x, submap_coordinates.y,
                       submap_coordinates.z );
@@ -6,10 +6,12 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <string>
 
 #include "point.h"
 
 class JsonIn;
+class background_writer;
 class submap;
 
 /**
@@ -27,6 +29,12 @@ class mapbuffer
          **/
         void save( bool delete_after_save = false );
 
+        /** Block until all submap quads queued by a previous background
+         * save have been written to disk. Must be called before the
+         * world's map files are read back or the world is exited.
+         **/
+        void flush_pending_writes();
+
         /** Delete all buffered submaps. **/
         void clear();
 
@@ -71,10 +79,13 @@ class mapbuffer
         void remove_submap( tripoint addr );
         submap *unserialize_submaps( const tripoint &p );
         void deserialize( JsonIn &jsin );
+        void deserialize_binary( std::istream &fin );
         void save_quad( const std::string &dirname, const std::string &filename,
                         const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
-                        bool delete_after_save );
+                        bool delete_after_save, bool save_in_background );
         submap_map_t submaps; // NOLINT(cata-serialize)
+        // Writes serialized quads on a worker thread; see background_writer.h.
+        std::unique_ptr<background_writer> writer; // NOLINT(cata-serialize)
 };
 
 extern mapbuffer MAPBUFFER;
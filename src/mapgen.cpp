@@ -70,6 +70,7 @@
 #include "to_string_id.h"
 #include "translations.h"
 #include "trap.h"
+#include "turn_profiler.h"
 #include "units.h"
 #include "value_ptr.h"
 #include "vehicle.h"
@@ -136,6 +137,12 @@ void map::generate( const tripoint &p, const time_point &when )
     tripoint_abs_omt abs_omt( sm_to_omt_copy( p ) );
     oter_id terrain_type = overmap_buffer.ter( abs_omt );
 
+    turn_profiler::scoped_span span( "map::generate" );
+    if( turn_profiler::capturing() ) {
+        span.set_detail( string_format( "%s at %s", terrain_type.id().str(),
+                                        abs_omt.to_string() ) );
+    }
+
     // This attempts to scale density of zombies inversely with distance from the nearest city.
     // In other words, make city centers dense and perimeters sparse.
     float density = 0.0f;
@@ -1299,6 +1306,15 @@ class mapgen_value
         Id get( const mapgendata &dat ) const {
             return source_->get( dat );
         }
+        // The fixed result of this value when it depends on nothing at
+        // runtime, or nullopt for parameters, distributions and
+        // switches. Used to bake constant pieces at finalize time.
+        cata::optional<Id> get_constant() const {
+            if( const id_source *src = dynamic_cast<const id_source *>( source_.get() ) ) {
+                return src->id;
+            }
+            return cata::nullopt;
+        }
         std::vector<StringId> all_possible_results( const mapgen_parameters &params ) const {
             return source_->all_possible_results( params );
         }
@@ -3587,6 +3603,46 @@ void jmapgen_objects::finalize()
     []( const jmapgen_obj & l, const jmapgen_obj & r ) {
         return l.second->phase() < r.second->phase();
     } );
+
+    // Compile the dominant case from "rows" out of the object list:
+    // cells holding exactly one constant terrain piece at a fixed point
+    // with no repeats. apply() runs those as direct ter_set calls.
+    // Order is safe to rearrange because terrain is the first phase and
+    // no other terrain piece touches a baked cell.
+    const auto is_fixed = []( const jmapgen_int & v ) {
+        return v.val == v.valmax;
+    };
+    std::map<point, int> terrain_pieces_at;
+    for( const jmapgen_obj &obj : objects ) {
+        if( obj.second->phase() != mapgen_phase::terrain ) {
+            continue;
+        }
+        const jmapgen_place &where = obj.first;
+        if( !is_fixed( where.x ) || !is_fixed( where.y ) ) {
+            // A variable-coordinate terrain piece may land on any cell,
+            // so nothing can be baked safely.
+            return;
+        }
+        terrain_pieces_at[point( where.x.val, where.y.val )]++;
+    }
+
+    std::vector<jmapgen_obj> remaining;
+    remaining.reserve( objects.size() );
+    for( const jmapgen_obj &obj : objects ) {
+        const jmapgen_place &where = obj.first;
+        const jmapgen_terrain *ter = dynamic_cast<const jmapgen_terrain *>( obj.second.get() );
+        if( ter && where.repeat.val == 1 && where.repeat.valmax == 1 &&
+            ter->repeat.val == 1 && ter->repeat.valmax == 1 &&
+            terrain_pieces_at[point( where.x.val, where.y.val )] == 1 ) {
+            const cata::optional<ter_id> fixed_id = ter->id.get_constant();
+            if( fixed_id && !fixed_id->id().is_null() ) {
+                baked_terrain.emplace_back( point( where.x.val, where.y.val ), *fixed_id );
+                continue;
+            }
+        }
+        remaining.push_back( obj );
+    }
+    objects = std::move( remaining );
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -3841,11 +3897,30 @@ void mapgen_function_json_nested::nest( const mapgendata &md, const point &offse
     resolve_regional_terrain_and_furniture( md_with_params );
 }
 
+void jmapgen_objects::apply_baked_terrain( const mapgendata &dat, const point &offset ) const
+{
+    map &m = dat.m;
+    for( const std::pair<point, ter_id> &baked : baked_terrain ) {
+        const point p = baked.first + offset;
+        m.ter_set( p, baked.second );
+        // Mirrors jmapgen_terrain::apply: delete furniture if a wall
+        // was just placed over it, and items unless the wall stores them.
+        if( m.has_flag_ter( ter_furn_flag::TFLAG_WALL, p ) ) {
+            m.furn_set( p, f_null );
+            if( !m.has_flag_ter( ter_furn_flag::TFLAG_PLACE_ITEM, p ) ) {
+                m.i_clear( tripoint( p, m.get_abs_sub().z ) );
+            }
+        }
+    }
+}
+
 /*
  * Apply mapgen as per a derived-from-json recipe; in theory fast, but not very versatile
  */
 void jmapgen_objects::apply( const mapgendata &dat ) const
 {
+    // Terrain is the first phase, so the baked cells always go first.
+    apply_baked_terrain( dat, point_zero );
     for( const jmapgen_obj &obj : objects ) {
         const auto &where = obj.first;
         const auto &what = *obj.second;
@@ -3866,6 +3941,7 @@ void jmapgen_objects::apply( const mapgendata &dat, const point &offset ) const
         return;
     }
 
+    apply_baked_terrain( dat, offset );
     for( const jmapgen_obj &obj : objects ) {
         jmapgen_place where = obj.first;
         where.offset( -offset );
@@ -3882,6 +3958,11 @@ void jmapgen_objects::apply( const mapgendata &dat, const point &offset ) const
 
 bool jmapgen_objects::has_vehicle_collision( const mapgendata &dat, const point &offset ) const
 {
+    for( const std::pair<point, ter_id> &baked : baked_terrain ) {
+        if( dat.m.veh_at( tripoint( baked.first + offset, dat.zlevel() ) ).has_value() ) {
+            return true;
+        }
+    }
     for( const jmapgen_obj &obj : objects ) {
         jmapgen_place where = obj.first;
         where.offset( -offset );
@@ -5880,6 +5961,7 @@ void map::add_spawn( const mtype_id &type, int count, const tripoint &p, bool fr
     }
     spawn_point tmp( type, count, offset, faction_id, mission_id, friendly, name, data );
     place_on_submap->spawns.push_back( tmp );
+    place_on_submap->modified = true;
 }
 
 vehicle *map::add_vehicle( const vgroup_id &type, const tripoint &p, const units::angle &dir,
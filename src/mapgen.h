@@ -384,6 +384,15 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * Terrain placements compiled out of @ref objects by finalize():
+         * cells with exactly one constant, fixed-position terrain piece.
+         * These cover nearly every cell of a typical "rows" mapgen and
+         * are applied as direct ter_set calls instead of going through
+         * the per-piece virtual machinery.
+         */
+        std::vector<std::pair<point, ter_id>> baked_terrain;
+        void apply_baked_terrain( const mapgendata &dat, const point &offset ) const;
         point m_offset;
         point mapgensize;
         point total_size;
@@ -128,6 +128,14 @@ void ofstream_wrapper::open( const std::ios::openmode mode )
         fs::remove( temp_path, ec );
     }
 
+    // JSON serialization emits the stream a few characters at a time. With
+    // the default filebuf that becomes thousands of tiny write syscalls per
+    // file, which is painfully slow on network filesystems; a large buffer
+    // batches them into sequential megabyte-sized blocks. Must be installed
+    // before the stream is opened to take effect portably.
+    write_buffer.resize( 1024 * 1024 );
+    file_stream.rdbuf()->pubsetbuf( write_buffer.data(), write_buffer.size() );
+
     file_stream.open( temp_path, mode );
     if( !file_stream.is_open() ) {
         throw std::runtime_error( "opening file failed" );
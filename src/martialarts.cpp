@@ -902,6 +902,36 @@ std::vector<matec_id> character_martial_arts::get_all_techniques( const item &we
     return tecs;
 }
 
+const std::vector<matec_id> &character_martial_arts::get_offense_techniques(
+    const item &weap, bool dodge_counter, bool block_counter ) const
+{
+    std::set<matec_id> weapon_techs = weap.get_techniques();
+    if( !offense_cache_valid || offense_cache_style != style_selected ||
+        offense_cache_weapon_techs != weapon_techs ) {
+        for( std::vector<matec_id> &bucket : offense_techniques ) {
+            bucket.clear();
+        }
+        std::vector<matec_id> all;
+        all.insert( all.end(), weapon_techs.begin(), weapon_techs.end() );
+        const martialart &style = style_selected.obj();
+        all.insert( all.end(), style.techniques.begin(), style.techniques.end() );
+        for( const matec_id &tec_id : all ) {
+            const ma_technique &tec = tec_id.obj();
+            // "Dummy" techniques like WBLOCK_1 and defensive techniques can
+            // never be picked as an attack.
+            if( tec.dummy || tec.defensive ) {
+                continue;
+            }
+            const int bucket = ( tec.dodge_counter ? 1 : 0 ) + ( tec.block_counter ? 2 : 0 );
+            offense_techniques[bucket].push_back( tec_id );
+        }
+        offense_cache_style = style_selected;
+        offense_cache_weapon_techs = std::move( weapon_techs );
+        offense_cache_valid = true;
+    }
+    return offense_techniques[( dodge_counter ? 1 : 0 ) + ( block_counter ? 2 : 0 )];
+}
+
 // defensive technique-related
 
 static ma_technique get_valid_technique( const Character &owner, bool ma_technique::*  purpose )
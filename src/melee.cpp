@@ -1363,7 +1363,10 @@ matec_id Character::pick_technique( Creature &t, const item &weap,
                                     bool crit, bool dodge_counter, bool block_counter )
 {
 
-    const std::vector<matec_id> all = martial_arts_data->get_all_techniques( weap );
+    // Dummy/defensive techniques and the counter class are filtered when
+    // the candidate list is rebuilt on style/weapon change, not per attack.
+    const std::vector<matec_id> &all = martial_arts_data->get_offense_techniques( weap,
+                                       dodge_counter, block_counter );
 
     std::vector<matec_id> possible;
 
@@ -1375,30 +1378,11 @@ matec_id Character::pick_technique( Creature &t, const item &weap,
     for( const matec_id &tec_id : all ) {
         const ma_technique &tec = tec_id.obj();
 
-        // ignore "dummy" techniques like WBLOCK_1
-        if( tec.dummy ) {
-            continue;
-        }
-
-        // skip defensive techniques
-        if( tec.defensive ) {
-            continue;
-        }
-
         // skip wall adjacent techniques if not next to a wall
         if( tec.wall_adjacent && !wall_adjacent ) {
             continue;
         }
 
-        // skip dodge counter techniques if it's not a dodge count, and vice versa
-        if( dodge_counter != tec.dodge_counter ) {
-            continue;
-        }
-        // likewise for block counters
-        if( block_counter != tec.block_counter ) {
-            continue;
-        }
-
         // Don't counter if it would exhaust moves.
         if( tec.block_counter || tec.dodge_counter ) {
             float move_cost = attack_speed( used_weapon() );
@@ -0,0 +1,120 @@
+#include "memory_stats.h"
+
+#include <ctime>
+#include <utility>
+
+#include "avatar.h"
+#include "cata_utility.h"
+#include "colony.h"
+#include "creature_tracker.h"
+#include "game.h"
+#include "game_constants.h"
+#include "item.h"
+#include "json.h"
+#include "mapbuffer.h"
+#include "messages.h"
+#include "monster.h"
+#include "output.h"
+#include "overmap.h"
+#include "overmapbuffer.h"
+#include "path_info.h"
+#include "point.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "translations.h"
+#include "visitable.h"
+
+namespace memory_stats
+{
+
+namespace
+{
+
+void dump_json( const std::vector<subsystem_usage> &usages )
+{
+    const std::string path = string_format( "%s/memory-%lld.json", PATH_INFO::config_dir(),
+                                            static_cast<long long>( std::time( nullptr ) ) );
+    const bool written = write_to_file( path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_array();
+        for( const subsystem_usage &usage : usages ) {
+            jsout.start_object();
+            jsout.member( "subsystem", usage.name );
+            jsout.member( "objects", usage.objects );
+            jsout.member( "bytes", usage.bytes );
+            jsout.end_object();
+        }
+        jsout.end_array();
+    }, "memory report" );
+    if( written ) {
+        add_msg( "memory report written to %s", path );
+    }
+}
+
+} // namespace
+
+std::vector<subsystem_usage> gather()
+{
+    std::vector<subsystem_usage> usages;
+
+    // Loaded submaps, with the items they hold counted separately since
+    // item stacks dominate submap growth over a long game.
+    int64_t submap_count = 0;
+    int64_t map_item_count = 0;
+    for( const auto &elem : MAPBUFFER ) {
+        ++submap_count;
+        const submap &sm = *elem.second;
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                map_item_count += sm.get_items( point( x, y ) ).size();
+            }
+        }
+    }
+    usages.push_back( { "mapbuffer submaps", submap_count,
+                        submap_count * static_cast<int64_t>( sizeof( submap ) ) } );
+    usages.push_back( { "mapbuffer items", map_item_count,
+                        map_item_count * static_cast<int64_t>( sizeof( item ) ) } );
+
+    const int64_t overmap_count = overmap_buffer.overmap_count();
+    usages.push_back( { "overmaps", overmap_count,
+                        overmap_count * static_cast<int64_t>( sizeof( overmap ) ) } );
+
+    const int64_t monster_count = g->critter_tracker->size();
+    usages.push_back( { "monsters", monster_count,
+                        monster_count * static_cast<int64_t>( sizeof( monster ) ) } );
+
+    int64_t carried_items = 0;
+    get_avatar().visit_items( [&carried_items]( const item *, item * ) {
+        ++carried_items;
+        return VisitResponse::NEXT;
+    } );
+    usages.push_back( { "player inventory items", carried_items,
+                        carried_items * static_cast<int64_t>( sizeof( item ) ) } );
+
+    const int64_t message_count = Messages::size();
+    usages.push_back( { "message log", message_count,
+                        // game_message is internal to messages.cpp; items are
+                        // string-dominated, so charge a rough per-entry cost.
+                        message_count * 128 } );
+
+    return usages;
+}
+
+void show_report()
+{
+    const std::vector<subsystem_usage> usages = gather();
+    std::string report = _( "Estimated memory usage (counts x sizeof, undercounts strings):" );
+    int64_t total = 0;
+    for( const subsystem_usage &usage : usages ) {
+        report += string_format( "\n%s: %lld objects, %.1f MiB", usage.name,
+                                 static_cast<long long>( usage.objects ),
+                                 usage.bytes / ( 1024.0 * 1024.0 ) );
+        total += usage.bytes;
+    }
+    report += string_format( "\n%s: %.1f MiB", _( "total accounted" ),
+                             total / ( 1024.0 * 1024.0 ) );
+    popup( "%s", report );
+    dump_json( usages );
+}
+
+} // namespace memory_stats
@@ -0,0 +1,35 @@
+#pragma once
+#ifndef CATA_SRC_MEMORY_STATS_H
+#define CATA_SRC_MEMORY_STATS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Estimated per-subsystem memory accounting for long-running worlds.
+ * The numbers are computed from object counts and sizeof, not from an
+ * instrumented allocator, so they undercount strings and other
+ * out-of-line storage; they are meant for triage ("which subsystem
+ * grew"), not for exact footprints.
+ */
+namespace memory_stats
+{
+
+struct subsystem_usage {
+    const char *name;
+    int64_t objects;
+    int64_t bytes;
+};
+
+/** Walks the major owners (mapbuffer, overmapbuffer, creatures, player
+ *  inventory, message log) and estimates their footprints. */
+std::vector<subsystem_usage> gather();
+
+/** Shows the report in a popup and writes a machine-readable JSON dump
+ *  (memory-<unixtime>.json in the config directory). */
+void show_report();
+
+} // namespace memory_stats
+
+#endif // CATA_SRC_MEMORY_STATS_H
@@ -29,8 +29,6 @@
 #include <memory>
 #include <string>
 
-#include "options.h"
-
 namespace
 {
 
@@ -187,8 +185,7 @@ class messages_impl
                 return;
             }
 
-            unsigned int message_limit = get_option<int>( "MESSAGE_LIMIT" );
-            while( messages.size() > message_limit ) {
+            while( messages.size() > static_cast<size_t>( message_limit ) ) {
                 messages.pop_front();
             }
 
@@ -316,6 +313,21 @@ std::vector<std::pair<std::string, std::string>> Messages::recent_messages( cons
     return player_messages.recent_messages( count );
 }
 
+bool Messages::log_is_active()
+{
+    return player_messages.active;
+}
+
+bool Messages::player_sees( const tripoint &target )
+{
+    return get_player_view().sees( target );
+}
+
+bool Messages::player_sees( const Creature &target )
+{
+    return get_player_view().sees( target );
+}
+
 void Messages::serialize( JsonOut &json )
 {
     json.member( "player_messages" );
@@ -905,14 +917,14 @@ void add_msg_debug( debugmode::debug_filter type, std::string msg )
 
 void add_msg_if_player_sees( const tripoint &target, std::string msg )
 {
-    if( get_player_view().sees( target ) ) {
+    if( Messages::player_sees( target ) ) {
         Messages::add_msg( std::move( msg ) );
     }
 }
 
 void add_msg_if_player_sees( const Creature &target, std::string msg )
 {
-    if( get_player_view().sees( target ) ) {
+    if( Messages::player_sees( target ) ) {
         Messages::add_msg( std::move( msg ) );
     }
 }
@@ -920,7 +932,7 @@ void add_msg_if_player_sees( const Creature &target, std::string msg )
 void add_msg_if_player_sees( const tripoint &target, const game_message_params &params,
                              std::string msg )
 {
-    if( get_player_view().sees( target ) ) {
+    if( Messages::player_sees( target ) ) {
         Messages::add_msg( params, std::move( msg ) );
     }
 }
@@ -928,7 +940,7 @@ void add_msg_if_player_sees( const tripoint &target, const game_message_params &
 void add_msg_if_player_sees( const Creature &target, const game_message_params &params,
                              std::string msg )
 {
-    if( get_player_view().sees( target ) ) {
+    if( Messages::player_sees( target ) ) {
         Messages::add_msg( params, std::move( msg ) );
     }
 }
@@ -936,7 +948,7 @@ void add_msg_if_player_sees( const Creature &target, const game_message_params &
 void add_msg_debug_if_player_sees( const tripoint &target, debugmode::debug_filter type,
                                    std::string msg )
 {
-    if( get_player_view().sees( target ) ) {
+    if( Messages::player_sees( target ) ) {
         Messages::add_msg_debug( type, std::move( msg ) );
     }
 }
@@ -944,7 +956,7 @@ void add_msg_debug_if_player_sees( const tripoint &target, debugmode::debug_filt
 void add_msg_debug_if_player_sees( const Creature &target, debugmode::debug_filter type,
                                    std::string msg )
 {
-    if( get_player_view().sees( target ) ) {
+    if( Messages::player_sees( target ) ) {
         Messages::add_msg_debug( type, std::move( msg ) );
     }
 }
@@ -26,6 +26,12 @@ class window;
 namespace Messages
 {
 std::vector<std::pair<std::string, std::string>> recent_messages( size_t count );
+/** Whether the log accepts messages at all; false after @ref deactivate. */
+bool log_is_active();
+/** Sight checks backing add_msg_if_player_sees, exposed so the inline
+ * wrappers below can skip string formatting for unseen messages. */
+bool player_sees( const tripoint &target );
+bool player_sees( const Creature &target );
 void add_msg( std::string msg );
 void add_msg( const game_message_params &params, std::string msg );
 void add_msg_debug( debugmode::debug_filter type, std::string msg );
@@ -44,16 +50,25 @@ void add_msg( std::string msg );
 template<typename ...Args>
 inline void add_msg( const std::string &msg, Args &&... args )
 {
+    if( !Messages::log_is_active() ) {
+        return;
+    }
     return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg( const char *const msg, Args &&... args )
 {
+    if( !Messages::log_is_active() ) {
+        return;
+    }
     return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg( const translation &msg, Args &&... args )
 {
+    if( !Messages::log_is_active() ) {
+        return;
+    }
     return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 
@@ -61,7 +76,7 @@ void add_msg( const game_message_params &params, std::string msg );
 template<typename ...Args>
 inline void add_msg( const game_message_params &params, const std::string &msg, Args &&... args )
 {
-    if( params.type == m_debug && !debug_mode ) {
+    if( ( params.type == m_debug && !debug_mode ) || !Messages::log_is_active() ) {
         return;
     }
     return add_msg( params, string_format( msg, std::forward<Args>( args )... ) );
@@ -69,7 +84,7 @@ inline void add_msg( const game_message_params &params, const std::string &msg,
 template<typename ...Args>
 inline void add_msg( const game_message_params &params, const char *const msg, Args &&... args )
 {
-    if( params.type == m_debug && !debug_mode ) {
+    if( ( params.type == m_debug && !debug_mode ) || !Messages::log_is_active() ) {
         return;
     }
     return add_msg( params, string_format( msg, std::forward<Args>( args )... ) );
@@ -94,39 +109,60 @@ inline void add_msg_debug( debugmode::debug_filter type, const char *const msg,
 
 void add_msg_if_player_sees( const tripoint &target, std::string msg );
 void add_msg_if_player_sees( const Creature &target, std::string msg );
+// The sight check runs before string_format in these wrappers, so unseen
+// messages are never formatted; add_msg is then called directly to avoid
+// repeating the check.
 template<typename ...Args>
 inline void add_msg_if_player_sees( const tripoint &target, const std::string &msg,
                                     Args &&... args )
 {
-    return add_msg_if_player_sees( target, string_format( msg, std::forward<Args>( args )... ) );
+    if( !Messages::log_is_active() || !Messages::player_sees( target ) ) {
+        return;
+    }
+    return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const Creature &target, const std::string &msg,
                                     Args &&... args )
 {
-    return add_msg_if_player_sees( target, string_format( msg, std::forward<Args>( args )... ) );
+    if( !Messages::log_is_active() || !Messages::player_sees( target ) ) {
+        return;
+    }
+    return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const tripoint &target, const char *const msg, Args &&... args )
 {
-    return add_msg_if_player_sees( target, string_format( msg, std::forward<Args>( args )... ) );
+    if( !Messages::log_is_active() || !Messages::player_sees( target ) ) {
+        return;
+    }
+    return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const Creature &target, const char *const msg, Args &&... args )
 {
-    return add_msg_if_player_sees( target, string_format( msg, std::forward<Args>( args )... ) );
+    if( !Messages::log_is_active() || !Messages::player_sees( target ) ) {
+        return;
+    }
+    return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const tripoint &target, const translation &msg,
                                     Args &&... args )
 {
-    return add_msg_if_player_sees( target, string_format( msg, std::forward<Args>( args )... ) );
+    if( !Messages::log_is_active() || !Messages::player_sees( target ) ) {
+        return;
+    }
+    return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const Creature &target, const translation &msg,
                                     Args &&... args )
 {
-    return add_msg_if_player_sees( target, string_format( msg, std::forward<Args>( args )... ) );
+    if( !Messages::log_is_active() || !Messages::player_sees( target ) ) {
+        return;
+    }
+    return add_msg( string_format( msg, std::forward<Args>( args )... ) );
 }
 
 void add_msg_if_player_sees( const tripoint &target, const game_message_params &params,
@@ -137,41 +173,41 @@ template<typename ...Args>
 inline void add_msg_if_player_sees( const tripoint &target, const game_message_params &params,
                                     const std::string &msg, Args &&... args )
 {
-    if( params.type == m_debug && !debug_mode ) {
+    if( ( params.type == m_debug && !debug_mode ) ||
+        !Messages::log_is_active() || !Messages::player_sees( target ) ) {
         return;
     }
-    return add_msg_if_player_sees( target, params, string_format( msg,
-                                   std::forward<Args>( args )... ) );
+    return add_msg( params, string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const Creature &target, const game_message_params &params,
                                     const std::string &msg, Args &&... args )
 {
-    if( params.type == m_debug && !debug_mode ) {
+    if( ( params.type == m_debug && !debug_mode ) ||
+        !Messages::log_is_active() || !Messages::player_sees( target ) ) {
         return;
     }
-    return add_msg_if_player_sees( target, params, string_format( msg,
-                                   std::forward<Args>( args )... ) );
+    return add_msg( params, string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const tripoint &target, const game_message_params &params,
                                     const char *const msg, Args &&... args )
 {
-    if( params.type == m_debug && !debug_mode ) {
+    if( ( params.type == m_debug && !debug_mode ) ||
+        !Messages::log_is_active() || !Messages::player_sees( target ) ) {
         return;
     }
-    return add_msg_if_player_sees( target, params, string_format( msg,
-                                   std::forward<Args>( args )... ) );
+    return add_msg( params, string_format( msg, std::forward<Args>( args )... ) );
 }
 template<typename ...Args>
 inline void add_msg_if_player_sees( const Creature &target, const game_message_params &params,
                                     const char *const msg, Args &&... args )
 {
-    if( params.type == m_debug && !debug_mode ) {
+    if( ( params.type == m_debug && !debug_mode ) ||
+        !Messages::log_is_active() || !Messages::player_sees( target ) ) {
         return;
     }
-    return add_msg_if_player_sees( target, params, string_format( msg,
-                                   std::forward<Args>( args )... ) );
+    return add_msg( params, string_format( msg, std::forward<Args>( args )... ) );
 }
 
 void add_msg_debug_if_player_sees( const tripoint &target, debugmode::debug_filter type,
@@ -183,36 +219,32 @@ inline void add_msg_debug_if_player_sees( const tripoint &target, debugmode::deb
         const std::string &msg, Args &&... args )
 {
     // expanding for string formatting can be expensive
-    if( debug_mode ) {
-        return add_msg_debug_if_player_sees( target, type, string_format( msg,
-                                             std::forward<Args>( args )... ) );
+    if( debug_mode && Messages::player_sees( target ) ) {
+        return add_msg_debug( type, string_format( msg, std::forward<Args>( args )... ) );
     }
 }
 template<typename ...Args>
 inline void add_msg_debug_if_player_sees( const Creature &target, debugmode::debug_filter type,
         const std::string &msg, Args &&... args )
 {
-    if( debug_mode ) {
-        return add_msg_debug_if_player_sees( target, type, string_format( msg,
-                                             std::forward<Args>( args )... ) );
+    if( debug_mode && Messages::player_sees( target ) ) {
+        return add_msg_debug( type, string_format( msg, std::forward<Args>( args )... ) );
     }
 }
 template<typename ...Args>
 inline void add_msg_debug_if_player_sees( const tripoint &target, debugmode::debug_filter type,
         const char *const msg, Args &&... args )
 {
-    if( debug_mode ) {
-        return add_msg_debug_if_player_sees( target, type, string_format( msg,
-                                             std::forward<Args>( args )... ) );
+    if( debug_mode && Messages::player_sees( target ) ) {
+        return add_msg_debug( type, string_format( msg, std::forward<Args>( args )... ) );
     }
 }
 template<typename ...Args>
 inline void add_msg_debug_if_player_sees( const Creature &target, debugmode::debug_filter type,
         const char *const msg, Args &&... args )
 {
-    if( debug_mode ) {
-        return add_msg_debug_if_player_sees( target, type, string_format( msg,
-                                             std::forward<Args>( args )... ) );
+    if( debug_mode && Messages::player_sees( target ) ) {
+        return add_msg_debug( type, string_format( msg, std::forward<Args>( args )... ) );
     }
 }
 
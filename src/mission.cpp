@@ -70,11 +70,27 @@ std::string mission_type::tname() const
 
 static std::unordered_map<int, mission> world_missions;
 
+// Per-turn mission processing schedule, rebuilt lazily in process_all.
+// Any mutation that can change it (missions added or loaded, status or
+// deadline changes) sets the dirty flag instead of recomputing eagerly.
+static bool mission_schedule_dirty = true;
+// Earliest deadline among in-progress missions; turn_zero when none has one.
+static time_point next_mission_deadline = calendar::turn_zero;
+// Missions without a quest giver complete on their own and must poll
+// is_complete every turn; everything else wraps up through dialogue.
+static std::vector<int> giverless_missions;
+
+static void invalidate_mission_schedule()
+{
+    mission_schedule_dirty = true;
+}
+
 mission *mission::reserve_new( const mission_type_id &type, const character_id &npc_id )
 {
     const mission tmp = mission_type::get( type )->create( npc_id );
     // TODO: Warn about overwrite?
     mission &miss = world_missions[tmp.uid] = tmp;
+    invalidate_mission_schedule();
     return &miss;
 }
 
@@ -103,12 +119,48 @@ std::vector<mission *> mission::get_all_active()
 void mission::add_existing( const mission &m )
 {
     world_missions[ m.uid ] = m;
+    invalidate_mission_schedule();
 }
 
 void mission::process_all()
 {
-    for( auto &e : world_missions ) {
-        e.second.process();
+    if( mission_schedule_dirty ) {
+        next_mission_deadline = calendar::turn_zero;
+        giverless_missions.clear();
+        for( const auto &e : world_missions ) {
+            const mission &m = e.second;
+            if( !m.in_progress() ) {
+                continue;
+            }
+            if( m.has_deadline() && ( next_mission_deadline == calendar::turn_zero
+                                      || m.deadline < next_mission_deadline ) ) {
+                next_mission_deadline = m.deadline;
+            }
+            if( !m.npc_id.is_valid() ) {
+                giverless_missions.push_back( m.uid );
+            }
+        }
+        mission_schedule_dirty = false;
+    }
+
+    // Late-game saves accumulate dozens of finished missions and a handful
+    // of in-progress ones with far-off deadlines; none of them need a
+    // per-turn pass. Only walk the full map when a deadline is actually due.
+    const bool deadline_due = next_mission_deadline != calendar::turn_zero
+                              && calendar::turn > next_mission_deadline;
+    if( deadline_due ) {
+        for( auto &e : world_missions ) {
+            e.second.process();
+        }
+        // The expired mission failed and dirtied the schedule; rebuilding on
+        // the next call picks up the following deadline.
+        return;
+    }
+    for( const int uid : giverless_missions ) {
+        const auto iter = world_missions.find( uid );
+        if( iter != world_missions.end() ) {
+            iter->second.process();
+        }
     }
 }
 
@@ -137,6 +189,7 @@ std::vector<int> mission::to_uid_vector( const std::vector<mission *> &vec )
 void mission::clear_all()
 {
     world_missions.clear();
+    invalidate_mission_schedule();
 }
 
 void mission::on_creature_death( Creature &poor_dead_dude )
@@ -298,12 +351,14 @@ void mission::assign( avatar &u )
         }
         type->start( this );
         status = mission_status::in_progress;
+        invalidate_mission_schedule();
     }
 }
 
 void mission::fail()
 {
     status = mission_status::failure;
+    invalidate_mission_schedule();
     avatar &player_character = get_avatar();
     if( player_character.getID() == player_id ) {
         player_character.on_mission_finished( *this );
@@ -353,6 +408,7 @@ void mission::wrap_up()
     }
 
     status = mission_status::success;
+    invalidate_mission_schedule();
     player_character.on_mission_finished( *this );
     std::vector<item_comp> comps;
     switch( type->goal ) {
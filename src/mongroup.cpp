@@ -97,15 +97,74 @@ const MonsterGroup &MonsterGroupManager::GetUpgradedMonsterGroup( const mongroup
     return *groupptr;
 }
 
+bool MonsterGroup::roll_is_unconditional() const
+{
+    if( unconditional_roll_cache < 0 ) {
+        int used = 0;
+        bool unconditional = freq_total > 0;
+        for( const MonsterGroupEntry &entry : monsters ) {
+            used += entry.frequency;
+            if( !entry.conditions.empty() || entry.starts > 0_turns || !entry.lasts_forever() ) {
+                unconditional = false;
+                break;
+            }
+        }
+        // When the frequencies overshoot freq_total the linear walk truncates
+        // the tail entries, which a plain weighted draw would not reproduce.
+        unconditional = unconditional && used <= freq_total;
+        unconditional_roll_cache = unconditional ? 1 : 0;
+    }
+    return unconditional_roll_cache != 0;
+}
+
+const MonsterGroupEntry *MonsterGroup::pick_unconditional_spawn() const
+{
+    if( spawn_alias.empty() ) {
+        // Slot 0 is the remainder of freq_total not claimed by any entry,
+        // i.e. the chance to fall through to the default monster.
+        std::vector<int> weights;
+        weights.reserve( monsters.size() + 1 );
+        int used = 0;
+        for( const MonsterGroupEntry &entry : monsters ) {
+            used += entry.frequency;
+        }
+        weights.push_back( freq_total - used );
+        for( const MonsterGroupEntry &entry : monsters ) {
+            weights.push_back( entry.frequency );
+        }
+        spawn_alias.build( weights );
+    }
+    const size_t idx = spawn_alias.pick();
+    return idx == 0 ? nullptr : &monsters[idx - 1];
+}
+
 //Quantity is adjusted directly as a side effect of this function
 MonsterGroupResult MonsterGroupManager::GetResultFromGroup(
     const mongroup_id &group_name, int *quantity )
 {
     const MonsterGroup &group = GetUpgradedMonsterGroup( group_name );
-    int spawn_chance = rng( 1, group.freq_total ); //Default 1000 unless specified
     //Our spawn details specify, by default, a single instance of the default monster
     MonsterGroupResult spawn_details = MonsterGroupResult( group.defaultMonster, 1, spawn_data() );
 
+    // Groups without calendar-gated entries roll in O(1) via an alias table.
+    if( group.roll_is_unconditional() ) {
+        const MonsterGroupEntry *entry = group.pick_unconditional_spawn();
+        if( entry == nullptr ) {
+            if( quantity ) {
+                ( *quantity )--;
+            }
+            return spawn_details;
+        }
+        const int pack_size = entry->pack_maximum > 1 ?
+                              rng( entry->pack_minimum, entry->pack_maximum ) : 1;
+        spawn_details = MonsterGroupResult( entry->name, pack_size, entry->data );
+        if( quantity ) {
+            *quantity -= std::max( 1, entry->cost_multiplier * pack_size );
+        }
+        return spawn_details;
+    }
+
+    int spawn_chance = rng( 1, group.freq_total ); //Default 1000 unless specified
     bool monster_found = false;
     // Loop invariant values
     const time_point sunset = ::sunset( calendar::turn );
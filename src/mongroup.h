@@ -7,6 +7,7 @@
 #include <set>
 #include <vector>
 
+#include "alias_table.h"
 #include "calendar.h"
 #include "coordinates.h"
 #include "io_tags.h"
@@ -19,6 +20,7 @@ class JsonObject;
 class JsonOut;
 // from overmap.h
 class overmap;
+struct city;
 struct MonsterGroupEntry;
 
 using FreqDef = std::vector<MonsterGroupEntry>;
@@ -78,6 +80,22 @@ struct MonsterGroup {
     time_duration monster_group_time = 0_turns;
     bool is_safe = false; /// Used for @ref mongroup::is_safe()
     int freq_total = 0; // Default 1000 unless specified - max number to roll for spawns
+
+    /**
+     * True when every entry is free of time-of-day, season and start/end
+     * gating (and the frequencies fit in freq_total), so a spawn roll is a
+     * plain weighted draw. Computed on first use.
+     */
+    bool roll_is_unconditional() const;
+    /**
+     * O(1) weighted spawn draw for groups where @ref roll_is_unconditional.
+     * Returns null when the roll lands on the default monster remainder.
+     */
+    const MonsterGroupEntry *pick_unconditional_spawn() const;
+
+    private:
+        mutable int unconditional_roll_cache = -1;
+        mutable alias_table spawn_alias;
 };
 
 struct mongroup {
@@ -134,7 +152,10 @@ struct mongroup {
         nemesis_target.x() = p.x();
         nemesis_target.y() = p.y();
     }
-    void wander( const overmap & );
+    // target_city is the city to head back to for "city" behaviour
+    // hordes, or nullptr to roam; move_hordes resolves it from its
+    // per-sector nearest-city cache.
+    void wander( const city *target_city );
     void inc_interest( int inc ) {
         interest += inc;
         if( interest > 100 ) {
@@ -13,6 +13,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "arena_alloc.h"
 #include "behavior.h"
 #include "bionics.h"
 #include "cached_options.h"
@@ -112,27 +113,37 @@ static bool z_is_valid( int z )
 bool monster::will_move_to( const tripoint &p ) const
 {
     map &here = get_map();
+    // Resolve the candidate tile once; every flag below is a bitset test
+    // on these two objects instead of a submap lookup per check. This
+    // runs per candidate tile per monster per turn.
+    const ter_id target = here.ter( p );
+    const ter_t &terrain = target.obj();
+    const furn_t &furniture = here.furn( p ).obj();
+    const auto ter_or_furn_has_flag = [&]( const ter_furn_flag flag ) {
+        return terrain.has_flag( flag ) || furniture.has_flag( flag );
+    };
+
     if( here.impassable( p ) ) {
         if( digging() ) {
-            if( !here.has_flag( ter_furn_flag::TFLAG_BURROWABLE, p ) ) {
+            if( !ter_or_furn_has_flag( ter_furn_flag::TFLAG_BURROWABLE ) ) {
                 return false;
             }
-        } else if( !( can_climb() && here.has_flag( ter_furn_flag::TFLAG_CLIMBABLE, p ) ) ) {
+        } else if( !( can_climb() && ter_or_furn_has_flag( ter_furn_flag::TFLAG_CLIMBABLE ) ) ) {
             return false;
         }
     }
 
-    if( ( !can_submerge() && !flies() ) && here.has_flag( ter_furn_flag::TFLAG_DEEP_WATER, p ) ) {
+    if( ( !can_submerge() && !flies() ) && ter_or_furn_has_flag( ter_furn_flag::TFLAG_DEEP_WATER ) ) {
         return false;
     }
 
-    if( digs() && !here.has_flag( ter_furn_flag::TFLAG_DIGGABLE, p ) &&
-        !here.has_flag( ter_furn_flag::TFLAG_BURROWABLE, p ) ) {
+    if( digs() && !ter_or_furn_has_flag( ter_furn_flag::TFLAG_DIGGABLE ) &&
+        !ter_or_furn_has_flag( ter_furn_flag::TFLAG_BURROWABLE ) ) {
         return false;
     }
 
     if( has_flag( MF_AQUATIC ) && (
-            !here.has_flag( ter_furn_flag::TFLAG_SWIMMABLE, p ) ||
+            !ter_or_furn_has_flag( ter_furn_flag::TFLAG_SWIMMABLE ) ||
             // AQUATIC (confined to water) monster avoid vehicles, unless they are already underneath one
             ( here.veh_at( p ) && !here.veh_at( pos() ) )
         ) ) {
@@ -144,7 +155,7 @@ bool monster::will_move_to( const tripoint &p ) const
     }
 
     if( get_size() > creature_size::medium &&
-        here.has_flag_ter( ter_furn_flag::TFLAG_SMALL_PASSAGE, p ) ) {
+        terrain.has_flag( ter_furn_flag::TFLAG_SMALL_PASSAGE ) ) {
         return false; // if a large critter, can't move through tight passages
     }
 
@@ -171,8 +182,6 @@ bool monster::will_move_to( const tripoint &p ) const
     // technically this will shortcut in evaluation from fire or fall
     // before hitting simple or complex but this is more explicit
     if( avoid_fire || avoid_fall || avoid_simple || avoid_complex ) {
-        const ter_id target = here.ter( p );
-
         // Don't enter lava if we have any concept of heat being bad
         if( avoid_fire && target == t_lava ) {
             return false;
@@ -194,7 +203,7 @@ bool monster::will_move_to( const tripoint &p ) const
         // Some things are only avoided if we're not attacking
         if( attitude( &get_player_character() ) != MATT_ATTACK ) {
             // Sharp terrain is ignored while attacking
-            if( avoid_simple && here.has_flag( ter_furn_flag::TFLAG_SHARP, p ) &&
+            if( avoid_simple && ter_or_furn_has_flag( ter_furn_flag::TFLAG_SHARP ) &&
                 !( type->size == creature_size::tiny || flies() ) ) {
                 return false;
             }
@@ -365,7 +374,11 @@ void monster::plan()
             }
         }
     } else if( friendly != 0 && !docile ) {
-        for( monster &tmp : g->all_monsters() ) {
+        // Anything beyond our sight range fails rate_target anyway, so
+        // only look at monsters in nearby submap buckets.
+        for( const shared_ptr_fast<monster> &tmp_ptr :
+             g->critter_tracker->find_in_radius( get_location(), max_sight_range ) ) {
+            monster &tmp = *tmp_ptr;
             if( tmp.friendly == 0 && tmp.attitude_to( *this ) == Attitude::HOSTILE &&
                 seen_levels.test( tmp.pos().z + OVERMAP_DEPTH ) ) {
                 float rating = rate_target( tmp, dist, smart_planning );
@@ -651,11 +664,8 @@ void monster::plan()
 static float get_stagger_adjust( const tripoint &source, const tripoint &destination,
                                  const tripoint &next_step )
 {
-    // TODO: push this down into rl_dist
-    const float initial_dist =
-        trigdist ? trig_dist( source, destination ) : rl_dist( source, destination );
-    const float new_dist =
-        trigdist ? trig_dist( next_step, destination ) : rl_dist( next_step, destination );
+    const float initial_dist = rl_dist_exact( source, destination );
+    const float new_dist = rl_dist_exact( next_step, destination );
     // If we return 0, it wil cancel the action.
     return std::max( 0.01f, initial_dist - new_dist );
 }
@@ -752,30 +762,34 @@ void monster::move()
     // this into another monster type). Therefore we can not iterate over it
     // directly and instead iterate over the map from the monster type
     // (properties of monster types should never change).
-    for( const auto &sp_type : type->special_attacks ) {
-        const std::string &special_name = sp_type.first;
-        const auto local_iter = special_attacks.find( special_name );
-        if( local_iter == special_attacks.end() ) {
-            continue;
-        }
-        mon_special_attack &local_attack_data = local_iter->second;
-        if( !local_attack_data.enabled ) {
-            continue;
-        }
-
-        // Cooldowns are decremented in monster::process_turn
-
-        if( local_attack_data.cooldown == 0 && !pacified && !is_hallucination() ) {
-            if( !sp_type.second->call( *this ) ) {
+    // special_ready_in counts down to the soonest cooldown expiry, so
+    // while it is positive no attack can fire and the loop is skipped.
+    if( special_ready_in == 0 ) {
+        for( const auto &sp_type : type->special_attacks ) {
+            const std::string &special_name = sp_type.first;
+            const auto local_iter = special_attacks.find( special_name );
+            if( local_iter == special_attacks.end() ) {
                 continue;
             }
-
-            // `special_attacks` might have changed at this point. Sadly `reset_special`
-            // doesn't check the attack name, so we need to do it here.
-            if( special_attacks.count( special_name ) == 0 ) {
+            mon_special_attack &local_attack_data = local_iter->second;
+            if( !local_attack_data.enabled ) {
                 continue;
             }
-            reset_special( special_name );
+
+            // Cooldowns are decremented in monster::process_turn
+
+            if( local_attack_data.cooldown == 0 && !pacified && !is_hallucination() ) {
+                if( !sp_type.second->call( *this ) ) {
+                    continue;
+                }
+
+                // `special_attacks` might have changed at this point. Sadly `reset_special`
+                // doesn't check the attack name, so we need to do it here.
+                if( special_attacks.count( special_name ) == 0 ) {
+                    continue;
+                }
+                reset_special( special_name );
+            }
         }
     }
 
@@ -884,8 +898,12 @@ void monster::move()
             const auto &pf_settings = get_pathfinding_settings();
             if( pf_settings.max_dist >= rl_dist( get_location(), get_dest() ) &&
                 ( path.empty() || rl_dist( pos(), path.front() ) >= 2 || path.back() != local_dest ) ) {
-                // We need a new path
-                path = here.route( pos(), local_dest, pf_settings, get_path_avoid() );
+                // We need a new path. Hordes heading for the same goal
+                // share one flow field instead of each running A*.
+                path = here.route_via_flow_field( pos(), local_dest, pf_settings );
+                if( path.empty() ) {
+                    path = here.route( pos(), local_dest, pf_settings, get_path_avoid() );
+                }
             }
 
             // Try to respect old paths, even if we can't pathfind at the moment
@@ -1245,7 +1263,7 @@ tripoint monster::scent_move()
     const std::set<scenttype_id> &tracked_scents = type->scents_tracked;
     const std::set<scenttype_id> &ignored_scents = type->scents_ignored;
 
-    std::vector<tripoint> smoves;
+    cata::arena_vector<tripoint> smoves;
 
     int bestsmell = 10; // Squares with smell 0 are not eligible targets.
     int smell_threshold = 200; // Squares at or above this level are ineligible.
@@ -1278,7 +1296,7 @@ tripoint monster::scent_move()
     if( !type_scent.is_empty() ) {
         const std::set<species_id> &receptive_species = type_scent->receptive_species;
         const std::set<species_id> &monster_species = type->species;
-        std::vector<species_id> v_intersection;
+        cata::arena_vector<species_id> v_intersection;
         std::set_intersection( receptive_species.begin(), receptive_species.end(), monster_species.begin(),
                                monster_species.end(), std::back_inserter( v_intersection ) );
         if( !v_intersection.empty() ) {
@@ -1942,7 +1960,7 @@ void monster::stumble()
     }
 
     map &here = get_map();
-    std::vector<tripoint> valid_stumbles;
+    cata::arena_vector<tripoint> valid_stumbles;
     valid_stumbles.reserve( 11 );
     const bool avoid_water = has_flag( MF_NO_BREATHE ) && !swims() && !has_flag( MF_AQUATIC );
     for( const tripoint &dest : here.points_in_radius( pos(), 1 ) ) {
@@ -191,6 +191,7 @@ monster::monster( const mtype_id &id ) : monster()
         mon_special_attack &entry = special_attacks[sa.first];
         entry.cooldown = rng( 0, sa.second->cooldown );
     }
+    recalc_special_ready();
     anger = type->agro;
     morale = type->morale;
     faction = type->default_faction;
@@ -250,10 +251,12 @@ void monster::poly( const mtype_id &id )
     morale = type->morale;
     hp = static_cast<int>( hp_percentage * type->hp );
     special_attacks.clear();
+    special_cooldown_lag = 0;
     for( const auto &sa : type->special_attacks ) {
         mon_special_attack &entry = special_attacks[sa.first];
         entry.cooldown = sa.second->cooldown;
     }
+    recalc_special_ready();
     faction = type->default_faction;
     upgrades = type->upgrades;
     reproduces = type->reproduces;
@@ -2246,19 +2249,60 @@ void monster::reset_special_rng( const std::string &special_name )
 
 void monster::set_special( const std::string &special_name, int time )
 {
+    // Catch up on deferred aging first, so the new cooldown isn't
+    // shortened by lag accrued before it was set.
+    apply_special_cooldown_lag();
     special_attacks[ special_name ].cooldown = time;
+    recalc_special_ready();
 }
 
 void monster::disable_special( const std::string &special_name )
 {
+    apply_special_cooldown_lag();
     special_attacks.at( special_name ).enabled = false;
+    recalc_special_ready();
 }
 
 bool monster::special_available( const std::string &special_name ) const
 {
     std::map<std::string, mon_special_attack>::const_iterator iter = special_attacks.find(
                 special_name );
-    return iter != special_attacks.end() && iter->second.enabled && iter->second.cooldown == 0;
+    // Deferred aging in special_cooldown_lag only covers attacks the
+    // current type knows about; see apply_special_cooldown_lag.
+    const int lag = type->special_attacks.count( special_name ) ? special_cooldown_lag : 0;
+    return iter != special_attacks.end() && iter->second.enabled && iter->second.cooldown - lag <= 0;
+}
+
+void monster::apply_special_cooldown_lag()
+{
+    if( special_cooldown_lag <= 0 ) {
+        return;
+    }
+    // Loop through the monster's special attacks, same as monster::move.
+    for( const auto &sp_type : type->special_attacks ) {
+        const auto local_iter = special_attacks.find( sp_type.first );
+        if( local_iter == special_attacks.end() || !local_iter->second.enabled ) {
+            continue;
+        }
+        mon_special_attack &local_attack_data = local_iter->second;
+        local_attack_data.cooldown = std::max( 0, local_attack_data.cooldown - special_cooldown_lag );
+    }
+    special_cooldown_lag = 0;
+}
+
+void monster::recalc_special_ready()
+{
+    special_ready_in = -1;
+    for( const auto &sp_type : type->special_attacks ) {
+        const auto local_iter = special_attacks.find( sp_type.first );
+        if( local_iter == special_attacks.end() || !local_iter->second.enabled ) {
+            continue;
+        }
+        const int remaining = std::max( 0, local_iter->second.cooldown - special_cooldown_lag );
+        if( special_ready_in < 0 || remaining < special_ready_in ) {
+            special_ready_in = remaining;
+        }
+    }
 }
 
 void monster::explode()
@@ -2308,20 +2352,30 @@ void monster::process_turn()
     }
 
     // Special attack cooldowns are updated here.
-    // Loop through the monster's special attacks, same as monster::move.
-    for( const auto &sp_type : type->special_attacks ) {
-        const std::string &special_name = sp_type.first;
-        const auto local_iter = special_attacks.find( special_name );
-        if( local_iter == special_attacks.end() ) {
-            continue;
-        }
-        mon_special_attack &local_attack_data = local_iter->second;
-        if( !local_attack_data.enabled ) {
-            continue;
-        }
+    if( special_ready_in > 0 ) {
+        // Everything is on cooldown: age all of them in O(1) by
+        // deferring the decrement until one can be ready.
+        special_cooldown_lag++;
+        if( --special_ready_in == 0 ) {
+            apply_special_cooldown_lag();
+        }
+    } else if( special_ready_in == 0 ) {
+        // At least one attack is ready; the rest still age per turn.
+        // Loop through the monster's special attacks, same as monster::move.
+        for( const auto &sp_type : type->special_attacks ) {
+            const std::string &special_name = sp_type.first;
+            const auto local_iter = special_attacks.find( special_name );
+            if( local_iter == special_attacks.end() ) {
+                continue;
+            }
+            mon_special_attack &local_attack_data = local_iter->second;
+            if( !local_attack_data.enabled ) {
+                continue;
+            }
 
-        if( local_attack_data.cooldown > 0 ) {
-            local_attack_data.cooldown--;
+            if( local_attack_data.cooldown > 0 ) {
+                local_attack_data.cooldown--;
+            }
         }
     }
     creature_tracker &creatures = get_creature_tracker();
@@ -2969,8 +3023,7 @@ float monster::power_rating() const
 float monster::speed_rating() const
 {
     float ret = get_speed() / 100.0f;
-    const auto leap = type->special_attacks.find( "leap" );
-    if( leap != type->special_attacks.end() ) {
+    if( type->has_leap_attack ) {
         // TODO: Make this calculate sane values here
         ret += 0.5f;
     }
@@ -570,6 +570,25 @@ class monster : public Creature
     private:
         int hp = 0;
         std::map<std::string, mon_special_attack> special_attacks;
+        /**
+         * Cooldown aging owed to every enabled special attack. While all of
+         * them are on cooldown, process_turn() builds this up in O(1) per
+         * turn instead of walking the map; it is applied in one pass when
+         * the soonest attack can be ready or a cooldown is touched.
+         * Serialized so saved cooldowns stay exact.
+         */
+        int special_cooldown_lag = 0;
+        /**
+         * Turns until the soonest enabled special attack can come off
+         * cooldown: 0 when one is ready now, -1 when there is nothing to
+         * age. Cooldown aging and the attack selection loop in move() are
+         * both skipped while this is positive.
+         */
+        int special_ready_in = -1; // NOLINT(cata-serialize)
+        // Apply special_cooldown_lag to the cooldowns in one pass.
+        void apply_special_cooldown_lag();
+        // Recompute special_ready_in after a cooldown changed.
+        void recalc_special_ready();
         cata::optional<tripoint_abs_ms> goal;
         bool dead = false;
         /** Normal upgrades **/
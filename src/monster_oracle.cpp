@@ -17,22 +17,35 @@ status_t monster_oracle_t::not_hallucination( const std::string & ) const
 
 status_t monster_oracle_t::items_available( const std::string & ) const
 {
+    const auto cached = predicate_cache.find( "items_available" );
+    if( cached != predicate_cache.end() ) {
+        return cached->second;
+    }
+    status_t result = status_t::failure;
     if( !get_map().has_flag( ter_furn_flag::TFLAG_SEALED, subject->pos() ) &&
         get_map().has_items( subject->pos() ) ) {
-        return status_t::running;
+        result = status_t::running;
     }
-    return status_t::failure;
+    predicate_cache.emplace( "items_available", result );
+    return result;
 }
 
 // TODO: Have it select a target and stash it somewhere.
 status_t monster_oracle_t::adjacent_plants( const std::string & ) const
 {
+    const auto cached = predicate_cache.find( "adjacent_plants" );
+    if( cached != predicate_cache.end() ) {
+        return cached->second;
+    }
+    status_t result = status_t::failure;
     for( const tripoint &p : get_map().points_in_radius( subject->pos(), 1 ) ) {
         if( get_map().has_flag( ter_furn_flag::TFLAG_PLANT, p ) ) {
-            return status_t::running;
+            result = status_t::running;
+            break;
         }
     }
-    return status_t::failure;
+    predicate_cache.emplace( "adjacent_plants", result );
+    return result;
 }
 
 status_t monster_oracle_t::special_available( const std::string &special_name ) const
@@ -3,6 +3,7 @@
 #define CATA_SRC_MONSTER_ORACLE_H
 
 #include <iosfwd>
+#include <map>
 
 #include "behavior_oracle.h"
 
@@ -27,6 +28,13 @@ class monster_oracle_t : public oracle_t
         status_t special_available( const std::string &special_name ) const;
     private:
         const monster *subject;
+        /**
+         * Verdicts already computed by map-scanning predicates. The oracle
+         * lives for a single call to monster::move(), so entries cannot go
+         * stale; they stop a goal tree from rescanning the surroundings when
+         * several nodes share a predicate.
+         */
+        mutable std::map<std::string, status_t> predicate_cache;
 };
 
 } // namespace behavior
@@ -439,6 +439,15 @@ void MonsterGenerator::finalize_mtypes()
             mon.zombify_into = mtype_id();
         }
 
+        mon.ranged_attacker = mon.has_flag( MF_RANGED_ATTACKER );
+        for( const std::pair<const std::string, mtype_special_attack> &attack :
+             mon.special_attacks ) {
+            if( attack.second->id == "gun" ) {
+                mon.ranged_attacker = true;
+            }
+        }
+        mon.has_leap_attack = mon.special_attacks.count( "leap" ) > 0;
+
         build_behavior_tree( mon );
         finalize_pathfinding_settings( mon );
     }
@@ -361,6 +361,11 @@ struct mtype {
         // special attack frequencies and function pointers
         std::map<std::string, mtype_special_attack> special_attacks;
         std::vector<std::string> special_attacks_names; // names of attacks, in json load order
+        // Derived at finalize from flags and special_attacks, shared by
+        // all instances so combat evaluation code doesn't rescan the
+        // attack map per call.
+        bool ranged_attacker = false;   // MF_RANGED_ATTACKER or a "gun" attack
+        bool has_leap_attack = false;   // a "leap" attack; see monster::speed_rating
         monster_death_effect mdeath_effect;
 
         // This monster's special "defensive" move that may trigger when the monster is attacked.
@@ -100,7 +100,29 @@ std::string enum_to_string<mutagen_technique>( mutagen_technique data )
 
 bool Character::has_trait( const trait_id &b ) const
 {
-    return my_mutations.count( b ) || enchantment_cache->get_mutations().count( b );
+    if( !trait_bitset_built ) {
+        rebuild_trait_bitset();
+    }
+    const int cid = b.id_or( int_id<mutation_branch>( -1 ) ).to_i();
+    return cid >= 0 && static_cast<size_t>( cid ) < trait_bitset.size() && trait_bitset[cid];
+}
+
+void Character::rebuild_trait_bitset() const
+{
+    trait_bitset.assign( mutation_branch::get_all().size(), false );
+    const auto set_bit = [this]( const trait_id & t ) {
+        const int cid = t.id_or( int_id<mutation_branch>( -1 ) ).to_i();
+        if( cid >= 0 && static_cast<size_t>( cid ) < trait_bitset.size() ) {
+            trait_bitset[cid] = true;
+        }
+    };
+    for( const std::pair<const trait_id, trait_data> &mut : my_mutations ) {
+        set_bit( mut.first );
+    }
+    for( const trait_id &mut : enchantment_cache->get_mutations() ) {
+        set_bit( mut );
+    }
+    trait_bitset_built = true;
 }
 
 bool Character::has_trait_flag( const json_character_flag &b ) const
@@ -162,6 +184,9 @@ void Character::set_mutation_unsafe( const trait_id &trait )
         return;
     }
     my_mutations.emplace( trait, trait_data{} );
+    trait_bitset_built = false;
+    mutation_value_cache.clear();
+    next_vitamin_tick = calendar::before_time_starts;
     cached_mutations.push_back( &trait.obj() );
     mutation_effect( trait, false );
 }
@@ -205,6 +230,9 @@ void Character::unset_mutation( const trait_id &trait_ )
     cached_mutations.erase( std::remove( cached_mutations.begin(), cached_mutations.end(), &mut ),
                             cached_mutations.end() );
     my_mutations.erase( iter );
+    trait_bitset_built = false;
+    mutation_value_cache.clear();
+    next_vitamin_tick = calendar::before_time_starts;
     mutation_loss_effect( trait );
     recalc_sight_limits();
     calc_encumbrance();
@@ -51,6 +51,51 @@ bool string_id<mutation_branch>::is_valid() const
     return trait_factory.is_valid( *this );
 }
 
+/** @relates int_id */
+template<>
+bool int_id<mutation_branch>::is_valid() const
+{
+    return trait_factory.is_valid( *this );
+}
+
+/** @relates int_id */
+template<>
+const mutation_branch &int_id<mutation_branch>::obj() const
+{
+    return trait_factory.obj( *this );
+}
+
+/** @relates int_id */
+template<>
+const string_id<mutation_branch> &int_id<mutation_branch>::id() const
+{
+    return trait_factory.convert( *this );
+}
+
+/** @relates string_id */
+template<>
+int_id<mutation_branch> string_id<mutation_branch>::id_or(
+    const int_id<mutation_branch> &fallback ) const
+{
+    if( trait_factory.initialized ) {
+        return trait_factory.convert( *this, fallback, false );
+    }
+    return fallback;
+}
+
+/** @relates string_id */
+template<>
+int_id<mutation_branch> string_id<mutation_branch>::id() const
+{
+    return trait_factory.convert( *this, int_id<mutation_branch>( -1 ) );
+}
+
+/** @relates int_id */
+template<>
+int_id<mutation_branch>::int_id( const string_id<mutation_branch> &id ) : _id( id.id() )
+{
+}
+
 template<>
 bool string_id<Trait_group>::is_valid() const
 {
@@ -15,6 +15,7 @@
 #include <curses.h>
 #endif
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <iosfwd>
@@ -261,6 +262,17 @@ void input_manager::pump_events()
         return;
     }
 
+    // Data loading and finalization loops call this once per element to
+    // keep the OS from flagging the window as unresponsive; polling the
+    // event queue hundreds of thousands of times during startup has real
+    // cost. Servicing it every few milliseconds is just as responsive.
+    static auto last_pump = std::chrono::steady_clock::time_point();
+    const auto now = std::chrono::steady_clock::now();
+    if( now - last_pump < std::chrono::milliseconds( 10 ) ) {
+        return;
+    }
+    last_pump = now;
+
     // Handle all events, but ignore any keypress
     int key = ERR;
     bool resize = false;
@@ -4015,6 +4015,9 @@ void Character::clear_mutations()
         mutation_loss_effect( trait );
     }
     cached_mutations.clear();
+    trait_bitset_built = false;
+    mutation_value_cache.clear();
+    next_vitamin_tick = calendar::before_time_starts;
     recalc_sight_limits();
     calc_encumbrance();
 }
@@ -1763,8 +1763,26 @@ int npc::value( const item &it, int market_price ) const
     }
     const item weapon = get_wielded_item();
     int ret = 0;
-    // TODO: Cache own weapon value (it can be a bit expensive to compute 50 times/turn)
-    double weapon_val = weapon_value( it ) - weapon_value( weapon );
+    // Weapon value is the expensive part of pricing a whole inventory, and
+    // for an unmodified item it only depends on the type and damage level,
+    // so memoize it alongside the own-weapon value in cached_info. A
+    // shopkeeper's stock is mostly duplicates, which makes this a large cut.
+    double it_weapon_val;
+    const bool memoizable = !it.is_gun() || it.gunmods().empty();
+    if( memoizable ) {
+        const std::string memo_key = "weapon_value_" + it.typeId().str() + "_" +
+                                     std::to_string( it.damage_level() );
+        const auto memo = cached_info.find( memo_key );
+        if( memo != cached_info.end() ) {
+            it_weapon_val = memo->second;
+        } else {
+            it_weapon_val = weapon_value( it );
+            cached_info.emplace( memo_key, it_weapon_val );
+        }
+    } else {
+        it_weapon_val = weapon_value( it );
+    }
+    double weapon_val = it_weapon_val - weapon_value( weapon );
     if( weapon_val > 0 ) {
         ret += weapon_val;
     }
@@ -583,6 +583,10 @@ struct npc_short_term_cache {
     std::vector<weak_ptr_fast<Creature>> friends;
     std::vector<sphere> dangerous_explosives;
     std::map<direction, float> threat_map;
+    // Next turn this cache must be fully regenerated. NPCs that are out
+    // of sight and have no stimulus coast on the previous cache between
+    // full updates; see npc::move().
+    time_point next_full_regen = calendar::turn_zero;
     // Cache of locations the NPC has searched recently in npc::find_item()
     lru_cache<tripoint, int> searched_tiles;
     // returns the value of the distance between a friendly creature and the closest enemy to that
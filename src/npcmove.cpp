@@ -13,6 +13,7 @@
 
 #include "active_item_cache.h"
 #include "activity_handlers.h"
+#include "arena_alloc.h"
 #include "avatar.h"
 #include "basecamp.h"
 #include "bionics.h"
@@ -266,7 +267,7 @@ tripoint npc::good_escape_direction( bool include_pos )
         }
     }
 
-    std::vector<tripoint> candidates;
+    cata::arena_vector<tripoint> candidates;
 
     const auto rate_pt = [&]( const tripoint & pt, const float threat_val ) {
         if( !can_move_to( pt, !rules.has_flag( ally_rule::allow_bash ) ) ) {
@@ -384,6 +385,33 @@ static bool too_close( const tripoint &critter_pos, const tripoint &ally_pos, co
     return rl_dist( critter_pos, ally_pos ) <= def_radius;
 }
 
+// Per-turn snapshot of every loaded monster and its base threat score.  The
+// monster branch of npc::evaluate_enemy() depends only on the monster's type,
+// so allied NPCs assessing danger on the same turn were rebuilding identical
+// creature lists and recomputing identical scores.  Build the list once per
+// turn and let every NPC's assess_danger() iterate it; the per-NPC terms
+// (line of sight, attitude, distance scaling, engagement rules and the
+// direction-bucketed threat map) are still evaluated by each consumer.
+struct monster_threat_entry {
+    shared_ptr_fast<monster> who;
+    float threat;
+};
+
+static const std::vector<monster_threat_entry> &monster_threat_snapshot()
+{
+    static time_point snapshot_turn = calendar::before_time_starts;
+    static std::vector<monster_threat_entry> snapshot;
+    if( snapshot_turn != calendar::turn ) {
+        snapshot_turn = calendar::turn;
+        snapshot.clear();
+        for( monster &critter : g->all_monsters() ) {
+            snapshot.push_back( { g->shared_from( critter ),
+                                  std::min( static_cast<float>( critter.type->difficulty ), NPC_DANGER_MAX ) } );
+        }
+    }
+    return snapshot;
+}
+
 cata::optional<int> npc_short_term_cache::closest_enemy_to_friendly_distance() const
 {
     int distance = INT_MAX;
@@ -510,7 +538,12 @@ void npc::assess_danger()
         }
     }
 
-    for( const monster &critter : g->all_monsters() ) {
+    for( const monster_threat_entry &entry : monster_threat_snapshot() ) {
+        const monster &critter = *entry.who;
+        // The snapshot can outlive monsters killed earlier this turn.
+        if( critter.is_dead() ) {
+            continue;
+        }
         if( !clairvoyant && !here.has_potential_los( pos(), critter.pos() ) ) {
             continue;
         }
@@ -528,7 +561,7 @@ void npc::assess_danger()
         }
 
         ai_cache.hostile_guys.emplace_back( g->shared_from( critter ) );
-        float critter_threat = evaluate_enemy( critter );
+        const float critter_threat = entry.threat;
         // warn and consider the odds for distant enemies
         int dist = rl_dist( pos(), critter.pos() );
         if( ( is_enemy() || !critter.friendly ) ) {
@@ -784,7 +817,23 @@ void npc::move()
     } else if( attitude == NPCATT_FLEE_TEMP && !has_effect( effect_npc_flee_player ) ) {
         set_attitude( NPCATT_NULL );
     }
-    regen_ai_cache();
+    // AI level of detail: an NPC the avatar can't see, with no danger found
+    // by the last full assessment, no pending sound alerts, no target and no
+    // fleeing state, coasts on the previous cache for a few turns. Any
+    // stimulus fails one of these checks and promotes it back to per-turn
+    // updates on the spot.
+    const bool ai_idle = ai_cache.danger_assessment <= 0 &&
+                         ai_cache.sound_alerts.empty() &&
+                         current_target() == nullptr &&
+                         attitude != NPCATT_FLEE && attitude != NPCATT_FLEE_TEMP &&
+                         !has_effect( effect_npc_run_away ) &&
+                         !get_player_character().sees( *this );
+    if( !ai_idle || calendar::turn >= ai_cache.next_full_regen ) {
+        regen_ai_cache();
+        // Stagger the refreshes so a camp full of companions doesn't run
+        // every assessment on the same turn.
+        ai_cache.next_full_regen = calendar::turn + 1_turns * rng( 3, 6 );
+    }
     // NPCs under operation should just stay still
     if( activity.id() == ACT_OPERATION || activity.id() == activity_id( "ACT_SPELLCASTING" ) ) {
         execute_action( npc_player_activity );
@@ -2714,7 +2763,7 @@ void npc::move_away_from( const std::vector<sphere> &spheres, bool no_bashing )
 
     const tripoint_range<tripoint> range( minp, maxp );
 
-    std::vector<tripoint> escape_points;
+    cata::arena_vector<tripoint> escape_points;
 
     map &here = get_map();
     std::copy_if( range.begin(), range.end(), std::back_inserter( escape_points ),
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_OFSTREAM_WRAPPER_H
 #define CATA_SRC_OFSTREAM_WRAPPER_H
 
+#include <vector>
+
 #include "filesystem.h"
 
 /**
@@ -25,6 +27,9 @@ class ofstream_wrapper
         cata::ofstream file_stream;
         fs::path path;
         fs::path temp_path;
+        // Backing storage for a large stream buffer, installed before the
+        // file is opened; see ofstream_wrapper::open.
+        std::vector<char> write_buffer;
 
         void open( std::ios::openmode mode );
 
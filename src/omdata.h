@@ -265,6 +265,24 @@ struct oter_type_t {
         void register_terrain( const oter_t &peer, size_t n, size_t max_n );
 };
 
+// Travel-cost class of an overmap terrain, used by overmap pathfinding
+// (see overmapbuffer::get_travel_path). Classification does string matching
+// on terrain ids, which is far too slow to run per A* node, so oter_t
+// computes it once and caches it.
+enum class oter_travel_cost_type : int {
+    other,
+    road,
+    field,
+    dirt_road,
+    trail,
+    forest,
+    shore,
+    swamp,
+    water,
+    air,
+    impassable
+};
+
 struct oter_t {
     private:
         const oter_type_t *type;
@@ -320,6 +338,8 @@ struct oter_t {
             return type->travel_cost;
         }
 
+        oter_travel_cost_type get_travel_cost_type() const;
+
         const std::string &get_extras() const {
             return type->extras;
         }
@@ -387,6 +407,9 @@ struct oter_t {
         uint32_t symbol;
         uint32_t symbol_alt;
         size_t line = 0;         // Index of line. Only valid in case of line drawing.
+        // Lazily computed by get_travel_cost_type; discarded with the terrain
+        // on data reload, so it can never go stale.
+        mutable cata::optional<oter_travel_cost_type> travel_cost_type_cache;
 };
 
 // TODO: Deprecate these operators
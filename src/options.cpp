@@ -1300,6 +1300,21 @@ void options_manager::add_options_general()
 
     get_option( "AUTOSAVE_MINUTES" ).setPrerequisite( "AUTOSAVE" );
 
+    add( "PARALLEL_MAP_CACHE", "general", to_translation( "Parallel map cache builds" ),
+         to_translation( "If true, the per-z-level map caches (transparency, floor, outside) are rebuilt across multiple threads.  Mainly helps with 3D vision enabled." ),
+         false
+       );
+
+    add( "BACKGROUND_SAVE", "general", to_translation( "Background map saving" ),
+         to_translation( "If true, map files are written on a background thread while play continues, shortening save and autosave pauses." ),
+         false
+       );
+
+    add( "BACKGROUND_SCENT", "general", to_translation( "Background scent simulation" ),
+         to_translation( "If true, scent diffusion for the next turn is computed on a background thread while the current turn renders.  Creatures then smell the world as of the previous turn." ),
+         false
+       );
+
     add_empty_line();
 
     add( "AUTO_NOTES", "general", to_translation( "Auto notes" ),
@@ -2122,6 +2137,11 @@ void options_manager::add_options_world_default()
     }, "reset"
        );
 
+    add( "BINARY_MAP_SAVES", "world_default", to_translation( "Binary map files" ),
+         to_translation( "If true, map files are written in a compact binary format that is faster to save and load.  Worlds saved this way still read JSON map files, so turning this on for an existing world is safe." ),
+         false
+       );
+
     add_empty_line();
 
     add( "CITY_SIZE", "world_default", to_translation( "Size of cities" ),
@@ -2299,6 +2319,13 @@ void options_manager::add_options_debug()
        );
 
     get_option( "FOV_3D_Z_RANGE" ).setPrerequisite( "FOV_3D" );
+
+    add_empty_line();
+
+    add( "SLOW_TURN_WARNING", "debug", to_translation( "Slow turn warning threshold" ),
+         to_translation( "If nonzero, any turn whose processing takes longer than this many milliseconds dumps a timing breakdown and world-state counts to the debug log.  0 disables the watchdog." ),
+         0, 10000, 0
+       );
 }
 
 void options_manager::add_options_android()
@@ -3158,6 +3185,17 @@ std::string options_manager::migrateOptionValue( const std::string &name,
     return iter_val != iter->second.second.end() ? iter_val->second : val;
 }
 
+static std::vector<std::function<void()>> &option_cache_refreshers()
+{
+    static std::vector<std::function<void()>> refreshers;
+    return refreshers;
+}
+
+void add_option_cache_refresher( std::function<void()> refresher )
+{
+    option_cache_refreshers().push_back( std::move( refresher ) );
+}
+
 static void update_options_cache()
 {
     // cache to global due to heavy usage.
@@ -3167,9 +3205,17 @@ static void update_options_cache()
     log_from_top = ::get_option<std::string>( "LOG_FLOW" ) == "new_top";
     message_ttl = ::get_option<int>( "MESSAGE_TTL" );
     message_cooldown = ::get_option<int>( "MESSAGE_COOLDOWN" );
+    message_limit = ::get_option<int>( "MESSAGE_LIMIT" );
+    slow_turn_warning_ms = ::get_option<int>( "SLOW_TURN_WARNING" );
     fov_3d = ::get_option<bool>( "FOV_3D" );
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
     keycode_mode = ::get_option<std::string>( "SDL_KEYBOARD_MODE" ) == "keycode";
+
+    // Self-registered cached_option handles; the globals above predate
+    // them and keep their plain types for the headers declaring them.
+    for( const std::function<void()> &refresher : option_cache_refreshers() ) {
+        refresher();
+    }
 }
 
 bool options_manager::save()
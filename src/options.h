@@ -322,4 +322,39 @@ inline T get_option( const std::string &name )
     return get_options().get_option( name ).value_as<T>();
 }
 
+/**
+ * Registers a callback run whenever options are loaded or saved; used by
+ * @ref cached_option to refresh its value. The callback must stay valid
+ * for the rest of the process.
+ */
+void add_option_cache_refresher( std::function<void()> refresher );
+
+/**
+ * A typed handle on a single option with the value cached, so reading it
+ * is a member access instead of a string-keyed map lookup. Refreshed by
+ * the same load/save hook that updates the globals in cached_options.h;
+ * unlike those, a handle can be declared right next to its use without
+ * touching options.cpp. Declare instances at namespace scope - they must
+ * exist before the first options load, which seeds them, and @p initial
+ * should match the option's default so reads before that load agree.
+ */
+template<typename T>
+class cached_option
+{
+    public:
+        cached_option( const std::string &name, const T &initial )
+            : value( initial ) {
+            add_option_cache_refresher( [this, name]() {
+                value = ::get_option<T>( name );
+            } );
+        }
+
+        operator T() const {
+            return value;
+        }
+
+    private:
+        T value;
+};
+
 #endif // CATA_SRC_OPTIONS_H
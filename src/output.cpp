@@ -15,6 +15,7 @@
 #include <stack>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "cached_options.h" // IWYU pragma: keep
@@ -23,6 +24,7 @@
 #include "color.h"
 #include "cursesport.h" // IWYU pragma: keep
 #include "cursesdef.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "item.h"
 #include "line.h"
@@ -63,8 +65,56 @@ int OVERMAP_LEGEND_WIDTH;
 
 scrollingcombattext SCT;
 
+namespace
+{
+
+struct fold_cache_key {
+    std::string str;
+    int width;
+    char split;
+
+    bool operator==( const fold_cache_key &rhs ) const {
+        return width == rhs.width && split == rhs.split && str == rhs.str;
+    }
+};
+
+struct fold_cache_key_hash {
+    size_t operator()( const fold_cache_key &key ) const {
+        size_t seed = std::hash<std::string>()( key.str );
+        cata::hash_combine( seed, key.width );
+        cata::hash_combine( seed, key.split );
+        return seed;
+    }
+};
+
+} // namespace
+
+static std::vector<std::string> foldstring_uncached( const std::string &str, int width,
+        char split );
+
 // utf8 version
 std::vector<std::string> foldstring( const std::string &str, int width, const char split )
+{
+    // Folding is a pure function of its arguments, and UI code refolds the
+    // same static labels and menu entries on every redraw, so the layout is
+    // memoized.  Transient strings (messages and the like) just churn the
+    // cache, which is evicted wholesale when it outgrows the cap.
+    static std::unordered_map<fold_cache_key, std::vector<std::string>, fold_cache_key_hash> cache;
+    fold_cache_key key{ str, width, split };
+    const auto iter = cache.find( key );
+    if( iter != cache.end() ) {
+        return iter->second;
+    }
+    if( cache.size() >= 4096 ) {
+        cache.clear();
+    }
+    std::vector<std::string> lines = foldstring_uncached( str, width, split );
+    cache.emplace( std::move( key ), lines );
+    return lines;
+}
+
+static std::vector<std::string> foldstring_uncached( const std::string &str, const int width,
+        const char split )
 {
     std::vector<std::string> lines;
     if( width < 1 ) {
@@ -1735,7 +1785,10 @@ std::string cata::string_formatter::raw_string_format( const char *format, ... )
     va_start( args, format );
 
     errno = 0; // Clear errno before trying
-    std::vector<char> buffer( 1024, '\0' );
+    // Reused scratch buffer. This function runs once per format specifier on every
+    // string_format call, so allocating (and growing) a fresh buffer each time adds
+    // up. The buffer is only used within this call, thread_local keeps that safe.
+    static thread_local std::vector<char> buffer( 1024, '\0' );
 
 #if defined(__CYGWIN__)
     std::string rewritten_format = rewrite_vsnprintf( format );
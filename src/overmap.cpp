@@ -2,20 +2,25 @@
 #include "overmap.h" // IWYU pragma: associated
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <cmath>
 #include <cstring>
 #include <exception>
 #include <istream>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <type_traits>
 #include <unordered_set>
 #include <vector>
 
 #include "all_enum_values.h"
 #include "assign.h"
+#include "background_writer.h"
 #include "cached_options.h"
 #include "cata_assert.h"
 #include "cata_utility.h"
@@ -715,6 +720,53 @@ oter_id oter_t::get_rotated( om_direction::type dir ) const
            : type->get_rotated( om_direction::add( this->dir, dir ) );
 }
 
+oter_travel_cost_type oter_t::get_travel_cost_type() const
+{
+    if( !travel_cost_type_cache ) {
+        const oter_id self = id.id();
+        oter_travel_cost_type ret = oter_travel_cost_type::other;
+        if( is_ot_match( "road", self, ot_match_type::type ) ||
+            is_ot_match( "bridge_road", self, ot_match_type::type ) ||
+            is_ot_match( "bridgehead_ground", self, ot_match_type::type ) ||
+            is_ot_match( "bridgehead_ramp", self, ot_match_type::type ) ||
+            is_ot_match( "road_nesw_manhole", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::road;
+        } else if( is_ot_match( "field", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::field;
+        } else if( is_ot_match( "rural_road", self, ot_match_type::prefix ) ||
+                   is_ot_match( "dirt_road", self, ot_match_type::prefix ) ||
+                   is_ot_match( "subway", self, ot_match_type::type ) ||
+                   is_ot_match( "lab_subway", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::dirt_road;
+        } else if( is_ot_match( "forest_trail", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::trail;
+        } else if( is_ot_match( "forest_water", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::swamp;
+        } else if( is_ot_match( "river", self, ot_match_type::prefix ) ||
+                   is_ot_match( "lake", self, ot_match_type::prefix ) ) {
+            if( is_ot_match( "river_center", self, ot_match_type::type ) ||
+                is_ot_match( "lake_surface", self, ot_match_type::type ) ) {
+                ret = oter_travel_cost_type::water;
+            } else {
+                ret = oter_travel_cost_type::shore;
+            }
+        } else if( is_ot_match( "bridge", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::water;
+        } else if( is_ot_match( "open_air", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::air;
+        } else if( is_ot_match( "forest", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::forest;
+        } else if( is_ot_match( "empty_rock", self, ot_match_type::type ) ||
+                   is_ot_match( "deep_rock", self, ot_match_type::type ) ||
+                   is_ot_match( "solid_earth", self, ot_match_type::type ) ||
+                   is_ot_match( "microlab_rock_border", self, ot_match_type::type ) ) {
+            ret = oter_travel_cost_type::impassable;
+        }
+        travel_cost_type_cache = ret;
+    }
+    return *travel_cost_type_cache;
+}
+
 void oter_t::get_rotation_and_subtile( int &rotation, int &subtile ) const
 {
     if( is_linear() ) {
@@ -2223,7 +2275,21 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
         return;
     }
 
-    layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()] = id;
+    oter_id &val = layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()];
+    if( val == id ) {
+        return;
+    }
+    if( oter_index_built ) {
+        // Keep the inverted index exact: move the location between buckets.
+        std::vector<tripoint_om_omt> &old_bucket = oter_id_index[val.to_i()];
+        const auto iter = std::find( old_bucket.begin(), old_bucket.end(), p );
+        if( iter != old_bucket.end() ) {
+            *iter = old_bucket.back();
+            old_bucket.pop_back();
+        }
+        oter_id_index[id.to_i()].push_back( p );
+    }
+    val = id;
 }
 
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
@@ -2926,6 +2992,29 @@ std::vector<point_abs_omt> overmap::find_terrain( const std::string &term, int z
     return found;
 }
 
+std::vector<tripoint_om_omt> overmap::matching_locations( const std::string &type,
+        ot_match_type match_type ) const
+{
+    if( !oter_index_built ) {
+        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+            const map_layer &l = layer[z + OVERMAP_DEPTH];
+            for( int x = 0; x < OMAPX; x++ ) {
+                for( int y = 0; y < OMAPY; y++ ) {
+                    oter_id_index[l.terrain[x][y].to_i()].push_back( tripoint_om_omt( x, y, z ) );
+                }
+            }
+        }
+        oter_index_built = true;
+    }
+    std::vector<tripoint_om_omt> result;
+    for( const auto &bucket : oter_id_index ) {
+        if( is_ot_match( type, oter_id( bucket.first ), match_type ) ) {
+            result.insert( result.end(), bucket.second.begin(), bucket.second.end() );
+        }
+    }
+    return result;
+}
+
 const city &overmap::get_nearest_city( const tripoint_om_omt &p ) const
 {
     int distance = 999;
@@ -2947,18 +3036,10 @@ const city &overmap::get_nearest_city( const tripoint_om_omt &p ) const
 tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_type> &target )
 const
 {
-    std::vector<tripoint_om_omt> valid;
-    for( int i = 0; i < OMAPX; i++ ) {
-        for( int j = 0; j < OMAPY; j++ ) {
-            for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                tripoint_om_omt p( i, j, k );
-                if( is_ot_match( target.first, ter( p ), target.second ) ) {
-                    valid.push_back( p );
-                }
-            }
-        }
-    }
-    return random_entry( valid, tripoint_om_omt( tripoint_min ) );
+    // The index matches per unique terrain id instead of per tile, which is far
+    // cheaper than scanning all OMAPX * OMAPY * z-levels tiles individually.
+    return random_entry( matching_locations( target.first, target.second ),
+                         tripoint_om_omt( tripoint_min ) );
 }
 
 void overmap::process_mongroups()
@@ -3002,24 +3083,8 @@ void overmap::place_special_forced( const overmap_special_id &special_id, const
     place_special( *special_id, p, dir, invalid_city, false, true );
 }
 
-void mongroup::wander( const overmap &om )
+void mongroup::wander( const city *target_city )
 {
-    const city *target_city = nullptr;
-    int target_distance = 0;
-
-    if( horde_behaviour == "city" ) {
-        // Find a nearby city to return to..
-        for( const city &check_city : om.cities ) {
-            // Check if this is the nearest city so far.
-            int distance = rl_dist( project_to<coords::sm>( check_city.pos ),
-                                    pos.xy() );
-            if( !target_city || distance < target_distance ) {
-                target_distance = distance;
-                target_city = &check_city;
-            }
-        }
-    }
-
     if( target_city ) {
         // TODO: somehow use the same algorithm that distributes zombie
         // density at world gen to spread the hordes over the actual
@@ -3038,6 +3103,39 @@ void overmap::move_hordes()
 {
     // Prevent hordes to be moved twice by putting them in here after moving.
     decltype( zg ) tmpzg;
+
+    // Nearest-city lookup, cached per 20x20-submap sector and resolved
+    // lazily. wander() used to scan every city for every "city" horde,
+    // which went quadratic on worlds with hundreds of hordes; sectors
+    // that actually contain a rewandering horde now pay for one scan.
+    constexpr int sector_size = 20;
+    constexpr int sectors_x = ( OMAPX * 2 + sector_size - 1 ) / sector_size;
+    constexpr int sectors_y = ( OMAPY * 2 + sector_size - 1 ) / sector_size;
+    std::array<const city *, sectors_x *sectors_y> sector_city;
+    std::bitset<sectors_x *sectors_y> sector_resolved;
+    const auto nearest_city = [&]( const point_om_sm & p ) -> const city * {
+        const int sx = clamp( p.x() / sector_size, 0, sectors_x - 1 );
+        const int sy = clamp( p.y() / sector_size, 0, sectors_y - 1 );
+        const int sector = sx + sy * sectors_x;
+        if( !sector_resolved.test( sector ) )
+        {
+            const point_om_sm center( sx * sector_size + sector_size / 2,
+                                      sy * sector_size + sector_size / 2 );
+            const city *best = nullptr;
+            int best_distance = 0;
+            for( const city &check_city : cities ) {
+                const int distance = rl_dist( project_to<coords::sm>( check_city.pos ), center );
+                if( !best || distance < best_distance ) {
+                    best_distance = distance;
+                    best = &check_city;
+                }
+            }
+            sector_city[sector] = best;
+            sector_resolved.set( sector );
+        }
+        return sector_city[sector];
+    };
+
     //MOVE ZOMBIE GROUPS
     for( auto it = zg.begin(); it != zg.end(); ) {
         mongroup &mg = it->second;
@@ -3055,7 +3153,7 @@ void overmap::move_hordes()
         mg.dec_interest( 1 );
 
         if( ( mg.pos.xy() == mg.target.xy() ) || mg.interest <= 15 ) {
-            mg.wander( *this );
+            mg.wander( mg.horde_behaviour == "city" ? nearest_city( mg.pos.xy() ) : nullptr );
         }
 
         // Decrease movement chance according to the terrain we're currently on.
@@ -3093,14 +3191,14 @@ void overmap::move_hordes()
             }
 
             // Erase the group at it's old location, add the group with the new location
-            tmpzg.insert( std::pair<tripoint_om_sm, mongroup>( mg.pos, mg ) );
+            tmpzg.insert( std::pair<tripoint_om_sm, mongroup>( mg.pos, std::move( mg ) ) );
             zg.erase( it++ );
         } else {
             ++it;
         }
     }
     // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    zg.insert( std::make_move_iterator( tmpzg.begin() ), std::make_move_iterator( tmpzg.end() ) );
 
     if( get_option<bool>( "WANDER_SPAWNS" ) ) {
 
@@ -3464,7 +3562,7 @@ void overmap::place_forest_trails()
 
             // ...and then add our random points.
             int random_point_count = 0;
-            std::shuffle( forest_points.begin(), forest_points.end(), rng_get_engine() );
+            std::shuffle( forest_points.begin(), forest_points.end(), rng_get_stream( rng_stream::mapgen ) );
             for( auto &random_point : forest_points ) {
                 if( random_point_count >= max_random_points ) {
                     break;
@@ -3935,7 +4033,7 @@ void overmap::place_roads( const overmap *north, const overmap *east, const over
         }
 
         if( north == nullptr ) {
-            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_engine() );
+            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_stream( rng_stream::mapgen ) );
             for( const auto &i : omap_num ) {
                 tmp = tripoint_om_omt( i, 0, 0 );
                 if( !( is_river( ter( tmp ) ) || is_river( ter( tmp + point_east ) ) ||
@@ -3946,7 +4044,7 @@ void overmap::place_roads( const overmap *north, const overmap *east, const over
             }
         }
         if( east == nullptr ) {
-            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_engine() );
+            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_stream( rng_stream::mapgen ) );
             for( const auto &i : omap_num ) {
                 tmp = tripoint_om_omt( OMAPX - 1, i, 0 );
                 if( !( is_river( ter( tmp ) ) || is_river( ter( tmp + point_north ) ) ||
@@ -3957,7 +4055,7 @@ void overmap::place_roads( const overmap *north, const overmap *east, const over
             }
         }
         if( south == nullptr ) {
-            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_engine() );
+            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_stream( rng_stream::mapgen ) );
             for( const auto &i : omap_num ) {
                 tmp = tripoint_om_omt( i, OMAPY - 1, 0 );
                 if( !( is_river( ter( tmp ) ) || is_river( ter( tmp + point_east ) ) ||
@@ -3968,7 +4066,7 @@ void overmap::place_roads( const overmap *north, const overmap *east, const over
             }
         }
         if( west == nullptr ) {
-            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_engine() );
+            std::shuffle( omap_num.begin(), omap_num.end(), rng_get_stream( rng_stream::mapgen ) );
             for( const auto &i : omap_num ) {
                 tmp = tripoint_om_omt( 0, i, 0 );
                 if( !( is_river( ter( tmp ) ) || is_river( ter( tmp + point_north ) ) ||
@@ -4349,7 +4447,7 @@ bool overmap::build_lab(
         }
     }
     if( generate_stairs && !generated_lab.empty() ) {
-        std::shuffle( generated_lab.begin(), generated_lab.end(), rng_get_engine() );
+        std::shuffle( generated_lab.begin(), generated_lab.end(), rng_get_stream( rng_stream::mapgen ) );
 
         // we want a spot where labs are above, but we'll settle for the last element if necessary.
         tripoint_om_omt lab_pos;
@@ -5150,7 +5248,7 @@ om_direction::type overmap::random_special_rotation( const overmap_special &spec
         }
     }
     // Pick first valid rotation at random.
-    std::shuffle( first, last, rng_get_engine() );
+    std::shuffle( first, last, rng_get_stream( rng_stream::mapgen ) );
     const auto rotation = std::find_if( first, last, [&]( om_direction::type elem ) {
         return can_place_special( special, p, elem, must_be_unexplored );
     } );
@@ -5664,6 +5762,23 @@ void overmap::save() const
     } );
 }
 
+void overmap::save( background_writer &writer ) const
+{
+    // Snapshot both files on this thread - the overmap keeps changing
+    // while the worker writes, the queued strings do not.
+    const auto queue_file = [&writer]( const std::string & filename, std::string && contents ) {
+        writer.queue( filename.substr( 0, filename.rfind( '/' ) ), filename, std::move( contents ) );
+    };
+
+    std::ostringstream view;
+    serialize_view( view );
+    queue_file( overmapbuffer::player_filename( loc ), view.str() );
+
+    std::ostringstream terrain;
+    serialize( terrain );
+    queue_file( overmapbuffer::terrain_filename( loc ), terrain.str() );
+}
+
 void overmap::spawn_mon_group( const mongroup &group )
 {
     tripoint_om_omt pos = project_to<coords::omt>( group.pos );
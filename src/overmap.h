@@ -33,6 +33,7 @@
 class JsonIn;
 class JsonObject;
 class JsonOut;
+class background_writer;
 class character_id;
 class map_extra;
 class npc;
@@ -224,6 +225,12 @@ class overmap
         }
 
         void save() const;
+        /**
+         * As @ref save, but serializes into memory on this thread and
+         * queues the file writes on @p writer instead of blocking on
+         * the disk.
+         */
+        void save( background_writer &writer ) const;
 
         /**
          * @return The (local) overmap terrain coordinates of a randomly
@@ -242,6 +249,15 @@ class overmap
          * coordinates), or empty vector if no matching terrain is found.
          */
         std::vector<point_abs_omt> find_terrain( const std::string &term, int zlevel );
+        /**
+         * Locations on this overmap whose terrain matches @p type under
+         * @p match_type, answered from an inverted index of the terrain
+         * layers. The matcher runs once per distinct terrain id instead of
+         * once per tile, so the cost scales with terrain variety rather
+         * than with OMAPX * OMAPY * OVERMAP_LAYERS.
+         */
+        std::vector<tripoint_om_omt> matching_locations( const std::string &type,
+                ot_match_type match_type ) const;
 
         void ter_set( const tripoint_om_omt &p, const oter_id &id );
         const oter_id &ter( const tripoint_om_omt &p ) const;
@@ -365,6 +381,16 @@ class overmap
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
+        /**
+         * Inverted index of @ref layer: for every distinct terrain id, the
+         * locations holding it. Built lazily by @ref matching_locations and
+         * kept exact by @ref ter_set afterwards; rebuilt from the layers on
+         * load instead of being serialized.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        mutable std::unordered_map<int, std::vector<tripoint_om_omt>> oter_id_index;
+        mutable bool oter_index_built = false; // NOLINT(cata-serialize)
+
         // Records the locations where a given overmap special was placed, which
         // can be used after placement to lookup whether a given location was created
         // as part of a special.
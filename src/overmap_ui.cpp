@@ -503,6 +503,24 @@ static point_abs_omt draw_notes( const tripoint_abs_omt &origin )
     return result;
 }
 
+/**
+ * Visibility and base glyph of one overmap cell, cached between frames of
+ * the map screen. These do not depend on the blink phase, so while the
+ * player pans the map only the blink overlays need recomposing; the
+ * seen/LOS/terrain work per cell is done once. Cleared when the map screen
+ * is opened and whenever an action other than plain navigation runs, since
+ * those can edit notes, explored state or the terrain itself.
+ */
+struct om_cell_basics {
+    bool see = false;
+    bool los = false;
+    bool los_sky = false;
+    oter_id ter = oter_str_id::NULL_ID();
+    nc_color color = c_black;
+    std::string sym = " ";
+};
+static std::unordered_map<tripoint_abs_omt, om_cell_basics> om_cell_cache;
+
 static void draw_ascii(
     const catacurses::window &w, const tripoint_abs_omt &center,
     const tripoint_abs_omt &orig, bool blink, bool show_explored, bool /* fast_scroll */,
@@ -557,6 +575,31 @@ static void draw_ascii(
         }
     }
 
+    // Everything the cached cell basics depend on; a change of any of these
+    // flushes the cache wholesale.
+    static int cache_z = -OVERMAP_DEPTH - 1;
+    static int cache_sight_points = -1;
+    static bool cache_show_explored = false;
+    static bool cache_land_use_codes = false;
+    static bool cache_forest_trails = false;
+    static bool cache_viewing_weather = false;
+    static bool cache_debug_vision = false;
+    if( cache_z != center.z() || cache_sight_points != sight_points ||
+        cache_show_explored != show_explored ||
+        cache_land_use_codes != uistate.overmap_show_land_use_codes ||
+        cache_forest_trails != uistate.overmap_show_forest_trails ||
+        cache_viewing_weather != viewing_weather ||
+        cache_debug_vision != has_debug_vision ) {
+        om_cell_cache.clear();
+        cache_z = center.z();
+        cache_sight_points = sight_points;
+        cache_show_explored = show_explored;
+        cache_land_use_codes = uistate.overmap_show_land_use_codes;
+        cache_forest_trails = uistate.overmap_show_forest_trails;
+        cache_viewing_weather = viewing_weather;
+        cache_debug_vision = has_debug_vision;
+    }
+
     // A small LRU cache: most oter_id's occur in clumps like forests of swamps.
     // This cache helps avoid much more costly lookups in the full hashmap.
     constexpr size_t cache_size = 8; // used below to calculate the next index
@@ -694,19 +737,42 @@ static void draw_ascii(
     for( int i = 0; i < om_map_width; ++i ) {
         for( int j = 0; j < om_map_height; ++j ) {
             const tripoint_abs_omt omp = corner + point( i, j );
-            oter_id cur_ter = oter_str_id::NULL_ID();
             nc_color ter_color = c_black;
             std::string ter_sym = " ";
 
-            const bool see = has_debug_vision || overmap_buffer.seen( omp );
-            if( see ) {
-                // Only load terrain if we can actually see it
-                cur_ter = overmap_buffer.ter( omp );
+            auto basics_iter = om_cell_cache.find( omp );
+            if( basics_iter == om_cell_cache.end() ) {
+                om_cell_basics fresh;
+                fresh.see = has_debug_vision || overmap_buffer.seen( omp );
+                if( fresh.see ) {
+                    // Only load terrain if we can actually see it
+                    fresh.ter = overmap_buffer.ter( omp );
+                }
+                // Check if location is within player line-of-sight
+                fresh.los = fresh.see && player_character.overmap_los( omp, sight_points );
+                // The doubled-range sky line is only ever read for weather.
+                fresh.los_sky = viewing_weather &&
+                                player_character.overmap_los( omp, sight_points * 2 );
+                if( !fresh.see ) {
+                    ter_color = c_dark_gray;
+                    ter_sym = "#";
+                } else if( !uistate.overmap_show_forest_trails && fresh.ter &&
+                           is_ot_match( "forest_trail", fresh.ter, ot_match_type::type ) ) {
+                    // If forest trails shouldn't be displayed, and this is a forest trail,
+                    // then instead render it like a forest.
+                    set_color_and_symbol( forest, omp, ter_sym, ter_color );
+                } else {
+                    set_color_and_symbol( fresh.ter, omp, ter_sym, ter_color );
+                }
+                fresh.color = ter_color;
+                fresh.sym = ter_sym;
+                basics_iter = om_cell_cache.emplace( omp, std::move( fresh ) ).first;
             }
-
-            // Check if location is within player line-of-sight
-            const bool los = see && player_character.overmap_los( omp, sight_points );
-            const bool los_sky = player_character.overmap_los( omp, sight_points * 2 );
+            const om_cell_basics &basics = basics_iter->second;
+            const oter_id &cur_ter = basics.ter;
+            const bool see = basics.see;
+            const bool los = basics.los;
+            const bool los_sky = basics.los_sky;
             const bool is_npc_path = npc_path_route.find( omp ) != npc_path_route.end();
             const bool is_player_path = player_path_route.find( omp.xy() ) != player_path_route.end();
             const int player_path_z = is_player_path ? player_path_route[ omp.xy() ] : 0;
@@ -735,8 +801,8 @@ static void draw_ascii(
                     get_note_display_info( overmap_buffer.note( omp ) );
             } else if( !see ) {
                 // All cases above ignore the seen-status,
-                ter_color = c_dark_gray;
-                ter_sym = "#";
+                ter_color = basics.color;
+                ter_sym = basics.sym;
                 // All cases below assume that see is true.
             } else if( blink && npc_color.count( omp ) != 0 ) {
                 // Visible NPCs are cached already
@@ -766,14 +832,10 @@ static void draw_ascii(
             } else if( !sZoneName.empty() && tripointZone.xy() == omp.xy() ) {
                 ter_color = c_yellow;
                 ter_sym = "Z";
-            } else if( !uistate.overmap_show_forest_trails && cur_ter &&
-                       is_ot_match( "forest_trail", cur_ter, ot_match_type::type ) ) {
-                // If forest trails shouldn't be displayed, and this is a forest trail, then
-                // instead render it like a forest.
-                set_color_and_symbol( forest, omp, ter_sym, ter_color );
             } else {
                 // Nothing special, but is visible to the player.
-                set_color_and_symbol( cur_ter, omp, ter_sym, ter_color );
+                ter_color = basics.color;
+                ter_sym = basics.sym;
             }
 
             // Are we debugging monster groups?
@@ -1683,6 +1745,9 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
     tripoint_abs_omt ret = overmap::invalid_tripoint;
     tripoint_abs_omt curs( orig );
 
+    // Terrain and seen state may have changed since the map was last open.
+    om_cell_cache.clear();
+
     if( data.select != tripoint_abs_omt( -1, -1, -1 ) ) {
         curs = data.select;
     }
@@ -1867,6 +1932,17 @@ static tripoint_abs_omt display( const tripoint_abs_omt &orig,
             g->list_missions();
         }
 
+        // Anything beyond plain navigation may have edited notes, explored
+        // state or the terrain itself; drop the cached cell basics. The
+        // cheap toggles are all part of the cache key already.
+        if( !ictxt.get_direction( action ) && action != "MOUSE_MOVE" && action != "TIMEOUT" &&
+            action != "SELECT" && action != "CENTER" && action != "LEVEL_UP" &&
+            action != "LEVEL_DOWN" && action != "TOGGLE_FAST_SCROLL" &&
+            action != "TOGGLE_BLINKING" && action != "TOGGLE_OVERLAYS" &&
+            action != "ANY_INPUT" ) {
+            om_cell_cache.clear();
+        }
+
         std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
         if( now > last_blink + std::chrono::milliseconds( BLINK_SPEED ) ) {
             if( uistate.overmap_blinking ) {
@@ -1,6 +1,7 @@
 #include "overmapbuffer.h"
 
 #include <algorithm>
+#include <array>
 #include <climits>
 #include <iterator>
 #include <list>
@@ -8,6 +9,7 @@
 #include <string>
 #include <tuple>
 
+#include "background_writer.h"
 #include "basecamp.h"
 #include "calendar.h"
 #include "cata_assert.h"
@@ -30,6 +32,7 @@
 #include "monster.h"
 #include "npc.h"
 #include "optional.h"
+#include "options.h"
 #include "overmap.h"
 #include "overmap_connection.h"
 #include "overmap_types.h"
@@ -50,6 +53,8 @@ overmapbuffer::overmapbuffer()
 {
 }
 
+overmapbuffer::~overmapbuffer() = default;
+
 const city_reference city_reference::invalid{ nullptr, tripoint_abs_sm(), -1 };
 
 int city_reference::get_distance_from_bounds() const
@@ -85,6 +90,9 @@ overmap &overmapbuffer::get( const point_abs_om &p )
         return *( last_requested_overmap = it->second.get() );
     }
 
+    // Evicted overmaps are reloaded from disk, so their queued writes
+    // must land before the files are read back.
+    flush_pending_writes();
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     new_om.populate();
@@ -225,19 +233,101 @@ void overmapbuffer::fix_npcs( overmap &new_overmap )
 
 void overmapbuffer::save()
 {
+    // The writes queued by the previous save must finish before their
+    // filenames are queued again with fresh contents.
+    flush_pending_writes();
+    const bool save_in_background = get_option<bool>( "BACKGROUND_SAVE" );
+    if( save_in_background && !writer ) {
+        writer = std::make_unique<background_writer>();
+    }
     for( auto &omp : overmaps ) {
-        // Note: this may throw io errors from std::ofstream
-        omp.second->save();
+        if( save_in_background ) {
+            omp.second->save( *writer );
+        } else {
+            // Note: this may throw io errors from std::ofstream
+            omp.second->save();
+        }
+    }
+}
+
+void overmapbuffer::flush_pending_writes()
+{
+    if( writer ) {
+        writer->flush();
     }
 }
 
 void overmapbuffer::clear()
 {
+    // Pending writes hold their own copies of the serialized data, but
+    // they must hit the disk before the world can be left or reloaded.
+    flush_pending_writes();
     overmaps.clear();
     known_non_existing.clear();
     last_requested_overmap = nullptr;
 }
 
+size_t overmapbuffer::overmap_count() const
+{
+    return overmaps.size();
+}
+
+void overmapbuffer::prefetch_adjacent( const tripoint_abs_omt &loc )
+{
+    point_abs_om om;
+    point_om_omt local;
+    std::tie( om, local ) = project_remain<coords::om>( loc.xy() );
+    // Only look ahead once the avatar is in the outer third of the
+    // current overmap, and only towards the near border(s).
+    constexpr int margin = OMAPX / 3;
+    const int dx = local.x() < margin ? -1 : local.x() >= OMAPX - margin ? 1 : 0;
+    const int dy = local.y() < margin ? -1 : local.y() >= OMAPY - margin ? 1 : 0;
+    if( dx == 0 && dy == 0 ) {
+        return;
+    }
+    const std::array<point, 3> sides = { { point( dx, dy ), point( dx, 0 ), point( 0, dy ) } };
+    for( const point &side : sides ) {
+        if( side == point_zero ) {
+            continue;
+        }
+        const point_abs_om next( om.raw() + side );
+        if( get_existing( next ) == nullptr ) {
+            // Generate at most one overmap per call; this spreads the
+            // cost over several moves when approaching a corner.
+            get( next );
+            return;
+        }
+    }
+}
+
+void overmapbuffer::evict_distant()
+{
+    // Long-haul travel accumulates overmaps that are never revisited
+    // but still hold their full terrain arrays, hordes and npcs. Keep
+    // the block around the player loaded unconditionally; beyond that,
+    // drop the farthest overmaps until we are back under the cap.
+    constexpr int keep_radius = 2;
+    constexpr size_t soft_cap = 25;
+    if( overmaps.size() <= soft_cap ) {
+        return;
+    }
+    const point_abs_om center =
+        project_to<coords::om>( get_player_character().global_omt_location().xy() );
+    for( auto it = overmaps.begin(); it != overmaps.end() && overmaps.size() > soft_cap; ) {
+        const point_abs_om &p = it->first;
+        const int dist = std::max( std::abs( p.x() - center.x() ),
+                                   std::abs( p.y() - center.y() ) );
+        if( dist <= keep_radius ) {
+            ++it;
+            continue;
+        }
+        if( last_requested_overmap == it->second.get() ) {
+            last_requested_overmap = nullptr;
+        }
+        it = overmaps.erase( it );
+    }
+}
+
 const regional_settings &overmapbuffer::get_settings( const tripoint_abs_omt &p )
 {
     overmap *om = get_om_global( p ).om;
@@ -294,6 +384,9 @@ overmap *overmapbuffer::get_existing( const point_abs_om &p )
         // checked in a previous call of this function).
         return nullptr;
     }
+    // A freshly generated overmap may still be queued for writing; it
+    // must not be misfiled as known_non_existing below.
+    flush_pending_writes();
     if( file_exist( terrain_filename( p ) ) ) {
         // File exists, load it normally (the get function
         // indirectly call overmap::open to do so).
@@ -721,6 +814,32 @@ void overmapbuffer::set_seen( const tripoint_abs_omt &p, bool seen )
     om_loc.om->seen( om_loc.local ) = seen;
 }
 
+void overmapbuffer::set_seen( const tripoint_abs_omt &from, const tripoint_abs_omt &to, bool seen )
+{
+    const int min_x = std::min( from.x(), to.x() );
+    const int max_x = std::max( from.x(), to.x() );
+    const int min_y = std::min( from.y(), to.y() );
+    const int max_y = std::max( from.y(), to.y() );
+    const int min_z = std::min( from.z(), to.z() );
+    const int max_z = std::max( from.z(), to.z() );
+    for( int y = min_y; y <= max_y; y++ ) {
+        int x = min_x;
+        while( x <= max_x ) {
+            point_abs_om om_pos;
+            point_om_omt local;
+            std::tie( om_pos, local ) = project_remain<coords::om>( point_abs_omt( x, y ) );
+            overmap &om = get( om_pos );
+            // Write the whole row span that falls inside this overmap.
+            const int span_end = std::min( max_x, x + ( OMAPX - 1 - local.x() ) );
+            for( int lx = local.x(); x <= span_end; x++, lx++ ) {
+                for( int z = min_z; z <= max_z; z++ ) {
+                    om.seen( tripoint_om_omt( lx, local.y(), z ) ) = seen;
+                }
+            }
+        }
+    }
+}
+
 const oter_id &overmapbuffer::ter( const tripoint_abs_omt &p )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
@@ -764,22 +883,33 @@ bool overmapbuffer::reveal( const tripoint_abs_omt &center, int radius )
 bool overmapbuffer::reveal( const tripoint_abs_omt &center, int radius,
                             const std::function<bool( const oter_id & )> &filter )
 {
-    int radius_squared = radius * radius;
+    const int radius_squared = radius * radius;
     bool result = false;
-    for( int i = -radius; i <= radius; i++ ) {
-        for( int j = -radius; j <= radius; j++ ) {
-            const tripoint_abs_omt p = center + point( i, j );
-            if( seen( p ) ) {
-                continue;
-            }
-            if( trigdist && i * i + j * j > radius_squared ) {
-                continue;
-            }
-            if( !filter( ter( p ) ) ) {
-                continue;
+    for( int j = -radius; j <= radius; j++ ) {
+        int i = -radius;
+        while( i <= radius ) {
+            const point_abs_omt row_start = center.xy() + point( i, j );
+            point_abs_om om_pos;
+            point_om_omt local;
+            std::tie( om_pos, local ) = project_remain<coords::om>( row_start );
+            overmap &om = get( om_pos );
+            // Work through the row span inside this overmap with direct
+            // accesses, instead of resolving the overmap per tile.
+            const int span_end = std::min( radius, i + ( OMAPX - 1 - local.x() ) );
+            for( int lx = local.x(); i <= span_end; i++, lx++ ) {
+                if( trigdist && i * i + j * j > radius_squared ) {
+                    continue;
+                }
+                const tripoint_om_omt p( lx, local.y(), center.z() );
+                if( om.seen( p ) ) {
+                    continue;
+                }
+                if( !filter( om.ter( p ) ) ) {
+                    continue;
+                }
+                result = true;
+                om.seen( p ) = true;
             }
-            result = true;
-            set_seen( p, true );
         }
     }
     return result;
@@ -852,45 +982,33 @@ static int get_terrain_cost( const tripoint_abs_omt &omt_pos, const overmap_path
         return -1;
     }
     const oter_id &oter = overmap_buffer.ter_existing( omt_pos );
-    if( is_ot_match( "road", oter, ot_match_type::type ) ||
-        is_ot_match( "bridge_road", oter, ot_match_type::type ) ||
-        is_ot_match( "bridgehead_ground", oter, ot_match_type::type ) ||
-        is_ot_match( "bridgehead_ramp", oter, ot_match_type::type ) ||
-        is_ot_match( "road_nesw_manhole", oter, ot_match_type::type ) ) {
-        return params.road_cost;
-    } else if( is_ot_match( "field", oter, ot_match_type::type ) ) {
-        return params.field_cost;
-    } else if( is_ot_match( "rural_road", oter, ot_match_type::prefix ) ||
-               is_ot_match( "dirt_road", oter, ot_match_type::prefix ) ||
-               is_ot_match( "subway", oter, ot_match_type::type ) ||
-               is_ot_match( "lab_subway", oter, ot_match_type::type ) ) {
-        return params.dirt_road_cost;
-    } else if( is_ot_match( "forest_trail", oter, ot_match_type::type ) ) {
-        return params.trail_cost;
-    } else if( is_ot_match( "forest_water", oter, ot_match_type::type ) ) {
-        return params.swamp_cost;
-    } else if( is_ot_match( "river", oter, ot_match_type::prefix ) ||
-               is_ot_match( "lake", oter, ot_match_type::prefix ) ) {
-        if( is_ot_match( "river_center", oter, ot_match_type::type ) ||
-            is_ot_match( "lake_surface", oter, ot_match_type::type ) ) {
+    // The terrain classification is cached on the oter_t; only the mapping
+    // from class to cost depends on the travel params.
+    switch( oter->get_travel_cost_type() ) {
+        case oter_travel_cost_type::road:
+            return params.road_cost;
+        case oter_travel_cost_type::field:
+            return params.field_cost;
+        case oter_travel_cost_type::dirt_road:
+            return params.dirt_road_cost;
+        case oter_travel_cost_type::trail:
+            return params.trail_cost;
+        case oter_travel_cost_type::swamp:
+            return params.swamp_cost;
+        case oter_travel_cost_type::water:
             return params.water_cost;
-        } else {
+        case oter_travel_cost_type::shore:
             return params.shore_cost;
-        }
-    } else if( is_ot_match( "bridge", oter, ot_match_type::type ) ) {
-        return params.water_cost;
-    } else if( is_ot_match( "open_air", oter, ot_match_type::type ) ) {
-        return params.air_cost;
-    } else if( is_ot_match( "forest", oter, ot_match_type::type ) ) {
-        return params.forest_cost;
-    } else if( is_ot_match( "empty_rock", oter, ot_match_type::type ) ||
-               is_ot_match( "deep_rock", oter, ot_match_type::type ) ||
-               is_ot_match( "solid_earth", oter, ot_match_type::type ) ||
-               is_ot_match( "microlab_rock_border", oter, ot_match_type::type ) ) {
-        return -1;
-    } else {
-        return params.other_cost;
+        case oter_travel_cost_type::air:
+            return params.air_cost;
+        case oter_travel_cost_type::forest:
+            return params.forest_cost;
+        case oter_travel_cost_type::impassable:
+            return -1;
+        case oter_travel_cost_type::other:
+            return params.other_cost;
     }
+    return params.other_cost;
 }
 
 static bool is_ramp( const tripoint_abs_omt &omt_pos )
@@ -1091,6 +1209,24 @@ tripoint_abs_omt overmapbuffer::find_closest(
     return find_closest( origin, params );
 }
 
+// Candidate locations of @p om matching any of the requested types, from the
+// overmap's inverted terrain index. Deduplicated so overlapping type patterns
+// cannot make one tile count twice.
+static std::vector<tripoint_om_omt> matching_candidates( const overmap &om,
+        const omt_find_params &params )
+{
+    std::vector<tripoint_om_omt> candidates;
+    for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
+        const std::vector<tripoint_om_omt> matches = om.matching_locations( elem.first, elem.second );
+        candidates.insert( candidates.end(), matches.begin(), matches.end() );
+    }
+    if( params.types.size() > 1 ) {
+        std::sort( candidates.begin(), candidates.end() );
+        candidates.erase( std::unique( candidates.begin(), candidates.end() ), candidates.end() );
+    }
+    return candidates;
+}
+
 tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
@@ -1120,24 +1256,49 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
     std::vector<tripoint_abs_omt> result;
     cata::optional<int> found_dist;
 
-    for( const point_abs_omt &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-        const int dist_xy = square_dist( origin.xy(), loc_xy );
-
-        if( found_dist && *found_dist < dist_xy ) {
+    // Instead of probing every tile of the spiral, query the inverted
+    // terrain index of each overmap, visiting overmaps in concentric rings
+    // outward from the origin. Every tile of a ring r overmap is at least
+    // ( r - 1 ) * OMAPX + 1 away, so the search can stop as soon as the
+    // best hit beats the next ring's lower bound.
+    const point_abs_om origin_om = project_to<coords::om>( origin.xy() );
+    const int max_om_ring = max_dist / OMAPX + 2;
+    for( int r = 0; r <= max_om_ring; r++ ) {
+        if( ( r - 1 ) * OMAPX + 1 > max_dist ) {
             break;
         }
-
-        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-            const tripoint_abs_omt loc( loc_xy, z );
-            const int dist = square_dist( origin, loc );
-
-            if( found_dist && *found_dist < dist ) {
-                continue;
-            }
-
-            if( is_findable_location( loc, params ) ) {
-                found_dist = dist;
-                result.push_back( loc );
+        if( found_dist && *found_dist <= ( r - 1 ) * OMAPX ) {
+            break;
+        }
+        for( int x = -r; x <= r; x++ ) {
+            for( int y = -r; y <= r; y++ ) {
+                if( std::max( std::abs( x ), std::abs( y ) ) != r ) {
+                    continue;
+                }
+                const point_abs_om om_pos = origin_om + point( x, y );
+                const overmap *om = params.existing_only ? get_existing( om_pos ) : &get( om_pos );
+                if( om == nullptr ) {
+                    continue;
+                }
+                for( const tripoint_om_omt &local : matching_candidates( *om, params ) ) {
+                    const tripoint_abs_omt loc( project_combine( om_pos, local ) );
+                    const int dist_xy = square_dist( origin.xy(), loc.xy() );
+                    if( dist_xy < min_dist || dist_xy > max_dist ) {
+                        continue;
+                    }
+                    const int dist = square_dist( origin, loc );
+                    if( found_dist && *found_dist < dist ) {
+                        continue;
+                    }
+                    if( !is_findable_location( loc, params ) ) {
+                        continue;
+                    }
+                    if( !found_dist || dist < *found_dist ) {
+                        found_dist = dist;
+                        result.clear();
+                    }
+                    result.push_back( loc );
+                }
             }
         }
     }
@@ -1153,11 +1314,37 @@ std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &o
     const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX;
 
-    for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
-        if( is_findable_location( loc, params ) ) {
-            result.push_back( loc );
+    // Collect candidates from the inverted terrain index of every overmap
+    // overlapping the search square, then restore the nearest-first order
+    // the old spiral produced.
+    const point_abs_om om_min = project_to<coords::om>( origin.xy() + point( -max_dist, -max_dist ) );
+    const point_abs_om om_max = project_to<coords::om>( origin.xy() + point( max_dist, max_dist ) );
+    for( int om_x = om_min.x(); om_x <= om_max.x(); om_x++ ) {
+        for( int om_y = om_min.y(); om_y <= om_max.y(); om_y++ ) {
+            const point_abs_om om_pos( om_x, om_y );
+            const overmap *om = params.existing_only ? get_existing( om_pos ) : &get( om_pos );
+            if( om == nullptr ) {
+                continue;
+            }
+            for( const tripoint_om_omt &local : matching_candidates( *om, params ) ) {
+                if( local.z() != origin.z() ) {
+                    continue;
+                }
+                const tripoint_abs_omt loc( project_combine( om_pos, local ) );
+                const int dist = square_dist( origin.xy(), loc.xy() );
+                if( dist < min_dist || dist > max_dist ) {
+                    continue;
+                }
+                if( is_findable_location( loc, params ) ) {
+                    result.push_back( loc );
+                }
+            }
         }
     }
+    std::sort( result.begin(), result.end(),
+    [&origin]( const tripoint_abs_omt & lhs, const tripoint_abs_omt & rhs ) {
+        return square_dist( origin, lhs ) < square_dist( origin, rhs );
+    } );
 
     return result;
 }
@@ -1510,8 +1697,10 @@ void overmapbuffer::spawn_monster( const tripoint_abs_sm &p )
         const tripoint local = here.getlocal( this_monster.get_location().raw() );
         // The monster position must be local to the main map when added to the game
         cata_assert( here.inbounds( local ) );
-        monster *const placed = g->place_critter_around( make_shared_fast<monster>( this_monster ),
-                                local, 0, true );
+        // The bucket is erased below, so the stored monster can be moved out
+        // instead of deep-copied back into the game.
+        monster *const placed = g->place_critter_around( make_shared_fast<monster>( std::move(
+                                    this_monster ) ), local, 0, true );
         if( placed ) {
             placed->on_load();
         }
@@ -1520,6 +1709,11 @@ void overmapbuffer::spawn_monster( const tripoint_abs_sm &p )
 }
 
 void overmapbuffer::despawn_monster( const monster &critter )
+{
+    despawn_monster( monster( critter ) );
+}
+
+void overmapbuffer::despawn_monster( monster &&critter )
 {
     // Get the overmap coordinates and get the overmap, sm is now local to that overmap
     point_abs_om omp;
@@ -1532,7 +1726,7 @@ void overmapbuffer::despawn_monster( const monster &critter )
         //if the monster is the 'hunted' trait's nemesis, it becomes an overmap horde
         om.place_nemesis( critter.global_omt_location() );
     } else {
-        om.monster_map.insert( std::make_pair( sm, critter ) );
+        om.monster_map.emplace( sm, std::move( critter ) );
     }
 }
 
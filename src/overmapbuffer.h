@@ -20,6 +20,7 @@
 #include "overmap_types.h"
 #include "type_id.h"
 
+class background_writer;
 class basecamp;
 class character_id;
 class map_extra;
@@ -141,6 +142,7 @@ class overmapbuffer
 {
     public:
         overmapbuffer();
+        ~overmapbuffer();
 
         static std::string terrain_filename( const point_abs_om & );
         static std::string player_filename( const point_abs_om & );
@@ -151,7 +153,30 @@ class overmapbuffer
          */
         overmap &get( const point_abs_om & );
         void save();
+        /** Block until all overmap files queued by a previous background
+         * save have been written to disk. Must be called before those
+         * files are read back or the world is exited.
+         **/
+        void flush_pending_writes();
         void clear();
+        /** Number of overmaps currently held in memory, for the debug
+         *  memory report. */
+        size_t overmap_count() const;
+        /**
+         * Unload overmaps far away from the player once the buffer has
+         * grown past its soft cap. Only safe right after save(), when
+         * everything in the buffer is on disk; evicted overmaps are
+         * simply reloaded by get() when next needed.
+         */
+        void evict_distant();
+        /**
+         * Speculatively generate the overmaps ahead of the avatar: when
+         * @p loc is in the outer third of its overmap, ensure the
+         * adjacent overmaps on that side exist, at most one generation
+         * per call. This moves the worldgen hitch away from the exact
+         * moment a border is crossed at speed.
+         */
+        void prefetch_adjacent( const tripoint_abs_omt &loc );
         void create_custom_overmap( const point_abs_om &, overmap_special_batch &specials );
 
         /**
@@ -183,6 +208,13 @@ class overmapbuffer
         void toggle_explored( const tripoint_abs_omt &p );
         bool seen( const tripoint_abs_omt &p );
         void set_seen( const tripoint_abs_omt &p, bool seen = true );
+        /**
+         * Bulk variant: marks every OMT in the axis-aligned box spanned by
+         * @p from and @p to (inclusive, including the z range) as seen.
+         * Each covered overmap is resolved once and its row spans written
+         * directly, instead of one overmap lookup per tile.
+         */
+        void set_seen( const tripoint_abs_omt &from, const tripoint_abs_omt &to, bool seen );
         bool has_camp( const tripoint_abs_omt &p );
         bool has_vehicle( const tripoint_abs_omt &p );
         bool has_horde( const tripoint_abs_omt &p );
@@ -455,6 +487,12 @@ class overmapbuffer
          * (monster::pos()) is interpreted as relative to the main map.
          */
         void despawn_monster( const monster &critter );
+        /**
+         * Moves the monster into overmap storage instead of copying it,
+         * leaving the caller's object as an empty shell. Preferred when the
+         * monster is being removed from the game anyway (bubble shifts).
+         */
+        void despawn_monster( monster &&critter );
         /**
          * Find radio station with given frequency, search an unspecified area around
          * the current player location.
@@ -529,6 +567,8 @@ class overmapbuffer
         mutable std::set<point_abs_om> known_non_existing;
         // Cached result of previous call to overmapbuffer::get_existing
         overmap mutable *last_requested_overmap;
+        // Writes serialized overmaps on a worker thread; see background_writer.h.
+        std::unique_ptr<background_writer> writer; // NOLINT(cata-serialize)
 
         /**
          * Get a list of notes in the (loaded) overmaps.
@@ -31,6 +31,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "game_ui.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "item.h"
 #include "json.h"
@@ -231,6 +232,38 @@ std::string window_panel::get_name() const
     return name.translated();
 }
 
+uint64_t window_panel::global_data_version( const avatar &u )
+{
+    size_t seed = static_cast<size_t>( to_turn<int>( calendar::turn ) );
+    cata::hash_combine( seed, u.pos() );
+    cata::hash_combine( seed, u.view_offset );
+    cata::hash_combine( seed, u.moves );
+    cata::hash_combine( seed, u.get_stamina() );
+    cata::hash_combine( seed, units::to_millijoule( u.get_power_level() ) );
+    cata::hash_combine( seed, u.get_pain() );
+    cata::hash_combine( seed, u.get_morale_level() );
+    cata::hash_combine( seed, Messages::size() );
+    cata::hash_combine( seed, static_cast<int>( g->safe_mode ) );
+    return seed;
+}
+
+catacurses::window window_panel::cached_window( const uint64_t version, const int h, const int w,
+        const point &origin ) const
+{
+    if( cached_win && cached_version == version &&
+        getmaxy( cached_win ) == h && getmaxx( cached_win ) == w &&
+        getbegy( cached_win ) == origin.y && getbegx( cached_win ) == origin.x ) {
+        return cached_win;
+    }
+    return catacurses::window();
+}
+
+void window_panel::cache_window( const uint64_t version, const catacurses::window &win ) const
+{
+    cached_win = win;
+    cached_version = version;
+}
+
 panel_layout::panel_layout( const translation &_name,
                             const std::vector<window_panel> &_panels )
     : _name( _name ), _panels( _panels )
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_PANELS_H
 #define CATA_SRC_PANELS_H
 
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <map>
@@ -11,6 +12,7 @@
 #include "bodypart.h"
 #include "color.h"
 #include "coordinates.h"
+#include "cursesdef.h"
 #include "translations.h"
 
 class JsonIn;
@@ -136,6 +138,20 @@ class window_panel
         int get_width() const;
         const std::string &get_id() const;
         std::string get_name() const;
+        /**
+         * Hash of everything the sidebar panels render.  Anything displayed
+         * changes either with the passage of time or through a player action,
+         * and both leave traces in the hashed state.
+         */
+        static uint64_t global_data_version( const avatar &u );
+        /**
+         * Returns the window rendered on a previous frame when the data
+         * version and the geometry still match, so the caller can re-blit it
+         * instead of re-rendering, or an invalid window otherwise.
+         */
+        catacurses::window cached_window( uint64_t version, int h, int w, const point &origin ) const;
+        /** Stores a freshly rendered window for subsequent frames. */
+        void cache_window( uint64_t version, const catacurses::window &win ) const;
         bool toggle;
         bool always_draw;
 
@@ -144,6 +160,8 @@ class window_panel
         int width;
         std::string id;
         translation name;
+        mutable catacurses::window cached_win;
+        mutable uint64_t cached_version = 0;
 };
 
 class panel_layout
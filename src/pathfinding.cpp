@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <array>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <queue>
 #include <set>
@@ -19,6 +21,7 @@
 #include "point.h"
 #include "submap.h"
 #include "trap.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 #include "veh_type.h"
 #include "vehicle.h"
@@ -40,80 +43,111 @@ static constexpr int flat_index( const point &p )
 struct path_data_layer {
     // State is accessed way more often than all other values here
     std::array< astar_state, MAPSIZE_X *MAPSIZE_Y > state;
+    // Generation stamp of the search that last wrote each cell; cells
+    // stamped by an older search read as unvisited, which is what lets
+    // the layers be reused without clearing them between searches.
+    std::array< int, MAPSIZE_X *MAPSIZE_Y > touched;
     std::array< int, MAPSIZE_X *MAPSIZE_Y > score;
     std::array< int, MAPSIZE_X *MAPSIZE_Y > gscore;
     std::array< tripoint, MAPSIZE_X *MAPSIZE_Y > parent;
-
-    void init( const point &min, const point &max ) {
-        for( int x = min.x; x <= max.x; x++ ) {
-            for( int y = min.y; y <= max.y; y++ ) {
-                const int ind = flat_index( point( x, y ) );
-                state[ind] = ASL_NONE; // Mark as unvisited
-            }
-        }
-    }
 };
 
 struct pathfinder {
     point min;
     point max;
-    pathfinder( const point &_min, const point &_max ) :
-        min( _min ), max( _max ) {
-    }
+    // Stamp compared against path_data_layer::touched; reset() bumps it
+    // so the previous search's cells are implicitly unvisited.
+    int generation = 0;
 
-    std::priority_queue< std::pair<int, tripoint>, std::vector< std::pair<int, tripoint> >, pair_greater_cmp_first >
-    open;
+    // Min-heap ordered by score; kept as a plain vector so clearing it
+    // between searches keeps the allocation.
+    std::vector< std::pair<int, tripoint> > open;
     std::array< std::unique_ptr< path_data_layer >, OVERMAP_LAYERS > path_data;
 
+    void reset( const point &_min, const point &_max ) {
+        min = _min;
+        max = _max;
+        generation++;
+        open.clear();
+    }
+
     path_data_layer &get_layer( const int z ) {
         std::unique_ptr< path_data_layer > &ptr = path_data[z + OVERMAP_DEPTH];
-        if( ptr != nullptr ) {
-            return *ptr;
+        if( ptr == nullptr ) {
+            // Value-initialized, so touched starts all zero and below
+            // any generation reset() hands out.
+            ptr = std::make_unique<path_data_layer>();
         }
-
-        ptr = std::make_unique<path_data_layer>();
-        ptr->init( min, max );
         return *ptr;
     }
 
+    astar_state get_state( const path_data_layer &layer, const int index ) const {
+        return layer.touched[index] == generation ? layer.state[index] : ASL_NONE;
+    }
+
+    void set_state( path_data_layer &layer, const int index, const astar_state st ) {
+        layer.touched[index] = generation;
+        layer.state[index] = st;
+    }
+
+    int get_gscore( const path_data_layer &layer, const int index ) const {
+        return layer.touched[index] == generation ? layer.gscore[index] : 0;
+    }
+
+    int get_score( const path_data_layer &layer, const int index ) const {
+        return layer.touched[index] == generation ? layer.score[index] : 0;
+    }
+
     bool empty() const {
         return open.empty();
     }
 
     tripoint get_next() {
-        const auto pt = open.top();
-        open.pop();
-        return pt.second;
+        std::pop_heap( open.begin(), open.end(), pair_greater_cmp_first() );
+        const tripoint pt = open.back().second;
+        open.pop_back();
+        return pt;
     }
 
     void add_point( const int gscore, const int score, const tripoint &from, const tripoint &to ) {
         auto &layer = get_layer( to.z );
         const int index = flat_index( to.xy() );
-        if( ( layer.state[index] == ASL_OPEN && gscore >= layer.gscore[index] ) ||
-            layer.state[index] == ASL_CLOSED ) {
+        const astar_state cur = get_state( layer, index );
+        if( ( cur == ASL_OPEN && gscore >= layer.gscore[index] ) ||
+            cur == ASL_CLOSED ) {
             return;
         }
 
-        layer.state [index] = ASL_OPEN;
+        set_state( layer, index, ASL_OPEN );
         layer.gscore[index] = gscore;
         layer.parent[index] = from;
         layer.score [index] = score;
-        open.push( std::make_pair( score, to ) );
+        open.emplace_back( score, to );
+        std::push_heap( open.begin(), open.end(), pair_greater_cmp_first() );
     }
 
     void close_point( const tripoint &p ) {
         auto &layer = get_layer( p.z );
-        const int index = flat_index( p.xy() );
-        layer.state[index] = ASL_CLOSED;
+        set_state( layer, flat_index( p.xy() ), ASL_CLOSED );
     }
 
     void unclose_point( const tripoint &p ) {
         auto &layer = get_layer( p.z );
-        const int index = flat_index( p.xy() );
-        layer.state[index] = ASL_NONE;
+        set_state( layer, flat_index( p.xy() ), ASL_NONE );
     }
 };
 
+// One arena per thread, handed out to every route_impl call. Reuse keeps
+// the open list's and layers' allocations across searches, so the many
+// creatures pathing each turn stop paying an allocate-and-clear on every
+// call; the generation stamps make the leftover contents harmless.
+static pathfinder &get_pathfinder_arena( const point &min, const point &max )
+{
+    static thread_local pathfinder arena;
+    arena.reset( min, max );
+    return arena;
+}
+
 // Modifies `t` to point to a tile with `flag` in a 1-submap radius of `t`'s original value,
 // searching nearest points first (starting with `t` itself).
 // return false if it could not find a suitable point
@@ -163,6 +197,118 @@ static bool is_disjoint( const Set1 &set1, const Set2 &set2 )
     return true;
 }
 
+// Any special case, including just hard terrain.
+static const pf_special non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
+
+const submap_connectivity &map::get_submap_connectivity( int zlev ) const
+{
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( zlev );
+    std::unique_ptr<submap_connectivity> &ptr = connectivity_caches[zlev + OVERMAP_DEPTH];
+    if( !ptr ) {
+        ptr = std::make_unique<submap_connectivity>();
+    }
+    submap_connectivity &conn = *ptr;
+    if( conn.cache_generation == pf_cache.generation ) {
+        return conn;
+    }
+
+    std::memset( conn.connections, 0, sizeof( conn.connections ) );
+    for( int smx = 0; smx < my_MAPSIZE; smx++ ) {
+        for( int smy = 0; smy < my_MAPSIZE; smy++ ) {
+            if( smx + 1 < my_MAPSIZE ) {
+                const int x = ( smx + 1 ) * SEEX - 1;
+                for( int y = smy * SEEY; y < ( smy + 1 ) * SEEY; y++ ) {
+                    if( !( pf_cache.special[x][y] & PF_WALL ) &&
+                        !( pf_cache.special[x + 1][y] & PF_WALL ) ) {
+                        conn.connections[smx][smy] |= submap_connectivity::CONN_EAST;
+                        conn.connections[smx + 1][smy] |= submap_connectivity::CONN_WEST;
+                        break;
+                    }
+                }
+            }
+            if( smy + 1 < my_MAPSIZE ) {
+                const int y = ( smy + 1 ) * SEEY - 1;
+                for( int x = smx * SEEX; x < ( smx + 1 ) * SEEX; x++ ) {
+                    if( !( pf_cache.special[x][y] & PF_WALL ) &&
+                        !( pf_cache.special[x][y + 1] & PF_WALL ) ) {
+                        conn.connections[smx][smy] |= submap_connectivity::CONN_SOUTH;
+                        conn.connections[smx][smy + 1] |= submap_connectivity::CONN_NORTH;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    conn.cache_generation = pf_cache.generation;
+    return conn;
+}
+
+// Breadth-first search over the submap connectivity graph. On success,
+// marks the submaps of the coarse route and all their neighbors in
+// corridor and returns true.
+static bool coarse_route_corridor( const submap_connectivity &conn, const int grid_size,
+                                   const point &from_sm, const point &to_sm,
+                                   std::bitset<MAPSIZE *MAPSIZE> &corridor )
+{
+    static const std::array<point, 4> sm_dirs = {{ point_north, point_south, point_west, point_east }};
+    static const std::array<uint8_t, 4> sm_bits = {{
+            submap_connectivity::CONN_NORTH, submap_connectivity::CONN_SOUTH,
+            submap_connectivity::CONN_WEST, submap_connectivity::CONN_EAST
+        }
+    };
+    const auto index = []( const point & sm ) {
+        return sm.x + sm.y * MAPSIZE;
+    };
+
+    std::array<int16_t, MAPSIZE *MAPSIZE> parent;
+    parent.fill( -1 );
+    std::vector<int16_t> queue;
+    queue.reserve( grid_size * grid_size );
+    const int start = index( from_sm );
+    const int goal = index( to_sm );
+    parent[start] = start;
+    queue.push_back( start );
+    for( size_t i = 0; i < queue.size() && parent[goal] < 0; i++ ) {
+        const int cur = queue[i];
+        const point cur_sm( cur % MAPSIZE, cur / MAPSIZE );
+        for( size_t d = 0; d < sm_dirs.size(); d++ ) {
+            if( !( conn.connections[cur_sm.x][cur_sm.y] & sm_bits[d] ) ) {
+                continue;
+            }
+            const point next_sm = cur_sm + sm_dirs[d];
+            if( next_sm.x < 0 || next_sm.y < 0 || next_sm.x >= grid_size || next_sm.y >= grid_size ) {
+                continue;
+            }
+            const int next = index( next_sm );
+            if( parent[next] < 0 ) {
+                parent[next] = cur;
+                queue.push_back( next );
+            }
+        }
+    }
+    if( parent[goal] < 0 ) {
+        return false;
+    }
+
+    // Mark the route and one submap of slack around it, so the refined
+    // search may cut corners the coarse route couldn't express.
+    for( int cur = goal; ; cur = parent[cur] ) {
+        const point cur_sm( cur % MAPSIZE, cur / MAPSIZE );
+        for( int dx = -1; dx <= 1; dx++ ) {
+            for( int dy = -1; dy <= 1; dy++ ) {
+                const point n = cur_sm + point( dx, dy );
+                if( n.x >= 0 && n.y >= 0 && n.x < grid_size && n.y < grid_size ) {
+                    corridor.set( index( n ) );
+                }
+            }
+        }
+        if( cur == parent[cur] ) {
+            break;
+        }
+    }
+    return true;
+}
+
 std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                   const pathfinding_settings &settings,
                                   const std::set<tripoint> &pre_closed ) const
@@ -176,6 +322,11 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         return ret;
     }
 
+    turn_profiler::scoped_span span( "map::route" );
+    if( turn_profiler::capturing() ) {
+        span.set_detail( string_format( "%s -> %s", f.to_string(), t.to_string() ) );
+    }
+
     if( !inbounds( t ) ) {
         tripoint clipped = t;
         clip_to_bounds( clipped );
@@ -183,7 +334,6 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
     }
     // First, check for a simple straight line on flat ground
     // Except when the line contains a pre-closed tile - we need to do regular pathing then
-    static const pf_special non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
     if( f.z == t.z ) {
         const auto line_path = line_to( f, t );
         const auto &pf_cache = get_pathfinding_cache_ref( f.z );
@@ -204,6 +354,64 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         return ret;
     }
 
+    // Check for a cached result of an identical query. The pathfinding
+    // cache generation changes whenever terrain, furniture or vehicles
+    // do, so a matching entry is still walkable; it just additionally
+    // has to avoid the tiles this particular caller has closed.
+    const pathfinding_cache &f_cache = get_pathfinding_cache_ref( f.z );
+    const route_cache_key cache_key = { f, t, settings };
+    if( !route_cache ) {
+        route_cache = std::make_unique<lru_cache<route_cache_key, route_cache_entry>>();
+    } else if( f.z == t.z ) {
+        const route_cache_entry hit = route_cache->get( cache_key, route_cache_entry() );
+        if( hit.cache_generation == f_cache.generation &&
+        std::none_of( hit.path.begin(), hit.path.end(), [&pre_closed]( const tripoint & p ) {
+        return pre_closed.count( p ) > 0;
+        } ) ) {
+            return hit.path;
+        }
+    }
+
+    // Hierarchical mode for long same-z trips: find a coarse route over
+    // the submap connectivity graph first and restrict the tile-level
+    // search to a corridor along it. When the coarse graph finds no
+    // route - or the corridor turns out not to contain a tile path,
+    // e.g. for monsters that would have bashed straight through - fall
+    // back to the unrestricted search.
+    if( f.z == t.z && rl_dist( f, t ) > 2 * SEEX ) {
+        std::bitset<MAPSIZE *MAPSIZE> corridor;
+        if( coarse_route_corridor( get_submap_connectivity( f.z ), my_MAPSIZE,
+                                   point( f.x / SEEX, f.y / SEEY ),
+                                   point( t.x / SEEX, t.y / SEEY ), corridor ) ) {
+            ret = route_impl( f, t, settings, pre_closed, &corridor );
+        }
+    }
+    if( ret.empty() ) {
+        ret = route_impl( f, t, settings, pre_closed, nullptr );
+    }
+
+    // Cache same-z results. A success is valid for any caller whose
+    // pre_closed set the path avoids; a failure is only valid for
+    // everyone when it wasn't caused by pre_closed tiles.
+    constexpr int max_route_cache = 8;
+    if( f.z == t.z && ( !ret.empty() || pre_closed.empty() ) &&
+    std::all_of( ret.begin(), ret.end(), [&f]( const tripoint & p ) {
+    return p.z == f.z;
+    } ) ) {
+        route_cache->insert( max_route_cache, cache_key,
+                             route_cache_entry{ f_cache.generation, ret } );
+    }
+
+    return ret;
+}
+
+std::vector<tripoint> map::route_impl( const tripoint &f, const tripoint &t,
+                                       const pathfinding_settings &settings,
+                                       const std::set<tripoint> &pre_closed,
+                                       const std::bitset<MAPSIZE *MAPSIZE> *corridor ) const
+{
+    std::vector<tripoint> ret;
+
     int max_length = settings.max_length;
     int bash = settings.bash_strength;
     int climb_cost = settings.climb_cost;
@@ -218,7 +426,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
     clip_to_bounds( min.x, min.y, min.z );
     clip_to_bounds( max.x, max.y, max.z );
 
-    pathfinder pf( min.xy(), max.xy() );
+    pathfinder &pf = get_pathfinder_arena( min.xy(), max.xy() );
     // Make NPCs not want to path through player
     // But don't make player pathing stop working
     for( const auto &p : pre_closed ) {
@@ -239,14 +447,13 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
 
         const int parent_index = flat_index( cur.xy() );
         auto &layer = pf.get_layer( cur.z );
-        auto &cur_state = layer.state[parent_index];
-        if( cur_state == ASL_CLOSED ) {
+        if( pf.get_state( layer, parent_index ) == ASL_CLOSED ) {
             continue;
         }
 
         if( layer.gscore[parent_index] > max_length ) {
             // Shortest path would be too long, return empty vector
-            return std::vector<tripoint>();
+            break;
         }
 
         if( cur == t ) {
@@ -254,11 +461,36 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             break;
         }
 
-        cur_state = ASL_CLOSED;
+        pf.set_state( layer, parent_index, ASL_CLOSED );
 
         const auto &pf_cache = get_pathfinding_cache_ref( cur.z );
         const pf_special cur_special = pf_cache.special[cur.x][cur.y];
 
+        // Jump straight to the target when the remaining line is all
+        // boring flat terrain, instead of expanding it tile by tile.
+        // In an open field the search ends here on the first pop.
+        if( cur.z == t.z && !( cur_special & non_normal ) ) {
+            const std::vector<tripoint> line_path = line_to( cur, t );
+            bool clear = layer.gscore[parent_index] +
+                         2 * static_cast<int>( line_path.size() ) <= max_length;
+            for( const tripoint &lp : line_path ) {
+                if( !clear ) {
+                    break;
+                }
+                clear = !( pf_cache.special[lp.x][lp.y] & non_normal ) &&
+                        ( lp == t || pre_closed.count( lp ) == 0 );
+            }
+            if( clear ) {
+                tripoint prev = cur;
+                for( const tripoint &lp : line_path ) {
+                    pf.get_layer( lp.z ).parent[flat_index( lp.xy() )] = prev;
+                    prev = lp;
+                }
+                done = true;
+                break;
+            }
+        }
+
         // 7 3 5
         // 1 . 2
         // 6 4 8
@@ -273,7 +505,12 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                 continue;
             }
 
-            if( layer.state[index] == ASL_CLOSED ) {
+            if( corridor != nullptr && !corridor->test( p.x / SEEX + ( p.y / SEEY ) * MAPSIZE ) ) {
+                // Outside the hierarchical corridor
+                continue;
+            }
+
+            if( pf.get_state( layer, index ) == ASL_CLOSED ) {
                 continue;
             }
 
@@ -287,7 +524,24 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                 newg += 2;
             } else {
                 if( roughavoid ) {
-                    layer.state[index] = ASL_CLOSED; // Close all rough terrain tiles
+                    // Close all rough terrain tiles
+                    pf.set_state( layer, index, ASL_CLOSED );
+                    continue;
+                }
+
+                if( !( p_special & ( PF_WALL | PF_TRAP ) ) ) {
+                    // Slow but passable and safe (underbrush, rubble, shallow
+                    // water...): the packed cost byte is all we need, no
+                    // point resolving terrain, furniture and vehicle parts.
+                    newg += pf_cache.move_cost[p.x][p.y];
+
+                    if( sharpavoid && p_special & PF_SHARP ) {
+                        pf.set_state( layer, index, ASL_CLOSED ); // Avoid sharp things
+                    }
+
+                    if( pf.get_state( layer, index ) == ASL_NONE || newg < layer.gscore[index] ) {
+                        pf.add_point( newg, newg + 2 * rl_dist( p, t ), cur, p );
+                    }
                     continue;
                 }
 
@@ -305,7 +559,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
 
                 if( cost == 0 && rating <= 0 && ( !doors || !terrain.open || !furniture.open ) && veh == nullptr &&
                     climb_cost <= 0 ) {
-                    layer.state[index] = ASL_CLOSED; // Close it so that next time we won't try to calculate costs
+                    // Close it so that next time we won't try to calculate costs
+                    pf.set_state( layer, index, ASL_CLOSED );
                     continue;
                 }
 
@@ -336,7 +591,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                             int hp = veh->part( part ).hp();
                             if( hp / 20 > bash ) {
                                 // Threshold damage thing means we just can't bash this down
-                                layer.state[index] = ASL_CLOSED;
+                                pf.set_state( layer, index, ASL_CLOSED );
                                 continue;
                             } else if( hp / 10 > bash ) {
                                 // Threshold damage thing means we will fail to deal damage pretty often
@@ -347,7 +602,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                         } else if( part >= 0 ) {
                             if( !doors || !veh->part_flag( part, VPFLAG_OPENABLE ) ) {
                                 // Won't be openable, don't try from other sides
-                                layer.state[index] = ASL_CLOSED;
+                                pf.set_state( layer, index, ASL_CLOSED );
                             }
 
                             continue;
@@ -363,7 +618,7 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                         // Unbashable and unopenable from here
                         if( !doors || !terrain.open || !furniture.open ) {
                             // Or anywhere else for that matter
-                            layer.state[index] = ASL_CLOSED;
+                            pf.set_state( layer, index, ASL_CLOSED );
                         }
 
                         continue;
@@ -384,13 +639,13 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                     // Otherwise this would have been a huge fall
                                     auto &layer = pf.get_layer( p.z - 1 );
                                     // From cur, not p, because we won't be walking on air
-                                    pf.add_point( layer.gscore[parent_index] + 10,
-                                                  layer.score[parent_index] + 10 + 2 * rl_dist( below, t ),
+                                    pf.add_point( pf.get_gscore( layer, parent_index ) + 10,
+                                                  pf.get_score( layer, parent_index ) + 10 + 2 * rl_dist( below, t ),
                                                   cur, below );
                                 }
 
                                 // Close p, because we won't be walking on it
-                                layer.state[index] = ASL_CLOSED;
+                                pf.set_state( layer, index, ASL_CLOSED );
                                 continue;
                             }
                         } else if( trapavoid ) {
@@ -401,14 +656,14 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                 }
 
                 if( sharpavoid && p_special & PF_SHARP ) {
-                    layer.state[index] = ASL_CLOSED; // Avoid sharp things
+                    pf.set_state( layer, index, ASL_CLOSED ); // Avoid sharp things
                 }
 
             }
 
             // If not visited, add as open
             // If visited, add it only if we can do so with better score
-            if( layer.state[index] == ASL_NONE || newg < layer.gscore[index] ) {
+            if( pf.get_state( layer, index ) == ASL_NONE || newg < layer.gscore[index] ) {
                 pf.add_point( newg, newg + 2 * rl_dist( p, t ), cur, p );
             }
         }
@@ -425,8 +680,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             tripoint dest( cur.xy(), cur.z - 1 );
             if( vertical_move_destination( *this, ter_furn_flag::TFLAG_GOES_UP, dest ) ) {
                 auto &layer = pf.get_layer( dest.z );
-                pf.add_point( layer.gscore[parent_index] + 2,
-                              layer.score[parent_index] + 2 * rl_dist( dest, t ),
+                pf.add_point( pf.get_gscore( layer, parent_index ) + 2,
+                              pf.get_score( layer, parent_index ) + 2 * rl_dist( dest, t ),
                               cur, dest );
             }
         }
@@ -435,8 +690,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             tripoint dest( cur.xy(), cur.z + 1 );
             if( vertical_move_destination( *this, ter_furn_flag::TFLAG_GOES_DOWN, dest ) ) {
                 auto &layer = pf.get_layer( dest.z );
-                pf.add_point( layer.gscore[parent_index] + 2,
-                              layer.score[parent_index] + 2 * rl_dist( dest, t ),
+                pf.add_point( pf.get_gscore( layer, parent_index ) + 2,
+                              pf.get_score( layer, parent_index ) + 2 * rl_dist( dest, t ),
                               cur, dest );
             }
         }
@@ -445,8 +700,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             auto &layer = pf.get_layer( cur.z + 1 );
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint above( cur.x + x_offset[it], cur.y + y_offset[it], cur.z + 1 );
-                pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( above, t ),
+                pf.add_point( pf.get_gscore( layer, parent_index ) + 4,
+                              pf.get_score( layer, parent_index ) + 4 + 2 * rl_dist( above, t ),
                               cur, above );
             }
         }
@@ -455,8 +710,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             auto &layer = pf.get_layer( cur.z + 1 );
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint above( cur.x + x_offset[it], cur.y + y_offset[it], cur.z + 1 );
-                pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( above, t ),
+                pf.add_point( pf.get_gscore( layer, parent_index ) + 4,
+                              pf.get_score( layer, parent_index ) + 4 + 2 * rl_dist( above, t ),
                               cur, above );
             }
         }
@@ -465,8 +720,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             auto &layer = pf.get_layer( cur.z - 1 );
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint below( cur.x + x_offset[it], cur.y + y_offset[it], cur.z - 1 );
-                pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( below, t ),
+                pf.add_point( pf.get_gscore( layer, parent_index ) + 4,
+                              pf.get_score( layer, parent_index ) + 4 + 2 * rl_dist( below, t ),
                               cur, below );
             }
         }
@@ -502,3 +757,157 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
 
     return ret;
 }
+
+int flow_field_settings_key( const pathfinding_settings &settings )
+{
+    return ( settings.avoid_traps ? 1 : 0 ) |
+           ( settings.avoid_rough_terrain ? 2 : 0 ) |
+           ( settings.avoid_sharp ? 4 : 0 );
+}
+
+// Move cost of a tile for the purposes of a shared flow field, or 0 if
+// impassable. Deliberately conservative compared to route(): anything a
+// monster could only get through by bashing or opening counts as a wall
+// here, and the A* fallback handles those cases.
+static int flow_field_move_cost( const pf_special p, const int settings_key )
+{
+    if( p & ( PF_WALL | PF_FIELD ) ) {
+        return 0;
+    }
+    if( ( settings_key & 1 ) && ( p & PF_TRAP ) ) {
+        return 0;
+    }
+    if( ( settings_key & 4 ) && ( p & PF_SHARP ) ) {
+        return 0;
+    }
+    if( p & PF_SLOW ) {
+        return ( settings_key & 2 ) ? 0 : 4;
+    }
+    return 2;
+}
+
+static void build_flow_field( flow_field &field, const pathfinding_cache &pf_cache,
+                              const tripoint &goal, const int settings_key )
+{
+    field.goal = goal;
+    field.settings_key = settings_key;
+    field.cache_generation = pf_cache.generation;
+    std::memset( field.cost, 0, sizeof( field.cost ) );
+
+    // Plain Dijkstra from the goal outwards. Nodes carry (cost, flat
+    // index); stale queue entries are skipped on pop.
+    using ff_node = std::pair<int, int>;
+    std::priority_queue<ff_node, std::vector<ff_node>, std::greater<ff_node>> open;
+
+    // Costs are offset by one so that 0 can mean "unreached". The goal
+    // tile itself is always seeded, even if impassable (e.g. the player
+    // inside a vehicle), so that attackers can approach to adjacency.
+    field.cost[goal.x][goal.y] = 1;
+    open.emplace( 1, flat_index( goal.xy() ) );
+
+    while( !open.empty() ) {
+        const int cur_cost = open.top().first;
+        const int cur_index = open.top().second;
+        open.pop();
+        const point cur( cur_index / MAPSIZE_Y, cur_index % MAPSIZE_Y );
+        if( field.cost[cur.x][cur.y] != cur_cost ) {
+            // Superseded by a cheaper path.
+            continue;
+        }
+        for( const tripoint &dir : eight_horizontal_neighbors ) {
+            const point next = cur + dir.xy();
+            if( next.x < 0 || next.x >= MAPSIZE_X || next.y < 0 || next.y >= MAPSIZE_Y ) {
+                continue;
+            }
+            const int step = flow_field_move_cost( pf_cache.special[next.x][next.y], settings_key );
+            if( step == 0 ) {
+                continue;
+            }
+            const int new_cost = cur_cost + step;
+            if( new_cost > std::numeric_limits<uint16_t>::max() ) {
+                continue;
+            }
+            uint16_t &slot = field.cost[next.x][next.y];
+            if( slot == 0 || new_cost < slot ) {
+                slot = new_cost;
+                open.emplace( new_cost, flat_index( next ) );
+            }
+        }
+    }
+}
+
+std::vector<tripoint> map::route_via_flow_field( const tripoint &f, const tripoint &t,
+        const pathfinding_settings &settings ) const
+{
+    std::vector<tripoint> ret;
+    // Flow fields cover a single z-level of the reality bubble.
+    if( f == t || f.z != t.z || !inbounds( f ) || !inbounds( t ) ) {
+        return ret;
+    }
+
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( t.z );
+    const int settings_key = flow_field_settings_key( settings );
+
+    flow_field *field = nullptr;
+    for( auto iter = flow_fields.begin(); iter != flow_fields.end(); ++iter ) {
+        if( ( *iter )->goal == t && ( *iter )->settings_key == settings_key &&
+            ( *iter )->cache_generation == pf_cache.generation ) {
+            // Keep the list in most-recently-used order.
+            std::rotate( flow_fields.begin(), iter, iter + 1 );
+            field = flow_fields.front().get();
+            break;
+        }
+    }
+
+    if( field == nullptr ) {
+        static constexpr size_t max_flow_fields = 4;
+        if( flow_fields.size() >= max_flow_fields ) {
+            flow_fields.pop_back();
+        }
+        flow_fields.insert( flow_fields.begin(), std::make_unique<flow_field>() );
+        field = flow_fields.front().get();
+        build_flow_field( *field, pf_cache, t, settings_key );
+    }
+
+    if( field->cost[f.x][f.y] == 0 ) {
+        // Not reachable without bashing/opening something; let the
+        // caller fall back to a full A* search.
+        return ret;
+    }
+
+    // Greedy descent: each step moves to the cheapest cheaper neighbor,
+    // so this terminates at the goal after at most cost/2 steps.
+    tripoint cur = f;
+    uint16_t cur_cost = field->cost[f.x][f.y];
+    const size_t max_length = settings.max_length > 0 ?
+                              static_cast<size_t>( settings.max_length ) : MAPSIZE_X;
+    while( cur != t && ret.size() < max_length ) {
+        point best;
+        uint16_t best_cost = cur_cost;
+        for( const tripoint &dir : eight_horizontal_neighbors ) {
+            const point next = cur.xy() + dir.xy();
+            if( next.x < 0 || next.x >= MAPSIZE_X || next.y < 0 || next.y >= MAPSIZE_Y ) {
+                continue;
+            }
+            const uint16_t next_cost = field->cost[next.x][next.y];
+            if( next_cost != 0 && next_cost < best_cost ) {
+                best_cost = next_cost;
+                best = next;
+            }
+        }
+        if( best_cost == cur_cost ) {
+            // Stuck in a local minimum; should not happen on a
+            // consistent field, but bail out rather than loop.
+            return std::vector<tripoint>();
+        }
+        cur = tripoint( best, t.z );
+        cur_cost = best_cost;
+        ret.push_back( cur );
+    }
+
+    if( cur != t ) {
+        return std::vector<tripoint>();
+    }
+
+    return ret;
+}
@@ -2,7 +2,12 @@
 #ifndef CATA_SRC_PATHFINDING_H
 #define CATA_SRC_PATHFINDING_H
 
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
 #include "game_constants.h"
+#include "point.h"
 
 enum pf_special : int {
     PF_NORMAL = 0x00,    // Plain boring tile (grass, dirt, floor etc.)
@@ -42,9 +47,22 @@ struct pathfinding_cache {
     pathfinding_cache();
     ~pathfinding_cache();
 
+    // Whole level needs a rebuild (terrain replaced wholesale, shift).
     bool dirty = false;
+    // Submaps needing a rebuild after a local mutation (a tile changed,
+    // a dangerous field spawned). Refreshing just these keeps a burning
+    // building from forcing full-level rebuilds on every route call.
+    std::bitset<MAPSIZE *MAPSIZE> dirty_submaps;
+    // Bumped on every rebuild, so structures derived from this cache
+    // (e.g. flow fields) can tell that their input changed.
+    int generation = 0;
 
     pf_special special[MAPSIZE_X][MAPSIZE_Y];
+    // Packed terrain+furniture+field+vehicle move cost, clamped to 255;
+    // 0 on impassable tiles (PF_WALL). Kept current by the same dirty
+    // tracking as `special`, so slow-but-safe tiles can be costed from
+    // one byte without resolving the tile objects.
+    uint8_t move_cost[MAPSIZE_X][MAPSIZE_Y];
 };
 
 struct pathfinding_settings {
@@ -72,6 +90,88 @@ struct pathfinding_settings {
           avoid_sharp( as ) {}
 
     pathfinding_settings &operator=( const pathfinding_settings & ) = default;
+
+    bool operator==( const pathfinding_settings &rhs ) const {
+        return bash_strength == rhs.bash_strength && max_dist == rhs.max_dist &&
+               max_length == rhs.max_length && climb_cost == rhs.climb_cost &&
+               allow_open_doors == rhs.allow_open_doors && avoid_traps == rhs.avoid_traps &&
+               allow_climb_stairs == rhs.allow_climb_stairs &&
+               avoid_rough_terrain == rhs.avoid_rough_terrain && avoid_sharp == rhs.avoid_sharp;
+    }
+};
+
+/**
+ * A shared, goal-centric Dijkstra map over one z-level. Built once per
+ * (goal, traversal class) and then consumed by every monster heading
+ * for the same goal with O(path length) lookups, instead of each of
+ * them running its own A*. See map::route_via_flow_field.
+ */
+struct flow_field {
+    // The tile the costs descend toward, in map-local coordinates.
+    tripoint goal = tripoint_min;
+    // Traversal class of the settings this was built for; see
+    // flow_field_settings_key.
+    int settings_key = -1;
+    // pathfinding_cache::generation this was built from.
+    int cache_generation = -1;
+    // Accumulated move cost to reach the goal, offset by one;
+    // 0 means unvisited or unreachable.
+    uint16_t cost[MAPSIZE_X][MAPSIZE_Y];
+};
+
+// The traversal aspects of the settings a flow field can honor.
+// Settings that only differ outside of these share one field.
+int flow_field_settings_key( const pathfinding_settings &settings );
+
+/**
+ * Connectivity between horizontally adjacent submaps of one z-level,
+ * derived from the pathfinding cache: two submaps connect when at least
+ * one pair of facing border tiles is passable on both sides. Closed
+ * doors count as walls here, so this is conservative; map::route uses
+ * it to prune long same-z searches and falls back to the flat search
+ * when the coarse graph finds no route.
+ */
+struct submap_connectivity {
+    // Bits; a submap's connections entry has the bit set when the edge
+    // towards that neighbor is passable.
+    static constexpr uint8_t CONN_NORTH = 1;
+    static constexpr uint8_t CONN_SOUTH = 2;
+    static constexpr uint8_t CONN_WEST = 4;
+    static constexpr uint8_t CONN_EAST = 8;
+
+    // pathfinding_cache::generation this was built from.
+    int cache_generation = -1;
+    uint8_t connections[MAPSIZE][MAPSIZE];
+};
+
+// Key for the lru_cache of recent route() results kept by map.
+struct route_cache_key {
+    tripoint from = tripoint_min;
+    tripoint to = tripoint_min;
+    pathfinding_settings settings;
+
+    bool operator==( const route_cache_key &rhs ) const {
+        return from == rhs.from && to == rhs.to && settings == rhs.settings;
+    }
+};
+
+// A cached route() result, valid only while the pathfinding cache
+// generation it was computed under is still current.
+struct route_cache_entry {
+    int cache_generation = -1;
+    std::vector<tripoint> path;
+};
+
+namespace std
+{
+template <>
+struct hash<route_cache_key> {
+    std::size_t operator()( const route_cache_key &key ) const {
+        // Settings are deliberately left out of the hash; queries for
+        // the same endpoints with different settings just collide.
+        return hash<tripoint>()( key.from ) ^ ( hash<tripoint>()( key.to ) << 1 );
+    }
 };
+} // namespace std
 
 #endif // CATA_SRC_PATHFINDING_H
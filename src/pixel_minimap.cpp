@@ -357,6 +357,21 @@ pixel_minimap::submap_cache &pixel_minimap::get_cache_at( const tripoint &abs_sm
 
 void pixel_minimap::process_cache( const tripoint &center )
 {
+    // Scanning every submap recomputes the color of ~17k tiles. The colors
+    // depend on the visibility cache, which is only rebuilt when the turn
+    // advances or the player moves, so identical frames reuse the chunk
+    // textures as they are.
+    const tripoint player_pos = get_player_character().pos();
+    const bool nv_goggle = get_player_character().get_vision_modes()[NV_GOGGLES];
+    const tripoint center_sm = get_map().get_abs_sub() + ms_to_sm_copy( center );
+    if( !cache.empty() && scanned_turn == calendar::turn && scanned_pos == player_pos &&
+        scanned_nv_goggle == nv_goggle && cached_center_sm == center_sm ) {
+        return;
+    }
+    scanned_turn = calendar::turn;
+    scanned_pos = player_pos;
+    scanned_nv_goggle = nv_goggle;
+
     prepare_cache_for_updates( center );
 
     for( int y = 0; y < MAPSIZE; ++y ) {
@@ -429,6 +444,7 @@ void pixel_minimap::reset()
     cache.clear();
     main_tex.reset();
     tex_pool.reset();
+    scanned_turn = calendar::before_time_starts;
 }
 
 void pixel_minimap::render( const tripoint &center )
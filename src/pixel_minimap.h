@@ -5,6 +5,7 @@
 #include <map>
 #include <memory>
 
+#include "calendar.h"
 #include "point.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
@@ -77,6 +78,13 @@ class pixel_minimap
         //track the previous viewing area to determine if the minimap cache needs to be cleared
         tripoint cached_center_sm;
 
+        // Inputs of the last per-tile color scan. Terrain colors only change
+        // when one of these does, so matching frames skip the scan entirely;
+        // the creature beacons are still animated every frame.
+        time_point scanned_turn = calendar::before_time_starts;
+        tripoint scanned_pos;
+        bool scanned_nv_goggle = false;
+
         SDL_Rect screen_rect;
         SDL_Rect main_tex_clip_rect;
         SDL_Rect screen_clip_rect;
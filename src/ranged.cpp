@@ -128,6 +128,15 @@ static int time_to_attack( const Character &p, const itype &firing );
 static void cycle_action( item &weap, const itype_id &ammo, const tripoint &pos );
 static void make_gun_sound_effect( const Character &p, bool burst, item *weapon );
 
+// Numbers behind one row of the aim confidence panel. Computing these
+// (aim time simulation, hit confidence) dwarfs the cost of printing
+// them, so target_ui caches them between redraws.
+struct ranged_chance_line {
+    aim_type type;
+    int moves_to_fire = 0;
+    double confidence = 0.0;
+};
+
 class target_ui
 {
     public:
@@ -237,6 +246,26 @@ class target_ui
         // relative to the current one.
         double predicted_recoil = 0;
 
+        // Cached numbers for panel_fire_mode_aim. The panel redraws on
+        // every input event, including ones that change nothing about the
+        // shot, so the dispersion/aim-time/confidence math is keyed on
+        // the state it was computed from and reused until that changes.
+        struct {
+            bool valid = false;
+            // State the cached numbers were computed from.
+            double recoil = 0.0;
+            double predicted_recoil = 0.0;
+            tripoint dst;
+            double target_size = 0.0;
+            const item *gun = nullptr;
+            int threshold = 0;
+            // Cached results.
+            double panel_predicted_recoil = 0.0;
+            int predicted_delay = 0;
+            double steadiness = 0.0;
+            std::vector<ranged_chance_line> lines;
+        } aim_cache;
+
         // For AOE spells, list of tiles affected by the spell
         // relevant for TargetMode::Spell
         std::set<tripoint> spell_aoe;
@@ -364,6 +393,9 @@ class target_ui
         void panel_spell_info( int &text_y );
         void panel_target_info( int &text_y, bool fill_with_blank_if_no_target );
         void panel_fire_mode_aim( int &text_y );
+        // Recompute aim_cache if the state the fire-mode aim panel
+        // depends on changed since the last redraw.
+        void refresh_aim_cache( const item &gun, double target_size );
         void panel_turret_list( int &text_y );
 
         // On-selected-as-target checks that act as if they are on-hit checks.
@@ -1356,10 +1388,47 @@ static std::string get_colored_bar( const double val, const int width, const std
     return result;
 }
 
-static int print_ranged_chance( const Character &you, const catacurses::window &w, int line_number,
-                                target_ui::TargetMode mode, input_context &ctxt, const item &ranged_weapon,
-                                const dispersion_sources &dispersion, const std::vector<confidence_rating> &confidence_config,
-                                double range, double target_size, int recoil = 0 )
+static std::vector<ranged_chance_line> compute_ranged_chances(
+    const Character &you, target_ui::TargetMode mode, const item &ranged_weapon,
+    const dispersion_sources &dispersion, double range, double target_size, int recoil = 0 )
+{
+    std::vector<aim_type> aim_types;
+    if( mode == target_ui::TargetMode::Throw || mode == target_ui::TargetMode::ThrowBlind ) {
+        aim_types = get_default_aim_type();
+    } else {
+        aim_types = you.get_aim_types( ranged_weapon );
+    }
+
+    std::vector<ranged_chance_line> lines;
+    lines.reserve( aim_types.size() );
+    for( const aim_type &type : aim_types ) {
+        dispersion_sources current_dispersion = dispersion;
+        int threshold = MAX_RECOIL;
+        if( type.has_threshold ) {
+            threshold = type.threshold;
+            current_dispersion.add_range( threshold );
+        } else {
+            current_dispersion.add_range( recoil );
+        }
+
+        ranged_chance_line line;
+        line.type = type;
+        if( mode == target_ui::TargetMode::Throw || mode == target_ui::TargetMode::ThrowBlind ) {
+            line.moves_to_fire = throw_cost( you, ranged_weapon );
+        } else {
+            line.moves_to_fire = you.gun_engagement_moves( ranged_weapon, threshold, recoil ) +
+                                 time_to_attack( you, *ranged_weapon.type );
+        }
+        line.confidence = confidence_estimate( range, target_size, current_dispersion );
+        lines.push_back( line );
+    }
+    return lines;
+}
+
+static int print_ranged_chance( const catacurses::window &w, int line_number,
+                                input_context &ctxt,
+                                const std::vector<confidence_rating> &confidence_config,
+                                const std::vector<ranged_chance_line> &lines )
 {
     int window_width = getmaxx( w ) - 2; // Window width minus borders.
     std::string display_type = get_option<std::string>( "ACCURACY_DISPLAY" );
@@ -1377,13 +1446,6 @@ static int print_ranged_chance( const Character &you, const catacurses::window &
 
     nc_color col = c_dark_gray;
 
-    std::vector<aim_type> aim_types;
-    if( mode == target_ui::TargetMode::Throw || mode == target_ui::TargetMode::ThrowBlind ) {
-        aim_types = get_default_aim_type();
-    } else {
-        aim_types = you.get_aim_types( ranged_weapon );
-    }
-
     if( display_type != "numbers" ) {
         int column_number = 1;
         if( !( panel_type == "compact" || panel_type == "labels-narrow" ) ) {
@@ -1424,26 +1486,15 @@ static int print_ranged_chance( const Character &you, const catacurses::window &
         return keys.empty() ? fallback : keys.front();
     };
 
-    for( const aim_type &type : aim_types ) {
-        dispersion_sources current_dispersion = dispersion;
-        int threshold = MAX_RECOIL;
+    for( const ranged_chance_line &chance_line : lines ) {
+        const aim_type &type = chance_line.type;
         std::string label = _( "Current" );
         std::string aim_l = _( "Aim" );
         if( type.has_threshold ) {
             label = type.name;
-            threshold = type.threshold;
-            current_dispersion.add_range( threshold );
-        } else {
-            current_dispersion.add_range( recoil );
         }
 
-        int moves_to_fire;
-        if( mode == target_ui::TargetMode::Throw || mode == target_ui::TargetMode::ThrowBlind ) {
-            moves_to_fire = throw_cost( you, ranged_weapon );
-        } else {
-            moves_to_fire = you.gun_engagement_moves( ranged_weapon, threshold, recoil ) + time_to_attack( you,
-                            *ranged_weapon.type );
-        }
+        const int moves_to_fire = chance_line.moves_to_fire;
 
         const input_event hotkey = front_or( type.action.empty() ? "FIRE" : type.action, input_event() );
         if( ( panel_type == "compact" || panel_type == "labels-narrow" ) ) {
@@ -1463,7 +1514,7 @@ static int print_ranged_chance( const Character &you, const catacurses::window &
                                                hotkey.short_description(), label, aim_l, moves_to_fire ) );
         }
 
-        double confidence = confidence_estimate( range, target_size, current_dispersion );
+        const double confidence = chance_line.confidence;
 
         if( display_type == "numbers" ) {
             if( panel_type == "compact" || panel_type == "labels-narrow" ) {
@@ -1549,29 +1600,9 @@ static double calculate_aim_cap( const Character &you, const tripoint &target )
     return min_recoil;
 }
 
-static int print_aim( const Character &you, const catacurses::window &w, int line_number,
-                      input_context &ctxt, item *weapon,
-                      const double target_size, const tripoint &pos, double predicted_recoil )
+static int print_aim( const catacurses::window &w, int line_number, input_context &ctxt,
+                      double steadiness, const std::vector<ranged_chance_line> &lines )
 {
-    // This is absolute accuracy for the player.
-    // TODO: push the calculations duplicated from Creature::deal_projectile_attack() and
-    // Creature::projectile_attack() into shared methods.
-    // Dodge doesn't affect gun attacks
-
-    dispersion_sources dispersion = you.get_weapon_dispersion( *weapon );
-    dispersion.add_range( you.recoil_vehicle() );
-
-    const double min_recoil = calculate_aim_cap( you, pos );
-    const double effective_recoil = you.effective_dispersion(
-                                        you.get_wielded_item().sight_dispersion() );
-    const double min_dispersion = std::max( min_recoil, effective_recoil );
-    const double steadiness_range = MAX_RECOIL - min_dispersion;
-    // This is a relative measure of how steady the player's aim is,
-    // 0 is the best the player can do.
-    const double steady_score = std::max( 0.0, predicted_recoil - min_dispersion );
-    // Fairly arbitrary cap on steadiness...
-    const double steadiness = 1.0 - ( steady_score / steadiness_range );
-
     // This could be extracted, to allow more/less verbose displays
     static const std::vector<confidence_rating> confidence_config = {{
             { accuracy_critical, '*', "green", translate_marker_context( "aim_confidence", "Great" ) },
@@ -1580,12 +1611,8 @@ static int print_aim( const Character &you, const catacurses::window &w, int lin
         }
     };
 
-    const double range = rl_dist( you.pos(), pos );
     line_number = print_steadiness( w, line_number, steadiness );
-    return print_ranged_chance( you, w, line_number, target_ui::TargetMode::Fire, ctxt, *weapon,
-                                dispersion,
-                                confidence_config,
-                                range, target_size, predicted_recoil );
+    return print_ranged_chance( w, line_number, ctxt, confidence_config, lines );
 }
 
 static void draw_throw_aim( const Character &you, const catacurses::window &w, int &text_y,
@@ -1618,9 +1645,9 @@ static void draw_throw_aim( const Character &you, const catacurses::window &w, i
     const target_ui::TargetMode throwing_target_mode = is_blind_throw ?
             target_ui::TargetMode::ThrowBlind :
             target_ui::TargetMode::Throw;
-    text_y = print_ranged_chance( you, w, text_y, throwing_target_mode, ctxt, weapon, dispersion,
-                                  confidence_config,
-                                  range, target_size );
+    const std::vector<ranged_chance_line> lines = compute_ranged_chances( you, throwing_target_mode,
+            weapon, dispersion, range, target_size );
+    text_y = print_ranged_chance( w, text_y, ctxt, confidence_config, lines );
 }
 
 std::vector<aim_type> Character::get_aim_types( const item &gun ) const
@@ -3479,37 +3506,83 @@ void target_ui::panel_target_info( int &text_y, bool fill_with_blank_if_no_targe
 
 void target_ui::panel_fire_mode_aim( int &text_y )
 {
+    const double target_size = dst_critter ? dst_critter->ranged_target_size() :
+                               occupied_tile_fraction( creature_size::medium );
+
+    refresh_aim_cache( *relevant->gun_current_mode(), target_size );
+
+    text_y = print_aim( w_target, text_y, ctxt, aim_cache.steadiness, aim_cache.lines );
+
+    if( aim_mode->has_threshold ) {
+        mvwprintw( w_target, point( 1, text_y++ ), _( "%s Delay: %i" ), aim_mode->name,
+                   aim_cache.predicted_delay );
+    }
+}
+
+void target_ui::refresh_aim_cache( const item &gun, double target_size )
+{
+    const int threshold = aim_mode->has_threshold ? aim_mode->threshold : -1;
+    if( aim_cache.valid && aim_cache.recoil == you->recoil &&
+        aim_cache.predicted_recoil == predicted_recoil && aim_cache.dst == dst &&
+        aim_cache.target_size == target_size && aim_cache.gun == &gun &&
+        aim_cache.threshold == threshold ) {
+        return;
+    }
+
     // TODO: saving & restoring pc.recoil may actually be unnecessary
     double saved_pc_recoil = you->recoil;
     you->recoil = predicted_recoil;
 
-    double predicted_recoil = you->recoil;
+    double panel_recoil = you->recoil;
     int predicted_delay = 0;
     if( aim_mode->has_threshold && aim_mode->threshold < you->recoil ) {
         do {
-            const double aim_amount = you->aim_per_move( *relevant, predicted_recoil );
+            const double aim_amount = you->aim_per_move( *relevant, panel_recoil );
             if( aim_amount > 0 ) {
                 predicted_delay++;
-                predicted_recoil = std::max( predicted_recoil - aim_amount, 0.0 );
+                panel_recoil = std::max( panel_recoil - aim_amount, 0.0 );
             }
-        } while( predicted_recoil > aim_mode->threshold &&
-                 predicted_recoil - sight_dispersion > 0 );
+        } while( panel_recoil > aim_mode->threshold &&
+                 panel_recoil - sight_dispersion > 0 );
     } else {
-        predicted_recoil = you->recoil;
+        panel_recoil = you->recoil;
     }
 
-    const double target_size = dst_critter ? dst_critter->ranged_target_size() :
-                               occupied_tile_fraction( creature_size::medium );
+    // This is absolute accuracy for the player.
+    // TODO: push the calculations duplicated from Creature::deal_projectile_attack() and
+    // Creature::projectile_attack() into shared methods.
+    // Dodge doesn't affect gun attacks
 
-    text_y = print_aim( *you, w_target, text_y, ctxt, &*relevant->gun_current_mode(),
-                        target_size, dst, predicted_recoil );
+    dispersion_sources dispersion = you->get_weapon_dispersion( gun );
+    dispersion.add_range( you->recoil_vehicle() );
 
-    if( aim_mode->has_threshold ) {
-        mvwprintw( w_target, point( 1, text_y++ ), _( "%s Delay: %i" ), aim_mode->name,
-                   predicted_delay );
-    }
+    const double min_recoil = calculate_aim_cap( *you, dst );
+    const double effective_recoil = you->effective_dispersion(
+                                        you->get_wielded_item().sight_dispersion() );
+    const double min_dispersion = std::max( min_recoil, effective_recoil );
+    const double steadiness_range = MAX_RECOIL - min_dispersion;
+    // This is a relative measure of how steady the player's aim is,
+    // 0 is the best the player can do.
+    const double steady_score = std::max( 0.0, panel_recoil - min_dispersion );
+
+    const double range_to_target = rl_dist( you->pos(), dst );
+
+    aim_cache.panel_predicted_recoil = panel_recoil;
+    aim_cache.predicted_delay = predicted_delay;
+    // Fairly arbitrary cap on steadiness...
+    aim_cache.steadiness = 1.0 - ( steady_score / steadiness_range );
+    aim_cache.lines = compute_ranged_chances( *you, TargetMode::Fire, gun, dispersion,
+                      range_to_target, target_size, panel_recoil );
 
     you->recoil = saved_pc_recoil;
+
+    aim_cache.valid = true;
+    aim_cache.recoil = you->recoil;
+    aim_cache.predicted_recoil = predicted_recoil;
+    aim_cache.dst = dst;
+    aim_cache.target_size = target_size;
+    aim_cache.gun = &gun;
+    aim_cache.threshold = threshold;
 }
 
 void target_ui::panel_turret_list( int &text_y )
@@ -271,7 +271,7 @@ bool reachability_cache_specialization<true, level_cache>::test( int d, int cach
 bool reachability_cache_specialization<false, level_cache, level_cache>::source_cache_dirty(
     const level_cache &this_lc, const level_cache &floor_lc )
 {
-    return floor_lc.floor_cache_dirty || this_lc.transparency_cache_dirty.any();
+    return floor_lc.floor_cache_dirty.any() || this_lc.transparency_cache_dirty.any();
 }
 
 bool reachability_cache_specialization<true, level_cache>::source_cache_dirty(
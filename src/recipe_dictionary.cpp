@@ -559,6 +559,67 @@ void recipe_dictionary::finalize()
     }
 
     recipe_dict.find_items_on_loops();
+    recipe_dict.build_component_indices();
+}
+
+void recipe_dictionary::build_component_indices()
+{
+    recipes_by_component.clear();
+    recipes_by_quality.clear();
+    perishable_component_recipes.clear();
+
+    for( const auto &e : recipes ) {
+        const recipe &r = e.second;
+        if( r.obsolete ) {
+            continue;
+        }
+        const requirement_data &reqs = r.simple_requirements();
+        for( const std::vector<item_comp> &group : reqs.get_components() ) {
+            for( const item_comp &comp : group ) {
+                std::vector<const recipe *> &vec = recipes_by_component[comp.type];
+                // recipes are processed one at a time, so duplicates are adjacent
+                if( vec.empty() || vec.back() != &r ) {
+                    vec.push_back( &r );
+                }
+                const itype *t = item::find_type( comp.type );
+                if( t->comestible && t->comestible->spoils != 0_turns ) {
+                    perishable_component_recipes.insert( &r );
+                }
+            }
+        }
+        for( const std::vector<tool_comp> &group : reqs.get_tools() ) {
+            for( const tool_comp &tool : group ) {
+                std::vector<const recipe *> &vec = recipes_by_component[tool.type];
+                if( vec.empty() || vec.back() != &r ) {
+                    vec.push_back( &r );
+                }
+            }
+        }
+        for( const std::vector<quality_requirement> &group : reqs.get_qualities() ) {
+            for( const quality_requirement &qual : group ) {
+                std::vector<const recipe *> &vec = recipes_by_quality[qual.type];
+                if( vec.empty() || vec.back() != &r ) {
+                    vec.push_back( &r );
+                }
+            }
+        }
+    }
+}
+
+const std::vector<const recipe *> &recipe_dictionary::recipes_using_itype(
+    const itype_id &id ) const
+{
+    static const std::vector<const recipe *> null_result;
+    const auto iter = recipes_by_component.find( id );
+    return iter != recipes_by_component.end() ? iter->second : null_result;
+}
+
+const std::vector<const recipe *> &recipe_dictionary::recipes_using_quality(
+    const quality_id &id ) const
+{
+    static const std::vector<const recipe *> null_result;
+    const auto iter = recipes_by_quality.find( id );
+    return iter != recipes_by_quality.end() ? iter->second : null_result;
 }
 
 void recipe_dictionary::check_consistency()
@@ -607,6 +668,11 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    recipe_dict.recipes_by_component.clear();
+    recipe_dict.recipes_by_quality.clear();
+    recipe_dict.perishable_component_recipes.clear();
+    // cached availability entries point into the recipe map
+    reset_recipe_availability_cache();
 }
 
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
@@ -41,6 +41,20 @@ class recipe_dictionary
 
         bool is_item_on_loop( const itype_id & ) const;
 
+        /**
+         * Reverse indices from requirement inputs to the recipes using them as
+         * a component or tool, built during finalize(). They let cached
+         * per-recipe availability be invalidated for just the recipes that
+         * reference an itype or quality that changed in the crafting
+         * inventory.
+         */
+        const std::vector<const recipe *> &recipes_using_itype( const itype_id &id ) const;
+        const std::vector<const recipe *> &recipes_using_quality( const quality_id &id ) const;
+        /** Recipes with components that can rot; their availability is time dependent. */
+        const std::set<const recipe *> &recipes_with_perishable_components() const {
+            return perishable_component_recipes;
+        }
+
         /** Returns disassembly recipe (or null recipe if no match) */
         static const recipe &get_uncraft( const itype_id &id );
 
@@ -69,8 +83,13 @@ class recipe_dictionary
         std::set<const recipe *> blueprints;
         std::unordered_set<itype_id> items_on_loops;
 
+        std::unordered_map<itype_id, std::vector<const recipe *>> recipes_by_component;
+        std::map<quality_id, std::vector<const recipe *>> recipes_by_quality;
+        std::set<const recipe *> perishable_component_recipes;
+
         static void finalize_internal( std::map<recipe_id, recipe> &obj );
         void find_items_on_loops();
+        void build_component_indices();
 };
 
 extern recipe_dictionary recipe_dict;
@@ -34,6 +34,11 @@ struct recipe_group_data {
 
 generic_factory<recipe_group_data> recipe_groups_data( "recipe group type" );
 
+// Memoized get_recipes_by_bldg results. The scan over all groups repeats
+// every time a camp queries its crafting options, but the group data is
+// fixed once loading finishes.
+std::map<std::string, std::map<recipe_id, translation>> recipes_by_bldg_cache;
+
 } // namespace
 
 void recipe_group_data::load( const JsonObject &jo, const std::string & )
@@ -63,12 +68,15 @@ void recipe_group_data::check() const
 
 std::map<recipe_id, translation> recipe_group::get_recipes_by_bldg( const std::string &bldg )
 {
+    const auto cached = recipes_by_bldg_cache.find( bldg );
+    if( cached != recipes_by_bldg_cache.end() ) {
+        return cached->second;
+    }
     std::map<recipe_id, translation> all_rec;
     if( bldg == "ALL" ) {
         for( const auto &gr : recipe_groups_data.get_all() ) {
             all_rec.insert( gr.recipes.cbegin(), gr.recipes.cend() );
         }
-        return all_rec;
     } else {
         for( const auto &gr : recipe_groups_data.get_all() ) {
             if( gr.building_type != bldg ) {
@@ -76,8 +84,9 @@ std::map<recipe_id, translation> recipe_group::get_recipes_by_bldg( const std::s
             }
             all_rec.insert( gr.recipes.cbegin(), gr.recipes.cend() );
         }
-        return all_rec;
     }
+    recipes_by_bldg_cache.emplace( bldg, all_rec );
+    return all_rec;
 }
 
 std::map<recipe_id, translation> recipe_group::get_recipes_by_id( const std::string &id,
@@ -108,6 +117,7 @@ std::map<recipe_id, translation> recipe_group::get_recipes_by_id( const std::str
 void recipe_group::load( const JsonObject &jo, const std::string &src )
 {
     recipe_groups_data.load( jo, src );
+    recipes_by_bldg_cache.clear();
 }
 
 void recipe_group::check()
@@ -118,4 +128,5 @@ void recipe_group::check()
 void recipe_group::reset()
 {
     recipe_groups_data.reset();
+    recipes_by_bldg_cache.clear();
 }
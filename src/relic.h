@@ -214,7 +214,7 @@ class relic
         void add_passive_effect( const enchantment &ench );
         void add_active_effect( const fake_spell &sp );
 
-        std::vector<enchantment> get_enchantments() const;
+        const std::vector<enchantment> &get_enchantments() const;
 
         int modify_value( enchant_vals::mod value_type, int value ) const;
         void overwrite_charge( const relic_charge_info &info );
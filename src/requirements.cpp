@@ -799,6 +799,24 @@ bool requirement_data::can_make_with_inventory( const read_only_visitable &craft
     return retval;
 }
 
+bool requirement_data::has_component_types( const inventory &crafting_inv ) const
+{
+    const itype_bin &binned = crafting_inv.get_binned_items();
+    for( const std::vector<item_comp> &group : components ) {
+        bool any_candidate = false;
+        for( const item_comp &comp : group ) {
+            if( binned.count( comp.type ) ) {
+                any_candidate = true;
+                break;
+            }
+        }
+        if( !any_candidate ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename T>
 bool requirement_data::has_comps( const read_only_visitable &crafting_inv,
                                   const std::vector< std::vector<T> > &vec,
@@ -1587,8 +1605,15 @@ bool deduped_requirement_data::can_make_with_inventory(
     const read_only_visitable &crafting_inv, const std::function<bool( const item & )> &filter,
     int batch, craft_flags flags ) const
 {
+    // The alternatives repeat the same tool and quality requirements, so drop
+    // the ones whose components are not even present before paying for the
+    // full evaluation of each.
+    const inventory *inv = dynamic_cast<const inventory *>( &crafting_inv );
     return std::any_of( alternatives().begin(), alternatives().end(),
     [&]( const requirement_data & alt ) {
+        if( inv && !alt.has_component_types( *inv ) ) {
+            return false;
+        }
         return alt.can_make_with_inventory( crafting_inv, filter, batch, flags );
     } );
 }
@@ -1598,7 +1623,11 @@ std::vector<const requirement_data *> deduped_requirement_data::feasible_alterna
     int batch, craft_flags flags ) const
 {
     std::vector<const requirement_data *> result;
+    const inventory *inv = dynamic_cast<const inventory *>( &crafting_inv );
     for( const requirement_data &req : alternatives() ) {
+        if( inv && !req.has_component_types( *inv ) ) {
+            continue;
+        }
         if( req.can_make_with_inventory( crafting_inv, filter, batch, flags ) ) {
             result.push_back( &req );
         }
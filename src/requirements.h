@@ -23,6 +23,7 @@ class JsonArray;
 class JsonObject;
 class JsonOut;
 class JsonValue;
+class inventory;
 class item;
 class nc_color;
 class read_only_visitable;
@@ -342,6 +343,16 @@ struct requirement_data {
                                       const std::function<bool( const item & )> &filter, int batch = 1,
                                       craft_flags = craft_flags::none ) const;
 
+        /**
+         * Cheap necessary-condition check: true if every component group has at
+         * least one alternative whose itype occurs in the inventory at all.
+         * Ignores filters, counts and charges, so a false result proves
+         * @ref can_make_with_inventory would fail too, while a true result
+         * still requires the full evaluation. Unlike the full evaluation this
+         * does not update the availability status of the components.
+         */
+        bool has_component_types( const inventory &crafting_inv ) const;
+
         /** @param filter see @ref can_make_with_inventory */
         std::vector<std::string> get_folded_components_list( int width, nc_color col,
                 const read_only_visitable &crafting_inv, const std::function<bool( const item & )> &filter,
@@ -135,9 +135,35 @@ cata_default_random_engine &rng_get_engine()
     return eng;
 }
 
+static std::array<pcg32_engine, static_cast<size_t>( rng_stream::num_streams )> &rng_streams()
+{
+    using stream_array = std::array<pcg32_engine, static_cast<size_t>( rng_stream::num_streams )>;
+    // NOLINTNEXTLINE(cata-determinism)
+    static stream_array streams = []() {
+        stream_array s;
+        const uint64_t base = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        for( size_t i = 0; i < s.size(); ++i ) {
+            s[i].seed( base + i );
+        }
+        return s;
+    }();
+    return streams;
+}
+
+pcg32_engine &rng_get_stream( rng_stream stream )
+{
+    return rng_streams()[static_cast<size_t>( stream )];
+}
+
 void rng_set_engine_seed( unsigned int seed )
 {
     if( seed != 0 ) {
         rng_get_engine().seed( seed );
+        std::array<pcg32_engine, static_cast<size_t>( rng_stream::num_streams )> &streams =
+            rng_streams();
+        for( size_t i = 0; i < streams.size(); ++i ) {
+            // Distinct but deterministic per-stream seeds.
+            streams[i].seed( static_cast<uint64_t>( seed ) + i );
+        }
     }
 }
@@ -5,10 +5,12 @@
 #include <functional>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <random>
 #include <type_traits>
+#include <utility>
 
 #include "optional.h"
 #include "units.h"
@@ -29,6 +31,111 @@ using cata_default_random_engine = std::minstd_rand0;
 cata_default_random_engine &rng_get_engine();
 unsigned int rng_bits();
 
+/**
+ * PCG32 (O'Neill's XSH-RR variant): a small, fast engine with 64 bits of
+ * state. Satisfies UniformRandomBitGenerator, so it also works with the
+ * <random> distributions and std::shuffle, and everything is inline so
+ * draws compile down to a multiply and some shifts.
+ */
+class pcg32_engine
+{
+    public:
+        using result_type = uint32_t;
+        static constexpr result_type min() {
+            return 0;
+        }
+        static constexpr result_type max() {
+            return UINT32_MAX;
+        }
+
+        explicit pcg32_engine( uint64_t initstate = 0x853c49e6748fea9bULL ) {
+            seed( initstate );
+        }
+
+        void seed( uint64_t initstate ) {
+            state = 0u;
+            next();
+            state += initstate;
+            next();
+        }
+
+        result_type operator()() {
+            return next();
+        }
+
+        /** Unbiased draw from [0, n), n > 0; Lemire's multiply-and-reject. */
+        uint32_t bounded( uint32_t n ) {
+            uint64_t m = static_cast<uint64_t>( next() ) * n;
+            uint32_t l = static_cast<uint32_t>( m );
+            if( l < n ) {
+                const uint32_t t = -n % n;
+                while( l < t ) {
+                    m = static_cast<uint64_t>( next() ) * n;
+                    l = static_cast<uint32_t>( m );
+                }
+            }
+            return m >> 32;
+        }
+
+        /** As @ref rng( lo, hi ), on this stream and without a distribution object. */
+        int range( int lo, int hi ) {
+            if( lo > hi ) {
+                std::swap( lo, hi );
+            }
+            return lo + static_cast<int>( bounded( static_cast<uint32_t>( hi - lo ) + 1u ) );
+        }
+
+        /** As @ref rng_float( lo, hi ), on this stream. */
+        double uniform( double lo, double hi ) {
+            if( lo > hi ) {
+                std::swap( lo, hi );
+            }
+            // 2^-32; one draw gives plenty of resolution for gameplay rolls.
+            return lo + next() * 2.3283064365386963e-10 * ( hi - lo );
+        }
+
+        /** Fills [dest, dest + n) with raw 32-bit draws. */
+        void fill_bits( uint32_t *dest, size_t n ) {
+            for( size_t i = 0; i < n; ++i ) {
+                dest[i] = next();
+            }
+        }
+
+    private:
+        result_type next() {
+            const uint64_t oldstate = state;
+            state = oldstate * 6364136223846793005ULL + 1442695040888963407ULL;
+            const uint32_t xorshifted = static_cast<uint32_t>( ( ( oldstate >> 18u ) ^ oldstate ) >> 27u );
+            const uint32_t rot = static_cast<uint32_t>( oldstate >> 59u );
+            return ( xorshifted >> rot ) | ( xorshifted << ( ( 32u - rot ) & 31u ) );
+        }
+        uint64_t state;
+};
+
+/**
+ * Dedicated engines for subsystems whose draw volume shows up in
+ * profiles. Keeping them off the shared engine avoids its call overhead
+ * and per-call distribution setup, and makes a subsystem's sequence
+ * reproducible under a fixed seed: @ref rng_set_engine_seed derives each
+ * stream's seed from the master seed.
+ */
+enum class rng_stream : int {
+    mapgen = 0,
+    combat,
+    ai,
+    num_streams
+};
+
+pcg32_engine &rng_get_stream( rng_stream stream );
+
+/** As @ref normal_roll, but drawing from the given engine. */
+template<typename Engine>
+double normal_roll_on( Engine &eng, double mean, double stddev )
+{
+    static std::normal_distribution<double> normal_dist;
+    return normal_dist( eng, std::normal_distribution<double>::param_type( mean, stddev ) );
+}
+
 int rng( int lo, int hi );
 double rng_float( double lo, double hi );
 
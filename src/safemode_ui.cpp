@@ -685,6 +685,7 @@ void safemode::create_rules()
 {
     safemode_rules_hostile.clear();
     safemode_rules_sound.clear();
+    generation_++;
     //process include/exclude in order of rules, global first, then character specific
     add_rules( global_rules );
     add_rules( character_rules );
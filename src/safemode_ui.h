@@ -86,6 +86,9 @@ class safemode
         void add_rules( const std::vector<rules_class> &rules_in );
         void set_rule( const rules_class &rule_in, const std::string &name_in, rule_state rs_in );
 
+        /** See @ref generation. */
+        int generation_ = 0; // NOLINT(cata-serialize)
+
     public:
         std::string lastmon_whitelist; // NOLINT(cata-serialize)
 
@@ -111,6 +114,14 @@ class safemode
 
         bool empty() const;
 
+        /**
+         * Monotonic counter bumped whenever the compiled rule set changes.
+         * Lets callers that cache safe-mode verdicts detect rule edits.
+         */
+        int generation() const {
+            return generation_;
+        }
+
         void serialize( JsonOut &json ) const;
         void deserialize( JsonIn &jsin );
 };
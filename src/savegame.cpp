@@ -102,6 +102,7 @@ void game::serialize( std::ostream &fout )
 
     // save stats.
     json.member( "kill_tracker", *kill_tracker_ptr );
+    stats_tracker_ptr->flush_pending_events();
     json.member( "stats_tracker", *stats_tracker_ptr );
     json.member( "achievements_tracker", *achievements_tracker_ptr );
 
@@ -466,6 +467,10 @@ void overmap::unserialize( std::istream &fin )
     while( !jsin.end_object() ) {
         const std::string name = jsin.get_member_name();
         if( name == "layers" ) {
+            // The terrain arrays are overwritten wholesale below, so any
+            // previously built inverted index of them is stale.
+            oter_id_index.clear();
+            oter_index_built = false;
             std::unordered_map<tripoint_om_omt, std::string> needs_conversion;
             jsin.start_array();
             for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
@@ -231,6 +231,7 @@ void item_pocket::serialize( JsonOut &json ) const
 void item_pocket::deserialize( const JsonObject &data )
 {
     data.allow_omitted_members();
+    invalidate_cached_aggregates();
     data.read( "contents", contents );
     int saved_type_int;
     data.read( "pocket_type", saved_type_int );
@@ -726,6 +727,8 @@ void Character::load( const JsonObject &data )
             it = my_mutations.erase( it );
         }
     }
+    trait_bitset_built = false;
+    mutation_value_cache.clear();
     recalculate_size();
 
     data.read( "my_bionics", *my_bionics );
@@ -2269,6 +2272,9 @@ void monster::load( const JsonObject &data )
             entry.cooldown = rng( 0, sa.second->cooldown );
         }
     }
+    // Aging deferred at save time; absent in older saves.
+    special_cooldown_lag = data.get_int( "special_cooldown_lag", 0 );
+    recalc_special_ready();
 
     data.read( "friendly", friendly );
     if( data.has_member( "mission_ids" ) ) {
@@ -2347,6 +2353,7 @@ void monster::store( JsonOut &json ) const
     }
     json.member( "hp", hp );
     json.member( "special_attacks", special_attacks );
+    json.member( "special_cooldown_lag", special_cooldown_lag );
     json.member( "friendly", friendly );
     json.member( "fish_population", fish_population );
     json.member( "faction", faction.id().str() );
@@ -2525,7 +2532,18 @@ void item::io( Archive &archive )
     archive.io( "bday", bday, calendar::start_of_cataclysm );
     archive.io( "mission_id", mission_id, -1 );
     archive.io( "player_id", player_id, -1 );
-    archive.io( "item_vars", item_vars, io::empty_default_tag() );
+    // The variables and techniques are stored behind lazily allocated
+    // pointers; run the archive over a plain copy and only allocate when
+    // something was actually read.
+    std::map<std::string, std::string> archived_item_vars = cvars();
+    archive.io( "item_vars", archived_item_vars, io::empty_default_tag() );
+    if( Archive::is_input::value ) {
+        if( archived_item_vars.empty() ) {
+            item_vars_.reset();
+        } else {
+            vars() = std::move( archived_item_vars );
+        }
+    }
     // TODO: change default to empty string
     archive.io( "name", corpse_name, std::string() );
     archive.io( "owner", owner, owner.NULL_ID() );
@@ -2539,7 +2557,15 @@ void item::io( Archive &archive )
     archive.io( "rot", rot, 0_turns );
     archive.io( "last_temp_check", last_temp_check, calendar::start_of_cataclysm );
     archive.io( "current_phase", cur_phase, static_cast<int>( type->phase ) );
-    archive.io( "techniques", techniques, io::empty_default_tag() );
+    std::set<matec_id> archived_techniques = item_techniques();
+    archive.io( "techniques", archived_techniques, io::empty_default_tag() );
+    if( Archive::is_input::value ) {
+        if( archived_techniques.empty() ) {
+            techniques_.reset();
+        } else {
+            techniques_ = cata::make_value<std::set<matec_id>>( std::move( archived_techniques ) );
+        }
+    }
     archive.io( "faults", faults, io::empty_default_tag() );
     archive.io( "item_tags", item_tags, io::empty_default_tag() );
     archive.io( "components", components, io::empty_default_tag() );
@@ -2642,10 +2668,10 @@ void item::io( Archive &archive )
 
     // Books without any chapters don't need to store a remaining-chapters
     // counter, it will always be 0 and it prevents proper stacking.
-    if( get_chapters() == 0 ) {
-        for( auto it = item_vars.begin(); it != item_vars.end(); ) {
+    if( get_chapters() == 0 && item_vars_ ) {
+        for( auto it = item_vars_->begin(); it != item_vars_->end(); ) {
             if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
-                item_vars.erase( it++ );
+                item_vars_->erase( it++ );
             } else {
                 ++it;
             }
@@ -2653,8 +2679,8 @@ void item::io( Archive &archive )
     }
 
     // Remove stored translated gerund in favor of storing the inscription tool type
-    item_vars.erase( "item_label_type" );
-    item_vars.erase( "item_note_type" );
+    erase_var( "item_label_type" );
+    erase_var( "item_note_type" );
 
     current_phase = static_cast<phase_id>( cur_phase );
     // override phase if frozen, needed for legacy save
@@ -3689,6 +3715,8 @@ void mm_submap::deserialize( JsonIn &jsin )
         }
     }
     jsin.end_array();
+    // The submap matches what is on disk until the next write.
+    mark_clean();
 }
 
 void mm_region::serialize( JsonOut &jsout ) const
@@ -4104,6 +4132,7 @@ void stats_tracker::serialize( JsonOut &jsout ) const
 void stats_tracker::deserialize( const JsonObject &jo )
 {
     jo.allow_omitted_members();
+    pending_events.clear();
     jo.read( "data", data );
     for( std::pair<const event_type, event_multiset> &d : data ) {
         d.second.set_type( d.first );
@@ -4111,11 +4140,24 @@ void stats_tracker::deserialize( const JsonObject &jo )
     jo.read( "initial_scores", initial_scores );
 }
 
-void submap::store( JsonOut &jsout ) const
+void submap::store( JsonOut &jsout, const bool skip_tile_arrays ) const
 {
     jsout.member( "turn_last_touched", last_touched );
     jsout.member( "temperature", temperature );
 
+    if( skip_tile_arrays ) {
+        // The flat tile arrays were already emitted through
+        // store_tile_arrays as part of a binary quad.
+        store_dynamic_members( jsout );
+        return;
+    }
+
+    store_tile_array_members( jsout );
+    store_dynamic_members( jsout );
+}
+
+void submap::store_tile_array_members( JsonOut &jsout ) const
+{
     // Terrain is saved using a simple RLE scheme.  Legacy saves don't have
     // this feature but the algorithm is backward compatible.
     jsout.member( "terrain" );
@@ -4125,7 +4167,7 @@ void submap::store( JsonOut &jsout ) const
     for( int j = 0; j < SEEY; j++ ) {
         // NOLINTNEXTLINE(modernize-loop-convert)
         for( int i = 0; i < SEEX; i++ ) {
-            const std::string this_id = ter[i][j].obj().id.str();
+            const std::string this_id = get_ter( point( i, j ) ).obj().id.str();
             if( !last_id.empty() ) {
                 if( this_id == last_id ) {
                     num_same++;
@@ -4201,20 +4243,6 @@ void submap::store( JsonOut &jsout ) const
     }
     jsout.end_array();
 
-    jsout.member( "items" );
-    jsout.start_array();
-    for( int j = 0; j < SEEY; j++ ) {
-        for( int i = 0; i < SEEX; i++ ) {
-            if( itm[i][j].empty() ) {
-                continue;
-            }
-            jsout.write( i );
-            jsout.write( j );
-            jsout.write( itm[i][j] );
-        }
-    }
-    jsout.end_array();
-
     jsout.member( "traps" );
     jsout.start_array();
     for( int j = 0; j < SEEY; j++ ) {
@@ -4232,17 +4260,36 @@ void submap::store( JsonOut &jsout ) const
         }
     }
     jsout.end_array();
+}
+
+void submap::store_dynamic_members( JsonOut &jsout ) const
+{
+    jsout.member( "items" );
+    jsout.start_array();
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            const cata::colony<item> &items = get_items( point( i, j ) );
+            if( items.empty() ) {
+                continue;
+            }
+            jsout.write( i );
+            jsout.write( j );
+            jsout.write( items );
+        }
+    }
+    jsout.end_array();
 
     jsout.member( "fields" );
     jsout.start_array();
     for( int j = 0; j < SEEY; j++ ) {
         for( int i = 0; i < SEEX; i++ ) {
             // Save fields
-            if( fld[i][j].field_count() > 0 ) {
+            const field &tile_field = get_field( point( i, j ) );
+            if( tile_field.field_count() > 0 ) {
                 jsout.write( i );
                 jsout.write( j );
                 jsout.start_array();
-                for( const auto &elem : fld[i][j] ) {
+                for( const auto &elem : tile_field ) {
                     const field_entry &cur = elem.second;
                     jsout.write( cur.get_field_type().id() );
                     jsout.write( cur.get_field_intensity() );
@@ -4338,6 +4385,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
     } else if( member_name == "temperature" ) {
         temperature = jsin.get_int();
     } else if( member_name == "terrain" ) {
+        materialize();
         // TODO: try block around this to error out if we come up short?
         jsin.start_array();
         // Small duplication here so that the update check is only performed once
@@ -4349,26 +4397,26 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     const ter_str_id tid( jsin.get_string() );
 
                     if( tid == ter_t_rubble ) {
-                        ter[i][j] = ter_id( "t_dirt" );
-                        frn[i][j] = furn_id( "f_rubble" );
-                        itm[i][j].insert( rock );
-                        itm[i][j].insert( rock );
+                        tiles->ter[i][j] = ter_id( "t_dirt" );
+                        tiles->frn[i][j] = furn_id( "f_rubble" );
+                        tiles->itm[i][j].insert( rock );
+                        tiles->itm[i][j].insert( rock );
                     } else if( tid == ter_t_wreckage ) {
-                        ter[i][j] = ter_id( "t_dirt" );
-                        frn[i][j] = furn_id( "f_wreckage" );
-                        itm[i][j].insert( chunk );
-                        itm[i][j].insert( chunk );
+                        tiles->ter[i][j] = ter_id( "t_dirt" );
+                        tiles->frn[i][j] = furn_id( "f_wreckage" );
+                        tiles->itm[i][j].insert( chunk );
+                        tiles->itm[i][j].insert( chunk );
                     } else if( tid == ter_t_ash ) {
-                        ter[i][j] = ter_id( "t_dirt" );
-                        frn[i][j] = furn_id( "f_ash" );
+                        tiles->ter[i][j] = ter_id( "t_dirt" );
+                        tiles->frn[i][j] = furn_id( "f_ash" );
                     } else if( tid == ter_t_pwr_sb_support_l ) {
-                        ter[i][j] = ter_id( "t_support_l" );
+                        tiles->ter[i][j] = ter_id( "t_support_l" );
                     } else if( tid == ter_t_pwr_sb_switchgear_l ) {
-                        ter[i][j] = ter_id( "t_switchgear_l" );
+                        tiles->ter[i][j] = ter_id( "t_switchgear_l" );
                     } else if( tid == ter_t_pwr_sb_switchgear_s ) {
-                        ter[i][j] = ter_id( "t_switchgear_s" );
+                        tiles->ter[i][j] = ter_id( "t_switchgear_s" );
                     } else {
-                        ter[i][j] = tid.id();
+                        tiles->ter[i][j] = tid.id();
                     }
                 }
             }
@@ -4393,7 +4441,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     } else {
                         --remaining;
                     }
-                    ter[i][j] = iid;
+                    tiles->ter[i][j] = iid;
                 }
             }
             if( remaining ) {
@@ -4415,26 +4463,28 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             }
         }
     } else if( member_name == "furniture" ) {
+        materialize();
         jsin.start_array();
         while( !jsin.end_array() ) {
             jsin.start_array();
             int i = jsin.get_int();
             int j = jsin.get_int();
-            frn[i][j] = furn_id( jsin.get_string() );
+            tiles->frn[i][j] = furn_id( jsin.get_string() );
             jsin.end_array();
         }
     } else if( member_name == "items" ) {
+        materialize();
         jsin.start_array();
         while( !jsin.end_array() ) {
             int i = jsin.get_int();
             int j = jsin.get_int();
             const point p( i, j );
 
-            if( !jsin.read( itm[p.x][p.y], false ) ) {
+            if( !jsin.read( tiles->itm[p.x][p.y], false ) ) {
                 debugmsg( "Items array is corrupt in submap at: %s, skipping", p.to_string() );
             }
             // some portion could've been read even if error occurred
-            for( item &it : itm[p.x][p.y] ) {
+            for( item &it : tiles->itm[p.x][p.y] ) {
                 if( it.is_emissive() ) {
                     update_lum_add( p, it );
                 }
@@ -4456,10 +4506,11 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             const point p( i, j );
             // TODO: jsin should support returning an id like jsin.get_id<trap>()
             const trap_str_id trid( jsin.get_string() );
-            trp[p.x][p.y] = trid.id();
+            set_trap( p, trid.id() );
             jsin.end_array();
         }
     } else if( member_name == "fields" ) {
+        materialize();
         jsin.start_array();
         while( !jsin.end_array() ) {
             // Coordinates loop
@@ -4483,8 +4534,9 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                 } else {
                     ft = field_types::get_field_type_by_legacy_enum( type_int ).id;
                 }
-                if( fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) ) ) {
+                if( tiles->fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) ) ) {
                     field_count++;
+                    set_field_presence( point( i, j ) );
                 }
             }
         }
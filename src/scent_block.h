@@ -3,16 +3,13 @@
 #define CATA_SRC_SCENT_BLOCK_H
 
 #include <algorithm>
-#include <array>
 
 #include "coordinate_conversions.h"
+#include "epoch_cache.h"
 #include "point.h"
 #include "scent_map.h"
 
 struct scent_block {
-    template<typename T>
-    using data_block = std::array < std::array < T, SEEY + 2 >, SEEX + 2 >;
-
     enum class data_mode : int {
         NONE = 0,
         SET = 1,
@@ -23,22 +20,25 @@ struct scent_block {
         data_mode mode;
         int intensity;
     };
-    data_block<datum> assignment;
+    // Cells not written since the last reset read as NONE, so reusing one
+    // block across submaps costs an epoch bump instead of re-zeroing.
+    epoch_cache<datum, SEEX + 2, SEEY + 2> assignment;
 
     tripoint origin;
     scent_map &scents;
     int modification_count;
 
     scent_block( const tripoint &sub, scent_map &scents )
-    // NOLINTNEXTLINE(cata-use-named-point-constants)
-        : origin( sm_to_ms_copy( sub ) + point( -1, -1 ) )
-        , scents( scents )
-        , modification_count( 0 ) {
-        for( int x = 0; x < SEEX + 2; ++x ) {
-            for( int y = 0; y < SEEY + 2; ++y ) {
-                assignment[x][y] = { data_mode::NONE, 0 };
-            }
-        }
+        : scents( scents ) {
+        reset( sub );
+    }
+
+    /** Retargets the block at another submap and discards all assignments. */
+    void reset( const tripoint &sub ) {
+        // NOLINTNEXTLINE(cata-use-named-point-constants)
+        origin = sm_to_ms_copy( sub ) + point( -1, -1 );
+        assignment.clear();
+        modification_count = 0;
     }
 
     void commit_modifications() {
@@ -47,20 +47,21 @@ struct scent_block {
         }
         for( int x = 0; x < SEEX + 2; ++x ) {
             for( int y = 0; y < SEEY + 2; ++y ) {
-                switch( assignment[x][y].mode ) {
+                const datum &dat = assignment.get( point( x, y ) );
+                switch( dat.mode ) {
                     case data_mode::NONE:
                         break;
                     case data_mode::SET: {
                         tripoint p = origin + tripoint( x, y, 0 );
                         if( scents.inbounds( p ) ) {
-                            scents.set_unsafe( p, assignment[x][y].intensity );
+                            scents.set_unsafe( p, dat.intensity );
                         }
                         break;
                     }
                     case data_mode::MAX: {
                         tripoint p = origin + tripoint( x, y, 0 );
                         if( scents.inbounds( p ) ) {
-                            scents.set_unsafe( p, std::max( assignment[x][y].intensity, scents.get_unsafe( p ) ) );
+                            scents.set_unsafe( p, std::max( dat.intensity, scents.get_unsafe( p ) ) );
                         }
                         break;
                     }
@@ -75,14 +76,13 @@ struct scent_block {
 
     // We should be working entirely within the range, so don't range check here
     void apply_gas( const tripoint &p, const int nintensity = 0 ) {
-        const point ndx = index( p );
-        assignment[ndx.x][ndx.y].mode = data_mode::SET;
-        assignment[ndx.x][ndx.y].intensity = std::max( 0, assignment[ndx.x][ndx.y].intensity - nintensity );
+        datum &dat = assignment.get_or_init( index( p ) );
+        dat.mode = data_mode::SET;
+        dat.intensity = std::max( 0, dat.intensity - nintensity );
         ++modification_count;
     }
     void apply_slime( const tripoint &p, int intensity ) {
-        const point ndx = index( p );
-        datum &dat = assignment[ndx.x][ndx.y];
+        datum &dat = assignment.get_or_init( index( p ) );
         switch( dat.mode ) {
             case data_mode::NONE: {
                 // we don't know what the current intensity is, so we must do a max operation
@@ -1,8 +1,11 @@
 #include "scent_map.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdlib>
+#include <mutex>
 #include <new>
+#include <thread>
 
 #include "assign.h"
 #include "calendar.h"
@@ -14,11 +17,91 @@
 #include "generic_factory.h"
 #include "json.h"
 #include "map.h"
+#include "options.h"
 #include "output.h"
 #include "point.h"
 
 static constexpr int SCENT_RADIUS = 40;
 
+/**
+ * Runs one diffusion job at a time on a worker thread, so the grid for
+ * the next turn can be computed while the main thread renders. The main
+ * thread hands over copies of all inputs in @ref enqueue and collects
+ * the result with @ref wait, so the worker never touches live game
+ * state.
+ */
+class scent_map::background_updater
+{
+    public:
+        ~background_updater() {
+            {
+                const std::lock_guard<std::mutex> guard( mutex );
+                exiting = true;
+            }
+            job_waiting.notify_all();
+            if( worker.joinable() ) {
+                worker.join();
+            }
+        }
+
+        void enqueue( const point &center, const scent_array<int> &scent,
+                      const scent_array<bool> &blocks_scent, const scent_array<bool> &reduces_scent ) {
+            {
+                const std::lock_guard<std::mutex> guard( mutex );
+                job_center = center;
+                job_scent = scent;
+                job_blocks = blocks_scent;
+                job_reduces = reduces_scent;
+                job_ready = true;
+            }
+            job_waiting.notify_all();
+            if( !worker.joinable() ) {
+                worker = std::thread( &background_updater::run, this );
+            }
+        }
+
+        // Blocks until the queued diffusion has finished and returns the
+        // resulting grid. Only valid until the next enqueue.
+        const scent_array<int> &wait() {
+            std::unique_lock<std::mutex> guard( mutex );
+            job_done.wait( guard, [this]() {
+                return !job_ready;
+            } );
+            return job_scent;
+        }
+
+    private:
+        void run() {
+            std::unique_lock<std::mutex> guard( mutex );
+            while( true ) {
+                job_waiting.wait( guard, [this]() {
+                    return job_ready || exiting;
+                } );
+                if( exiting ) {
+                    break;
+                }
+                scent_map::diffuse( job_scent, job_blocks, job_reduces, job_center );
+                job_ready = false;
+                job_done.notify_all();
+            }
+        }
+
+        std::thread worker;
+        std::mutex mutex;
+        std::condition_variable job_waiting;
+        std::condition_variable job_done;
+        bool job_ready = false;
+        bool exiting = false;
+        point job_center;
+        scent_array<int> job_scent;
+        scent_array<bool> job_blocks;
+        scent_array<bool> job_reduces;
+};
+
+scent_map::scent_map( const game &g ) : gm( g ) { }
+
+scent_map::~scent_map() = default;
+
 static nc_color sev( const size_t level )
 {
     static const std::array<nc_color, 22> colors = { {
@@ -51,6 +134,14 @@ static nc_color sev( const size_t level )
 
 void scent_map::reset()
 {
+    // Discard any in-flight diffusion; it was computed from the grid
+    // being wiped.
+    if( update_pending ) {
+        update_pending = false;
+        updater->wait();
+        pending_sets.clear();
+        pending_decay = 0;
+    }
     for( auto &elem : grscent ) {
         for( auto &val : elem ) {
             val = 0;
@@ -61,6 +152,11 @@ void scent_map::reset()
 
 void scent_map::decay()
 {
+    if( update_pending ) {
+        // The worker holds a copy from before this decay; replay it on
+        // the adopted grid at the next handoff.
+        ++pending_decay;
+    }
     for( auto &elem : grscent ) {
         for( auto &val : elem ) {
             val = std::max( 0, val - 1 );
@@ -82,6 +178,9 @@ void scent_map::draw( const catacurses::window &win, const int div, const tripoi
 
 void scent_map::shift( const point &sm_shift )
 {
+    // An in-flight diffusion is in pre-shift coordinates; adopt it
+    // before moving the grid.
+    finish_background_update();
     scent_array<int> new_scent;
     for( size_t x = 0; x < MAPSIZE_X; ++x ) {
         for( size_t y = 0; y < MAPSIZE_Y; ++y ) {
@@ -110,6 +209,11 @@ void scent_map::set( const tripoint &p, int value, const scenttype_id &type )
 void scent_map::set_unsafe( const tripoint &p, int value, const scenttype_id &type )
 {
     grscent[p.x][p.y] = value;
+    if( update_pending ) {
+        // The worker holds a copy without this write; replay it on the
+        // adopted grid at the next handoff.
+        pending_sets.emplace_back( p.xy(), value );
+    }
     if( !type.is_empty() ) {
         typescent = type;
     }
@@ -161,6 +265,10 @@ bool scent_map::inbounds( const point &p ) const
 
 void scent_map::update( const tripoint &center, map &m )
 {
+    // Adopt the grid the worker computed during the last render phase
+    // before deciding what this turn needs.
+    finish_background_update();
+
     // Stop updating scent after X turns of the player not moving.
     // Once wind is added, need to reset this on wind shifts as well.
     if( !player_last_position || center != *player_last_position ) {
@@ -170,18 +278,69 @@ void scent_map::update( const tripoint &center, map &m )
         return;
     }
 
-    // note: the next four intermediate matrices need to be at least
+    // these are for caching flag lookups
+    scent_array<bool> blocks_scent; // currently only ter_furn_flag::TFLAG_NO_SCENT blocks scent
+    scent_array<bool> reduces_scent;
+
+    // The new scent flag searching function. Should be wayyy faster than the old one.
+    m.scent_blockers( blocks_scent, reduces_scent,
+                      center.xy() + point( -SCENT_RADIUS - 1, -SCENT_RADIUS - 1 ),
+                      center.xy() + point( SCENT_RADIUS + 1, SCENT_RADIUS + 1 ) );
+
+    if( get_option<bool>( "BACKGROUND_SCENT" ) ) {
+        // Pipelined: hand this turn's inputs to the worker and let it
+        // compute the next grid while the main thread renders. Readers
+        // this turn see the grid adopted above, one diffusion behind.
+        if( !updater ) {
+            updater = std::make_unique<background_updater>();
+        }
+        updater->enqueue( center.xy(), grscent, blocks_scent, reduces_scent );
+        update_pending = true;
+    } else {
+        diffuse( grscent, blocks_scent, reduces_scent, center.xy() );
+    }
+}
+
+void scent_map::finish_background_update()
+{
+    if( !update_pending ) {
+        return;
+    }
+    update_pending = false;
+    grscent = updater->wait();
+    // Replay everything that happened to the live grid while the worker
+    // held a stale copy: decay first, then direct writes on top.
+    if( pending_decay > 0 ) {
+        for( auto &elem : grscent ) {
+            for( auto &val : elem ) {
+                val = std::max( 0, val - pending_decay );
+            }
+        }
+        pending_decay = 0;
+    }
+    for( const std::pair<point, int> &elem : pending_sets ) {
+        grscent[elem.first.x][elem.first.y] = elem.second;
+    }
+    pending_sets.clear();
+}
+
+void scent_map::diffuse( scent_array<int> &grscent, const scent_array<bool> &blocks_scent,
+                         const scent_array<bool> &reduces_scent, const point &center )
+{
+    // note: the intermediate matrices below need to be at least
     // [2*SCENT_RADIUS+3][2*SCENT_RADIUS+1] in size to hold enough data
     // The code I'm modifying used [MAPSIZE_X]. I'm staying with that to avoid new bugs.
 
-    // These two matrices are transposed so that x addresses are contiguous in memory
+    // Diffusion weight of every tile: 0 where scent is blocked, 2 on
+    // REDUCE_SCENT tiles (only 20% diffuses) and 10 elsewhere. Folding
+    // the flags into weights up front makes the two passes below pure
+    // arithmetic over contiguous rows, which the compiler can vectorize.
+    scent_array<int> weight;
+    scent_array<int> weighted_scent;
+    // 3-tap sums of the above in the y direction.
     scent_array<int> sum_3_scent_y;
     scent_array<int> squares_used_y;
 
-    // these are for caching flag lookups
-    scent_array<bool> blocks_scent; // currently only ter_furn_flag::TFLAG_NO_SCENT blocks scent
-    scent_array<bool> reduces_scent;
-
     // for loop constants
     const int scentmap_minx = center.x - SCENT_RADIUS;
     const int scentmap_maxx = center.x + SCENT_RADIUS;
@@ -192,69 +351,57 @@ void scent_map::update( const tripoint &center, map &m )
     // stability. This is essentially a decimal number * 1000.
     const int diffusivity = 100;
 
-    // The new scent flag searching function. Should be wayyy faster than the old one.
-    m.scent_blockers( blocks_scent, reduces_scent, point( scentmap_minx - 1, scentmap_miny - 1 ),
-                      point( scentmap_maxx + 1, scentmap_maxy + 1 ) );
+    for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
+        for( int y = scentmap_miny - 1; y <= scentmap_maxy + 1; ++y ) {
+            const int w = blocks_scent[x][y] ? 0 : ( reduces_scent[x][y] ? 2 : 10 );
+            weight[x][y] = w;
+            weighted_scent[x][y] = w * grscent[x][y];
+        }
+    }
+
     // Sum neighbors in the y direction.  This way, each square gets called 3 times instead of 9
     // times. This cost us an extra loop here, but it also eliminated a loop at the end, so there
-    // is a net performance improvement over the old code. Could probably still be better.
+    // is a net performance improvement over the old code.
     // note: this method needs an array that is one square larger on each side in the x direction
     // than the final scent matrix. I think this is fine since SCENT_RADIUS is less than
     // MAPSIZE_X, but if that changes, this may need tweaking.
     for( int x = scentmap_minx - 1; x <= scentmap_maxx + 1; ++x ) {
         for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = y - 1; i <= y + 1; ++i ) {
-                if( !blocks_scent[x][i] ) {
-                    if( reduces_scent[x][i] ) {
-                        // only 20% of scent can diffuse on REDUCE_SCENT squares
-                        sum_3_scent_y[y][x] += 2 * grscent[x][i];
-                        squares_used_y[y][x] += 2;
-                    } else {
-                        sum_3_scent_y[y][x] += 10 * grscent[x][i];
-                        squares_used_y[y][x] += 10;
-                    }
-                }
-            }
+            // the sum of the scent val for the 3 neighboring squares that can diffuse into
+            sum_3_scent_y[x][y] = weighted_scent[x][y - 1] + weighted_scent[x][y] +
+                                  weighted_scent[x][y + 1];
+            squares_used_y[x][y] = weight[x][y - 1] + weight[x][y] + weight[x][y + 1];
         }
     }
 
-    // Rest of the scent map
+    // Rest of the scent map. Branch-free: a blocked center tile has
+    // weight 0 and its result is masked to 0 at the end.
     for( int x = scentmap_minx; x <= scentmap_maxx; ++x ) {
         for( int y = scentmap_miny; y <= scentmap_maxy; ++y ) {
-            int &scent_here = grscent[x][y];
-            if( !blocks_scent[x][y] ) {
-                // to how many neighboring squares do we diffuse out? (include our own square
-                // since we also include our own square when diffusing in)
-                const int squares_used = squares_used_y[y][x - 1]
-                                         + squares_used_y[y][x]
-                                         + squares_used_y[y][x + 1];
-
-                int this_diffusivity;
-                if( !reduces_scent[x][y] ) {
-                    this_diffusivity = diffusivity;
-                } else {
-                    this_diffusivity = diffusivity / 5; //less air movement for REDUCE_SCENT square
-                }
-                // take the old scent and subtract what diffuses out
-                int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
-                // neighboring REDUCE_SCENT squares absorb some scent
-                temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
-                // we've already summed neighboring scent values in the y direction in the previous
-                // loop. Now we do it for the x direction, multiply by diffusion, and this is what
-                // diffuses into our current square.
-                scent_here =
-                    ( temp_scent
-                      + this_diffusivity * ( sum_3_scent_y[y][x - 1]
-                                             + sum_3_scent_y[y][x]
-                                             + sum_3_scent_y[y][x + 1] )
-                    ) / ( 1000 * 10 );
-            } else {
-                // this cell blocks scent via NO_SCENT (in json)
-                scent_here = 0;
-            }
+            const int scent_here = grscent[x][y];
+            // to how many neighboring squares do we diffuse out? (include our own square
+            // since we also include our own square when diffusing in)
+            const int squares_used = squares_used_y[x - 1][y]
+                                     + squares_used_y[x][y]
+                                     + squares_used_y[x + 1][y];
+            // diffusivity on a normal tile (weight 10), diffusivity / 5
+            // on a REDUCE_SCENT tile (weight 2) - less air movement there
+            const int this_diffusivity = weight[x][y] * ( diffusivity / 10 );
+            // take the old scent and subtract what diffuses out
+            int temp_scent = scent_here * ( 10 * 1000 - squares_used * this_diffusivity );
+            // neighboring REDUCE_SCENT squares absorb some scent
+            temp_scent -= scent_here * this_diffusivity * ( 90 - squares_used ) / 5;
+            // we've already summed neighboring scent values in the y direction in the previous
+            // loop. Now we do it for the x direction, multiply by diffusion, and this is what
+            // diffuses into our current square.
+            const int result =
+                ( temp_scent
+                  + this_diffusivity * ( sum_3_scent_y[x - 1][y]
+                                         + sum_3_scent_y[x][y]
+                                         + sum_3_scent_y[x + 1][y] )
+                ) / ( 1000 * 10 );
+            // this cell blocks scent via NO_SCENT (in json)
+            grscent[x][y] = weight[x][y] == 0 ? 0 : result;
         }
     }
 }
@@ -4,7 +4,9 @@
 
 #include <array>
 #include <iosfwd>
+#include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
@@ -53,8 +55,28 @@ class scent_map
 
         const game &gm; // NOLINT(cata-serialize)
 
+        // Runs the diffusion for the next turn during this turn's render
+        // phase when the BACKGROUND_SCENT option is on; see update().
+        class background_updater;
+        std::unique_ptr<background_updater> updater; // NOLINT(cata-serialize)
+        // Whether a diffusion job has been handed to the worker and its
+        // result not yet adopted.
+        bool update_pending = false; // NOLINT(cata-serialize)
+        // Writes and decay that happened while a job was in flight; they
+        // are replayed onto the adopted grid at the next handoff.
+        std::vector<std::pair<point, int>> pending_sets; // NOLINT(cata-serialize)
+        int pending_decay = 0; // NOLINT(cata-serialize)
+
+        // The diffusion kernel proper. Pure arithmetic over its
+        // arguments, so it can run off the main thread.
+        static void diffuse( scent_array<int> &scent, const scent_array<bool> &blocks_scent,
+                             const scent_array<bool> &reduces_scent, const point &center );
+        // Adopts the result of the pending diffusion job, if any.
+        void finish_background_update();
+
     public:
-        explicit scent_map( const game &g ) : gm( g ) { }
+        explicit scent_map( const game &g );
+        ~scent_map();
 
         void deserialize( const std::string &data, bool is_type = false );
         std::string serialize( bool is_type = false ) const;
@@ -1,4 +1,6 @@
 #if defined(TILES)
+#include <utility>
+
 #include "sdl_geometry.h"
 #include "debug.h"
 
@@ -73,4 +75,76 @@ void ColorModulatedGeometryRenderer::rect( const SDL_Renderer_Ptr &renderer, con
     }
 }
 
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+
+void SpriteBatchRenderer::queue( const SDL_Renderer_Ptr &renderer,
+                                 const std::shared_ptr<SDL_Texture> &texture,
+                                 const SDL_Rect &srcrect, const SDL_Rect &dstrect,
+                                 const SDL_RendererFlip flip )
+{
+    if( texture.get() != batch_texture.get() ) {
+        flush( renderer );
+        batch_texture = texture;
+        int w = 0;
+        int h = 0;
+        printErrorIf( SDL_QueryTexture( texture.get(), nullptr, nullptr, &w, &h ) != 0,
+                      "SDL_QueryTexture failed" );
+        texture_width = w;
+        texture_height = h;
+    }
+    float u0 = srcrect.x / texture_width;
+    float v0 = srcrect.y / texture_height;
+    float u1 = ( srcrect.x + srcrect.w ) / texture_width;
+    float v1 = ( srcrect.y + srcrect.h ) / texture_height;
+    if( flip & SDL_FLIP_HORIZONTAL ) {
+        std::swap( u0, u1 );
+    }
+    if( flip & SDL_FLIP_VERTICAL ) {
+        std::swap( v0, v1 );
+    }
+    const float x0 = dstrect.x;
+    const float y0 = dstrect.y;
+    const float x1 = dstrect.x + dstrect.w;
+    const float y1 = dstrect.y + dstrect.h;
+    const SDL_Color white = { 255, 255, 255, 255 };
+    const SDL_Vertex corners[4] = {
+        { { x0, y0 }, white, { u0, v0 } },
+        { { x1, y0 }, white, { u1, v0 } },
+        { { x1, y1 }, white, { u1, v1 } },
+        { { x0, y1 }, white, { u0, v1 } }
+    };
+    // Two triangles per quad; SDL_RenderGeometry takes plain triangle lists.
+    for( const int corner : { 0, 1, 2, 0, 2, 3 } ) {
+        vertices.emplace_back( corners[corner] );
+    }
+}
+
+void SpriteBatchRenderer::flush( const SDL_Renderer_Ptr &renderer )
+{
+    if( vertices.empty() ) {
+        return;
+    }
+    printErrorIf( SDL_RenderGeometry( renderer.get(), batch_texture.get(), vertices.data(),
+                                      static_cast<int>( vertices.size() ), nullptr, 0 ) != 0,
+                  "SDL_RenderGeometry failed" );
+    vertices.clear();
+}
+
+#else
+
+void SpriteBatchRenderer::queue( const SDL_Renderer_Ptr &renderer,
+                                 const std::shared_ptr<SDL_Texture> &texture,
+                                 const SDL_Rect &srcrect, const SDL_Rect &dstrect,
+                                 const SDL_RendererFlip flip )
+{
+    printErrorIf( SDL_RenderCopyEx( renderer.get(), texture.get(), &srcrect, &dstrect, 0, nullptr,
+                                    flip ) != 0, "SDL_RenderCopyEx failed" );
+}
+
+void SpriteBatchRenderer::flush( const SDL_Renderer_Ptr & )
+{
+}
+
+#endif // SDL_VERSION_ATLEAST( 2, 0, 18 )
+
 #endif // TILES
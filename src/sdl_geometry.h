@@ -4,6 +4,7 @@
 
 #if defined(TILES)
 #include <memory>
+#include <vector>
 
 #include "sdl_wrappers.h"
 #include "point.h"
@@ -53,6 +54,33 @@ class ColorModulatedGeometryRenderer: public DefaultGeometryRenderer
         SDL_Texture_Ptr tex;
 };
 
+/// Accumulates textured quads and renders each run of consecutive quads
+/// sharing one texture with a single SDL_RenderGeometry call, which keeps a
+/// full map redraw from being bound by tens of thousands of draw calls.
+/// Queueing a quad for a different texture flushes the pending run first, so
+/// draw order is preserved. On SDL versions without SDL_RenderGeometry every
+/// quad is rendered immediately instead and flushing is a no-op.
+class SpriteBatchRenderer
+{
+    public:
+        /// Queues an unrotated quad; equivalent to SDL_RenderCopyEx with the
+        /// given flip and an angle of zero.
+        void queue( const SDL_Renderer_Ptr &renderer, const std::shared_ptr<SDL_Texture> &texture,
+                    const SDL_Rect &srcrect, const SDL_Rect &dstrect, SDL_RendererFlip flip );
+
+        /// Renders all queued quads. Must be called before anything else
+        /// draws to the renderer and at the end of the frame.
+        void flush( const SDL_Renderer_Ptr &renderer );
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+    private:
+        std::shared_ptr<SDL_Texture> batch_texture;
+        std::vector<SDL_Vertex> vertices;
+        float texture_width = 0.0f;
+        float texture_height = 0.0f;
+#endif
+};
+
 #endif // TILES
 
 #endif // CATA_SRC_SDL_GEOMETRY_H
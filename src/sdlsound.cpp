@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -81,6 +82,24 @@ static std::unordered_map<std::string, int> unique_paths;
 static sfx_resources_t sfx_resources;
 static std::vector<id_and_variant> sfx_preload;
 
+// Cache of pitch-shifted chunk variants, keyed by resource id and pitch
+// quantized to 1/64 steps. Random pitches drawn from a narrow band collapse
+// onto a handful of steps, so repeated plays of the same effect reuse the
+// processed chunk instead of resampling on every play. Cached chunks are
+// owned here rather than freed by a channel-finished callback.
+struct pitched_chunk_entry {
+    Mix_Chunk *chunk = nullptr;
+    long long last_used = 0;
+};
+static std::map<std::pair<int, int>, pitched_chunk_entry> pitched_chunk_cache;
+static long long pitched_chunk_use_counter = 0;
+
+static void free_pitched_chunk( Mix_Chunk *chunk )
+{
+    free( chunk->abuf );
+    free( chunk );
+}
+
 bool sounds::sound_enabled = false;
 
 static inline bool check_sound( const int volume = 1 )
@@ -130,6 +149,10 @@ bool init_sound()
 void shutdown_sound()
 {
     // De-allocate all loaded sound.
+    for( auto &entry : pitched_chunk_cache ) {
+        free_pitched_chunk( entry.second.chunk );
+    }
+    pitched_chunk_cache.clear();
     sfx_resources.resource.clear();
     sfx_resources.sound_effects.clear();
 
@@ -402,20 +425,6 @@ bool sfx::has_variant_sound( const std::string &id, const std::string &variant )
     return find_random_effect( id, variant ) != nullptr;
 }
 
-// Deletes the dynamically created chunk (if such a chunk had been played).
-static void cleanup_when_channel_finished( int /* channel */, void *udata )
-{
-    Mix_Chunk *chunk = static_cast<Mix_Chunk *>( udata );
-    free( chunk->abuf );
-    free( chunk );
-}
-
-// empty effect, as we cannot change the size of the output buffer,
-// therefore we cannot do the math from do_pitch_shift here
-static void empty_effect( int /* chan */, void * /* stream */, int /* len */, void * /* udata */ )
-{
-}
-
 static Mix_Chunk *do_pitch_shift( Mix_Chunk *s, float pitch )
 {
     Uint32 s_in = s->alen / 4;
@@ -459,6 +468,53 @@ static Mix_Chunk *do_pitch_shift( Mix_Chunk *s, float pitch )
     return result;
 }
 
+// Whether any channel is currently playing the given chunk, in which case
+// it must not be freed.
+static bool chunk_is_playing( const Mix_Chunk *chunk )
+{
+    const int channels = Mix_AllocateChannels( -1 );
+    for( int ch = 0; ch < channels; ch++ ) {
+        if( Mix_Playing( ch ) && Mix_GetChunk( ch ) == chunk ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static Mix_Chunk *get_pitch_shifted_chunk( int resource_id, Mix_Chunk *s, float pitch )
+{
+    // A 1/64 step is about 1.5%, well inside the random band it is drawn from.
+    const int pitch_step = std::max( 1, static_cast<int>( std::lround( pitch * 64.0f ) ) );
+    const std::pair<int, int> key( resource_id, pitch_step );
+    auto iter = pitched_chunk_cache.find( key );
+    if( iter == pitched_chunk_cache.end() ) {
+        static const size_t cache_cap = 64;
+        while( pitched_chunk_cache.size() >= cache_cap ) {
+            auto victim = pitched_chunk_cache.end();
+            for( auto it = pitched_chunk_cache.begin(); it != pitched_chunk_cache.end(); ++it ) {
+                if( chunk_is_playing( it->second.chunk ) ) {
+                    continue;
+                }
+                if( victim == pitched_chunk_cache.end() ||
+                    it->second.last_used < victim->second.last_used ) {
+                    victim = it;
+                }
+            }
+            if( victim == pitched_chunk_cache.end() ) {
+                // Everything left is audible right now; let the cache run over.
+                break;
+            }
+            free_pitched_chunk( victim->second.chunk );
+            pitched_chunk_cache.erase( victim );
+        }
+        pitched_chunk_entry entry;
+        entry.chunk = do_pitch_shift( s, static_cast<float>( pitch_step ) / 64.0f );
+        iter = pitched_chunk_cache.emplace( key, entry ).first;
+    }
+    iter->second.last_used = ++pitched_chunk_use_counter;
+    return iter->second.chunk;
+}
+
 void sfx::play_variant_sound( const std::string &id, const std::string &variant, int volume )
 {
     if( test_mode ) {
@@ -510,21 +566,13 @@ void sfx::play_variant_sound( const std::string &id, const std::string &variant,
     bool is_pitched = ( pitch_min > 0 ) && ( pitch_max > 0 );
     if( is_pitched ) {
         double pitch_random = rng_float( pitch_min, pitch_max );
-        effect_to_play = do_pitch_shift( effect_to_play, static_cast<float>( pitch_random ) );
+        effect_to_play = get_pitch_shifted_chunk( selected_sound_effect.resource_id, effect_to_play,
+                         static_cast<float>( pitch_random ) );
     }
     Mix_VolumeChunk( effect_to_play,
                      selected_sound_effect.volume * get_option<int>( "SOUND_EFFECT_VOLUME" ) * volume / ( 100 * 100 ) );
     int channel = Mix_PlayChannel( static_cast<int>( sfx::channel::any ), effect_to_play, 0 );
     bool failed = ( channel == -1 );
-    if( !failed && is_pitched ) {
-        if( Mix_RegisterEffect( channel, empty_effect, cleanup_when_channel_finished,
-                                effect_to_play ) == 0 ) {
-            // To prevent use after free, stop the playback right now.
-            failed = true;
-            dbg( D_WARNING ) << "Mix_RegisterEffect failed: " << Mix_GetError();
-            Mix_HaltChannel( channel );
-        }
-    }
     if( !failed ) {
         if( Mix_SetPosition( channel, static_cast<Sint16>( to_degrees( angle ) ), 1 ) == 0 ) {
             // Not critical
@@ -533,9 +581,6 @@ void sfx::play_variant_sound( const std::string &id, const std::string &variant,
     }
     if( failed ) {
         dbg( D_ERROR ) << "Failed to play sound effect: " << Mix_GetError();
-        if( is_pitched ) {
-            cleanup_when_channel_finished( channel, effect_to_play );
-        }
     }
 }
 
@@ -560,7 +605,8 @@ void sfx::play_ambient_variant_sound( const std::string &id, const std::string &
     Mix_Chunk *effect_to_play = get_sfx_resource( selected_sound_effect.resource_id );
     bool is_pitched = ( pitch > 0 );
     if( is_pitched ) {
-        effect_to_play = do_pitch_shift( effect_to_play, static_cast<float>( pitch ) );
+        effect_to_play = get_pitch_shifted_chunk( selected_sound_effect.resource_id, effect_to_play,
+                         static_cast<float>( pitch ) );
     }
     Mix_VolumeChunk( effect_to_play,
                      selected_sound_effect.volume * get_option<int>( "AMBIENT_SOUND_VOLUME" ) * volume / ( 100 * 100 ) );
@@ -571,19 +617,8 @@ void sfx::play_ambient_variant_sound( const std::string &id, const std::string &
     } else {
         failed = ( Mix_PlayChannel( ch, effect_to_play, loops ) == -1 );
     }
-    if( !failed && is_pitched ) {
-        if( Mix_RegisterEffect( ch, empty_effect, cleanup_when_channel_finished, effect_to_play ) == 0 ) {
-            // To prevent use after free, stop the playback right now.
-            failed = true;
-            dbg( D_WARNING ) << "Mix_RegisterEffect failed: " << Mix_GetError();
-            Mix_HaltChannel( ch );
-        }
-    }
     if( failed ) {
         dbg( D_ERROR ) << "Failed to play sound effect: " << Mix_GetError();
-        if( is_pitched ) {
-            cleanup_when_channel_finished( ch, effect_to_play );
-        }
     }
 }
 
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <climits>
 #include <cmath>
 #include <cstdint>
@@ -22,6 +23,7 @@
 #include <stack>
 #include <stdexcept>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 #if defined(_MSC_VER) && defined(USE_VCPKG)
 #   include <SDL2/SDL_image.h>
@@ -1231,6 +1233,107 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                   "SDL_RenderSetClipRect failed" );
 }
 
+// Cells of the current line that survived the framebuffer diff.
+struct changed_cell {
+    int i;
+    const cursecell *cell;
+    int codepoint;
+    int cw;
+};
+
+// Line-drawing codepoints take the draw_ascii_lines path and cannot be part
+// of a composed glyph run.
+static bool is_composable_codepoint( const int codepoint )
+{
+    switch( codepoint ) {
+        case LINE_XOXO_UNICODE:
+        case LINE_OXOX_UNICODE:
+        case LINE_XXOO_UNICODE:
+        case LINE_OXXO_UNICODE:
+        case LINE_OOXX_UNICODE:
+        case LINE_XOOX_UNICODE:
+        case LINE_XXXO_UNICODE:
+        case LINE_XXOX_UNICODE:
+        case LINE_XOXX_UNICODE:
+        case LINE_OXXX_UNICODE:
+        case LINE_XXXX_UNICODE:
+        case UNKNOWN_UNICODE:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// Composed glyph-run cache. Stable UI text (menus, sidebar, labels) is
+// redrawn glyph by glyph whenever its line is touched; keeping recently
+// drawn (text, font, color) runs composed into one texture turns such a
+// run into a single RenderCopy on later draws.
+struct glyph_run_key {
+    std::string text;
+    const Font *font;
+    unsigned char color;
+
+    friend bool operator==( const glyph_run_key &lhs, const glyph_run_key &rhs ) noexcept {
+        return lhs.color == rhs.color && lhs.font == rhs.font && lhs.text == rhs.text;
+    }
+};
+
+struct glyph_run_key_hash {
+    size_t operator()( const glyph_run_key &k ) const {
+        return std::hash<std::string>()( k.text ) ^
+               std::hash<const void *>()( k.font ) ^ k.color;
+    }
+};
+
+static std::unordered_map<glyph_run_key, SDL_Texture_Ptr, glyph_run_key_hash> glyph_run_cache;
+
+// Returns a texture holding the given run of cells drawn with `color`,
+// composing and caching it on the first request. Null on failure (e.g. no
+// render target support), in which case the caller draws glyph by glyph.
+static SDL_Texture *compose_glyph_run( const Font_Ptr &font,
+                                       const std::vector<changed_cell> &cells,
+                                       const size_t first, const size_t last,
+                                       const unsigned char color, const int width_px )
+{
+    glyph_run_key key;
+    for( size_t k = first; k < last; k++ ) {
+        key.text += cells[k].cell->ch;
+    }
+    key.font = font.get();
+    key.color = color;
+    const auto found = glyph_run_cache.find( key );
+    if( found != glyph_run_cache.end() ) {
+        return found->second.get();
+    }
+    if( glyph_run_cache.size() >= 512 ) {
+        // Bound memory use; by then most entries are text no longer shown.
+        glyph_run_cache.clear();
+    }
+    SDL_Texture_Ptr tex = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                         SDL_TEXTUREACCESS_TARGET, width_px, font->height );
+    if( !tex ) {
+        return nullptr;
+    }
+    printErrorIf( SDL_SetTextureBlendMode( tex.get(), SDL_BLENDMODE_BLEND ) != 0,
+                  "SDL_SetTextureBlendMode failed" );
+    SetRenderTarget( renderer, tex );
+    SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_NONE );
+    SetRenderDrawColor( renderer, 0, 0, 0, 0 );
+    RenderClear( renderer );
+    SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_BLEND );
+    int x = 0;
+    for( size_t k = first; k < last; k++ ) {
+        if( cells[k].cell->ch != " " ) {
+            font->OutputChar( renderer, geometry, cells[k].cell->ch, point( x, 0 ), color );
+        }
+        x += cells[k].cw * font->width;
+    }
+    SetRenderTarget( renderer, display_buffer );
+    SDL_Texture *result = tex.get();
+    glyph_run_cache.emplace( std::move( key ), std::move( tex ) );
+    return result;
+}
+
 static bool draw_window( Font_Ptr &font, const catacurses::window &w, const point &offset )
 {
     if( scaling_factor > 1 ) {
@@ -1289,6 +1392,9 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
     // TODO: Get this from UTF system to make sure it is exactly the kind of space we need
     static const std::string space_string = " ";
 
+    const bool ascii_lines_option = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+    std::vector<changed_cell> changed_cells;
+
     bool update = false;
     for( int j = 0; j < win->height; j++ ) {
         if( !win->line[j].touched ) {
@@ -1303,6 +1409,8 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
 
         update = true;
         win->line[j].touched = false;
+        const int draw_y = offset.y + j * font->height;
+        changed_cells.clear();
         for( int i = 0; i < win->width; i++ ) {
             const int fbx = win->pos.x + i;
             if( fbx >= static_cast<int>( framebuffer[fby].chars.size() ) ) {
@@ -1331,21 +1439,49 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                 continue; // second cell of a multi-cell character
             }
 
-            // Spaces are used a lot, so this does help noticeably
-            if( cell.ch == space_string ) {
-                geometry->rect( renderer, draw, font->width, font->height,
-                                color_as_sdl( cell.BG ) );
-                continue;
-            }
             const int codepoint = UTF8_getch( cell.ch );
-            const catacurses::base_color FG = cell.FG;
-            const catacurses::base_color BG = cell.BG;
-            int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch );
+            const int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch );
             if( cw < 1 ) {
                 // utf8_width() may return a negative width
                 continue;
             }
-            bool use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+            changed_cells.push_back( changed_cell{ i, &cell, codepoint, cw } );
+        }
+
+        // Draw the background of each run of contiguous cells sharing one
+        // color as a single rectangle instead of one draw call per cell.
+        int run_start = 0;
+        int run_width = 0;
+        catacurses::base_color run_bg = catacurses::black;
+        const auto flush_bg = [&]() {
+            if( run_width > 0 ) {
+                geometry->rect( renderer, point( offset.x + run_start * font->width, draw_y ),
+                                run_width * font->width, font->height, color_as_sdl( run_bg ) );
+                run_width = 0;
+            }
+        };
+        for( const changed_cell &cc : changed_cells ) {
+            if( run_width == 0 || cc.cell->BG != run_bg || cc.i != run_start + run_width ) {
+                flush_bg();
+                run_start = cc.i;
+                run_bg = cc.cell->BG;
+            }
+            run_width += cc.cw;
+        }
+        flush_bg();
+
+        // Draw the glyphs on top of the batched backgrounds.
+        const auto draw_cell_glyph = [&]( const changed_cell &cc ) {
+            const cursecell &cell = *cc.cell;
+
+            // Spaces are used a lot, so this does help noticeably
+            if( cell.ch == space_string ) {
+                return; // the background already covers them
+            }
+            const point draw( offset + point( cc.i * font->width, draw_y - offset.y ) );
+            const int codepoint = cc.codepoint;
+            const catacurses::base_color FG = cell.FG;
+            bool use_draw_ascii_lines_routine = ascii_lines_option;
             unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
             switch( codepoint ) {
                 case LINE_XOXO_UNICODE:
@@ -1388,13 +1524,52 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                     use_draw_ascii_lines_routine = false;
                     break;
             }
-            geometry->rect( renderer, draw, font->width * cw, font->height,
-                            color_as_sdl( BG ) );
             if( use_draw_ascii_lines_routine ) {
                 font->draw_ascii_lines( renderer, geometry, uc, draw, FG );
             } else {
                 font->OutputChar( renderer, geometry, cell.ch, draw, FG );
             }
+        };
+
+        // Group contiguous same-color plain-text cells into composed,
+        // cached runs: one RenderCopy per run instead of one per glyph.
+        // Composition renders outside the logical-size transform, so it
+        // is skipped when a scaling factor is active.
+        const bool can_compose = scaling_factor == 1;
+        size_t idx = 0;
+        while( idx < changed_cells.size() ) {
+            const changed_cell &cc = changed_cells[idx];
+            if( !can_compose || !is_composable_codepoint( cc.codepoint ) ) {
+                draw_cell_glyph( cc );
+                ++idx;
+                continue;
+            }
+            // Extend the run while cells stay adjacent, same-colored and plain.
+            size_t run_end = idx;
+            int run_cells = 0;
+            while( run_end < changed_cells.size() &&
+                   is_composable_codepoint( changed_cells[run_end].codepoint ) &&
+                   changed_cells[run_end].cell->FG == cc.cell->FG &&
+                   changed_cells[run_end].i == cc.i + run_cells ) {
+                run_cells += changed_cells[run_end].cw;
+                ++run_end;
+            }
+            SDL_Texture *run_tex = nullptr;
+            if( run_end - idx >= 3 ) {
+                run_tex = compose_glyph_run( font, changed_cells, idx, run_end,
+                                             cc.cell->FG, run_cells * font->width );
+            }
+            if( run_tex ) {
+                SDL_Rect rect { offset.x + cc.i * font->width, draw_y,
+                                run_cells * font->width, font->height };
+                printErrorIf( SDL_RenderCopy( renderer.get(), run_tex, nullptr, &rect ) != 0,
+                              "SDL_RenderCopy failed" );
+            } else {
+                for( size_t k = idx; k < run_end; k++ ) {
+                    draw_cell_glyph( changed_cells[k] );
+                }
+            }
+            idx = run_end;
         }
     }
     win->draw = false; //We drew the window, mark it as so
@@ -3611,6 +3786,8 @@ void catacurses::init_interface()
     // initialize sound set
     load_soundset();
 
+    // Composed runs hold pointers to the old fonts as cache keys.
+    glyph_run_cache.clear();
     font = std::make_unique<FontFallbackList>( renderer, format, fl.fontwidth, fl.fontheight,
             windowsPalette, fl.typeface, fl.fontsize, fl.fontblending );
     map_font = std::make_unique<FontFallbackList>( renderer, format, fl.map_fontwidth,
@@ -3682,6 +3859,17 @@ void input_manager::pump_events()
         return;
     }
 
+    // Data loading and finalization loops call this once per element to
+    // keep the OS from flagging the window as unresponsive; polling the
+    // event queue hundreds of thousands of times during startup has real
+    // cost. Servicing it every few milliseconds is just as responsive.
+    static auto last_pump = std::chrono::steady_clock::time_point();
+    const auto now = std::chrono::steady_clock::now();
+    if( now - last_pump < std::chrono::milliseconds( 10 ) ) {
+        return;
+    }
+    last_pump = now;
+
     // Handle all events, but ignore any keypress
     CheckMessages();
 
@@ -3728,7 +3916,11 @@ input_event input_manager::get_input_event( const keyboard_mode preferred_keyboa
             if( last_input.type != input_event_t::error ) {
                 break;
             }
-            SDL_Delay( 1 );
+            // Block in the OS until an event arrives instead of polling at
+            // 1 ms - an idle client used to cost a core. The event is left
+            // in the queue for the next CheckMessages call; the timeout
+            // keeps the periodic housekeeping in CheckMessages alive.
+            SDL_WaitEventTimeout( nullptr, 50 );
         } while( last_input.type == input_event_t::error );
     } else if( inputdelay > 0 ) {
         uint32_t starttime = SDL_GetTicks();
@@ -3740,10 +3932,15 @@ input_event input_manager::get_input_event( const keyboard_mode preferred_keyboa
             if( last_input.type != input_event_t::error ) {
                 break;
             }
-            SDL_Delay( 1 );
             timedout = endtime >= starttime + inputdelay;
             if( timedout ) {
                 last_input.type = input_event_t::timeout;
+            } else {
+                // As above, but wake at the deadline so timeout-driven
+                // animation frames are not delayed.
+                const uint32_t remaining = starttime + inputdelay - endtime;
+                SDL_WaitEventTimeout( nullptr,
+                                      static_cast<int>( std::min<uint32_t>( remaining, 50 ) ) );
             }
         } while( !timedout );
     } else {
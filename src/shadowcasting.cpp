@@ -182,6 +182,11 @@ void cast_horizontal_zlight_segment(
 
         for( auto this_span = spans.begin(); this_span != spans.end(); ) {
             bool started_block = false;
+            // calc is relatively expensive (sight_calc is an exp()) and,
+            // for a given span, depends only on the rounded distance;
+            // adjacent tiles usually share it, so memoize the last value.
+            int cached_dist = -1;
+            T cached_intensity( 0.0f );
             // TODO: Precalculate min/max delta.z based on start/end and distance
             for( delta.z = 0; delta.z <= distance; delta.z++ ) {
                 // Shadowcasting sweeps from the cardinal to the most extreme edge of the octant
@@ -275,7 +280,11 @@ void cast_horizontal_zlight_segment(
                     }
 
                     const int dist = rl_dist( tripoint_zero, delta ) + offset_distance;
-                    last_intensity = calc( numerator, this_span->cumulative_value, dist );
+                    if( dist != cached_dist ) {
+                        cached_intensity = calc( numerator, this_span->cumulative_value, dist );
+                        cached_dist = dist;
+                    }
+                    last_intensity = cached_intensity;
 
                     if( !floor_block ) {
                         ( *output_caches[z_index] )[current.x][current.y] =
@@ -370,6 +379,9 @@ void cast_vertical_zlight_segment(
 
         for( auto this_span = spans.begin(); this_span != spans.end(); ) {
             bool started_block = false;
+            // See the matching memoization in cast_horizontal_zlight_segment.
+            int cached_dist = -1;
+            T cached_intensity( 0.0f );
             for( delta.y = 0; delta.y <= distance; delta.y++ ) {
                 // See comment above trailing_edge_major and leading_edge_major in above function.
                 const slope trailing_edge_major( delta.y * 2 - 1, delta.z * 2 + 1 );
@@ -447,7 +459,11 @@ void cast_vertical_zlight_segment(
                     }
 
                     const int dist = rl_dist( tripoint_zero, delta ) + offset_distance;
-                    last_intensity = calc( numerator, this_span->cumulative_value, dist );
+                    if( dist != cached_dist ) {
+                        cached_intensity = calc( numerator, this_span->cumulative_value, dist );
+                        cached_dist = dist;
+                    }
+                    last_intensity = cached_intensity;
 
                     if( !floor_block ) {
                         ( *output_caches[z_index] )[current.x][current.y] =
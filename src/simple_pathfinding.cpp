@@ -1,9 +1,11 @@
 #include "simple_pathfinding.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <queue>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "coordinates.h"
@@ -283,17 +285,29 @@ simple_path<tripoint_abs_omt> find_overmap_path( const tripoint_abs_omt &source,
     if( start_score.node_cost < 0 || end_score.node_cost < 0 ) {
         return ret;
     }
-    std::unordered_map<node_address, navigation_node, node_address_hasher> known_nodes;
-    std::priority_queue<scored_address, std::vector<scored_address>, std::greater<>> open_set;
+    // The search buffers are reused across calls, so repeated queries (NPC
+    // travel recomputes routes frequently) do not pay for reallocating and
+    // rehashing them from scratch every time.
+    static std::unordered_map<node_address, navigation_node, node_address_hasher> known_nodes;
+    // OMTs the scorer rejected; without this every impassable OMT on the
+    // search frontier would be re-scored once per passable neighbor.
+    static std::unordered_set<node_address, node_address_hasher> rejected_nodes;
+    // Min-heap ordered by estimated total cost.
+    static std::vector<scored_address> open_set;
+    known_nodes.clear();
+    rejected_nodes.clear();
+    open_set.clear();
     const node_address start( tripoint_zero );
     known_nodes.emplace( start, navigation_node{0, 0, -1, start_score.allow_z_change} );
-    open_set.push( scored_address{ start, 0 } );
+    open_set.push_back( scored_address{ start, 0 } );
     const point_abs_omt source_point = source.xy();
+    const point_abs_omt dest_point = dest.xy();
     int search_count = 0;
     constexpr int max_search_count = 100000;
     while( !open_set.empty() ) {
-        const node_address cur_addr = open_set.top().addr;
-        open_set.pop();
+        std::pop_heap( open_set.begin(), open_set.end(), std::greater<>() );
+        const node_address cur_addr = open_set.back().addr;
+        open_set.pop_back();
         search_count++;
         const tripoint_abs_omt cur_point = cur_addr.to_tripoint( source );
         if( cur_point == dest ) {
@@ -323,13 +337,24 @@ simple_path<tripoint_abs_omt> find_overmap_path( const tripoint_abs_omt &source,
                     next_node.prev_dir = static_cast<int8_t>( rev_dir );
                 }
             } else if( known_nodes.size() < max_search_count ) {
+                if( rejected_nodes.count( next_addr ) > 0 ) {
+                    continue;
+                }
                 const tripoint_abs_omt next_point = next_addr.to_tripoint( source );
-                if( octile_dist( source_point, next_point.xy() ) > radius ) {
+                const int dist_from_source = octile_dist( source_point, next_point.xy() );
+                if( dist_from_source > radius ) {
+                    continue;
+                }
+                // Goal bounding: any path through this node is at least as
+                // long as the two octile legs, so nodes well off the
+                // source-destination axis need not be expanded even though
+                // they are within the search radius.
+                if( dist_from_source + octile_dist( next_point.xy(), dest_point ) > 2 * radius ) {
                     continue;
                 }
                 const omt_score next_score = scorer( next_point );
                 if( next_score.node_cost < 0 ) {
-                    // TODO: add to closed set to avoid re-visiting
+                    rejected_nodes.insert( next_addr );
                     continue;
                 }
                 // TODO: pass in the 10 (default terrain cost)
@@ -344,7 +369,8 @@ simple_path<tripoint_abs_omt> find_overmap_path( const tripoint_abs_omt &source,
                 next_node.node_cost = next_score.node_cost;
                 next_node.prev_dir = static_cast<int8_t>( rev_dir );
                 next_node.allow_z_change = next_score.allow_z_change;
-                open_set.push( scored_address{ next_addr, estimated_total_cost } );
+                open_set.push_back( scored_address{ next_addr, estimated_total_cost } );
+                std::push_heap( open_set.begin(), open_set.end(), std::greater<>() );
             }
         }
     }
@@ -337,6 +337,7 @@ void sounds::process_sounds()
 {
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = get_weather().weather_id->sound_attn;
+    map &here = get_map();
     for( const auto &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -348,19 +349,38 @@ void sounds::process_sounds()
         int sig_power = get_signal_for_hordes( this_centroid );
         if( sig_power > 0 ) {
 
-            const point abs_ms = get_map().getabs( source.xy() );
+            const point abs_ms = here.getabs( source.xy() );
             // TODO: fix point types
             const point_abs_sm abs_sm( ms_to_sm_copy( abs_ms ) );
             const tripoint_abs_sm target( abs_sm, source.z );
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
-            // TODO: Generalize this to Creature::hear_sound
-            const int dist = sound_distance( source, critter.pos() );
-            if( vol * 2 > dist ) {
-                // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist, this_centroid.provocative );
+        const int max_hear_dist = vol * 2;
+        if( max_hear_dist < MAPSIZE_X ) {
+            // Quiet sounds can only reach nearby monsters, so pull candidates
+            // from the submap index instead of scanning every loaded monster.
+            // sound_distance is at least the horizontal rl_dist and at least
+            // the vertical displacement, so this radius can't miss a hearer.
+            for( const shared_ptr_fast<monster> &mon_ptr :
+                 get_creature_tracker().find_in_radius( here.getglobal( source ), max_hear_dist ) ) {
+                monster &critter = *mon_ptr;
+                // TODO: Generalize this to Creature::hear_sound
+                const int dist = sound_distance( source, critter.pos() );
+                if( vol * 2 > dist ) {
+                    // Exclude monsters that certainly won't hear the sound
+                    critter.hear_sound( source, vol, dist, this_centroid.provocative );
+                }
+            }
+        } else {
+            // Loud enough to span the reality bubble; check everyone.
+            for( monster &critter : g->all_monsters() ) {
+                // TODO: Generalize this to Creature::hear_sound
+                const int dist = sound_distance( source, critter.pos() );
+                if( vol * 2 > dist ) {
+                    // Exclude monsters that certainly won't hear the sound
+                    critter.hear_sound( source, vol, dist, this_centroid.provocative );
+                }
             }
         }
     }
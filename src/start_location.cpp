@@ -205,11 +205,18 @@ tripoint_abs_omt start_location::find_player_initial_location() const
     // Spiral out from the world origin scanning for a compatible starting location,
     // creating overmaps as necessary.
     const int radius = 3;
+    std::vector<std::pair<std::string, ot_match_type>> targets = _omt_types;
     for( const point_abs_om &omp : closest_points_first( point_abs_om(), radius ) ) {
         overmap &omap = overmap_buffer.get( omp );
-        const tripoint_om_omt omtstart = omap.find_random_omt( random_target() );
-        if( omtstart.raw() != tripoint_min ) {
-            return project_combine( omp, omtstart );
+        // Generating an overmap is far more expensive than searching one, so try
+        // every eligible terrain type before moving on and generating the next.
+        // The shuffle keeps the pick among this location's types random.
+        std::shuffle( targets.begin(), targets.end(), rng_get_engine() );
+        for( const std::pair<std::string, ot_match_type> &target : targets ) {
+            const tripoint_om_omt omtstart = omap.find_random_omt( target );
+            if( omtstart.raw() != tripoint_min ) {
+                return project_combine( omp, omtstart );
+            }
         }
     }
     // Should never happen, if it does we messed up.
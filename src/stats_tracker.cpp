@@ -231,9 +231,23 @@ stats_tracker::~stats_tracker()
 
 event_multiset &stats_tracker::get_events( event_type type )
 {
+    flush_pending_events();
     return data.emplace( type, event_multiset( type ) ).first->second;
 }
 
+void stats_tracker::flush_pending_events()
+{
+    if( pending_events.empty() ) {
+        return;
+    }
+    // folding can re-enter through get_events, so detach the buffer first
+    std::vector<cata::event> pending;
+    pending.swap( pending_events );
+    for( const cata::event &e : pending ) {
+        data.emplace( e.type(), event_multiset( e.type() ) ).first->second.add( e );
+    }
+}
+
 event_multiset stats_tracker::get_events(
     const string_id<event_transformation> &transform_id )
 {
@@ -338,6 +352,7 @@ void stats_tracker::clear()
 {
     unwatch_all();
     data.clear();
+    pending_events.clear();
     event_transformation_states.clear();
     stat_states.clear();
     initial_scores.clear();
@@ -360,11 +375,17 @@ void stats_tracker::unwatch_all()
 void stats_tracker::notify( const cata::event &e )
 {
     const event_type type = e.type();
-    get_events( type ).add( e );
 
     auto it = event_type_watchers.find( type );
     if( it != event_type_watchers.end() ) {
+        // Watched types must be visible immediately; get_events folds any
+        // buffered events first so the multisets stay in event order.
+        get_events( type ).add( e );
         it->second.send_to_all( &event_multiset_watcher::event_added, e, *this );
+    } else {
+        // Nobody is watching this type, so defer the aggregation to the next
+        // read and keep the gameplay path to an append.
+        pending_events.push_back( e );
     }
 
     if( e.type() == event_type::game_start ) {
@@ -212,6 +212,10 @@ class stats_tracker : public event_subscriber
 
         void clear();
         void notify( const cata::event & ) override;
+        // Folds buffered events into the multisets. Reads go through
+        // get_events, which flushes implicitly; saving must call this
+        // explicitly before serializing.
+        void flush_pending_events();
 
         void serialize( JsonOut & ) const;
         void deserialize( const JsonObject &jo );
@@ -219,6 +223,10 @@ class stats_tracker : public event_subscriber
         void unwatch_all();
 
         std::unordered_map<event_type, event_multiset> data;
+        // Events of types nobody watches, buffered so a combat-path
+        // notification is a plain append and the aggregation cost is paid on
+        // the next read instead.
+        std::vector<cata::event> pending_events; // NOLINT(cata-serialize)
 
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<event_type, watcher_set<event_multiset_watcher>> event_type_watchers;
@@ -355,9 +355,14 @@ class string_formatter
                 read_conversion( arg, std::forward<Args>( args )... );
             }
         }
-        std::string get_output() const {
+        std::string get_output() const & {
             return output;
         }
+        /// Rvalue overload so @ref string_format can move the result out of the
+        /// (about to be destroyed) formatter instead of copying it.
+        std::string get_output() && {
+            return std::move( output );
+        }
 #if defined(__clang__)
 #define PRINTF_LIKE(a,b) __attribute__((format(printf,a,b)))
 #elif defined(__GNUC__)
@@ -413,10 +418,16 @@ class string_formatter
 template<typename ...Args>
 inline std::string string_format( std::string format, Args &&...args )
 {
+    // Fast path: a format string without any conversion is its own output. A large
+    // share of the calls (translated messages, item names, plain UI text) end up
+    // here and can skip the parsing and the formatter instance entirely.
+    if( format.find( '%' ) == std::string::npos ) {
+        return format;
+    }
     try {
         cata::string_formatter formatter( std::move( format ) );
         formatter.parse( std::forward<Args>( args )... );
-        return formatter.get_output();
+        return std::move( formatter ).get_output();
     } catch( ... ) {
         return cata::handle_string_format_error();
     }
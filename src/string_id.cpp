@@ -1,3 +1,4 @@
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include "string_id.h"
@@ -6,6 +7,9 @@ namespace
 {
 using InternMapType = std::unordered_map<std::string, int>;
 using ReverseLookupVecType = std::vector<const std::string *>;
+// The pool is process-wide and save loading parses some files on worker
+// threads (see game::load), so all pool access is serialized.
+std::mutex intern_mutex;
 } // namespace
 
 inline static InternMapType &get_intern_map()
@@ -23,11 +27,17 @@ inline static ReverseLookupVecType &get_reverse_lookup_vec()
 template<typename S>
 inline static int universal_string_id_intern( S &&s )
 {
-    int next_id = get_reverse_lookup_vec().size();
-    const auto &pair = get_intern_map().emplace( std::forward<S>( s ), next_id );
-    if( pair.second ) { // inserted
-        get_reverse_lookup_vec().push_back( &pair.first->first );
+    std::lock_guard<std::mutex> lock( intern_mutex );
+    InternMapType &map = get_intern_map();
+    // Look up first: most interns are repeats, and emplace would
+    // allocate a node before discovering the duplicate.
+    const auto iter = map.find( s );
+    if( iter != map.end() ) {
+        return iter->second;
     }
+    int next_id = get_reverse_lookup_vec().size();
+    const auto &pair = map.emplace( std::forward<S>( s ), next_id );
+    get_reverse_lookup_vec().push_back( &pair.first->first );
     return pair.first->second;
 }
 
@@ -48,6 +58,9 @@ int string_identity_static::string_id_intern( std::string &&s )
 
 const std::string &string_identity_static::get_interned_string( int id )
 {
+    // The returned reference is stable (the map's nodes never move);
+    // the lock only covers the vector, which may grow concurrently.
+    std::lock_guard<std::mutex> lock( intern_mutex );
     return *get_reverse_lookup_vec()[id];
 }
 
@@ -2,9 +2,13 @@
 
 #include <algorithm>
 #include <array>
+#include <istream>
 #include <iterator>
+#include <mutex>
+#include <ostream>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "basecamp.h"
 #include "mapdata.h"
@@ -27,18 +31,293 @@ void maptile_soa<sx, sy>::swap_soa_tile( const point &p1, const point &p2 )
 
 submap::submap()
 {
-    std::uninitialized_fill_n( &ter[0][0], elements, t_null );
-    std::uninitialized_fill_n( &frn[0][0], elements, f_null );
-    std::uninitialized_fill_n( &lum[0][0], elements, 0 );
-    std::uninitialized_fill_n( &trp[0][0], elements, tr_null );
-    std::uninitialized_fill_n( &rad[0][0], elements, 0 );
+    // The tile arrays are not allocated until something writes to them; a
+    // fresh submap reads as a uniform block of t_null. See materialize().
+    uniform_ter = t_null;
+}
+
+void submap::materialize()
+{
+    if( tiles ) {
+        return;
+    }
+    tiles = std::make_unique<maptile_soa<SEEX, SEEY>>();
+    std::uninitialized_fill_n( &tiles->ter[0][0], elements, uniform_ter );
+    std::uninitialized_fill_n( &tiles->frn[0][0], elements, f_null );
+    std::uninitialized_fill_n( &tiles->lum[0][0], elements, 0 );
+    std::uninitialized_fill_n( &tiles->trp[0][0], elements, tr_null );
+    std::uninitialized_fill_n( &tiles->rad[0][0], elements, 0 );
+
+    // colony's generic minimum group size of 8 makes the first block of a
+    // tile holding a single item several KB, and most tiles hold no or few
+    // items. Start the item stacks with the smallest legal block instead;
+    // busy tiles still grow in colony's usual doubling steps, capped at the
+    // per-tile item limit. The colonies are empty here so this only sets
+    // the bounds and allocates nothing.
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            tiles->itm[x][y].change_group_sizes( 4, MAX_ITEM_IN_SQUARE );
+        }
+    }
+}
+
+furn_id submap::uniform_furn()
+{
+    return f_null;
+}
+
+trap_id submap::uniform_trap()
+{
+    return tr_null;
+}
 
+const field &submap::uniform_field()
+{
+    static const field empty;
+    return empty;
+}
+
+const cata::colony<item> &submap::uniform_items()
+{
+    static const cata::colony<item> empty;
+    return empty;
+}
+
+void submap::set_trap( const point &p, trap_id trap )
+{
+    if( !tiles ) {
+        materialize();
+    }
     is_uniform = false;
+    modified = true;
+    trap_id &cur = tiles->trp[p.x][p.y];
+    if( cur == tr_null && trap != tr_null ) {
+        trap_count++;
+    } else if( cur != tr_null && trap == tr_null ) {
+        trap_count--;
+    }
+    cur = trap;
+}
+
+void submap::set_all_ter( const ter_id &terr )
+{
+    modified = true;
+    if( !tiles ) {
+        // Still the flyweight: just change which terrain it is a block of.
+        uniform_ter = terr;
+        return;
+    }
+    std::uninitialized_fill_n( &tiles->ter[0][0], elements, terr );
+}
+
+void submap::set_all_furn( const furn_id &furn )
+{
+    modified = true;
+    if( !tiles ) {
+        if( furn == f_null ) {
+            return;
+        }
+        materialize();
+    }
+    std::uninitialized_fill_n( &tiles->frn[0][0], elements, furn );
+}
+
+void submap::set_all_traps( const trap_id &trap )
+{
+    modified = true;
+    if( !tiles ) {
+        if( trap == tr_null ) {
+            trap_count = 0;
+            return;
+        }
+        materialize();
+    }
+    std::uninitialized_fill_n( &tiles->trp[0][0], elements, trap );
+    trap_count = trap == tr_null ? 0 : static_cast<int>( elements );
+}
+
+// Helpers for the binary tile-array format. Each id array is written as
+// a table of the distinct string ids used in this submap followed by a
+// memcpy-able run of 16 bit indices into that table, so int_id values
+// never hit the disk and the format survives id reordering between runs.
+static void write_binary_u16( std::ostream &fout, uint16_t val )
+{
+    fout.write( reinterpret_cast<const char *>( &val ), sizeof( val ) );
+}
+
+static uint16_t read_binary_u16( std::istream &fin )
+{
+    uint16_t val = 0;
+    fin.read( reinterpret_cast<char *>( &val ), sizeof( val ) );
+    return val;
+}
+
+static void write_binary_string( std::ostream &fout, const std::string &str )
+{
+    write_binary_u16( fout, static_cast<uint16_t>( str.size() ) );
+    fout.write( str.data(), str.size() );
+}
+
+static std::string read_binary_string( std::istream &fin )
+{
+    std::string str( read_binary_u16( fin ), '\0' );
+    fin.read( &str[0], str.size() );
+    return str;
+}
+
+template<typename T>
+static void store_id_array( std::ostream &fout, const int_id<T>( &arr )[SEEX][SEEY] )
+{
+    std::vector<std::string> table;
+    std::map<int_id<T>, uint16_t> indices;
+    uint16_t run[SEEX * SEEY];
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            const int_id<T> &id = arr[x][y];
+            auto iter = indices.find( id );
+            if( iter == indices.end() ) {
+                iter = indices.emplace( id, static_cast<uint16_t>( table.size() ) ).first;
+                table.push_back( id.id().str() );
+            }
+            run[x * SEEY + y] = iter->second;
+        }
+    }
+    write_binary_u16( fout, static_cast<uint16_t>( table.size() ) );
+    for( const std::string &id : table ) {
+        write_binary_string( fout, id );
+    }
+    fout.write( reinterpret_cast<const char *>( run ), sizeof( run ) );
+}
+
+template<typename T>
+static void load_id_array( std::istream &fin, int_id<T>( &arr )[SEEX][SEEY] )
+{
+    const int table_size = read_binary_u16( fin );
+    std::vector<int_id<T>> table;
+    table.reserve( table_size );
+    for( int i = 0; i < table_size; i++ ) {
+        // Resolve each string id exactly once per submap.
+        table.push_back( string_id<T>( read_binary_string( fin ) ).id() );
+    }
+    uint16_t run[SEEX * SEEY];
+    fin.read( reinterpret_cast<char *>( run ), sizeof( run ) );
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            arr[x][y] = table.at( run[x * SEEY + y] );
+        }
+    }
+}
+
+// As store_id_array for an unmaterialized submap: one table entry and a
+// run of zero indices, so the loader needs no special case.
+template<typename T>
+static void store_uniform_id_array( std::ostream &fout, const int_id<T> &id )
+{
+    write_binary_u16( fout, 1 );
+    write_binary_string( fout, id.id().str() );
+    const uint16_t run[SEEX * SEEY] = {};
+    fout.write( reinterpret_cast<const char *>( run ), sizeof( run ) );
+}
+
+void submap::store_tile_arrays( std::ostream &fout ) const
+{
+    using soa = maptile_soa<SEEX, SEEY>;
+    static_assert( sizeof( soa::rad ) == sizeof( int32_t ) * SEEX * SEEY,
+                   "radiation array is expected to be a flat run of 32 bit values" );
+    if( !tiles ) {
+        store_uniform_id_array( fout, uniform_ter );
+        store_uniform_id_array( fout, f_null );
+        store_uniform_id_array( fout, tr_null );
+        const std::vector<char> zeros( sizeof( soa::lum ) + sizeof( soa::rad ), 0 );
+        fout.write( zeros.data(), zeros.size() );
+        return;
+    }
+    store_id_array( fout, tiles->ter );
+    store_id_array( fout, tiles->frn );
+    store_id_array( fout, tiles->trp );
+    fout.write( reinterpret_cast<const char *>( tiles->lum ), sizeof( tiles->lum ) );
+    fout.write( reinterpret_cast<const char *>( tiles->rad ), sizeof( tiles->rad ) );
+}
+
+void submap::load_tile_arrays( std::istream &fin )
+{
+    materialize();
+    load_id_array( fin, tiles->ter );
+    load_id_array( fin, tiles->frn );
+    load_id_array( fin, tiles->trp );
+    fin.read( reinterpret_cast<char *>( tiles->lum ), sizeof( tiles->lum ) );
+    fin.read( reinterpret_cast<char *>( tiles->rad ), sizeof( tiles->rad ) );
+
+    is_uniform = false;
+    trap_count = 0;
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            if( tiles->trp[x][y] != tr_null ) {
+                trap_count++;
+            }
+        }
+    }
+}
+
+void submap::rebuild_field_cells()
+{
+    field_cells.reset();
+    if( !tiles ) {
+        return;
+    }
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            if( tiles->fld[x][y].field_count() > 0 ) {
+                field_cells.set( x * SEEY + y );
+            }
+        }
+    }
 }
 
 submap::submap( submap && ) noexcept( map_is_noexcept ) = default;
 submap::~submap() = default;
 
+namespace
+{
+// Recycled tile blocks. The cap bounds the pool at a few MB; beyond
+// it (e.g. mapbuffer::clear dumping a whole world) blocks go back to
+// the system allocator. Guarded by a mutex because submaps can be
+// destroyed while the background save thread is running.
+std::mutex tile_pool_mutex;
+std::vector<void *> tile_pool;
+constexpr size_t tile_pool_max = 128;
+} // namespace
+
+template<int sx, int sy>
+void *maptile_soa<sx, sy>::operator new( std::size_t size )
+{
+    if( size == sizeof( maptile_soa<sx, sy> ) ) {
+        std::lock_guard<std::mutex> lock( tile_pool_mutex );
+        if( !tile_pool.empty() ) {
+            void *const block = tile_pool.back();
+            tile_pool.pop_back();
+            return block;
+        }
+    }
+    return ::operator new( size );
+}
+
+template<int sx, int sy>
+void maptile_soa<sx, sy>::operator delete( void *ptr, std::size_t size ) noexcept
+{
+    if( ptr == nullptr ) {
+        return;
+    }
+    if( size == sizeof( maptile_soa<sx, sy> ) ) {
+        std::lock_guard<std::mutex> lock( tile_pool_mutex );
+        if( tile_pool.size() < tile_pool_max ) {
+            tile_pool.push_back( ptr );
+            return;
+        }
+    }
+    ::operator delete( ptr );
+}
+
 submap &submap::operator=( submap && ) noexcept = default;
 
 static const std::string COSMETICS_GRAFFITI( "GRAFFITI" );
@@ -85,6 +364,7 @@ const std::string &submap::get_graffiti( const point &p ) const
 void submap::set_graffiti( const point &p, const std::string &new_graffiti )
 {
     is_uniform = false;
+    modified = true;
     // Find signage at p if available
     const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_GRAFFITI );
     if( fresult.result ) {
@@ -97,6 +377,7 @@ void submap::set_graffiti( const point &p, const std::string &new_graffiti )
 void submap::delete_graffiti( const point &p )
 {
     is_uniform = false;
+    modified = true;
     const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_GRAFFITI );
     if( fresult.result ) {
         cosmetics[ fresult.ndx ] = cosmetics.back();
@@ -105,7 +386,7 @@ void submap::delete_graffiti( const point &p )
 }
 bool submap::has_signage( const point &p ) const
 {
-    if( frn[p.x][p.y].obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
+    if( get_furn( p ).obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
         return find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE ).result;
     }
 
@@ -113,7 +394,7 @@ bool submap::has_signage( const point &p ) const
 }
 std::string submap::get_signage( const point &p ) const
 {
-    if( frn[p.x][p.y].obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
+    if( get_furn( p ).obj().has_flag( ter_furn_flag::TFLAG_SIGN ) ) {
         const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
         if( fresult.result ) {
             return cosmetics[ fresult.ndx ].str;
@@ -125,6 +406,7 @@ std::string submap::get_signage( const point &p ) const
 void submap::set_signage( const point &p, const std::string &s )
 {
     is_uniform = false;
+    modified = true;
     // Find signage at p if available
     const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
     if( fresult.result ) {
@@ -136,6 +418,7 @@ void submap::set_signage( const point &p, const std::string &s )
 void submap::delete_signage( const point &p )
 {
     is_uniform = false;
+    modified = true;
     const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
     if( fresult.result ) {
         cosmetics[ fresult.ndx ] = cosmetics.back();
@@ -146,10 +429,12 @@ void submap::delete_signage( const point &p )
 void submap::update_legacy_computer()
 {
     if( legacy_computer ) {
-        for( int x = 0; x < SEEX; ++x ) {
-            for( int y = 0; y < SEEY; ++y ) {
-                if( frn[x][y] == furn_str_id( "f_console" ) ) {
-                    computers.emplace( point( x, y ), *legacy_computer );
+        if( tiles ) {
+            for( int x = 0; x < SEEX; ++x ) {
+                for( int y = 0; y < SEEY; ++y ) {
+                    if( tiles->frn[x][y] == furn_str_id( "f_console" ) ) {
+                        computers.emplace( point( x, y ), *legacy_computer );
+                    }
                 }
             }
         }
@@ -159,7 +444,7 @@ void submap::update_legacy_computer()
 
 bool submap::has_computer( const point &p ) const
 {
-    return computers.find( p ) != computers.end() || ( legacy_computer && frn[p.x][p.y]
+    return computers.find( p ) != computers.end() || ( legacy_computer && get_furn( p )
             == furn_str_id( "f_console" ) );
 }
 
@@ -171,7 +456,7 @@ const computer *submap::get_computer( const point &p ) const
     if( it != computers.end() ) {
         return &it->second;
     }
-    if( legacy_computer && frn[p.x][p.y] == furn_str_id( "f_console" ) ) {
+    if( legacy_computer && get_furn( p ) == furn_str_id( "f_console" ) ) {
         return legacy_computer.get();
     }
     return nullptr;
@@ -179,6 +464,7 @@ const computer *submap::get_computer( const point &p ) const
 
 computer *submap::get_computer( const point &p )
 {
+    modified = true;
     // need to update to std::map first so modifications to the returned object
     // only affects the exact point p
     //update_legacy_computer();
@@ -191,6 +477,7 @@ computer *submap::get_computer( const point &p )
 
 void submap::set_computer( const point &p, const computer &c )
 {
+    modified = true;
     //update_legacy_computer();
     const auto it = computers.find( p );
     if( it != computers.end() ) {
@@ -202,6 +489,7 @@ void submap::set_computer( const point &p, const computer &c )
 
 void submap::delete_computer( const point &p )
 {
+    modified = true;
     update_legacy_computer();
     computers.erase( p );
 }
@@ -218,6 +506,7 @@ bool submap::contains_vehicle( vehicle *veh )
 
 void submap::rotate( int turns )
 {
+    modified = true;
     turns = turns % 4;
 
     if( turns == 0 ) {
@@ -231,18 +520,21 @@ void submap::rotate( int turns )
         return p.rotate( 4 - turns, { SEEX, SEEY } );
     };
 
-    if( turns == 2 ) {
+    if( !tiles ) {
+        // A uniform block looks the same from every direction; only the
+        // members below carry positions that need rotating.
+    } else if( turns == 2 ) {
         // Swap horizontal stripes.
         for( int j = 0, je = SEEY / 2; j < je; ++j ) {
             for( int i = j, ie = SEEX - j; i < ie; ++i ) {
-                swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
+                tiles->swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
             }
         }
         // Swap vertical stripes so that they don't overlap with
         // the already swapped horizontals.
         for( int i = 0, ie = SEEX / 2; i < ie; ++i ) {
             for( int j = i + 1, je = SEEY - i - 1; j < je; ++j ) {
-                swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
+                tiles->swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
             }
         }
     } else {
@@ -255,7 +547,7 @@ void submap::rotate( int turns )
                 for( int k = 0; k < 3; ++k ) {
                     p = pp;
                     pp = rotate_point_ccw( pp );
-                    swap_soa_tile( p, pp );
+                    tiles->swap_soa_tile( p, pp );
                 }
             }
         }
@@ -288,16 +580,21 @@ void submap::rotate( int turns )
         rot_comp.emplace( rotate_point( elem.first ), elem.second );
     }
     computers = rot_comp;
+
+    rebuild_field_cells();
 }
 
 void submap::mirror( bool horizontally )
 {
+    modified = true;
     std::map<point, computer> mirror_comp;
 
     if( horizontally ) {
-        for( int i = 0, ie = SEEX / 2; i < ie; i++ ) {
-            for( int k = 0; k < SEEY; k++ ) {
-                swap_soa_tile( { i, k }, { SEEX - 1 - i, k } );
+        if( tiles ) {
+            for( int i = 0, ie = SEEX / 2; i < ie; i++ ) {
+                for( int k = 0; k < SEEY; k++ ) {
+                    tiles->swap_soa_tile( { i, k }, { SEEX - 1 - i, k } );
+                }
             }
         }
 
@@ -312,9 +609,11 @@ void submap::mirror( bool horizontally )
         }
         computers = mirror_comp;
     } else {
-        for( int k = 0, ke = SEEY / 2; k < ke; k++ ) {
-            for( int i = 0; i < SEEX; i++ ) {
-                swap_soa_tile( { i, k }, { i, SEEY - 1 - k } );
+        if( tiles ) {
+            for( int k = 0, ke = SEEY / 2; k < ke; k++ ) {
+                for( int i = 0; i < SEEX; i++ ) {
+                    tiles->swap_soa_tile( { i, k }, { i, SEEY - 1 - k } );
+                }
             }
         }
 
@@ -329,4 +628,6 @@ void submap::mirror( bool horizontally )
         }
         computers = mirror_comp;
     }
+
+    rebuild_field_cells();
 }
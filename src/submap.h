@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_SUBMAP_H
 #define CATA_SRC_SUBMAP_H
 
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
@@ -60,9 +61,16 @@ struct maptile_soa {
     int                rad[sx][sy];  // Irradiation of each square
 
     void swap_soa_tile( const point &p1, const point &p2 );
+
+    // Tile blocks are large and churn constantly as the reality bubble
+    // shifts and the mapbuffer loads and evicts; their blocks are
+    // recycled through a freelist instead of hitting the system
+    // allocator every time.
+    static void *operator new( std::size_t size );
+    static void operator delete( void *ptr, std::size_t size ) noexcept;
 };
 
-class submap : maptile_soa<SEEX, SEEY>
+class submap
 {
     public:
         submap();
@@ -72,108 +80,153 @@ class submap : maptile_soa<SEEX, SEEY>
         submap &operator=( submap && ) noexcept;
 
         trap_id get_trap( const point &p ) const {
-            return trp[p.x][p.y];
+            return tiles ? tiles->trp[p.x][p.y] : uniform_trap();
         }
 
-        void set_trap( const point &p, trap_id trap ) {
-            is_uniform = false;
-            trp[p.x][p.y] = trap;
-        }
+        void set_trap( const point &p, trap_id trap );
+
+        void set_all_traps( const trap_id &trap );
 
-        void set_all_traps( const trap_id &trap ) {
-            std::uninitialized_fill_n( &trp[0][0], elements, trap );
+        // Number of tiles with a non-null trap, so trap scans can skip
+        // submaps that have none.
+        int get_trap_count() const {
+            return trap_count;
         }
 
         furn_id get_furn( const point &p ) const {
-            return frn[p.x][p.y];
+            return tiles ? tiles->frn[p.x][p.y] : uniform_furn();
         }
 
         void set_furn( const point &p, furn_id furn ) {
+            if( !tiles ) {
+                materialize();
+            }
             is_uniform = false;
-            frn[p.x][p.y] = furn;
+            modified = true;
+            tiles->frn[p.x][p.y] = furn;
         }
 
-        void set_all_furn( const furn_id &furn ) {
-            std::uninitialized_fill_n( &frn[0][0], elements, furn );
-        }
+        void set_all_furn( const furn_id &furn );
 
         ter_id get_ter( const point &p ) const {
-            return ter[p.x][p.y];
+            return tiles ? tiles->ter[p.x][p.y] : uniform_ter;
         }
 
         void set_ter( const point &p, ter_id terr ) {
+            if( !tiles ) {
+                materialize();
+            }
             is_uniform = false;
-            ter[p.x][p.y] = terr;
+            modified = true;
+            tiles->ter[p.x][p.y] = terr;
         }
 
-        void set_all_ter( const ter_id &terr ) {
-            std::uninitialized_fill_n( &ter[0][0], elements, terr );
-        }
+        void set_all_ter( const ter_id &terr );
 
         int get_radiation( const point &p ) const {
-            return rad[p.x][p.y];
+            return tiles ? tiles->rad[p.x][p.y] : 0;
         }
 
         void set_radiation( const point &p, const int radiation ) {
+            if( !tiles ) {
+                materialize();
+            }
             is_uniform = false;
-            rad[p.x][p.y] = radiation;
+            modified = true;
+            tiles->rad[p.x][p.y] = radiation;
         }
 
         uint8_t get_lum( const point &p ) const {
-            return lum[p.x][p.y];
+            return tiles ? tiles->lum[p.x][p.y] : 0;
         }
 
         void set_lum( const point &p, uint8_t luminance ) {
+            if( !tiles ) {
+                materialize();
+            }
             is_uniform = false;
-            lum[p.x][p.y] = luminance;
+            modified = true;
+            tiles->lum[p.x][p.y] = luminance;
         }
 
         void update_lum_add( const point &p, const item &i ) {
+            if( !tiles ) {
+                materialize();
+            }
             is_uniform = false;
-            if( i.is_emissive() && lum[p.x][p.y] < 255 ) {
-                lum[p.x][p.y]++;
+            modified = true;
+            if( i.is_emissive() && tiles->lum[p.x][p.y] < 255 ) {
+                tiles->lum[p.x][p.y]++;
             }
         }
 
         void update_lum_rem( const point &p, const item &i ) {
+            if( !tiles ) {
+                materialize();
+            }
             is_uniform = false;
+            modified = true;
             if( !i.is_emissive() ) {
                 return;
-            } else if( lum[p.x][p.y] && lum[p.x][p.y] < 255 ) {
-                lum[p.x][p.y]--;
+            } else if( tiles->lum[p.x][p.y] && tiles->lum[p.x][p.y] < 255 ) {
+                tiles->lum[p.x][p.y]--;
                 return;
             }
 
             // Have to scan through all items to be sure removing i will actually lower
             // the count below 255.
             int count = 0;
-            for( const auto &it : itm[p.x][p.y] ) {
+            for( const auto &it : tiles->itm[p.x][p.y] ) {
                 if( it.is_emissive() ) {
                     count++;
                 }
             }
 
             if( count <= 256 ) {
-                lum[p.x][p.y] = static_cast<uint8_t>( count - 1 );
+                tiles->lum[p.x][p.y] = static_cast<uint8_t>( count - 1 );
             }
         }
 
         // TODO: Replace this as it essentially makes itm public
         cata::colony<item> &get_items( const point &p ) {
-            return itm[p.x][p.y];
+            if( !tiles ) {
+                materialize();
+            }
+            modified = true;
+            return tiles->itm[p.x][p.y];
         }
 
         const cata::colony<item> &get_items( const point &p ) const {
-            return itm[p.x][p.y];
+            return tiles ? tiles->itm[p.x][p.y] : uniform_items();
         }
 
         // TODO: Replace this as it essentially makes fld public
         field &get_field( const point &p ) {
-            return fld[p.x][p.y];
+            if( !tiles ) {
+                materialize();
+            }
+            modified = true;
+            return tiles->fld[p.x][p.y];
         }
 
         const field &get_field( const point &p ) const {
-            return fld[p.x][p.y];
+            return tiles ? tiles->fld[p.x][p.y] : uniform_field();
+        }
+
+        // The bits below mirror which tiles currently hold at least one
+        // field entry. They are maintained alongside field_count on
+        // insert/remove so field processing can iterate only occupied
+        // cells instead of walking all of them.
+        bool has_field_at( const point &p ) const {
+            return field_cells.test( p.x * SEEY + p.y );
+        }
+
+        void set_field_presence( const point &p ) {
+            field_cells.set( p.x * SEEY + p.y );
+        }
+
+        void clear_field_presence( const point &p ) {
+            field_cells.reset( p.x * SEEY + p.y );
         }
 
         struct cosmetic_t {
@@ -189,6 +242,7 @@ class submap : maptile_soa<SEEX, SEEY>
             ins.type = type;
             ins.str = str;
 
+            modified = true;
             cosmetics.push_back( ins );
         }
 
@@ -197,6 +251,7 @@ class submap : maptile_soa<SEEX, SEEY>
         }
 
         void set_temperature( int new_temperature ) {
+            modified = true;
             temperature = new_temperature;
         }
 
@@ -227,18 +282,42 @@ class submap : maptile_soa<SEEX, SEEY>
         void rotate( int turns );
         void mirror( bool horizontally );
 
-        void store( JsonOut &jsout ) const;
+        void store( JsonOut &jsout, bool skip_tile_arrays = false ) const;
         void load( JsonIn &jsin, const std::string &member_name, int version );
 
+        // Binary fast path for the flat maptile_soa arrays (terrain,
+        // furniture, traps, luminance, radiation). The remaining members
+        // still go through store()/load() as JSON; see mapbuffer::save_quad.
+        void store_tile_arrays( std::ostream &fout ) const;
+        void load_tile_arrays( std::istream &fin );
+
         // If is_uniform is true, this submap is a solid block of terrain
         // Uniform submaps aren't saved/loaded, because regenerating them is faster
         bool is_uniform = false;
 
+        // Set on any mutation since this submap was loaded or last written to
+        // disk. Quads whose submaps are all unmodified are not rewritten by
+        // mapbuffer::save; see save_quad. Mutable accessors mark this
+        // conservatively - a spurious rewrite is cheap, a missed one loses
+        // data. Defaults to true so freshly generated submaps always save.
+        bool modified = true;
+
         std::vector<cosmetic_t> cosmetics; // Textual "visuals" for squares
 
         active_item_cache active_items;
 
         int field_count = 0;
+        /**
+         * Fields in this submap need no processing before this time;
+         * set by map::process_fields_in_submap when every field here is
+         * passive, cleared whenever a field is added or changed.
+         */
+        time_point fields_dormant_until = calendar::turn_zero;
+        /**
+         * When fields here last aged; a processing pass ages them by the
+         * full span since then, so deferred submaps catch up exactly.
+         */
+        time_point last_field_process = calendar::turn_zero;
         time_point last_touched = calendar::turn_zero;
         std::vector<spawn_point> spawns;
         /**
@@ -251,11 +330,39 @@ class submap : maptile_soa<SEEX, SEEY>
         std::unique_ptr<basecamp> camp;  // only allowing one basecamp per submap
 
     private:
+        /**
+         * The full tile arrays, allocated on first mutation. While this is
+         * null the submap is a flyweight: every tile reads as uniform_ter
+         * with no furniture, trap, items, field, radiation or luminance.
+         * Open-air and solid-rock z-levels stay in this state for their
+         * whole lifetime, so they never pay for the arrays at all.
+         */
+        std::unique_ptr<maptile_soa<SEEX, SEEY>> tiles;
+        // Terrain of every tile while the arrays are unallocated.
+        ter_id uniform_ter;
         std::map<point, computer> computers;
         std::unique_ptr<computer> legacy_computer;
+        std::bitset<SEEX *SEEY> field_cells;
+        int trap_count = 0;
         int temperature = 0;
 
+        // Allocate the tile arrays and fill them with the uniform state.
+        // Every mutating accessor funnels through this before writing.
+        void materialize();
+        // Tile contents of an unmaterialized submap.
+        static furn_id uniform_furn();
+        static trap_id uniform_trap();
+        static const field &uniform_field();
+        static const cata::colony<item> &uniform_items();
+
         void update_legacy_computer();
+        // Recompute field_cells from fld, for operations (rotate/mirror)
+        // that rearrange tiles wholesale.
+        void rebuild_field_cells();
+        // JSON members for the flat tile arrays, and for everything else.
+        // Binary quads emit only the latter; see store().
+        void store_tile_array_members( JsonOut &jsout ) const;
+        void store_dynamic_members( JsonOut &jsout ) const;
 
         static constexpr size_t elements = SEEX * SEEY;
 };
@@ -303,7 +410,9 @@ struct maptile {
         }
 
         const field &get_field() const {
-            return sm->get_field( pos() );
+            // Use the const overload: it neither marks the submap modified
+            // nor materializes a still-uniform one.
+            return static_cast<const submap *>( sm )->get_field( pos() );
         }
 
         field_entry *find_field( const field_type_id &field_to_find ) {
@@ -332,12 +441,12 @@ struct maptile {
 
         // For map::draw_maptile
         size_t get_item_count() const {
-            return sm->get_items( pos() ).size();
+            return static_cast<const submap *>( sm )->get_items( pos() ).size();
         }
 
         // Assumes there is at least one item
         const item &get_uppermost_item() const {
-            return *std::prev( sm->get_items( pos() ).cend() );
+            return *std::prev( static_cast<const submap *>( sm )->get_items( pos() ).cend() );
         }
 };
 
@@ -1495,8 +1495,13 @@ void Character::suffer()
         }
     }
 
+    // process_bionic is a no-op for a switched-off bionic that handles no
+    // fuel, which covers most of an installed set.
+    const std::vector<bool> &bionic_fuel_mask = bionic_fuel_processing_mask();
     for( size_t i = 0; i < get_bionics().size(); i++ ) {
-        process_bionic( i );
+        if( ( *my_bionics )[i].powered || bionic_fuel_mask[i] ) {
+            process_bionic( i );
+        }
     }
 
     for( const trait_id &mut_id : get_mutations() ) {
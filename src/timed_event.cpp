@@ -1,5 +1,6 @@
 #include "timed_event.h"
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <new>
@@ -270,6 +271,22 @@ void timed_event::actualize()
     }
 }
 
+/// Whether events of the given type do something in @ref timed_event::per_turn
+/// and therefore need to be visited every turn rather than only when due.
+static bool has_per_turn_effect( const timed_event_type type )
+{
+    switch( type ) {
+        case timed_event_type::WANTED:
+        case timed_event_type::SPAWN_WYRMS:
+        case timed_event_type::AMIGARA:
+        case timed_event_type::AMIGARA_WHISPERS:
+        case timed_event_type::TEMPLE_OPEN:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void timed_event::per_turn()
 {
     Character &player_character = get_player_character();
@@ -338,8 +355,24 @@ void timed_event::per_turn()
     }
 }
 
+void timed_event_manager::recalc_due()
+{
+    next_due = time_point::from_turn( std::numeric_limits<int>::max() );
+    queued_per_turn = 0;
+    for( const timed_event &e : events ) {
+        next_due = std::min( next_due, e.when );
+        if( has_per_turn_effect( e.type ) ) {
+            queued_per_turn++;
+        }
+    }
+}
+
 void timed_event_manager::process()
 {
+    // Skip the pass entirely on turns where no queued event can do anything.
+    if( queued_per_turn == 0 && calendar::turn < next_due ) {
+        return;
+    }
     for( auto it = events.begin(); it != events.end(); ) {
         it->per_turn();
         if( it->when <= calendar::turn ) {
@@ -349,6 +382,9 @@ void timed_event_manager::process()
             it++;
         }
     }
+    // per_turn and actualize may have shifted completion times or queued
+    // further events, so rebuild the bookkeeping from what remains.
+    recalc_due();
 }
 
 void timed_event_manager::add( const timed_event_type type, const time_point &when,
@@ -363,6 +399,10 @@ void timed_event_manager::add( const timed_event_type type, const time_point &wh
                                int strength )
 {
     events.emplace_back( type, when, faction_id, where, strength );
+    next_due = std::min( next_due, when );
+    if( has_per_turn_effect( type ) ) {
+        queued_per_turn++;
+    }
 }
 
 bool timed_event_manager::queued( const timed_event_type type ) const
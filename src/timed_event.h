@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_TIMED_EVENT_H
 #define CATA_SRC_TIMED_EVENT_H
 
+#include <limits>
 #include <list>
 
 #include "calendar.h"
@@ -48,6 +49,16 @@ class timed_event_manager
 {
     private:
         std::list<timed_event> events;
+        /** Earliest completion time among the queued events, far future when
+         * the queue is empty.  Lets @ref process return without walking the
+         * queue on turns where nothing can happen. */
+        time_point next_due = time_point::from_turn( std::numeric_limits<int>::max() );
+        /** Number of queued events whose type has a per-turn effect and
+         * therefore requires a full pass every turn. */
+        int queued_per_turn = 0;
+
+        /// Recompute @ref next_due and @ref queued_per_turn from the queue.
+        void recalc_due();
 
     public:
         /**
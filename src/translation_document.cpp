@@ -1,5 +1,7 @@
 #if defined(LOCALIZE)
 
+#include <cstring>
+
 #include "debug.h"
 #include "filesystem.h"
 #include "string_formatter.h"
@@ -114,6 +116,8 @@ TranslationDocument::TranslationDocument( const std::string &path )
                 string_format( "translated strings table offset %zu with %zu entries exceeds buffer size %zu",
                                translated_strings_table_offset, number_of_strings, data.size() ) );
     }
+    original_offsets.reserve( number_of_strings );
+    translated_offsets.reserve( number_of_strings );
     for( std::size_t i = 0; i < number_of_strings; i++ ) {
         std::size_t length = GetUint32( original_strings_table_offset + 8 * i );
         std::size_t offset = GetUint32( original_strings_table_offset + 8 * i + 4 );
@@ -130,7 +134,6 @@ TranslationDocument::TranslationDocument( const std::string &path )
         original_offsets.emplace_back( offset );
     }
     for( std::size_t i = 0; i < number_of_strings; i++ ) {
-        std::vector<std::size_t> offsets;
         std::size_t length = GetUint32( translated_strings_table_offset + 8 * i );
         std::size_t offset = GetUint32( translated_strings_table_offset + 8 * i + 4 );
         if( offset >= data.size() || length >= data.size() || offset + length >= data.size() ) {
@@ -143,13 +146,18 @@ TranslationDocument::TranslationDocument( const std::string &path )
                     string_format( "translated string %zu offset %zu with length %zu not terminated by '\\0'",
                                    i, offset, length ) );
         }
-        offsets.emplace_back( offset );
-        for( std::size_t idx = offset; idx + 1 < offset + length; idx++ ) {
-            if( data[idx] == '\0' ) {
-                offsets.emplace_back( idx + 1 );
+        translated_offsets.emplace_back( offset );
+        const char *const str_begin = data.c_str() + offset;
+        const char *const str_end = str_begin + length;
+        const char *nul = static_cast<const char *>( memchr( str_begin, '\0', length ) );
+        if( nul != nullptr && nul + 1 < str_end ) {
+            std::vector<std::size_t> &forms = plural_offsets[i];
+            forms.emplace_back( offset );
+            while( nul != nullptr && nul + 1 < str_end ) {
+                forms.emplace_back( nul + 1 - data.c_str() );
+                nul = static_cast<const char *>( memchr( nul + 1, '\0', str_end - ( nul + 1 ) ) );
             }
         }
-        translated_offsets.emplace_back( offsets );
     }
     const std::string metadata( GetTranslatedString( 0 ) );
     const std::string plural_rules_header( "Plural-Forms:" );
@@ -197,19 +205,23 @@ const char *TranslationDocument::GetOriginalString( const std::size_t index ) co
 
 const char *TranslationDocument::GetTranslatedString( const std::size_t index ) const
 {
-    return GetString( translated_offsets[index][0] );
+    return GetString( translated_offsets[index] );
 }
 
 const char *TranslationDocument::GetTranslatedStringPlural( const std::size_t index,
         std::size_t n ) const
 {
     std::size_t plural_form = EvaluatePluralForm( n );
-    if( plural_form >= translated_offsets[index].size() ) {
+    if( plural_form == 0 ) {
+        return GetString( translated_offsets[index] );
+    }
+    const auto it = plural_offsets.find( index );
+    if( it == plural_offsets.end() || plural_form >= it->second.size() ) {
         DebugLog( D_ERROR, DC_ALL ) << "Plural forms expression evaluated out-of-bound at string entry " <<
                                     index << " with n=" << n;
-        return GetString( translated_offsets[index][0] );
+        return GetString( translated_offsets[index] );
     }
-    return GetString( translated_offsets[index][plural_form] );
+    return GetString( it->second[plural_form] );
 }
 
 #endif // defined(LOCALIZE)
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "translation_plural_evaluator.h"
@@ -40,7 +41,14 @@ class TranslationDocument
         std::string data;
         Endianness endianness;
         std::vector<std::size_t> original_offsets;
-        std::vector<std::vector<std::size_t>> translated_offsets;
+        // Offset of the first (singular) form of each translated string.
+        // The overwhelming majority of entries have only that one form, so
+        // the full per-form offset lists live in a side table instead of
+        // paying for a heap vector per string.
+        std::vector<std::size_t> translated_offsets;
+        // Entry index -> offsets of every plural form (including the
+        // first), only for entries that actually have more than one form.
+        std::unordered_map<std::size_t, std::vector<std::size_t>> plural_offsets;
         std::unique_ptr<TranslationPluralRulesEvaluator> plural_rules;
 
         std::uint8_t GetByte( const std::size_t byteIndex ) const;
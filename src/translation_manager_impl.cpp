@@ -108,6 +108,11 @@ void TranslationManagerImpl::LoadDocuments( const std::vector<std::string> &file
             DebugLog( D_ERROR, DC_ALL ) << e.what();
         }
     }
+    std::size_t total_strings = 0;
+    for( const TranslationDocument &doc : documents ) {
+        total_strings += doc.Count();
+    }
+    string_to_document_no.reserve( total_strings );
     for( std::size_t document = 0; document < documents.size(); document++ ) {
         for( std::size_t i = 0; i < documents[document].Count(); i++ ) {
             const char *message = documents[document].GetOriginalString( i );
@@ -0,0 +1,283 @@
+#include "turn_profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <utility>
+#include <vector>
+
+#include "cached_options.h"
+#include "calendar.h"
+#include "cata_utility.h"
+#include "creature_tracker.h"
+#include "debug.h"
+#include "game.h"
+#include "json.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "messages.h"
+#include "path_info.h"
+
+namespace turn_profiler
+{
+
+namespace
+{
+
+// Number of turns aggregated before a report is printed.
+constexpr int window_turns = 100;
+constexpr size_t phase_count = static_cast<size_t>( phase::num_phases );
+
+const std::array<const char *, phase_count> phase_names = { {
+        "fields", "vehicles", "map cache", "monster ai", "npc ai", "drawing"
+    }
+};
+
+bool active = false;
+// Microseconds spent per phase during the current turn.
+std::array<int64_t, phase_count> current_turn = {};
+// Rolling window of completed per-turn phase totals, in microseconds.
+std::array<std::vector<int64_t>, phase_count> window;
+int banked_turns = 0;
+
+struct trace_event {
+    const char *name;
+    std::string detail;
+    int64_t start_us;
+    int64_t dur_us;
+};
+
+// Hard cap on recorded spans so a runaway capture cannot eat all memory.
+constexpr size_t max_trace_events = 1 << 20;
+
+bool capture_active = false;
+int capture_turns_left = 0;
+std::vector<trace_event> trace_events;
+std::chrono::steady_clock::time_point capture_epoch;
+int64_t capture_turn_start_us = 0;
+
+int64_t since_epoch_us( const std::chrono::steady_clock::time_point &when )
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>( when - capture_epoch ).count();
+}
+
+void record_event( const char *name, std::string &&detail, const int64_t start_us,
+                   const int64_t dur_us )
+{
+    if( trace_events.size() < max_trace_events ) {
+        trace_events.push_back( { name, std::move( detail ), start_us, dur_us } );
+    }
+}
+
+void write_capture()
+{
+    const std::string path = string_format( "%s/trace-%lld.json", PATH_INFO::config_dir(),
+                                            static_cast<long long>( std::time( nullptr ) ) );
+    const bool written = write_to_file( path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "traceEvents" );
+        jsout.start_array();
+        for( const trace_event &e : trace_events ) {
+            jsout.start_object();
+            jsout.member( "name", e.name );
+            jsout.member( "ph", "X" );
+            jsout.member( "pid", 0 );
+            jsout.member( "tid", 0 );
+            jsout.member( "ts", e.start_us );
+            jsout.member( "dur", e.dur_us );
+            if( !e.detail.empty() ) {
+                jsout.member( "args" );
+                jsout.start_object();
+                jsout.member( "detail", e.detail );
+                jsout.end_object();
+            }
+            jsout.end_object();
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }, "trace data" );
+    if( written ) {
+        add_msg( "turn profiler: wrote %d trace spans to %s",
+                 static_cast<int>( trace_events.size() ), path );
+    }
+    trace_events.clear();
+    trace_events.shrink_to_fit();
+}
+
+// Writes the just-finished turn's phase breakdown and world-state counts to
+// the debug log, to give "it froze for a moment" reports something to
+// correlate against.
+void dump_slow_turn( const int64_t total_us )
+{
+    std::string phases;
+    for( size_t i = 0; i < phase_count; ++i ) {
+        if( current_turn[i] > 0 ) {
+            phases += string_format( " %s %.2fms", phase_names[i], current_turn[i] / 1000.0 );
+        }
+    }
+    int buffered_submaps = 0;
+    for( auto it = MAPBUFFER.begin(); it != MAPBUFFER.end(); ++it ) {
+        buffered_submaps++;
+    }
+    const map &here = get_map();
+    DebugLog( D_WARNING, D_GAME ) << string_format(
+        "slow turn %d: %.2f ms total;%s; %d monsters, %d fields, "
+        "%d buffered submaps, %d active items",
+        to_turn<int>( calendar::turn ), total_us / 1000.0, phases,
+        static_cast<int>( g->critter_tracker->size() ), here.debug_field_count(),
+        buffered_submaps, here.debug_active_item_count() );
+}
+
+int64_t percentile( std::vector<int64_t> &samples, const double frac )
+{
+    const size_t nth = std::min( samples.size() - 1,
+                                 static_cast<size_t>( frac * samples.size() ) );
+    std::nth_element( samples.begin(), samples.begin() + nth, samples.end() );
+    return samples[nth];
+}
+
+void report()
+{
+    add_msg( "turn profiler, last %d turns (p50/p95/max ms):", banked_turns );
+    for( size_t i = 0; i < phase_count; ++i ) {
+        std::vector<int64_t> &samples = window[i];
+        if( samples.empty() ) {
+            continue;
+        }
+        const int64_t worst = *std::max_element( samples.begin(), samples.end() );
+        const int64_t p95 = percentile( samples, 0.95 );
+        const int64_t p50 = percentile( samples, 0.5 );
+        add_msg( "  %s: %.2f / %.2f / %.2f", phase_names[i],
+                 p50 / 1000.0, p95 / 1000.0, worst / 1000.0 );
+    }
+}
+
+void clear_stats()
+{
+    current_turn = {};
+    for( std::vector<int64_t> &samples : window ) {
+        samples.clear();
+    }
+    banked_turns = 0;
+}
+
+} // namespace
+
+bool enabled()
+{
+    return active;
+}
+
+void toggle()
+{
+    active = !active;
+    clear_stats();
+    add_msg( string_format( "turn profiler %s", active ? "enabled" : "disabled" ) );
+}
+
+bool capturing()
+{
+    return capture_active;
+}
+
+void start_capture( const int turns )
+{
+    if( capture_active || turns <= 0 ) {
+        return;
+    }
+    capture_active = true;
+    capture_turns_left = turns;
+    trace_events.clear();
+    trace_events.reserve( 4096 );
+    capture_epoch = std::chrono::steady_clock::now();
+    capture_turn_start_us = 0;
+    add_msg( "turn profiler: capturing a %d turn trace", turns );
+}
+
+void finish_turn()
+{
+    if( capture_active ) {
+        const int64_t now_us = since_epoch_us( std::chrono::steady_clock::now() );
+        record_event( "turn", string_format( "turn %d", to_turn<int>( calendar::turn ) ),
+                      capture_turn_start_us, now_us - capture_turn_start_us );
+        capture_turn_start_us = now_us;
+        if( --capture_turns_left <= 0 ) {
+            capture_active = false;
+            write_capture();
+        }
+    }
+    if( slow_turn_warning_ms > 0 ) {
+        int64_t total_us = 0;
+        for( const int64_t phase_us : current_turn ) {
+            total_us += phase_us;
+        }
+        if( total_us >= slow_turn_warning_ms * 1000LL ) {
+            dump_slow_turn( total_us );
+        }
+    }
+    if( !active ) {
+        current_turn = {};
+        return;
+    }
+    for( size_t i = 0; i < phase_count; ++i ) {
+        window[i].push_back( current_turn[i] );
+    }
+    current_turn = {};
+    if( ++banked_turns >= window_turns ) {
+        report();
+        clear_stats();
+    }
+}
+
+scoped_timer::scoped_timer( const phase p ) : p( p ),
+    armed( active || capture_active || slow_turn_warning_ms > 0 )
+{
+    if( armed ) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+scoped_timer::~scoped_timer()
+{
+    if( !armed ) {
+        return;
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    const int64_t elapsed_us =
+        std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    if( active || slow_turn_warning_ms > 0 ) {
+        current_turn[static_cast<size_t>( p )] += elapsed_us;
+    }
+    if( capture_active ) {
+        record_event( phase_names[static_cast<size_t>( p )], std::string(),
+                      since_epoch_us( start ), elapsed_us );
+    }
+}
+
+scoped_span::scoped_span( const char *const name ) : name( name ), armed( capture_active )
+{
+    if( armed ) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+scoped_span::~scoped_span()
+{
+    if( !armed || !capture_active ) {
+        return;
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    record_event( name, std::move( detail ), since_epoch_us( start ),
+                  std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count() );
+}
+
+void scoped_span::set_detail( std::string new_detail )
+{
+    if( armed ) {
+        detail = std::move( new_detail );
+    }
+}
+
+} // namespace turn_profiler
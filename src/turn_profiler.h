@@ -0,0 +1,87 @@
+#pragma once
+#ifndef CATA_SRC_TURN_PROFILER_H
+#define CATA_SRC_TURN_PROFILER_H
+
+#include <chrono>
+#include <string>
+
+/**
+ * Wall-clock accounting for the expensive phases of a game turn.
+ * Toggled at runtime from the debug menu (@see debug_menu_index);
+ * while enabled, per-turn phase totals are banked into a rolling
+ * window and p50/p95/max stats are printed to the message log every
+ * time the window fills. While disabled the scoped timers cost a
+ * single branch, so the instrumentation can stay in release builds.
+ */
+namespace turn_profiler
+{
+
+enum class phase : int {
+    fields,
+    vehicles,
+    map_cache,
+    monster_ai,
+    npc_ai,
+    drawing,
+    num_phases
+};
+
+bool enabled();
+
+/** Toggles measurement, discarding any partially collected stats. */
+void toggle();
+
+/** Marks the turn boundary: banks the phase totals measured since the
+ *  last call and reports once the rolling window is full. */
+void finish_turn();
+
+/** True while a trace capture is running. Detail strings for spans are
+ *  only worth building when this returns true. */
+bool capturing();
+
+/** Records a chrome://tracing / Perfetto JSON trace covering the next
+ *  @p turns turns. The file is written into the config directory when
+ *  the window ends, giving a flight-recorder artifact that can be
+ *  inspected after the fact instead of a live profiler session. */
+void start_capture( int turns );
+
+/** Adds the wall-clock lifetime of this object to a phase's total for
+ *  the current turn. Does nothing while the profiler is disabled. */
+class scoped_timer
+{
+    public:
+        explicit scoped_timer( phase p );
+        ~scoped_timer();
+        scoped_timer( const scoped_timer & ) = delete;
+        scoped_timer &operator=( const scoped_timer & ) = delete;
+
+    private:
+        phase p;
+        bool armed;
+        std::chrono::steady_clock::time_point start;
+};
+
+/** Records one named span into the running capture. Costs a single
+ *  branch while no capture is active. */
+class scoped_span
+{
+    public:
+        explicit scoped_span( const char *name );
+        ~scoped_span();
+        scoped_span( const scoped_span & ) = delete;
+        scoped_span &operator=( const scoped_span & ) = delete;
+
+        /** Attaches free-form detail (an OMT id, path endpoints, ...)
+         *  surfaced in the trace viewer's args pane. */
+        void set_detail( std::string detail );
+
+    private:
+        const char *name;
+        bool armed;
+        std::string detail;
+        std::chrono::steady_clock::time_point start;
+};
+
+} // namespace turn_profiler
+
+#endif // CATA_SRC_TURN_PROFILER_H
@@ -558,6 +558,8 @@ void veh_interact::cache_tool_availability()
 {
     Character &player_character = get_player_character();
     crafting_inv = player_character.crafting_inventory();
+    // installability depends on the crafting inventory refreshed above
+    can_mount_cache.clear();
 
     cache_tool_availability_update_lifting( player_character.pos() );
     int mech_jack = 0;
@@ -2287,30 +2289,36 @@ void veh_interact::move_cursor( const point &d, int dstart_at )
 
     can_mount.clear();
     if( !obstruct ) {
-        std::vector<const vpart_info *> req_missing;
-        for( const auto &e : vpart_info::all() ) {
-            const vpart_info &vp = e.second;
-            if( has_critter && vp.has_flag( VPFLAG_OBSTACLE ) ) {
-                continue;
-            }
-            if( veh->can_mount( vd, vp.get_id() ) ) {
-                if( vp.get_id() != vpart_shapes[ vp.name() + vp.base_item.str() ][ 0 ]->get_id() ) {
-                    // only add first shape to install list
+        const auto cached = can_mount_cache.find( vd );
+        if( cached != can_mount_cache.end() ) {
+            can_mount = cached->second;
+        } else {
+            std::vector<const vpart_info *> req_missing;
+            for( const auto &e : vpart_info::all() ) {
+                const vpart_info &vp = e.second;
+                if( has_critter && vp.has_flag( VPFLAG_OBSTACLE ) ) {
                     continue;
                 }
-                if( can_potentially_install( vp ) ) {
-                    can_mount.push_back( &vp );
-                } else {
-                    req_missing.push_back( &vp );
+                if( veh->can_mount( vd, vp.get_id() ) ) {
+                    if( vp.get_id() != vpart_shapes[ vp.name() + vp.base_item.str() ][ 0 ]->get_id() ) {
+                        // only add first shape to install list
+                        continue;
+                    }
+                    if( can_potentially_install( vp ) ) {
+                        can_mount.push_back( &vp );
+                    } else {
+                        req_missing.push_back( &vp );
+                    }
                 }
             }
+            auto vpart_localized_sort = []( const vpart_info * a, const vpart_info * b ) {
+                return localized_compare( a->name(), b->name() );
+            };
+            std::sort( can_mount.begin(), can_mount.end(), vpart_localized_sort );
+            std::sort( req_missing.begin(), req_missing.end(), vpart_localized_sort );
+            can_mount.insert( can_mount.end(), req_missing.cbegin(), req_missing.cend() );
+            can_mount_cache.emplace( vd, can_mount );
         }
-        auto vpart_localized_sort = []( const vpart_info * a, const vpart_info * b ) {
-            return localized_compare( a->name(), b->name() );
-        };
-        std::sort( can_mount.begin(), can_mount.end(), vpart_localized_sort );
-        std::sort( req_missing.begin(), req_missing.end(), vpart_localized_sort );
-        can_mount.insert( can_mount.end(), req_missing.cbegin(), req_missing.cend() );
     }
 
     need_repair.clear();
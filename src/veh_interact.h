@@ -258,6 +258,11 @@ class veh_interact
          * Updated whenever the cursor moves. */
         std::vector<const vpart_info *> can_mount;
 
+        /* Cached can_mount lists per cursor location. The vehicle cannot be
+         * modified while the interaction screen is open, so entries stay valid
+         * until the crafting inventory is refreshed. */
+        std::map<point, std::vector<const vpart_info *>> can_mount_cache;
+
         /* Maps part names to vparts representing different shapes of a part.
          * Used to slim down installable parts list. Only built once. */
         std::map< std::string, std::vector<const vpart_info *> > vpart_shapes;
@@ -1576,7 +1576,7 @@ int vehicle::install_part( const point &dp, const vehicle_part &new_part )
 
     pt.mount = dp;
 
-    refresh();
+    append_part_to_caches( parts.size() - 1 );
     coeff_air_changed = true;
     return parts.size() - 1;
 }
@@ -2611,6 +2611,14 @@ bool vehicle::has_part( const std::string &flag, bool enabled ) const
     } );
 }
 
+bool vehicle::has_enabled_idle_part( const std::string &flag ) const
+{
+    return std::any_of( idle_parts.begin(), idle_parts.end(), [this, &flag]( int p ) {
+        const vehicle_part &e = parts[ p ];
+        return !e.removed && e.enabled && !e.is_broken() && e.info().has_flag( flag );
+    } );
+}
+
 bool vehicle::has_part( const tripoint &pos, const std::string &flag, bool enabled ) const
 {
     const tripoint relative_pos = pos - global_pos3();
@@ -3045,10 +3053,12 @@ point vehicle::coord_translate( const point &p ) const
 void vehicle::coord_translate( const units::angle &dir, const point &pivot, const point &p,
                                tripoint &q ) const
 {
-    tileray tdir( dir );
-    tdir.advance( p.x - pivot.x );
-    q.x = tdir.dx() + tdir.ortho_dx( p.y - pivot.y );
-    q.y = tdir.dy() + tdir.ortho_dy( p.y - pivot.y );
+    if( !coord_translate_ray_cached || coord_translate_angle != dir ) {
+        coord_translate_ray = tileray( dir );
+        coord_translate_angle = dir;
+        coord_translate_ray_cached = true;
+    }
+    coord_translate( coord_translate_ray, pivot, p, q );
 }
 
 void vehicle::coord_translate( tileray tdir, const point &pivot, const point &p, tripoint &q ) const
@@ -3066,6 +3076,14 @@ tripoint vehicle::mount_to_tripoint( const point &mount ) const
 
 tripoint vehicle::mount_to_tripoint( const point &mount, const point &offset ) const
 {
+    if( offset == point_zero ) {
+        // Occupied mounts already carry their rotated offset for the
+        // current facing in precalc[0]; no need to redo the rotation.
+        const auto it = relative_parts.find( mount );
+        if( it != relative_parts.end() && !it->second.empty() ) {
+            return global_pos3() + parts[it->second.front()].precalc[0];
+        }
+    }
     tripoint mnt_translated;
     coord_translate( pivot_rotation[0], pivot_anchor[ 0 ], mount + offset, mnt_translated );
     return global_pos3() + mnt_translated;
@@ -4270,6 +4288,24 @@ float vehicle::k_traction( float wheel_traction_area ) const
     return std::max( 0.1f, traction );
 }
 
+cata::optional<float> vehicle::cached_wheel_traction() const
+{
+    if( traction_cache_turn == to_turn<int>( calendar::turn ) &&
+        traction_cache_pos == global_pos3() &&
+        traction_cache_direction == face.dir() ) {
+        return traction_cache_area;
+    }
+    return cata::nullopt;
+}
+
+void vehicle::set_cached_wheel_traction( float traction_area ) const
+{
+    traction_cache_turn = to_turn<int>( calendar::turn );
+    traction_cache_pos = global_pos3();
+    traction_cache_direction = face.dir();
+    traction_cache_area = traction_area;
+}
+
 int vehicle::static_drag( bool actual ) const
 {
     return extra_drag + ( actual && !engine_on && !is_towed() ? -1500 : 0 );
@@ -4980,7 +5016,7 @@ void vehicle::enumerate_vehicles( std::map<vehicle *, bool> &connected_vehicles,
 template <typename Func, typename Vehicle>
 int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action )
 {
-    if( start_veh->loose_parts.empty() ) {
+    if( start_veh->power_cables.empty() ) {
         return amount;
     }
     // Breadth-first search! Initialize the queue with a pointer to ourselves and go!
@@ -4998,11 +5034,7 @@ int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action
 
         add_msg_debug( debugmode::DF_VEHICLE, "Traversing graph with %d power", amount );
 
-        for( int p : current_veh->loose_parts ) {
-            if( !current_veh->part_info( p ).has_flag( "POWER_TRANSFER" ) ) {
-                continue; // ignore loose parts that aren't power transfer cables
-            }
-
+        for( int p : current_veh->power_cables ) {
             vehicle *target_veh = vehicle::find_vehicle( current_veh->parts[p].target.second );
             if( target_veh == nullptr || visited_vehs.count( target_veh ) > 0 ) {
                 // Either no destination here (that vehicle's rolled away or off-map) or
@@ -5038,8 +5070,9 @@ int vehicle::charge_battery( int amount, bool include_other_vehicles )
 {
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> chargeable_parts;
-    for( vehicle_part &p : parts ) {
-        if( p.is_available() && p.is_battery() &&
+    for( const int bi : batteries ) {
+        vehicle_part &p = parts[bi];
+        if( p.is_available() &&
             p.ammo_capacity( ammotype( "battery" ) ) > p.ammo_remaining() ) {
             chargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity( ammotype( "battery" ) ), &p } );
         }
@@ -5078,8 +5111,9 @@ int vehicle::discharge_battery( int amount, bool recurse )
 {
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> dischargeable_parts;
-    for( vehicle_part &p : parts ) {
-        if( p.is_available() && p.is_battery() && p.ammo_remaining() > 0 ) {
+    for( const int bi : batteries ) {
+        vehicle_part &p = parts[bi];
+        if( p.is_available() && p.ammo_remaining() > 0 ) {
             dischargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity( ammotype( "battery" ) ), &p } );
         }
     }
@@ -5171,15 +5205,15 @@ void vehicle::idle( bool on_map )
         update_time( calendar::turn );
     }
 
-    if( has_part( "STEREO", true ) ) {
+    if( has_enabled_idle_part( "STEREO" ) ) {
         play_music();
     }
 
-    if( has_part( "CHIMES", true ) ) {
+    if( has_enabled_idle_part( "CHIMES" ) ) {
         play_chimes();
     }
 
-    if( has_part( "CRASH_TERRAIN_AROUND", true ) ) {
+    if( has_enabled_idle_part( "CRASH_TERRAIN_AROUND" ) ) {
         crash_terrain_around();
     }
 
@@ -5346,6 +5380,7 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
     }
 
     invalidate_mass();
+    get_map().bump_items_generation();
     return cata::optional<vehicle_stack::iterator>( new_pos );
 }
 
@@ -5368,6 +5403,7 @@ vehicle_stack::iterator vehicle::remove_item( int part, const vehicle_stack::con
     active_items.remove( &*it );
 
     invalidate_mass();
+    get_map().bump_items_generation();
     return veh_items.erase( it );
 }
 
@@ -5596,6 +5632,7 @@ void vehicle::refresh()
     emitters.clear();
     relative_parts.clear();
     loose_parts.clear();
+    power_cables.clear();
     wheelcache.clear();
     rail_wheelcache.clear();
     rotors.clear();
@@ -5608,6 +5645,7 @@ void vehicle::refresh()
     mufflers.clear();
     planters.clear();
     accessories.clear();
+    idle_parts.clear();
 
     alternator_load = 0;
     extra_drag = 0;
@@ -5704,6 +5742,9 @@ void vehicle::refresh()
         }
         if( vpi.has_flag( "UNMOUNT_ON_MOVE" ) ) {
             loose_parts.push_back( p );
+            if( vpi.has_flag( "POWER_TRANSFER" ) ) {
+                power_cables.push_back( p );
+            }
         }
         if( !vpi.emissions.empty() || !vpi.exhaust.empty() ) {
             emitters.push_back( p );
@@ -5739,6 +5780,10 @@ void vehicle::refresh()
         if( vpi.has_flag( "SECURITY" ) ) {
             speciality.push_back( p );
         }
+        if( vpi.has_flag( "STEREO" ) || vpi.has_flag( "CHIMES" ) ||
+            vpi.has_flag( "CRASH_TERRAIN_AROUND" ) ) {
+            idle_parts.push_back( p );
+        }
         if( vp.part().enabled && vpi.has_flag( "EXTRA_DRAG" ) ) {
             extra_drag += vpi.power;
         }
@@ -5784,6 +5829,157 @@ void vehicle::refresh()
     zones_dirty = true;
     invalidate_mass();
     occupied_cache_pos = { -1, -1, -1 };
+    traction_cache_turn = -1;
+}
+
+void vehicle::append_part_to_caches( const size_t p )
+{
+    if( no_refresh ) {
+        return;
+    }
+    // The mount extrema and the rail wheel bookkeeping are zeroed rather
+    // than left at their sentinel values when no part survived the last
+    // refresh, so the first part needs the full rebuild.
+    if( relative_parts.empty() ) {
+        refresh();
+        return;
+    }
+
+    vehicle_part &new_part = parts[p];
+    const vpart_info &vpi = new_part.info();
+    if( new_part.removed ) {
+        return;
+    }
+
+    const point pt = new_part.mount;
+    mount_min.x = std::min( mount_min.x, pt.x );
+    mount_min.y = std::min( mount_min.y, pt.y );
+    mount_max.x = std::max( mount_max.x, pt.x );
+    mount_max.y = std::max( mount_max.y, pt.y );
+    front_left.x = mount_max.x;
+    front_left.y = mount_min.y;
+    front_right = mount_max;
+
+    const auto list_order_cmp = [this]( const int p1, const int p2 ) {
+        return part_info( p1 ).list_order < part_info( p2 ).list_order;
+    };
+    std::vector<int> &parts_here = relative_parts[pt];
+    parts_here.insert( std::lower_bound( parts_here.begin(), parts_here.end(),
+                                         static_cast<int>( p ), list_order_cmp ),
+                       static_cast<int>( p ) );
+
+    if( vpi.has_flag( VPFLAG_FLOATS ) ) {
+        floating.push_back( p );
+    }
+
+    if( !new_part.is_unavailable() ) {
+        if( vpi.has_flag( VPFLAG_ALTERNATOR ) ) {
+            alternators.push_back( p );
+        }
+        if( vpi.has_flag( VPFLAG_ENGINE ) ) {
+            engines.push_back( p );
+        }
+        if( vpi.has_flag( VPFLAG_REACTOR ) ) {
+            reactors.push_back( p );
+        }
+        if( vpi.has_flag( VPFLAG_SOLAR_PANEL ) ) {
+            solar_panels.push_back( p );
+        }
+        if( vpi.has_flag( VPFLAG_ROTOR ) || vpi.has_flag( VPFLAG_ROTOR_SIMPLE ) ) {
+            rotors.push_back( p );
+        }
+        if( new_part.is_battery() ) {
+            batteries.push_back( p );
+        }
+        if( new_part.is_fuel_store( false ) ) {
+            fuel_containers.push_back( p );
+        }
+        if( new_part.is_turret() ) {
+            turret_locations.push_back( p );
+        }
+        if( vpi.has_flag( "WIND_TURBINE" ) ) {
+            wind_turbines.push_back( p );
+        }
+        if( vpi.has_flag( "WIND_POWERED" ) ) {
+            sails.push_back( p );
+        }
+        if( vpi.has_flag( "WATER_WHEEL" ) ) {
+            water_wheels.push_back( p );
+        }
+        if( vpi.has_flag( "FUNNEL" ) ) {
+            funnels.push_back( p );
+        }
+        if( vpi.has_flag( "UNMOUNT_ON_MOVE" ) ) {
+            loose_parts.push_back( p );
+            if( vpi.has_flag( "POWER_TRANSFER" ) ) {
+                power_cables.push_back( p );
+            }
+        }
+        if( !vpi.emissions.empty() || !vpi.exhaust.empty() ) {
+            emitters.push_back( p );
+        }
+        if( vpi.has_flag( VPFLAG_WHEEL ) ) {
+            wheelcache.push_back( p );
+        }
+        if( vpi.has_flag( "SMART_ENGINE_CONTROLLER" ) && new_part.enabled ) {
+            has_enabled_smart_controller = true;
+        }
+        if( vpi.has_flag( VPFLAG_WHEEL ) && vpi.has_flag( VPFLAG_RAIL ) ) {
+            if( !rail_wheelcache.empty() &&
+                parts[rail_wheelcache.front()].mount.y != pt.y ) {
+                all_wheels_on_one_axis = false;
+            }
+            rail_wheelcache.push_back( p );
+            rail_wheel_bounding_box.p1.x = std::min( rail_wheel_bounding_box.p1.x, pt.x );
+            rail_wheel_bounding_box.p1.y = std::min( rail_wheel_bounding_box.p1.y, pt.y );
+            rail_wheel_bounding_box.p2.x = std::max( rail_wheel_bounding_box.p2.x, pt.x );
+            rail_wheel_bounding_box.p2.y = std::max( rail_wheel_bounding_box.p2.y, pt.y );
+        }
+        if( ( vpi.has_flag( "STEERABLE" ) && part_with_feature( pt, "STEERABLE", true ) != -1 ) ||
+            vpi.has_flag( "TRACKED" ) ) {
+            steering.push_back( p );
+        }
+        if( vpi.has_flag( "SECURITY" ) ) {
+            speciality.push_back( p );
+        }
+        if( vpi.has_flag( "STEREO" ) || vpi.has_flag( "CHIMES" ) ||
+            vpi.has_flag( "CRASH_TERRAIN_AROUND" ) ) {
+            idle_parts.push_back( p );
+        }
+        if( new_part.enabled && vpi.has_flag( "EXTRA_DRAG" ) ) {
+            extra_drag += vpi.power;
+        }
+        if( vpi.has_flag( "EXTRA_DRAG" ) && ( vpi.has_flag( "WIND_TURBINE" ) ||
+                                              vpi.has_flag( "WATER_WHEEL" ) ) ) {
+            extra_drag += vpi.power;
+        }
+        if( vpi.has_flag( "CAMERA" ) ) {
+            new_part.enabled = camera_on;
+        }
+        if( vpi.has_flag( "TURRET" ) && !has_part( global_part_pos3( new_part ), "TURRET_CONTROLS" ) ) {
+            new_part.enabled = false;
+        }
+        if( vpi.has_flag( "MUFFLER" ) ) {
+            mufflers.push_back( p );
+        }
+        if( vpi.has_flag( "PLANTER" ) ) {
+            planters.push_back( p );
+        }
+        if( vpi.has_flag( VPFLAG_ENABLED_DRAINS_EPOWER ) ) {
+            accessories.push_back( p );
+        }
+    }
+
+    // Only the new part needs its mount precalculated; the pivot is the
+    // same one the last full refresh used.
+    tileray tdir( pivot_rotation[0] );
+    coord_translate( tdir, pivot_anchor[0], new_part.mount, new_part.precalc[0] );
+
+    check_environmental_effects = true;
+    insides_dirty = true;
+    zones_dirty = true;
+    invalidate_mass();
+    occupied_cache_pos = { -1, -1, -1 };
 }
 
 const point &vehicle::pivot_point() const
@@ -729,6 +729,16 @@ class vehicle
         //Refresh all caches and re-locate all parts
         void refresh();
 
+        /**
+         * Adds the freshly appended part to the cached part lists without
+         * rebuilding them. The lists hold part indices in ascending order
+         * and the new part has the highest index, so appending keeps them
+         * sorted; everything else mirrors one iteration of the main loop in
+         * refresh(). Installing one part on a large vehicle this way avoids
+         * re-sorting every cache.
+         */
+        void append_part_to_caches( size_t p );
+
         // Do stuff like clean up blood and produce smoke from broken parts. Returns false if nothing needs doing.
         bool do_environmental_effects();
 
@@ -1040,6 +1050,13 @@ class vehicle
          */
         bool has_part( const std::string &flag, bool enabled = false ) const;
 
+        /**
+         *  As has_part( flag, true ), but only scans the parts collected in
+         *  @ref idle_parts so the per-turn idle checks don't walk every part.
+         *  @param flag must be one of the flags idle_parts is built from
+         */
+        bool has_enabled_idle_part( const std::string &flag ) const;
+
         /**
          *  Check if vehicle has at least one unbroken part with specified flag
          *  @param pos limit check for parts to this global position
@@ -1424,6 +1441,15 @@ class vehicle
         float k_traction( float wheel_traction_area ) const;
         /*@}*/
 
+        /**
+         * Wheel traction area computed this turn at the current position and
+         * facing, or nullopt when it has to be re-sampled. Several callers
+         * per move step ask map::vehicle_wheel_traction the same question.
+         */
+        cata::optional<float> cached_wheel_traction() const;
+        /** See @ref cached_wheel_traction. */
+        void set_cached_wheel_traction( float traction_area ) const;
+
         // Extra drag on the vehicle from components other than wheels.
         // @param actual is current drag if true or nominal drag otherwise
         int static_drag( bool actual = true ) const;
@@ -1492,8 +1518,12 @@ class vehicle
 
         // Handle given part collision with vehicle, monster/NPC/player or terrain obstacle
         // Returns collision, which has type, impulse, part, & target.
+        // @param creature_possible may be false when a broadphase has already
+        // proven no creature is anywhere near the projected position, which
+        // skips the per-tile creature lookup.
         veh_collision part_collision( int part, const tripoint &p,
-                                      bool just_detect, bool bash_floor );
+                                      bool just_detect, bool bash_floor,
+                                      bool creature_possible = true );
 
         // Process the trap beneath
         void handle_trap( const tripoint &p, int part );
@@ -1838,6 +1868,14 @@ class vehicle
         // Cached points occupied by the vehicle
         mutable std::set<tripoint> occupied_points; // NOLINT(cata-serialize)
 
+        // Wheel traction area cache for map::vehicle_wheel_traction, keyed
+        // on position, facing and turn so terrain edits under a stationary
+        // vehicle are picked up on the following turn.
+        mutable tripoint traction_cache_pos = { -1, -1, -1 }; // NOLINT(cata-serialize)
+        mutable units::angle traction_cache_direction = 0_degrees; // NOLINT(cata-serialize)
+        mutable int traction_cache_turn = -1; // NOLINT(cata-serialize)
+        mutable float traction_cache_area = 0.0f; // NOLINT(cata-serialize)
+
         std::vector<vehicle_part> parts;   // Parts which occupy different tiles
         /**
         * checks carried_vehicles param for duplicate entries of bike racks/vehicle parts
@@ -1874,6 +1912,10 @@ class vehicle
         std::vector<int> funnels;          // List of funnel indices NOLINT(cata-serialize)
         std::vector<int> emitters;         // List of emitter parts NOLINT(cata-serialize)
         std::vector<int> loose_parts;      // List of UNMOUNT_ON_MOVE parts NOLINT(cata-serialize)
+        // Subset of loose_parts with POWER_TRANSFER, ie. the cables linking
+        // this vehicle into an electrical network. Kept separately so the
+        // per-turn power settlement doesn't re-filter loose_parts.
+        std::vector<int> power_cables;     // NOLINT(cata-serialize)
         std::vector<int> wheelcache;       // List of wheels NOLINT(cata-serialize)
         std::vector<int> rotors;           // List of rotors NOLINT(cata-serialize)
         std::vector<int> rail_wheelcache;  // List of rail wheels NOLINT(cata-serialize)
@@ -1886,6 +1928,8 @@ class vehicle
         std::vector<int> turret_locations; // List of turret parts NOLINT(cata-serialize)
         std::vector<int> mufflers; // List of muffler parts NOLINT(cata-serialize)
         std::vector<int> planters; // List of planter parts NOLINT(cata-serialize)
+        // STEREO, CHIMES and CRASH_TERRAIN_AROUND parts, polled by idle() every turn
+        std::vector<int> idle_parts; // NOLINT(cata-serialize)
         std::vector<int> accessories; // List of power consuming parts NOLINT(cata-serialize)
 
         // config values
@@ -1991,6 +2035,13 @@ class vehicle
         // NOLINTNEXTLINE(cata-serialize)
         std::array<units::angle, 2> pivot_rotation = { { 0_degrees, 0_degrees } };
 
+        // tileray construction runs trig, and coord_translate is called for
+        // every part at the same facing; keep the last ray built for a given
+        // angle and rebuild only when the facing actually changes.
+        mutable tileray coord_translate_ray; // NOLINT(cata-serialize)
+        mutable units::angle coord_translate_angle = 0_degrees; // NOLINT(cata-serialize)
+        mutable bool coord_translate_ray_cached = false; // NOLINT(cata-serialize)
+
         bounding_box rail_wheel_bounding_box; // NOLINT(cata-serialize)
         point front_left; // NOLINT(cata-serialize)
         point front_right; // NOLINT(cata-serialize)
@@ -680,6 +680,45 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     const int sign_before = sgn( velocity_before );
     bool empty = true;
     map &here = get_map();
+
+    // Broadphase: span the box every collision-relevant part projects
+    // into this step and ask the spatial creature index once whether
+    // anything lives in it. When nothing does - the common case on an
+    // open road - the per-part creature lookups are skipped entirely.
+    const tripoint projected_origin = global_pos3() + dp;
+    tripoint coll_min( INT_MAX, INT_MAX, INT_MAX );
+    tripoint coll_max( INT_MIN, INT_MIN, INT_MIN );
+    int rotor_reach = 0;
+    for( int p = 0; static_cast<size_t>( p ) < parts.size(); p++ ) {
+        const vpart_info &info = part_info( p );
+        if( ( info.location != part_location_structure && info.rotor_diameter() == 0 ) ||
+            parts[ p ].removed ) {
+            continue;
+        }
+        const tripoint dsp = projected_origin + parts[p].precalc[1];
+        coll_min.x = std::min( coll_min.x, dsp.x );
+        coll_min.y = std::min( coll_min.y, dsp.y );
+        coll_min.z = std::min( coll_min.z, dsp.z );
+        coll_max.x = std::max( coll_max.x, dsp.x );
+        coll_max.y = std::max( coll_max.y, dsp.y );
+        coll_max.z = std::max( coll_max.z, dsp.z );
+        rotor_reach = std::max( rotor_reach,
+                                static_cast<int>( std::round( info.rotor_diameter() / 2.0f ) ) );
+    }
+    bool creature_possible = true;
+    if( coll_min.x != INT_MAX ) {
+        const tripoint box_min = coll_min + tripoint( -rotor_reach, -rotor_reach, 0 );
+        const tripoint box_max = coll_max + tripoint( rotor_reach, rotor_reach, 0 );
+        const tripoint &avatar_pos = get_player_character().pos();
+        const bool avatar_in_box =
+            avatar_pos.x >= box_min.x && avatar_pos.x <= box_max.x &&
+            avatar_pos.y >= box_min.y && avatar_pos.y <= box_max.y &&
+            avatar_pos.z >= box_min.z && avatar_pos.z <= box_max.z;
+        creature_possible = avatar_in_box ||
+                            get_creature_tracker().any_in_aabb( here.getglobal( box_min ),
+                                    here.getglobal( box_max ) );
+    }
+
     for( int p = 0; static_cast<size_t>( p ) < parts.size(); p++ ) {
         const vpart_info &info = part_info( p );
         if( ( info.location != part_location_structure && info.rotor_diameter() == 0 ) ||
@@ -690,11 +729,12 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
         // Coordinates of where part will go due to movement (dx/dy/dz)
         //  and turning (precalc[1])
         const tripoint dsp = global_pos3() + dp + parts[p].precalc[1];
-        veh_collision coll = part_collision( p, dsp, just_detect, bash_floor );
+        veh_collision coll = part_collision( p, dsp, just_detect, bash_floor, creature_possible );
         if( coll.type == veh_coll_nothing && info.rotor_diameter() > 0 ) {
             size_t radius = static_cast<size_t>( std::round( info.rotor_diameter() / 2.0f ) );
             for( const tripoint &rotor_point : here.points_in_radius( dsp, radius ) ) {
-                veh_collision rotor_coll = part_collision( p, rotor_point, just_detect, false );
+                veh_collision rotor_coll = part_collision( p, rotor_point, just_detect, false,
+                                           creature_possible );
                 if( rotor_coll.type != veh_coll_nothing ) {
                     coll = rotor_coll;
                     if( just_detect ) {
@@ -767,14 +807,16 @@ static void terrain_collision_data( const tripoint &p, bool bash_floor,
 }
 
 veh_collision vehicle::part_collision( int part, const tripoint &p,
-                                       bool just_detect, bool bash_floor )
+                                       bool just_detect, bool bash_floor,
+                                       bool creature_possible )
 {
     // Vertical collisions need to be handled differently
     // All collisions have to be either fully vertical or fully horizontal for now
     const bool vert_coll = bash_floor || p.z != sm_pos.z;
     Character &player_character = get_player_character();
     const bool pl_ctrl = player_in_control( player_character );
-    Creature *critter = get_creature_tracker().creature_at( p, true );
+    Creature *critter = creature_possible ?
+                        get_creature_tracker().creature_at( p, true ) : nullptr;
     Character *ph = dynamic_cast<Character *>( critter );
 
     Creature *driver = pl_ctrl ? &player_character : nullptr;
@@ -2029,6 +2071,14 @@ float map::vehicle_wheel_traction( const vehicle &veh,
         return 0.0f;
     }
 
+    // Several callers per move step re-sample the terrain under every wheel;
+    // the answer only changes with position, facing or the passage of time.
+    if( !ignore_movement_modifiers ) {
+        if( const cata::optional<float> cached = veh.cached_wheel_traction() ) {
+            return *cached;
+        }
+    }
+
     float traction_wheel_area = 0.0f;
     for( int p : wheel_indices ) {
         const tripoint pp = veh.global_part_pos3( p );
@@ -2068,6 +2118,9 @@ float map::vehicle_wheel_traction( const vehicle &veh,
         traction_wheel_area += 2.0 * wheel_area / move_mod;
     }
 
+    if( !ignore_movement_modifiers ) {
+        veh.set_cached_wheel_traction( traction_wheel_area );
+    }
     return traction_wheel_area;
 }
 
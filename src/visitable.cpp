@@ -151,9 +151,17 @@ bool read_only_visitable::has_quality( const quality_id &qual, int level, int qt
 /** @relates visitable */
 bool inventory::has_quality( const quality_id &qual, int level, int qty ) const
 {
+    // Ensure the quality summary that is built along with the bin is current.
+    get_binned_items();
+    const auto iter = quality_cache.find( qual );
+    if( iter == quality_cache.end() ) {
+        return false;
+    }
     int res = 0;
-    for( const auto &stack : this->items ) {
-        res += stack.size() * has_quality_internal( stack.front(), qual, level, qty );
+    // levels are stored in ascending order, so everything from the first
+    // sufficient one on counts
+    for( auto it = iter->second.lower_bound( level ); it != iter->second.end(); ++it ) {
+        res = sum_no_wrap( res, it->second );
         if( res >= qty ) {
             return true;
         }
@@ -217,7 +225,9 @@ bool read_only_visitable::has_components( const itype_id &it, int quantity,
 bool read_only_visitable::has_charges( const itype_id &it, int quantity,
                                        const std::function<bool( const item & )> &filter ) const
 {
-    return ( charges_of( it, INT_MAX, filter ) >= quantity );
+    // Passing quantity as the limit aborts the traversal as soon as
+    // enough charges have been found.
+    return ( charges_of( it, quantity, filter ) >= quantity );
 }
 
 template <typename T>
@@ -383,6 +393,8 @@ VisitResponse item_contents::visit_contents( const std::function<VisitResponse(
 VisitResponse item_pocket::visit_contents( const std::function<VisitResponse( item *, item * )>
         &func, item *parent )
 {
+    // The visitor gets mutable access to every contained item.
+    invalidate_cached_aggregates();
     for( item &e : contents ) {
         switch( visit_internal( func, &e, parent ) ) {
             case VisitResponse::ABORT:
@@ -596,6 +608,8 @@ std::list<item> Character::remove_items_with( const
         return res;
     }
 
+    invalidate_crafting_inventory();
+
     // first try and remove items from the inventory
     res = inv->remove_items_with( filter, count );
     count -= res.size();
@@ -984,3 +998,42 @@ bool read_only_visitable::has_amount( const itype_id &what, int qty, bool pseudo
 {
     return amount_of( what, pseudo, qty, filter ) == qty;
 }
+
+/** @relates visitable */
+void read_only_visitable::count_all_of( std::vector<item_count_query> &queries ) const
+{
+    bool outstanding = false;
+    for( const item_count_query &q : queries ) {
+        outstanding = outstanding || !q.satisfied();
+    }
+    if( !outstanding ) {
+        return;
+    }
+
+    visit_items( [&queries]( const item * e, item * ) {
+        bool all_satisfied = true;
+        for( item_count_query &q : queries ) {
+            if( q.satisfied() ) {
+                continue;
+            }
+            if( q.kind == item_count_query::count_kind::amount ) {
+                if( !e->has_flag( STATIC( flag_id( "ITEM_BROKEN" ) ) ) && e->typeId() == q.what &&
+                    q.filter( *e ) && ( q.pseudo || !e->has_flag( STATIC( flag_id( "PSEUDO" ) ) ) ) ) {
+                    q.qty = sum_no_wrap( q.qty, 1 );
+                }
+            } else if( e->typeId() == q.what && !e->is_broken() && q.filter( *e ) ) {
+                if( e->count_by_charges() ) {
+                    q.qty = sum_no_wrap( q.qty, e->charges );
+                } else {
+                    q.qty = sum_no_wrap( q.qty, e->ammo_remaining() );
+                }
+            }
+            all_satisfied = all_satisfied && q.satisfied();
+        }
+        return all_satisfied ? VisitResponse::ABORT : VisitResponse::NEXT;
+    } );
+
+    for( item_count_query &q : queries ) {
+        q.qty = std::min( q.qty, q.limit );
+    }
+}
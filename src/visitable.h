@@ -19,6 +19,36 @@ enum class VisitResponse : int {
     SKIP   // Skip any child nodes and move directly to the next sibling
 };
 
+/**
+ * One aggregate wanted from a batched traversal (@see
+ * read_only_visitable::count_all_of). Results accumulate into @ref qty.
+ */
+struct item_count_query {
+    enum class count_kind : int {
+        amount,  // count matching items, as per amount_of
+        charges, // count charges of matching items, as per charges_of
+    };
+
+    item_count_query( const itype_id &what, count_kind kind, int limit = INT_MAX,
+                      const std::function<bool( const item & )> &filter = return_true<item> )
+        : what( what ), kind( kind ), limit( limit ), filter( filter ) {}
+
+    itype_id what;
+    count_kind kind;
+    /** This query stops accumulating once @ref qty reaches this many */
+    int limit;
+    /** Only items matching the filter are counted */
+    std::function<bool( const item & )> filter;
+    /** Whether pseudo-items are counted; only meaningful for amount queries */
+    bool pseudo = true;
+    /** Accumulated result, clamped to limit once the traversal finishes */
+    int qty = 0;
+
+    bool satisfied() const {
+        return qty >= limit;
+    }
+};
+
 /**
  * Read-only interface for the "container of items".
  * Provides API for the traversal and querying of the items hierarchy.
@@ -94,6 +124,17 @@ class read_only_visitable
         bool has_amount( const itype_id &what, int qty, bool pseudo = true,
                          const std::function<bool( const item & )> &filter = return_true<item> ) const;
 
+        /**
+         * Answer several amount/charge queries with a single traversal.
+         * Each query accumulates independently up to its own limit and the
+         * traversal aborts as soon as every query is satisfied. Unlike
+         * @ref charges_of this does not draw on UPS or bionic power
+         * reserves, and unlike @ref amount_of it does not handle the "any"
+         * or "apparatus" pseudo ids; queries needing those must go through
+         * the single-query functions.
+         */
+        void count_all_of( std::vector<item_count_query> &queries ) const;
+
         /** Returns all items (including those within a container) matching the filter */
         std::vector<item *> items_with( const std::function<bool( const item & )> &filter );
         std::vector<const item *> items_with( const std::function<bool( const item & )> &filter ) const;
@@ -4,9 +4,11 @@
 #include <array>
 #include <cmath>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "activity_type.h"
@@ -166,7 +168,7 @@ static inline void proc_weather_sum( const weather_type_id &wtype, weather_sum &
 weather_type_id current_weather( const tripoint &location, const time_point &t )
 {
     weather_manager &weather = get_weather();
-    const weather_generator wgen = weather.get_cur_weather_gen();
+    const weather_generator &wgen = weather.get_cur_weather_gen();
     if( weather.weather_override != WEATHER_NULL ) {
         return weather.weather_override;
     }
@@ -181,6 +183,15 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
     weather_sum data;
 
     weather_manager &weather = get_weather();
+    const weather_generator &wgen = weather.get_cur_weather_gen();
+    // The location does not change, so neither does its overmap terrain.
+    // TODO: fix point types
+    const oter_id om_ter = overmap_buffer.ter( tripoint_abs_omt( ms_to_omt_copy( location ) ) );
+    // Re-deriving the weather type per one-minute tick is pure overhead:
+    // sample it on the same ten minute grid the forecast table uses and
+    // hold it between samples.
+    weather_type_id wtype = WEATHER_NULL;
+    time_point next_sample = start;
     for( time_point t = start; t < end; t += tick_size ) {
         const time_duration diff = end - t;
         if( diff < 10_turns ) {
@@ -191,12 +202,17 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
             tick_size = 1_minutes;
         }
 
-        weather_type_id wtype = current_weather( location, t );
+        if( wtype == WEATHER_NULL || t >= next_sample ) {
+            if( weather.weather_override != WEATHER_NULL ) {
+                wtype = weather.weather_override;
+            } else {
+                wtype = wgen.get_weather_conditions( wgen.get_weather_sampled( location, t,
+                                                     g->get_seed() ) );
+            }
+            next_sample = t + 10_minutes;
+        }
         proc_weather_sum( wtype, data, t, tick_size );
-        data.wind_amount += get_local_windpower( weather.windspeed,
-                            // TODO: fix point types
-                            overmap_buffer.ter( tripoint_abs_omt( ms_to_omt_copy( location ) ) ),
-                            location,
+        data.wind_amount += get_local_windpower( weather.windspeed, om_ter, location,
                             weather.winddirection, false ) * to_turns<int>( tick_size );
     }
     return data;
@@ -214,7 +230,21 @@ void retroactively_fill_from_funnel( item &it, const trap &tr, const time_point
 
     // bday == last fill check
     it.set_birthday( end );
-    weather_sum data = sum_conditions( start, end, pos );
+
+    // A base full of rain barrels catches up after every long activity, and
+    // each barrel would sweep the same span of weather. Funnels in the same
+    // overmap tile over the same span share one summed result; the catch-up
+    // happens in one burst, so the memo can stay small.
+    static std::map<std::tuple<time_point, time_point, tripoint>, weather_sum> funnel_sums;
+    const auto key = std::make_tuple( start, end, ms_to_omt_copy( pos ) );
+    auto iter = funnel_sums.find( key );
+    if( iter == funnel_sums.end() ) {
+        if( funnel_sums.size() > 64 ) {
+            funnel_sums.clear();
+        }
+        iter = funnel_sums.emplace( key, sum_conditions( start, end, pos ) ).first;
+    }
+    const weather_sum &data = iter->second;
 
     // Technically 0.0 division is OK, but it will be cleaner without it
     if( data.rain_amount > 0 ) {
@@ -415,16 +445,7 @@ void wet_character( Character &target, int amount )
     if( !calendar::once_every( 6_seconds ) ) {
         return;
     }
-    std::map<bodypart_id, std::vector<const item *>> clothing_map;
-    for( const bodypart_id &bp : target.get_all_body_parts() ) {
-        clothing_map.emplace( bp, std::vector<const item *>() );
-    }
-    for( const item &it : target.worn ) {
-        for( const bodypart_str_id &covered : it.get_covered_body_parts() ) {
-            clothing_map[covered.id()].emplace_back( &it );
-        }
-    }
-    std::map<bodypart_id, int> warmth_bp = target.warmth( clothing_map );
+    std::map<bodypart_id, int> warmth_bp = target.warmth();
     const int warmth_delay = warmth_bp[body_part_torso] * 0.8 +
                              warmth_bp[body_part_head] * 0.2;
     if( rng( 0, 100 - amount + warmth_delay ) > 10 ) {
@@ -598,9 +619,9 @@ std::string weather_forecast( const point_abs_sm &abs_sm_pos )
                                  1_hours;
     for( int d = 0; d < 6; d++ ) {
         weather_type_id forecast = WEATHER_NULL;
-        const weather_generator wgen = get_weather().get_cur_weather_gen();
+        const weather_generator &wgen = get_weather().get_cur_weather_gen();
         for( time_point i = last_hour + d * 12_hours; i < last_hour + ( d + 1 ) * 12_hours; i += 1_hours ) {
-            w_point w = wgen.get_weather( abs_ms_pos, i, g->get_seed() );
+            w_point w = wgen.get_weather_sampled( abs_ms_pos, i, g->get_seed() );
             *weather.weather_precise = w;
             forecast = std::max( forecast, wgen.get_weather_conditions( w ) );
             high = std::max( high, w.temperature );
@@ -1008,9 +1029,26 @@ int weather_manager::get_temperature( const tripoint_abs_omt &location )
     return location.z() < 0 ? AVERAGE_ANNUAL_TEMPERATURE : temperature;
 }
 
+double weather_manager::get_windpower( const tripoint &location )
+{
+    const auto &cached = windpower_cache.find( location );
+    if( cached != windpower_cache.end() ) {
+        return cached->second;
+    }
+
+    // TODO: fix point types
+    const tripoint_abs_omt omt( ms_to_omt_copy( get_map().getabs( location ) ) );
+    const oter_id &cur_om_ter = overmap_buffer.ter( omt );
+    const double wind = get_local_windpower( windspeed, cur_om_ter, location, winddirection,
+                        g->is_sheltered( location ) );
+    windpower_cache.emplace( location, wind );
+    return wind;
+}
+
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    windpower_cache.clear();
 }
 
 const weather_manager &get_weather_const()
@@ -181,8 +181,13 @@ class weather_manager
         time_point nextweather;
         /** temperature cache, cleared every turn, sparse map of map tripoints to temperatures */
         std::unordered_map< tripoint, int > temperature_cache;
+        /** local windpower cache (no vehicle contribution), cleared with the temperature cache */
+        std::unordered_map< tripoint, double > windpower_cache;
         // Returns outdoor or indoor temperature of given location (in absolute (@ref map::getabs))
         int get_temperature( const tripoint &location );
+        // Returns the local windpower at the given map square, accounting for
+        // overmap terrain, elevation, wind blockers and shelter.
+        double get_windpower( const tripoint &location );
         // Returns outdoor or indoor temperature of given location
         int get_temperature( const tripoint_abs_omt &location );
         void clear_temp_cache();
@@ -170,6 +170,31 @@ w_point weather_generator::get_weather( const tripoint &location, const time_poi
     return w_point{ T, H, P, W, wind_desc, current_winddir, t };
 }
 
+w_point weather_generator::get_weather_sampled( const tripoint &location, const time_point &t,
+        unsigned seed ) const
+{
+    // Coarse enough to amortize the noise stack over many queries, fine
+    // enough that nothing changes between samples faster than the weather
+    // itself does.
+    static const time_duration sample_step = 10_minutes;
+    if( forecast_location != location || forecast_seed != seed ) {
+        forecast_samples.clear();
+        forecast_location = location;
+        forecast_seed = seed;
+    }
+    if( forecast_samples.size() > 8192 ) {
+        forecast_samples.clear();
+    }
+    const time_point sample_time = t - ( t - calendar::turn_zero ) % sample_step;
+    auto iter = forecast_samples.find( sample_time );
+    if( iter == forecast_samples.end() ) {
+        iter = forecast_samples.emplace( sample_time, get_weather( location, sample_time, seed ) ).first;
+    }
+    w_point result = iter->second;
+    result.time = t;
+    return result;
+}
+
 weather_type_id weather_generator::get_weather_conditions( const tripoint &location,
         const time_point &t, unsigned seed ) const
 {
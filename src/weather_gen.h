@@ -7,10 +7,10 @@
 #include <vector>
 
 #include "calendar.h"
+#include "point.h"
 #include "type_id.h"
 
 class JsonObject;
-struct tripoint;
 
 struct w_point {
     double temperature = 0;
@@ -55,6 +55,14 @@ class weather_generator
          * relative position (relative to the map you called getabs on).
          */
         w_point get_weather( const tripoint &, const time_point &, unsigned ) const;
+        /**
+         * As @ref get_weather, but served from a rolling table of samples
+         * on a fixed time grid for one location, rebuilt when the location
+         * or seed changes. Callers that sweep many nearby time points
+         * (forecast radio, funnel catch-up) evaluate the layered noise once
+         * per grid step instead of once per query.
+         */
+        w_point get_weather_sampled( const tripoint &, const time_point &, unsigned ) const;
         weather_type_id get_weather_conditions( const tripoint &, const time_point &, unsigned seed ) const;
         weather_type_id get_weather_conditions( const w_point & ) const;
         int get_wind_direction( season_type ) const;
@@ -65,6 +73,13 @@ class weather_generator
         double get_weather_temperature( const tripoint &, const time_point &, unsigned ) const;
 
         static weather_generator load( const JsonObject &jo );
+
+    private:
+        /** See @ref get_weather_sampled. Pruned when it grows past a cap so
+         * months-long sweeps cannot hoard memory. */
+        mutable std::map<time_point, w_point> forecast_samples;
+        mutable tripoint forecast_location = tripoint_min;
+        mutable unsigned forecast_seed = 0;
 };
 
 #endif // CATA_SRC_WEATHER_GEN_H
@@ -147,7 +147,9 @@ WORLDPTR worldfactory::make_new_world( bool show_prompt, const std::string &worl
     std::unique_ptr<WORLD> retworld = std::make_unique<WORLD>();
 
     if( !world_to_copy.empty() ) {
-        retworld->COPY_WORLD( world_generator->get_world( world_to_copy ) );
+        WORLDPTR copied = world_generator->get_world( world_to_copy );
+        copied->ensure_details_loaded();
+        retworld->COPY_WORLD( copied );
     }
 
     if( show_prompt ) {
@@ -222,6 +224,7 @@ void worldfactory::set_active_world( WORLDPTR world )
 {
     world_generator->active_world = world;
     if( world ) {
+        world->ensure_details_loaded();
         get_options().set_world_options( &world->WORLD_OPTIONS );
     } else {
         get_options().set_world_options( nullptr );
@@ -304,14 +307,11 @@ void worldfactory::init()
         for( auto &world_sav_file : world_sav_files ) {
             all_worlds[worldname]->world_saves.push_back( save_t::from_base_path( world_sav_file ) );
         }
-        mman->load_mods_list( all_worlds[worldname].get() );
-
-        // load options into the world
-        if( !all_worlds[worldname]->load_options() ) {
-            all_worlds[worldname]->WORLD_OPTIONS = get_options().get_world_defaults();
-            all_worlds[worldname]->WORLD_OPTIONS["WORLD_END"].setValue( "delete" );
-            all_worlds[worldname]->save();
-        }
+        // Defer parsing the options and mod list until the world is
+        // actually inspected or activated - with many worlds on disk,
+        // opening every worldoptions.json and mods.json here is what
+        // makes the main menu slow to appear.
+        all_worlds[worldname]->details_loaded = false;
     };
 
     // This returns files as well, but they are going to be discarded later as
@@ -329,6 +329,7 @@ void worldfactory::init()
     if( is_save_dir( "save" ) ) {
         // @TODO import directly into the new world instead of having this dummy "save" world.
         add_existing_world( "save" );
+        all_worlds["save"]->ensure_details_loaded();
 
         const WORLD &old_world = *all_worlds["save"];
 
@@ -1564,6 +1565,22 @@ bool WORLD::load_options()
     } );
 }
 
+void WORLD::ensure_details_loaded()
+{
+    if( details_loaded ) {
+        return;
+    }
+    // Mark first: the missing-options fallback below calls save(),
+    // which must not recurse back into here.
+    details_loaded = true;
+    world_generator->get_mod_manager().load_mods_list( this );
+    if( !load_options() ) {
+        WORLD_OPTIONS = get_options().get_world_defaults();
+        WORLD_OPTIONS["WORLD_END"].setValue( "delete" );
+        save();
+    }
+}
+
 void load_world_option( const JsonObject &jo )
 {
     JsonArray arr = jo.get_array( "options" );
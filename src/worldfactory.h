@@ -77,6 +77,15 @@ struct WORLD {
 
         void load_options( JsonIn &jsin );
         bool load_options();
+        /**
+         * Parse this world's options and mod list from disk if @ref
+         * worldfactory::init deferred them. Worlds created during this
+         * session are born loaded. Must be called before
+         * @ref WORLD_OPTIONS or @ref active_mod_order is read.
+         */
+        void ensure_details_loaded();
+        /** Whether WORLD_OPTIONS and active_mod_order reflect the files on disk. */
+        bool details_loaded = true;
 };
 
 class mod_manager;
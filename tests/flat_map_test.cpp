@@ -0,0 +1,114 @@
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "assertion_helpers.h"
+#include "cata_catch.h"
+#include "flat_map.h"
+
+TEST_CASE( "flat_map", "[flat_map]" )
+{
+    cata::flat_map<int, std::string> m;
+    m.insert( { 2, "two" } );
+    m.insert( { 1, "one" } );
+    m.insert( { 4, "four" } );
+    m.insert( { 3, "three" } );
+    std::vector<std::pair<int, std::string>> ref{
+        { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }
+    };
+    check_containers_equal( m, ref );
+    CHECK( m.count( 0 ) == 0 );
+    CHECK( m.count( 1 ) == 1 );
+    CHECK( m.count( 2 ) == 1 );
+    CHECK( m.count( 3 ) == 1 );
+    CHECK( m.count( 4 ) == 1 );
+    CHECK( m.count( 5 ) == 0 );
+
+    CHECK( m.find( 0 ) == m.end() );
+    CHECK( m.find( 1 ) == m.begin() );
+    CHECK( m.find( 2 ) == m.begin() + 1 );
+    CHECK( m.find( 5 ) == m.end() );
+
+    CHECK( m.lower_bound( 0 ) == m.begin() );
+    CHECK( m.lower_bound( 2 ) == m.begin() + 1 );
+    CHECK( m.lower_bound( 5 ) == m.end() );
+}
+
+TEST_CASE( "flat_map_duplicate_insert", "[flat_map]" )
+{
+    cata::flat_map<int, std::string> m;
+    const auto first = m.insert( { 1, "one" } );
+    CHECK( first.second );
+    // Inserting an existing key must not overwrite the mapped value.
+    const auto again = m.insert( { 1, "uno" } );
+    CHECK( !again.second );
+    CHECK( again.first == first.first );
+    CHECK( m.size() == 1 );
+    CHECK( m.find( 1 )->second == "one" );
+}
+
+TEST_CASE( "flat_map_subscript", "[flat_map]" )
+{
+    cata::flat_map<int, std::string> m;
+    // operator[] default-constructs missing entries, like std::map.
+    CHECK( m[1].empty() );
+    CHECK( m.size() == 1 );
+    m[1] = "one";
+    CHECK( m.size() == 1 );
+    CHECK( m[1] == "one" );
+    m[0] = "zero";
+    std::vector<std::pair<int, std::string>> ref{ { 0, "zero" }, { 1, "one" } };
+    check_containers_equal( m, ref );
+}
+
+TEST_CASE( "flat_map_erase", "[flat_map]" )
+{
+    cata::flat_map<int, std::string> m;
+    m.insert( { 1, "one" } );
+    m.insert( { 2, "two" } );
+    m.insert( { 3, "three" } );
+    CHECK( m.erase( 0 ) == 0 );
+    CHECK( m.erase( 2 ) == 1 );
+    CHECK( m.size() == 2 );
+    CHECK( m.find( 2 ) == m.end() );
+    // Erasing via iterator returns the entry following the removed one.
+    const auto next = m.erase( m.find( 1 ) );
+    CHECK( next == m.begin() );
+    CHECK( next->first == 3 );
+    m.clear();
+    CHECK( m.empty() );
+}
+
+TEST_CASE( "flat_map_insert_positions", "[flat_map]" )
+{
+    // Unlike std::map, inserting invalidates iterators at or after the
+    // insertion point: the elements there shift one slot to the right.
+    // Verify the shifted positions so the caveat documented in flat_map.h
+    // stays true to the implementation.
+    cata::flat_map<int, std::string> m;
+    m.insert( { 1, "one" } );
+    m.insert( { 3, "three" } );
+    const auto inserted = m.insert( { 2, "two" } );
+    CHECK( inserted.second );
+    CHECK( inserted.first == m.begin() + 1 );
+    CHECK( m.find( 3 ) == m.begin() + 2 );
+    CHECK( m.find( 1 ) == m.begin() );
+}
+
+TEST_CASE( "reversed_flat_map_insertion", "[flat_map]" )
+{
+    cata::flat_map<int, std::string, std::greater<>> m;
+    m.insert( { 2, "two" } );
+    m.insert( { 1, "one" } );
+    m.insert( { 4, "four" } );
+    m.insert( { 3, "three" } );
+    std::vector<std::pair<int, std::string>> ref{
+        { 4, "four" }, { 3, "three" }, { 2, "two" }, { 1, "one" }
+    };
+    check_containers_equal( m, ref );
+    CHECK( m.count( 0 ) == 0 );
+    CHECK( m.count( 1 ) == 1 );
+    CHECK( m.count( 4 ) == 1 );
+    CHECK( m.count( 5 ) == 0 );
+}
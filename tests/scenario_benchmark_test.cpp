@@ -0,0 +1,94 @@
+#include <cstdlib>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
+#include "monster.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "recipe_dictionary.h"
+#include "type_id.h"
+
+// Load-realistic scenario benchmarks, for tracking regressions between
+// releases. Like the other BENCHMARK cases they hide behind the [.] tag;
+// run them explicitly and with a fixed seed so the numbers are
+// comparable:
+//   tests/cata_test "[benchmark][scenario]" --rng-seed 42
+// Add -r xml for machine-readable output.
+
+TEST_CASE( "horde_turn_benchmark", "[.][benchmark][scenario]" )
+{
+    clear_map();
+    const tripoint center = get_avatar().pos();
+    int spawned = 0;
+    for( int x = -25; x <= 25 && spawned < 500; ++x ) {
+        for( int y = -25; y <= 25 && spawned < 500; ++y ) {
+            // Leave some space around the avatar.
+            if( std::abs( x ) <= 2 && std::abs( y ) <= 2 ) {
+                continue;
+            }
+            spawn_test_monster( "mon_zombie", center + point( x, y ) );
+            ++spawned;
+        }
+    }
+    REQUIRE( spawned == 500 );
+
+    BENCHMARK( "500 monster planning and movement pass" ) {
+        int processed = 0;
+        for( monster &critter : g->all_monsters() ) {
+            if( critter.is_dead() ) {
+                continue;
+            }
+            critter.anger = 100;
+            critter.set_moves( critter.get_speed() );
+            critter.plan();
+            while( critter.moves > 0 && !critter.is_dead() ) {
+                const int before = critter.moves;
+                critter.move();
+                if( critter.moves == before ) {
+                    // Not spending moves; bail rather than spin.
+                    break;
+                }
+            }
+            ++processed;
+        }
+        return processed;
+    };
+}
+
+TEST_CASE( "autosave_benchmark", "[.][benchmark][scenario]" )
+{
+    clear_map();
+
+    BENCHMARK( "save loaded submaps" ) {
+        MAPBUFFER.save( false );
+    };
+}
+
+TEST_CASE( "mapgen_sweep_benchmark", "[.][benchmark][scenario]" )
+{
+    // Start away from anything the test world has generated and step the
+    // cursor every iteration, so each sample generates a fresh OMT.
+    tripoint_abs_omt cursor( 120, 120, 0 );
+
+    BENCHMARK( "generate one fresh OMT" ) {
+        tinymap tm;
+        tm.load( project_to<coords::sm>( cursor ), false );
+        cursor += point_east;
+        return cursor.x();
+    };
+}
+
+TEST_CASE( "craft_menu_open_benchmark", "[.][benchmark][scenario]" )
+{
+    clear_avatar();
+    avatar &you = get_avatar();
+
+    BENCHMARK( "collect available recipes" ) {
+        return you.get_available_recipes( you.crafting_inventory() ).size();
+    };
+}